@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef SCENE_BOARD_ENABLED
+#include "window_scene_config.h"
+#else
+#include "display_manager_config.h"
+#include "window_manager_config.h"
+#endif
+
+using namespace OHOS::Rosen;
+
+namespace {
+struct ConfigChecker {
+    std::string name;
+    std::function<bool()> check;
+};
+} // namespace
+
+int main()
+{
+    std::vector<ConfigChecker> checkers = {
+#ifdef SCENE_BOARD_ENABLED
+        { "WindowSceneConfig", WindowSceneConfig::CheckConfigSnapshot },
+#else
+        { "WindowManagerConfig", WindowManagerConfig::CheckConfigSnapshot },
+        { "DisplayManagerConfig", DisplayManagerConfig::CheckConfigSnapshot },
+#endif
+    };
+    int failedCount = 0;
+    for (const auto& checker : checkers) {
+        bool isMatched = checker.check();
+        std::cout << checker.name << ": " << (isMatched ? "snapshot matches xml" : "snapshot is missing, stale "
+            "or does not match xml") << std::endl;
+        failedCount += isMatched ? 0 : 1;
+    }
+    return failedCount;
+}
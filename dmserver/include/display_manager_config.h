@@ -28,6 +28,11 @@ public:
     ~DisplayManagerConfig() = default;
 
     static bool LoadConfigXml();
+
+    /**
+     * @brief Check whether the config snapshot matches a fresh parse of the xml.
+     */
+    static bool CheckConfigSnapshot();
     static const std::map<std::string, bool>& GetEnableConfig();
     static const std::map<std::string, std::vector<int>>& GetIntNumbersConfig();
     static const std::map<std::string, std::string>& GetStringConfig();
@@ -38,6 +43,9 @@ private:
     static std::map<std::string, std::vector<int>> intNumbersConfig_;
     static std::map<std::string, std::string> stringConfig_;
 
+    static bool ParseConfigXml(const std::string& configFilePath, ConfigItem& config);
+    static void ToConfigItem(ConfigItem& config);
+    static void ApplyConfig(const ConfigItem& config);
     static bool IsValidNode(const xmlNode& currNode);
     static void ReadEnableConfigInfo(const xmlNodePtr& currNode);
     static void ReadIntNumbersConfigInfo(const xmlNodePtr& currNode);
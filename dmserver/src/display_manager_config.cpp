@@ -27,9 +27,18 @@
 
 #include "config_policy_utils.h"
 #include "window_manager_hilog.h"
-
+#include "xml_config_snapshot.h"
 
 namespace OHOS::Rosen {
+namespace {
+const std::string CONFIG_FILE_NAME = "etc/window/resources/display_manager_config.xml";
+const std::string SNAPSHOT_NAME = "display_manager_config";
+// bump when ParseConfigXml builds a different ConfigItem tree
+constexpr uint32_t SNAPSHOT_PARSER_VERSION = 1;
+const std::string ENABLE_CONFIG_KEY = "enable";
+const std::string INT_NUMBERS_CONFIG_KEY = "intNumbers";
+const std::string STRING_CONFIG_KEY = "string";
+} // namespace
 
 std::map<std::string, bool> DisplayManagerConfig::enableConfig_;
 std::map<std::string, std::vector<int>> DisplayManagerConfig::intNumbersConfig_;
@@ -75,13 +84,30 @@ std::string DisplayManagerConfig::GetConfigPath(const std::string& configFileNam
 
 bool DisplayManagerConfig::LoadConfigXml()
 {
-    auto configFilePath = GetConfigPath("etc/window/resources/display_manager_config.xml");
+    auto configFilePath = GetConfigPath(CONFIG_FILE_NAME);
+    TLOGI(WmsLogTag::DMS, "[DmConfig] filePath: %{public}s", configFilePath.c_str());
+    ConfigItem config;
+    if (!XmlConfigSnapshot::LoadOrParse(configFilePath, SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml, config)) {
+        return false;
+    }
+    ApplyConfig(config);
+    return true;
+}
+
+bool DisplayManagerConfig::CheckConfigSnapshot()
+{
+    return XmlConfigSnapshot::Check(GetConfigPath(CONFIG_FILE_NAME), SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml);
+}
+
+bool DisplayManagerConfig::ParseConfigXml(const std::string& configFilePath, ConfigItem& config)
+{
     xmlDocPtr docPtr = nullptr;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         docPtr = xmlReadFile(configFilePath.c_str(), nullptr, XML_PARSE_NOBLANKS);
     }
-    TLOGI(WmsLogTag::DMS, "[DmConfig] filePath: %{public}s", configFilePath.c_str());
     if (docPtr == nullptr) {
         TLOGE(WmsLogTag::DMS, "[DmConfig] load xml error!");
         return false;
@@ -122,9 +148,57 @@ bool DisplayManagerConfig::LoadConfigXml()
         }
     }
     xmlFreeDoc(docPtr);
+    ToConfigItem(config);
     return true;
 }
 
+void DisplayManagerConfig::ToConfigItem(ConfigItem& config)
+{
+    // the parsed maps are packed into one tree so that they can be cached by XmlConfigSnapshot
+    std::map<std::string, ConfigItem> enableMap;
+    for (const auto& [name, enable] : enableConfig_) {
+        enableMap[name].SetValue(enable);
+    }
+    std::map<std::string, ConfigItem> intNumbersMap;
+    for (const auto& [name, numbers] : intNumbersConfig_) {
+        intNumbersMap[name].SetValue(numbers);
+    }
+    std::map<std::string, ConfigItem> stringMap;
+    for (const auto& [name, value] : stringConfig_) {
+        stringMap[name].SetValue(value);
+    }
+    config.SetValue(std::map<std::string, ConfigItem>());
+    (*config.mapValue_)[ENABLE_CONFIG_KEY].SetValue(enableMap);
+    (*config.mapValue_)[INT_NUMBERS_CONFIG_KEY].SetValue(intNumbersMap);
+    (*config.mapValue_)[STRING_CONFIG_KEY].SetValue(stringMap);
+}
+
+void DisplayManagerConfig::ApplyConfig(const ConfigItem& config)
+{
+    const auto& enableItem = config[ENABLE_CONFIG_KEY];
+    if (enableItem.IsMap()) {
+        for (const auto& [name, item] : *enableItem.mapValue_) {
+            enableConfig_[name] = item.IsBool() && item.boolValue_;
+        }
+    }
+    const auto& intNumbersItem = config[INT_NUMBERS_CONFIG_KEY];
+    if (intNumbersItem.IsMap()) {
+        for (const auto& [name, item] : *intNumbersItem.mapValue_) {
+            if (item.IsInts()) {
+                intNumbersConfig_[name] = *item.intsValue_;
+            }
+        }
+    }
+    const auto& stringItem = config[STRING_CONFIG_KEY];
+    if (stringItem.IsMap()) {
+        for (const auto& [name, item] : *stringItem.mapValue_) {
+            if (item.IsString()) {
+                stringConfig_[name] = item.stringValue_;
+            }
+        }
+    }
+}
+
 bool DisplayManagerConfig::IsValidNode(const xmlNode& currNode)
 {
     if (currNode.name == nullptr || currNode.type == XML_COMMENT_NODE) {
@@ -808,6 +808,16 @@ public:
      */
     WMError RegisterVisibilityChangedListener(const sptr<IVisibilityChangedListener>& listener);
 
+    /**
+     * @brief Register visibility changed listener which is only notified of the windows matching the filter.
+     *
+     * @param listener IVisibilityChangedListener.
+     * @param filter Windows the listener cares about, an empty filter means all windows.
+     * @return WM_OK means register success, others means register failed.
+     */
+    WMError RegisterVisibilityChangedListener(const sptr<IVisibilityChangedListener>& listener,
+        const WindowManagerAgentFilter& filter);
+
     /**
      * @brief Unregister visibility changed listener.
      *
@@ -824,6 +834,16 @@ public:
      */
     WMError RegisterDrawingContentChangedListener(const sptr<IDrawingContentChangedListener>& listener);
 
+    /**
+     * @brief Register drawingcontent changed listener which is only notified of the windows matching the filter.
+     *
+     * @param listener IDrawingContentChangedListener.
+     * @param filter Windows the listener cares about, only pids and windowIds apply to drawing content.
+     * @return WM_OK means register success, others means register failed.
+     */
+    WMError RegisterDrawingContentChangedListener(const sptr<IDrawingContentChangedListener>& listener,
+        const WindowManagerAgentFilter& filter);
+
     /**
      * @brief Unregister drawingcontent changed listener.
      *
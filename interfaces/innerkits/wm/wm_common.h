@@ -3027,6 +3027,133 @@ struct WindowInfoOption : public Parcelable {
     }
 };
 
+/**
+ * @struct WindowManagerAgentFilter
+ *
+ * @brief Entries a window manager agent wants, an empty set does not restrict its field.
+ *
+ * An entry is sent to the agent only if it matches every non-empty set. Drawing content entries carry no bundle
+ * name or display id, so only the pid and window id sets apply to them.
+ */
+struct WindowManagerAgentFilter : public Parcelable {
+    std::unordered_set<int32_t> pids;
+    std::unordered_set<std::string> bundleNames;
+    std::unordered_set<uint32_t> windowIds;
+    std::unordered_set<DisplayId> displayIds;
+
+    static constexpr uint32_t MAX_FILTER_SIZE = 1000;
+
+    bool IsEmpty() const
+    {
+        return pids.empty() && bundleNames.empty() && windowIds.empty() && displayIds.empty();
+    }
+
+    bool IsWindowMatched(int32_t pid, uint32_t windowId) const
+    {
+        return (pids.empty() || pids.count(pid) != 0) && (windowIds.empty() || windowIds.count(windowId) != 0);
+    }
+
+    bool IsMatched(int32_t pid, uint32_t windowId, const std::string& bundleName, DisplayId displayId) const
+    {
+        return IsWindowMatched(pid, windowId) && (bundleNames.empty() || bundleNames.count(bundleName) != 0) &&
+               (displayIds.empty() || displayIds.count(displayId) != 0);
+    }
+
+    bool operator==(const WindowManagerAgentFilter& other) const
+    {
+        return pids == other.pids && bundleNames == other.bundleNames && windowIds == other.windowIds &&
+               displayIds == other.displayIds;
+    }
+
+    /**
+     * @brief Widen to also match every entry the other filter matches, a field not restricted by both is dropped.
+     */
+    void Merge(const WindowManagerAgentFilter& other)
+    {
+        MergeSet(pids, other.pids);
+        MergeSet(bundleNames, other.bundleNames);
+        MergeSet(windowIds, other.windowIds);
+        MergeSet(displayIds, other.displayIds);
+    }
+
+    bool Marshalling(Parcel& parcel) const override
+    {
+        if (!parcel.WriteUint32(static_cast<uint32_t>(pids.size())) ||
+            !parcel.WriteUint32(static_cast<uint32_t>(bundleNames.size())) ||
+            !parcel.WriteUint32(static_cast<uint32_t>(windowIds.size())) ||
+            !parcel.WriteUint32(static_cast<uint32_t>(displayIds.size()))) {
+            return false;
+        }
+        for (auto pid : pids) {
+            if (!parcel.WriteInt32(pid)) {
+                return false;
+            }
+        }
+        for (const auto& bundleName : bundleNames) {
+            if (!parcel.WriteString(bundleName)) {
+                return false;
+            }
+        }
+        for (auto windowId : windowIds) {
+            if (!parcel.WriteUint32(windowId)) {
+                return false;
+            }
+        }
+        for (auto displayId : displayIds) {
+            if (!parcel.WriteUint64(displayId)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static WindowManagerAgentFilter* Unmarshalling(Parcel& parcel)
+    {
+        uint32_t pidSize = 0;
+        uint32_t bundleNameSize = 0;
+        uint32_t windowIdSize = 0;
+        uint32_t displayIdSize = 0;
+        if (!parcel.ReadUint32(pidSize) || !parcel.ReadUint32(bundleNameSize) || !parcel.ReadUint32(windowIdSize) ||
+            !parcel.ReadUint32(displayIdSize) || pidSize > MAX_FILTER_SIZE || bundleNameSize > MAX_FILTER_SIZE ||
+            windowIdSize > MAX_FILTER_SIZE || displayIdSize > MAX_FILTER_SIZE) {
+            return nullptr;
+        }
+        auto filter = new WindowManagerAgentFilter();
+        if (!ReadSet(parcel, pidSize, filter->pids, &Parcel::ReadInt32) ||
+            !ReadSet(parcel, bundleNameSize, filter->bundleNames, &Parcel::ReadString) ||
+            !ReadSet(parcel, windowIdSize, filter->windowIds, &Parcel::ReadUint32) ||
+            !ReadSet(parcel, displayIdSize, filter->displayIds, &Parcel::ReadUint64)) {
+            delete filter;
+            return nullptr;
+        }
+        return filter;
+    }
+
+private:
+    template <typename T>
+    static bool ReadSet(Parcel& parcel, uint32_t size, std::unordered_set<T>& values, bool (Parcel::*read)(T&))
+    {
+        for (uint32_t i = 0; i < size; i++) {
+            T value {};
+            if (!(parcel.*read)(value)) {
+                return false;
+            }
+            values.insert(std::move(value));
+        }
+        return true;
+    }
+
+    template <typename T>
+    static void MergeSet(std::unordered_set<T>& target, const std::unordered_set<T>& other)
+    {
+        if (target.empty() || other.empty()) {
+            target.clear();
+            return;
+        }
+        target.insert(other.begin(), other.end());
+    }
+};
+
 struct CrossProcessWindowInfo : public Parcelable {
     int32_t persistentId = 0;
     uint64_t displayId = 0;
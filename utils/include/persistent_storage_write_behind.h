@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_PERSISTENT_STORAGE_WRITE_BEHIND_H
+#define OHOS_ROSEN_WINDOW_PERSISTENT_STORAGE_WRITE_BEHIND_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "preferences.h"
+
+namespace ffrt {
+class queue;
+} // namespace ffrt
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @brief Write-behind layer of persistent storages.
+ *
+ * Preference handles are cached by file name. Changed keys are only marked dirty,
+ * the dirty files are written together after the batch interval or on shutdown.
+ */
+class PersistentStorageWriteBehind {
+public:
+    static PersistentStorageWriteBehind& GetInstance();
+
+    std::shared_ptr<NativePreferences::Preferences> GetPreference(const std::string& fileName);
+    void MarkDirty(const std::string& fileName, const std::string& key);
+
+    /**
+     * @brief Write all dirty files now, used on shutdown with isSync true.
+     */
+    void FlushAll(bool isSync);
+    void SetBatchInterval(uint64_t intervalMs);
+
+    uint64_t GetPendingKeyCount();
+    uint64_t GetFlushedKeyCount() const { return flushedKeyCount_.load(); }
+    uint64_t GetFileWriteCount() const { return fileWriteCount_.load(); }
+    void DumpInfo(std::string& dumpInfo);
+
+private:
+    PersistentStorageWriteBehind();
+    ~PersistentStorageWriteBehind();
+
+    void FlushDirtyFiles(std::unordered_map<std::string, std::unordered_set<std::string>>&& dirtyKeys);
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<NativePreferences::Preferences>> preferences_;
+    std::unordered_map<std::string, std::unordered_set<std::string>> dirtyKeys_;
+    bool isFlushScheduled_ = false;
+    uint64_t batchIntervalMs_;
+    std::atomic<uint64_t> flushedKeyCount_ { 0 };
+    std::atomic<uint64_t> fileWriteCount_ { 0 };
+    std::unique_ptr<ffrt::queue> flushQueue_;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_WINDOW_PERSISTENT_STORAGE_WRITE_BEHIND_H
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WM_TIME_UTIL_H
+#define OHOS_ROSEN_WM_TIME_UTIL_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace OHOS::Rosen {
+class TimeUtil {
+public:
+    /**
+     * @brief Steady clock time in microseconds, only meaningful as a difference of two readings.
+     */
+    static int64_t GetCurrentTimeUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Steady clock time in nanoseconds, only meaningful as a difference of two readings.
+     */
+    static int64_t GetCurrentTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WM_TIME_UTIL_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_PROPERTY_CHANGE_BATCH_H
+#define OHOS_ROSEN_WINDOW_PROPERTY_CHANGE_BATCH_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <parcel.h>
+
+#include "dm_common.h"
+#include "window_manager.h"
+#include "wm_common.h"
+
+namespace OHOS::Rosen {
+/**
+ * @brief Property change of one window, a field is valid only if its WindowInfoKey is set in presentKeys_.
+ */
+struct WindowPropertyChangeRecord {
+    // WindowInfoKey bits, the same values as SessionPropertyFlag
+    uint32_t presentKeys_ = 0;
+    int32_t windowId_ = 0;
+    // index in the string table of the batch
+    uint32_t bundleNameIndex_ = 0;
+    uint32_t abilityNameIndex_ = 0;
+    int32_t appIndex_ = 0;
+    WindowVisibilityState visibilityState_ = WINDOW_LAYER_STATE_MAX;
+    DisplayId displayId_ = DISPLAY_ID_INVALID;
+    Rect rect_;
+    WindowMode mode_ = WindowMode::WINDOW_MODE_UNDEFINED;
+    WindowModeInfo modeInfo_;
+    float floatingScale_ = 1.0f;
+    bool isMidScene_ = false;
+    Rect globalRect_;
+
+    bool HasKey(WindowInfoKey key) const
+    {
+        return (presentKeys_ & static_cast<uint32_t>(key)) != 0;
+    }
+};
+
+/**
+ * @brief Window property changes of one notification, kept as flat records with the names interned once.
+ *
+ * Every record is written with the same fixed layout whatever its presentKeys_, and the names are sent once in
+ * the string table. Clear keeps the capacity, so a batch reused for every flush does not allocate once it has grown.
+ */
+class WindowPropertyChangeBatch {
+public:
+    void Clear();
+    bool IsEmpty() const { return records_.empty(); }
+    uint32_t GetPropertyDirtyFlags() const { return propertyDirtyFlags_; }
+    void AddPropertyDirtyFlags(uint32_t dirtyFlags) { propertyDirtyFlags_ |= dirtyFlags; }
+    WindowPropertyChangeRecord& AddRecord();
+    const std::vector<WindowPropertyChangeRecord>& GetRecords() const { return records_; }
+    uint32_t InternString(const std::string& str);
+    const std::string& GetString(uint32_t index) const;
+
+    /**
+     * @brief Layout: dirty flags, string table, record count, then the fixed-layout records.
+     */
+    bool Marshalling(Parcel& parcel) const;
+
+    /**
+     * @brief Read what Marshalling wrote, fails on a truncated parcel or a name index out of the string table.
+     */
+    bool Unmarshalling(Parcel& parcel);
+
+    /**
+     * @brief Convert to the list WindowManager::NotifyWindowPropertyChange takes, only present keys are added.
+     */
+    void ToWindowInfoList(WindowInfoList& windowInfoList) const;
+
+private:
+    static bool MarshallingRecord(Parcel& parcel, const WindowPropertyChangeRecord& record);
+    static bool UnmarshallingRecord(Parcel& parcel, WindowPropertyChangeRecord& record);
+
+    uint32_t propertyDirtyFlags_ = 0;
+    std::vector<WindowPropertyChangeRecord> records_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> stringIndexes_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_PROPERTY_CHANGE_BATCH_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_XML_CONFIG_SNAPSHOT_H
+#define OHOS_ROSEN_XML_CONFIG_SNAPSHOT_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "xml_config_base.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @brief Compiled cache of a parsed xml config.
+ *
+ * The parsed ConfigItem tree is serialized into a flat binary together with the size, mtime and
+ * hash of the source xml, the version of the parser and the build version. Later boots map the binary
+ * and rebuild the tree without libxml2, the binary is dropped as soon as the source xml, the parser
+ * or the build changes.
+ */
+class XmlConfigSnapshot {
+public:
+    struct XmlStamp {
+        uint64_t size_ = 0;
+        int64_t mtimeNs_ = 0;
+        uint64_t hash_ = 0;
+    };
+
+    using ParseFunc = std::function<bool(const std::string& xmlPath, XmlConfigBase::ConfigItem& config)>;
+
+    /**
+     * @brief Load config from the snapshot named snapshotName, or parse xmlPath with parseFunc and
+     * save a new snapshot when the snapshot is missing or stale.
+     *
+     * @param parserVersion Version of parseFunc, bump it whenever parseFunc builds a different tree.
+     */
+    static bool LoadOrParse(const std::string& xmlPath, const std::string& snapshotName, uint32_t parserVersion,
+        const ParseFunc& parseFunc, XmlConfigBase::ConfigItem& config);
+
+    /**
+     * @brief Check whether the snapshot named snapshotName is valid and matches a fresh parse of xmlPath.
+     */
+    static bool Check(const std::string& xmlPath, const std::string& snapshotName, uint32_t parserVersion,
+        const ParseFunc& parseFunc);
+
+    static std::string GetSnapshotPath(const std::string& snapshotName);
+    static bool GetXmlStamp(const std::string& xmlPath, XmlStamp& stamp);
+
+    /**
+     * @brief Hash of the build version, snapshots saved by another build are stale.
+     */
+    static uint64_t GetBuildHash();
+
+    /**
+     * @brief Load the snapshot if it was built from the current content of xmlPath by the same parser and build.
+     *
+     * @param parseCostUs Output the xml parse cost recorded when the snapshot was built.
+     */
+    static bool Load(const std::string& xmlPath, const std::string& snapshotPath, uint32_t parserVersion,
+        XmlConfigBase::ConfigItem& config, int64_t* parseCostUs = nullptr);
+    static bool Save(const std::string& xmlPath, const std::string& snapshotPath, uint32_t parserVersion,
+        const XmlConfigBase::ConfigItem& config, int64_t parseCostUs = 0);
+
+    static void Serialize(const XmlConfigBase::ConfigItem& config, std::string& data);
+    static bool Deserialize(const uint8_t* data, size_t size, XmlConfigBase::ConfigItem& config);
+    static bool IsEqual(const XmlConfigBase::ConfigItem& lhs, const XmlConfigBase::ConfigItem& rhs);
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_XML_CONFIG_SNAPSHOT_H
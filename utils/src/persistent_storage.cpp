@@ -15,6 +15,8 @@
 
 #include "persistent_storage.h"
 
+#include "persistent_storage_write_behind.h"
+
 namespace OHOS {
 namespace Rosen {
 namespace {
@@ -53,7 +55,7 @@ void PersistentStorage::Delete(const std::string& key, PersistentStorageType sto
         return;
     }
     pref->Delete(key);
-    pref->Flush();
+    PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], key);
     WLOGD("[PersistentStorage] Delete key %{public}s", key.c_str());
 }
 
@@ -63,11 +65,7 @@ std::shared_ptr<PersistentPerference> PersistentStorage::GetPreference(Persisten
     if (iter == storagePath_.end()) {
         return nullptr;
     }
-    auto fileName = storagePath_[storageType];
-    int errCode;
-    auto pref = NativePreferences::PreferencesHelper::GetPreferences(fileName, errCode);
-    WLOGD("[PersistentStorage] GetPreference fileName: %{public}s, errCode: %{public}d", fileName.c_str(), errCode);
-    return pref;
+    return PersistentStorageWriteBehind::GetInstance().GetPreference(iter->second);
 }
 
 template <typename T>
@@ -94,7 +92,7 @@ void PersistentStorage::Insert(const std::string& key, const T& value, Persisten
         default:
             WLOGFW("[PersistentStorage] Unknown storage type!");
     }
-    pref->Flush();
+    PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], key);
 }
 
 template <typename T>
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "persistent_storage_write_behind.h"
+
+#include <cinttypes>
+#include <sstream>
+
+#include "ffrt_inner.h"
+#include "preferences_helper.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint64_t DEFAULT_BATCH_INTERVAL_MS = 1000;
+constexpr uint64_t US_PER_MS = 1000;
+}
+
+PersistentStorageWriteBehind::PersistentStorageWriteBehind() : batchIntervalMs_(DEFAULT_BATCH_INTERVAL_MS)
+{
+    flushQueue_ = std::make_unique<ffrt::queue>(ffrt::queue_serial, "PersistentStorageWriteBehind",
+        ffrt::queue_attr().qos(ffrt_qos_utility));
+}
+
+PersistentStorageWriteBehind::~PersistentStorageWriteBehind()
+{
+    FlushAll(true);
+}
+
+PersistentStorageWriteBehind& PersistentStorageWriteBehind::GetInstance()
+{
+    static PersistentStorageWriteBehind instance;
+    return instance;
+}
+
+std::shared_ptr<NativePreferences::Preferences> PersistentStorageWriteBehind::GetPreference(
+    const std::string& fileName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = preferences_.find(fileName);
+    if (iter != preferences_.end()) {
+        return iter->second;
+    }
+    int errCode = 0;
+    auto pref = NativePreferences::PreferencesHelper::GetPreferences(fileName, errCode);
+    TLOGD(WmsLogTag::DEFAULT, "fileName: %{public}s, errCode: %{public}d", fileName.c_str(), errCode);
+    if (pref != nullptr) {
+        preferences_[fileName] = pref;
+    }
+    return pref;
+}
+
+void PersistentStorageWriteBehind::MarkDirty(const std::string& fileName, const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    dirtyKeys_[fileName].insert(key);
+    if (isFlushScheduled_) {
+        return;
+    }
+    isFlushScheduled_ = true;
+    flushQueue_->submit([this] {
+        std::unordered_map<std::string, std::unordered_set<std::string>> dirtyKeys;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isFlushScheduled_ = false;
+            dirtyKeys.swap(dirtyKeys_);
+        }
+        FlushDirtyFiles(std::move(dirtyKeys));
+    }, ffrt::task_attr().name("PersistentStorageFlush").delay(batchIntervalMs_ * US_PER_MS));
+}
+
+void PersistentStorageWriteBehind::FlushAll(bool isSync)
+{
+    std::unordered_map<std::string, std::unordered_set<std::string>> dirtyKeys;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dirtyKeys.swap(dirtyKeys_);
+    }
+    if (dirtyKeys.empty()) {
+        return;
+    }
+    if (isSync) {
+        FlushDirtyFiles(std::move(dirtyKeys));
+        return;
+    }
+    flushQueue_->submit([this, dirtyKeys = std::move(dirtyKeys)]() mutable {
+        FlushDirtyFiles(std::move(dirtyKeys));
+    }, ffrt::task_attr().name("PersistentStorageFlush"));
+}
+
+void PersistentStorageWriteBehind::FlushDirtyFiles(
+    std::unordered_map<std::string, std::unordered_set<std::string>>&& dirtyKeys)
+{
+    for (const auto& [fileName, keys] : dirtyKeys) {
+        std::shared_ptr<NativePreferences::Preferences> pref;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto iter = preferences_.find(fileName);
+            if (iter != preferences_.end()) {
+                pref = iter->second;
+            }
+        }
+        if (pref == nullptr) {
+            TLOGE(WmsLogTag::DEFAULT, "preference of %{public}s is not cached", fileName.c_str());
+            continue;
+        }
+        // replacing the file atomically is left to preferences, which keeps a backup while writing
+        int errCode = pref->FlushSync();
+        if (errCode != 0) {
+            TLOGE(WmsLogTag::DEFAULT, "flush %{public}s failed, errCode: %{public}d", fileName.c_str(), errCode);
+            continue;
+        }
+        fileWriteCount_.fetch_add(1);
+        flushedKeyCount_.fetch_add(keys.size());
+        TLOGI(WmsLogTag::DEFAULT, "flush %{public}s, keys: %{public}zu, total flushed: %{public}" PRIu64,
+            fileName.c_str(), keys.size(), flushedKeyCount_.load());
+    }
+}
+
+void PersistentStorageWriteBehind::SetBatchInterval(uint64_t intervalMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    batchIntervalMs_ = intervalMs;
+}
+
+uint64_t PersistentStorageWriteBehind::GetPendingKeyCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t pendingKeyCount = 0;
+    for (const auto& [_, keys] : dirtyKeys_) {
+        pendingKeyCount += keys.size();
+    }
+    return pendingKeyCount;
+}
+
+void PersistentStorageWriteBehind::DumpInfo(std::string& dumpInfo)
+{
+    std::ostringstream oss;
+    oss << "PersistentStorage" << std::endl;
+    oss << "PendingKeys: " << GetPendingKeyCount() << std::endl;
+    oss << "FlushedKeys: " << GetFlushedKeyCount() << std::endl;
+    oss << "FileWrites: " << GetFileWriteCount() << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        oss << "CachedFiles: " << preferences_.size() << std::endl;
+        oss << "BatchIntervalMs: " << batchIntervalMs_ << std::endl;
+    }
+    dumpInfo.append(oss.str());
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "window_property_change_batch.h"
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+const std::string EMPTY_STRING;
+
+// bytes of the smallest string and of a record, used to bound the counts read from the parcel
+constexpr size_t MIN_STRING_BYTES = sizeof(int32_t);
+constexpr size_t RECORD_BYTES = 22 * sizeof(int32_t);
+
+// in the order the keys are added to the window info
+constexpr WindowInfoKey RECORD_KEYS[] = {
+    WindowInfoKey::WINDOW_ID, WindowInfoKey::BUNDLE_NAME, WindowInfoKey::ABILITY_NAME,
+    WindowInfoKey::APP_INDEX, WindowInfoKey::VISIBILITY_STATE, WindowInfoKey::DISPLAY_ID,
+    WindowInfoKey::WINDOW_RECT, WindowInfoKey::WINDOW_MODE, WindowInfoKey::FLOATING_SCALE,
+    WindowInfoKey::MID_SCENE, WindowInfoKey::WINDOW_GLOBAL_RECT, WindowInfoKey::WINDOW_MODE_INFO,
+};
+
+uint32_t GetRecordKeyMask()
+{
+    uint32_t mask = 0;
+    for (auto key : RECORD_KEYS) {
+        mask |= static_cast<uint32_t>(key);
+    }
+    return mask;
+}
+
+bool MarshallingRect(Parcel& parcel, const Rect& rect)
+{
+    return parcel.WriteInt32(rect.posX_) && parcel.WriteInt32(rect.posY_) &&
+        parcel.WriteUint32(rect.width_) && parcel.WriteUint32(rect.height_);
+}
+
+bool UnmarshallingRect(Parcel& parcel, Rect& rect)
+{
+    return parcel.ReadInt32(rect.posX_) && parcel.ReadInt32(rect.posY_) &&
+        parcel.ReadUint32(rect.width_) && parcel.ReadUint32(rect.height_);
+}
+} // namespace
+
+void WindowPropertyChangeBatch::Clear()
+{
+    propertyDirtyFlags_ = 0;
+    records_.clear();
+    strings_.clear();
+    stringIndexes_.clear();
+}
+
+WindowPropertyChangeRecord& WindowPropertyChangeBatch::AddRecord()
+{
+    return records_.emplace_back();
+}
+
+uint32_t WindowPropertyChangeBatch::InternString(const std::string& str)
+{
+    auto [iter, isInserted] = stringIndexes_.try_emplace(str, static_cast<uint32_t>(strings_.size()));
+    if (isInserted) {
+        strings_.push_back(str);
+    }
+    return iter->second;
+}
+
+const std::string& WindowPropertyChangeBatch::GetString(uint32_t index) const
+{
+    return index < strings_.size() ? strings_[index] : EMPTY_STRING;
+}
+
+bool WindowPropertyChangeBatch::Marshalling(Parcel& parcel) const
+{
+    if (!parcel.WriteUint32(propertyDirtyFlags_) || !parcel.WriteUint32(static_cast<uint32_t>(strings_.size()))) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "write header failed");
+        return false;
+    }
+    for (const auto& str : strings_) {
+        if (!parcel.WriteString(str)) {
+            TLOGE(WmsLogTag::WMS_ATTRIBUTE, "write string failed");
+            return false;
+        }
+    }
+    if (!parcel.WriteUint32(static_cast<uint32_t>(records_.size()))) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "write record size failed");
+        return false;
+    }
+    for (const auto& record : records_) {
+        if (!MarshallingRecord(parcel, record)) {
+            TLOGE(WmsLogTag::WMS_ATTRIBUTE, "write record failed, windowId:%{public}d", record.windowId_);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WindowPropertyChangeBatch::MarshallingRecord(Parcel& parcel, const WindowPropertyChangeRecord& record)
+{
+    static const uint32_t recordKeyMask = GetRecordKeyMask();
+    return parcel.WriteUint32(record.presentKeys_ & recordKeyMask) && parcel.WriteInt32(record.windowId_) &&
+        parcel.WriteUint32(record.bundleNameIndex_) && parcel.WriteUint32(record.abilityNameIndex_) &&
+        parcel.WriteInt32(record.appIndex_) && parcel.WriteUint32(static_cast<uint32_t>(record.visibilityState_)) &&
+        parcel.WriteUint64(record.displayId_) && MarshallingRect(parcel, record.rect_) &&
+        parcel.WriteUint32(static_cast<uint32_t>(record.mode_)) && record.modeInfo_.Marshalling(parcel) &&
+        parcel.WriteFloat(record.floatingScale_) && parcel.WriteBool(record.isMidScene_) &&
+        MarshallingRect(parcel, record.globalRect_);
+}
+
+bool WindowPropertyChangeBatch::Unmarshalling(Parcel& parcel)
+{
+    Clear();
+    uint32_t stringSize = 0;
+    if (!parcel.ReadUint32(propertyDirtyFlags_) || !parcel.ReadUint32(stringSize) ||
+        stringSize > parcel.GetReadableBytes() / MIN_STRING_BYTES) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "read header failed");
+        return false;
+    }
+    strings_.reserve(stringSize);
+    for (uint32_t i = 0; i < stringSize; i++) {
+        std::string str;
+        if (!parcel.ReadString(str)) {
+            TLOGE(WmsLogTag::WMS_ATTRIBUTE, "read string failed");
+            return false;
+        }
+        strings_.push_back(std::move(str));
+    }
+    uint32_t recordSize = 0;
+    if (!parcel.ReadUint32(recordSize) || recordSize > parcel.GetReadableBytes() / RECORD_BYTES) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "read record size failed");
+        return false;
+    }
+    records_.resize(recordSize);
+    for (auto& record : records_) {
+        if (!UnmarshallingRecord(parcel, record)) {
+            TLOGE(WmsLogTag::WMS_ATTRIBUTE, "read record failed");
+            return false;
+        }
+        if ((record.HasKey(WindowInfoKey::BUNDLE_NAME) && record.bundleNameIndex_ >= strings_.size()) ||
+            (record.HasKey(WindowInfoKey::ABILITY_NAME) && record.abilityNameIndex_ >= strings_.size())) {
+            TLOGE(WmsLogTag::WMS_ATTRIBUTE, "invalid name index, windowId:%{public}d", record.windowId_);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WindowPropertyChangeBatch::UnmarshallingRecord(Parcel& parcel, WindowPropertyChangeRecord& record)
+{
+    uint32_t visibilityState = 0;
+    uint32_t mode = 0;
+    if (!parcel.ReadUint32(record.presentKeys_) || !parcel.ReadInt32(record.windowId_) ||
+        !parcel.ReadUint32(record.bundleNameIndex_) || !parcel.ReadUint32(record.abilityNameIndex_) ||
+        !parcel.ReadInt32(record.appIndex_) || !parcel.ReadUint32(visibilityState) ||
+        !parcel.ReadUint64(record.displayId_) || !UnmarshallingRect(parcel, record.rect_) ||
+        !parcel.ReadUint32(mode) || !record.modeInfo_.Unmarshalling(parcel) ||
+        !parcel.ReadFloat(record.floatingScale_) || !parcel.ReadBool(record.isMidScene_) ||
+        !UnmarshallingRect(parcel, record.globalRect_)) {
+        return false;
+    }
+    record.visibilityState_ = static_cast<WindowVisibilityState>(visibilityState);
+    record.mode_ = static_cast<WindowMode>(mode);
+    return true;
+}
+
+void WindowPropertyChangeBatch::ToWindowInfoList(WindowInfoList& windowInfoList) const
+{
+    windowInfoList.reserve(windowInfoList.size() + records_.size());
+    for (const auto& record : records_) {
+        auto& windowInfo = windowInfoList.emplace_back();
+        for (auto key : RECORD_KEYS) {
+            if (!record.HasKey(key)) {
+                continue;
+            }
+            switch (key) {
+                case WindowInfoKey::WINDOW_ID:
+                    windowInfo[key] = static_cast<uint32_t>(record.windowId_);
+                    break;
+                case WindowInfoKey::BUNDLE_NAME:
+                    windowInfo[key] = GetString(record.bundleNameIndex_);
+                    break;
+                case WindowInfoKey::ABILITY_NAME:
+                    windowInfo[key] = GetString(record.abilityNameIndex_);
+                    break;
+                case WindowInfoKey::APP_INDEX:
+                    windowInfo[key] = record.appIndex_;
+                    break;
+                case WindowInfoKey::VISIBILITY_STATE:
+                    windowInfo[key] = record.visibilityState_;
+                    break;
+                case WindowInfoKey::DISPLAY_ID:
+                    windowInfo[key] = static_cast<uint64_t>(record.displayId_);
+                    break;
+                case WindowInfoKey::WINDOW_RECT:
+                    windowInfo[key] = record.rect_;
+                    break;
+                case WindowInfoKey::WINDOW_MODE:
+                    windowInfo[key] = record.mode_;
+                    break;
+                case WindowInfoKey::FLOATING_SCALE:
+                    windowInfo[key] = record.floatingScale_;
+                    break;
+                case WindowInfoKey::MID_SCENE:
+                    windowInfo[key] = record.isMidScene_;
+                    break;
+                case WindowInfoKey::WINDOW_GLOBAL_RECT:
+                    windowInfo[key] = record.globalRect_;
+                    break;
+                case WindowInfoKey::WINDOW_MODE_INFO:
+                    windowInfo[key] = record.modeInfo_;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,528 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "xml_config_snapshot.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "parameters.h"
+#include "time_util.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53434d57; // "WMCS"
+constexpr uint32_t SNAPSHOT_VERSION = 2;
+constexpr uint32_t MAX_ITEM_DEPTH = 64;
+constexpr uint32_t MAX_XML_PATH_LEN = 4096;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr size_t READ_BUFFER_SIZE = 4096;
+constexpr mode_t SNAPSHOT_DIR_MODE = 0750;
+constexpr mode_t SNAPSHOT_FILE_MODE = 0640;
+const std::string SNAPSHOT_DIR = "/data/service/el1/public/window/config_snapshot/";
+const std::string BUILD_VERSION_PARAM = "const.product.software.version";
+const std::string BUILD_INCREMENTAL_PARAM = "const.product.incremental.version";
+
+struct SnapshotHeader {
+    uint32_t magic_ = SNAPSHOT_MAGIC;
+    uint32_t version_ = SNAPSHOT_VERSION;
+    uint64_t xmlSize_ = 0;
+    int64_t xmlMtimeNs_ = 0;
+    uint64_t xmlHash_ = 0;
+    uint32_t xmlPathLen_ = 0;
+    uint32_t parserVersion_ = 0;
+    uint64_t buildHash_ = 0;
+    int64_t parseCostUs_ = 0;
+    uint64_t payloadSize_ = 0;
+    uint64_t payloadHash_ = 0;
+};
+
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+template<typename T>
+void WritePod(std::string& data, const T& value)
+{
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(std::string& data, const std::string& value)
+{
+    WritePod(data, static_cast<uint32_t>(value.size()));
+    data.append(value);
+}
+
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool ReadPod(T& value)
+    {
+        if (size_ - offset_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        uint32_t len = 0;
+        if (!ReadPod(len) || size_ - offset_ < len) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data_ + offset_), len);
+        offset_ += len;
+        return true;
+    }
+
+    template<typename T>
+    bool ReadPodVector(std::vector<T>& values)
+    {
+        uint32_t count = 0;
+        if (!ReadPod(count) || (size_ - offset_) / sizeof(T) < count) {
+            return false;
+        }
+        values.resize(count);
+        if (count != 0) {
+            std::memcpy(values.data(), data_ + offset_, count * sizeof(T));
+        }
+        offset_ += count * sizeof(T);
+        return true;
+    }
+
+    bool IsEnd() const { return offset_ == size_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+void WriteItem(std::string& data, const XmlConfigBase::ConfigItem& item);
+
+void WriteItemMap(std::string& data, const std::map<std::string, XmlConfigBase::ConfigItem>& itemMap)
+{
+    WritePod(data, static_cast<uint32_t>(itemMap.size()));
+    for (const auto& [key, item] : itemMap) {
+        WriteString(data, key);
+        WriteItem(data, item);
+    }
+}
+
+void WriteItem(std::string& data, const XmlConfigBase::ConfigItem& item)
+{
+    using ValueType = XmlConfigBase::ValueType;
+    WritePod(data, static_cast<uint8_t>(item.type_));
+    WritePod(data, static_cast<uint8_t>(item.property_ != nullptr));
+    if (item.property_ != nullptr) {
+        WriteItemMap(data, *item.property_);
+    }
+    switch (item.type_) {
+        case ValueType::MAP:
+            WriteItemMap(data, *item.mapValue_);
+            break;
+        case ValueType::BOOL:
+            WritePod(data, static_cast<uint8_t>(item.boolValue_));
+            break;
+        case ValueType::STRING:
+            WriteString(data, item.stringValue_);
+            break;
+        case ValueType::INTS:
+            WritePod(data, static_cast<uint32_t>(item.intsValue_->size()));
+            data.append(reinterpret_cast<const char*>(item.intsValue_->data()), item.intsValue_->size() * sizeof(int));
+            break;
+        case ValueType::FLOATS:
+            WritePod(data, static_cast<uint32_t>(item.floatsValue_->size()));
+            data.append(reinterpret_cast<const char*>(item.floatsValue_->data()),
+                item.floatsValue_->size() * sizeof(float));
+            break;
+        case ValueType::STRINGS:
+            WritePod(data, static_cast<uint32_t>(item.stringsValue_->size()));
+            for (const auto& value : *item.stringsValue_) {
+                WriteString(data, value);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+bool ReadItem(SnapshotReader& reader, XmlConfigBase::ConfigItem& item, uint32_t depth);
+
+bool ReadItemMap(SnapshotReader& reader, std::map<std::string, XmlConfigBase::ConfigItem>& itemMap, uint32_t depth)
+{
+    uint32_t count = 0;
+    if (!reader.ReadPod(count)) {
+        return false;
+    }
+    std::string key;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!reader.ReadString(key) || !ReadItem(reader, itemMap[key], depth + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadItem(SnapshotReader& reader, XmlConfigBase::ConfigItem& item, uint32_t depth)
+{
+    using ValueType = XmlConfigBase::ValueType;
+    uint8_t type = 0;
+    uint8_t hasProperty = 0;
+    if (depth > MAX_ITEM_DEPTH || !reader.ReadPod(type) || !reader.ReadPod(hasProperty)) {
+        return false;
+    }
+    if (hasProperty != 0) {
+        item.SetProperty({});
+        if (!ReadItemMap(reader, *item.property_, depth)) {
+            return false;
+        }
+    }
+    switch (static_cast<ValueType>(type)) {
+        case ValueType::UNDIFINED:
+            return true;
+        case ValueType::MAP:
+            item.SetValue(std::map<std::string, XmlConfigBase::ConfigItem>());
+            return ReadItemMap(reader, *item.mapValue_, depth);
+        case ValueType::BOOL: {
+            uint8_t value = 0;
+            if (!reader.ReadPod(value)) {
+                return false;
+            }
+            item.SetValue(value != 0);
+            return true;
+        }
+        case ValueType::STRING: {
+            std::string value;
+            if (!reader.ReadString(value)) {
+                return false;
+            }
+            item.SetValue(value);
+            return true;
+        }
+        case ValueType::INTS:
+            item.SetValue(std::vector<int>());
+            return reader.ReadPodVector(*item.intsValue_);
+        case ValueType::FLOATS:
+            item.SetValue(std::vector<float>());
+            return reader.ReadPodVector(*item.floatsValue_);
+        case ValueType::STRINGS: {
+            uint32_t count = 0;
+            if (!reader.ReadPod(count)) {
+                return false;
+            }
+            item.SetValue(std::vector<std::string>());
+            std::string value;
+            for (uint32_t i = 0; i < count; i++) {
+                if (!reader.ReadString(value)) {
+                    return false;
+                }
+                item.stringsValue_->push_back(value);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool IsItemMapEqual(const std::map<std::string, XmlConfigBase::ConfigItem>* lhs,
+    const std::map<std::string, XmlConfigBase::ConfigItem>* rhs)
+{
+    if (lhs == nullptr || rhs == nullptr) {
+        return lhs == rhs;
+    }
+    if (lhs->size() != rhs->size()) {
+        return false;
+    }
+    for (auto lhsIter = lhs->begin(), rhsIter = rhs->begin(); lhsIter != lhs->end(); ++lhsIter, ++rhsIter) {
+        if (lhsIter->first != rhsIter->first || !XmlConfigSnapshot::IsEqual(lhsIter->second, rhsIter->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WriteFile(const std::string& path, const std::string& data)
+{
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, SNAPSHOT_FILE_MODE);
+    if (fd < 0) {
+        TLOGE(WmsLogTag::DEFAULT, "open %{public}s failed, errno: %{public}d", path.c_str(), errno);
+        return false;
+    }
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t ret = write(fd, data.data() + written, data.size() - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            TLOGE(WmsLogTag::DEFAULT, "write %{public}s failed, errno: %{public}d", path.c_str(), errno);
+            close(fd);
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    bool isSynced = fsync(fd) == 0;
+    close(fd);
+    return isSynced;
+}
+} // namespace
+
+std::string XmlConfigSnapshot::GetSnapshotPath(const std::string& snapshotName)
+{
+    return SNAPSHOT_DIR + snapshotName + ".bin";
+}
+
+bool XmlConfigSnapshot::GetXmlStamp(const std::string& xmlPath, XmlStamp& stamp)
+{
+    int fd = open(xmlPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        return false;
+    }
+    stamp.size_ = static_cast<uint64_t>(fileStat.st_size);
+    stamp.mtimeNs_ = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * NS_PER_SECOND + fileStat.st_mtim.tv_nsec;
+    stamp.hash_ = FNV_OFFSET_BASIS;
+    uint8_t buffer[READ_BUFFER_SIZE];
+    ssize_t ret = 0;
+    while ((ret = read(fd, buffer, sizeof(buffer))) != 0) {
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret < 0) {
+            close(fd);
+            return false;
+        }
+        stamp.hash_ = HashBytes(buffer, static_cast<size_t>(ret), stamp.hash_);
+    }
+    close(fd);
+    return true;
+}
+
+uint64_t XmlConfigSnapshot::GetBuildHash()
+{
+    static const uint64_t buildHash = [] {
+        std::string buildVersion = system::GetParameter(BUILD_VERSION_PARAM, "") + "/" +
+            system::GetParameter(BUILD_INCREMENTAL_PARAM, "");
+        return HashBytes(reinterpret_cast<const uint8_t*>(buildVersion.data()), buildVersion.size());
+    }();
+    return buildHash;
+}
+
+bool XmlConfigSnapshot::Load(const std::string& xmlPath, const std::string& snapshotPath, uint32_t parserVersion,
+    XmlConfigBase::ConfigItem& config, int64_t* parseCostUs)
+{
+    XmlStamp stamp;
+    if (!GetXmlStamp(xmlPath, stamp)) {
+        return false;
+    }
+    int fd = open(snapshotPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        TLOGI(WmsLogTag::DEFAULT, "no snapshot: %{public}s", snapshotPath.c_str());
+        return false;
+    }
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) < sizeof(SnapshotHeader)) {
+        close(fd);
+        return false;
+    }
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void* addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        TLOGE(WmsLogTag::DEFAULT, "mmap %{public}s failed, errno: %{public}d", snapshotPath.c_str(), errno);
+        return false;
+    }
+    const auto* data = static_cast<const uint8_t*>(addr);
+    SnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    size_t pathOffset = sizeof(header);
+    bool isValid = header.magic_ == SNAPSHOT_MAGIC && header.version_ == SNAPSHOT_VERSION &&
+        header.parserVersion_ == parserVersion && header.buildHash_ == GetBuildHash() &&
+        header.xmlSize_ == stamp.size_ && header.xmlMtimeNs_ == stamp.mtimeNs_ && header.xmlHash_ == stamp.hash_ &&
+        header.xmlPathLen_ <= MAX_XML_PATH_LEN && fileSize - pathOffset >= header.xmlPathLen_ &&
+        fileSize - pathOffset - header.xmlPathLen_ == header.payloadSize_ &&
+        xmlPath.compare(0, std::string::npos, reinterpret_cast<const char*>(data + pathOffset),
+            header.xmlPathLen_) == 0;
+    const uint8_t* payload = data + pathOffset + header.xmlPathLen_;
+    isValid = isValid && HashBytes(payload, header.payloadSize_) == header.payloadHash_;
+    XmlConfigBase::ConfigItem snapshotConfig;
+    isValid = isValid && Deserialize(payload, header.payloadSize_, snapshotConfig);
+    munmap(addr, fileSize);
+    if (!isValid) {
+        TLOGI(WmsLogTag::DEFAULT, "snapshot is stale: %{public}s", snapshotPath.c_str());
+        return false;
+    }
+    config = std::move(snapshotConfig);
+    if (parseCostUs != nullptr) {
+        *parseCostUs = header.parseCostUs_;
+    }
+    return true;
+}
+
+bool XmlConfigSnapshot::Save(const std::string& xmlPath, const std::string& snapshotPath, uint32_t parserVersion,
+    const XmlConfigBase::ConfigItem& config, int64_t parseCostUs)
+{
+    XmlStamp stamp;
+    if (xmlPath.size() > MAX_XML_PATH_LEN || !GetXmlStamp(xmlPath, stamp)) {
+        return false;
+    }
+    std::string payload;
+    Serialize(config, payload);
+    SnapshotHeader header;
+    header.xmlSize_ = stamp.size_;
+    header.xmlMtimeNs_ = stamp.mtimeNs_;
+    header.xmlHash_ = stamp.hash_;
+    header.xmlPathLen_ = static_cast<uint32_t>(xmlPath.size());
+    header.parserVersion_ = parserVersion;
+    header.buildHash_ = GetBuildHash();
+    header.parseCostUs_ = parseCostUs;
+    header.payloadSize_ = payload.size();
+    header.payloadHash_ = HashBytes(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+    std::string data;
+    data.reserve(sizeof(header) + xmlPath.size() + payload.size());
+    WritePod(data, header);
+    data.append(xmlPath).append(payload);
+
+    auto dirPos = snapshotPath.find_last_of('/');
+    if (dirPos != std::string::npos) {
+        std::string dir = snapshotPath.substr(0, dirPos);
+        if (mkdir(dir.c_str(), SNAPSHOT_DIR_MODE) != 0 && errno != EEXIST) {
+            TLOGE(WmsLogTag::DEFAULT, "mkdir %{public}s failed, errno: %{public}d", dir.c_str(), errno);
+            return false;
+        }
+    }
+    // write to a temp file first so that a crash never leaves a half written snapshot
+    std::string tmpPath = snapshotPath + ".tmp";
+    if (!WriteFile(tmpPath, data) || rename(tmpPath.c_str(), snapshotPath.c_str()) != 0) {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    TLOGI(WmsLogTag::DEFAULT, "saved %{public}s, size: %{public}zu", snapshotPath.c_str(), data.size());
+    return true;
+}
+
+bool XmlConfigSnapshot::LoadOrParse(const std::string& xmlPath, const std::string& snapshotName,
+    uint32_t parserVersion, const ParseFunc& parseFunc, XmlConfigBase::ConfigItem& config)
+{
+    auto snapshotPath = GetSnapshotPath(snapshotName);
+    int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
+    int64_t parseCostUs = 0;
+    XmlConfigBase::ConfigItem loadedConfig;
+    if (Load(xmlPath, snapshotPath, parserVersion, loadedConfig, &parseCostUs)) {
+        config = std::move(loadedConfig);
+        int64_t loadCostUs = TimeUtil::GetCurrentTimeUs() - startTimeUs;
+        TLOGI(WmsLogTag::DEFAULT, "%{public}s loaded from snapshot, cost: %{public}" PRId64 "us, "
+            "xml parse cost: %{public}" PRId64 "us, saved: %{public}" PRId64 "us", snapshotName.c_str(),
+            loadCostUs, parseCostUs, parseCostUs - loadCostUs);
+        return true;
+    }
+    startTimeUs = TimeUtil::GetCurrentTimeUs();
+    if (!parseFunc || !parseFunc(xmlPath, loadedConfig)) {
+        return false;
+    }
+    parseCostUs = TimeUtil::GetCurrentTimeUs() - startTimeUs;
+    config = std::move(loadedConfig);
+    TLOGI(WmsLogTag::DEFAULT, "%{public}s parsed from xml, cost: %{public}" PRId64 "us",
+        snapshotName.c_str(), parseCostUs);
+    Save(xmlPath, snapshotPath, parserVersion, config, parseCostUs);
+    return true;
+}
+
+bool XmlConfigSnapshot::Check(const std::string& xmlPath, const std::string& snapshotName,
+    uint32_t parserVersion, const ParseFunc& parseFunc)
+{
+    XmlConfigBase::ConfigItem snapshotConfig;
+    if (!Load(xmlPath, GetSnapshotPath(snapshotName), parserVersion, snapshotConfig)) {
+        TLOGE(WmsLogTag::DEFAULT, "%{public}s snapshot is missing or stale", snapshotName.c_str());
+        return false;
+    }
+    XmlConfigBase::ConfigItem xmlConfig;
+    if (!parseFunc || !parseFunc(xmlPath, xmlConfig)) {
+        TLOGE(WmsLogTag::DEFAULT, "%{public}s parse xml failed", snapshotName.c_str());
+        return false;
+    }
+    if (!IsEqual(snapshotConfig, xmlConfig)) {
+        TLOGE(WmsLogTag::DEFAULT, "%{public}s snapshot does not match xml", snapshotName.c_str());
+        return false;
+    }
+    return true;
+}
+
+void XmlConfigSnapshot::Serialize(const XmlConfigBase::ConfigItem& config, std::string& data)
+{
+    data.clear();
+    WriteItem(data, config);
+}
+
+bool XmlConfigSnapshot::Deserialize(const uint8_t* data, size_t size, XmlConfigBase::ConfigItem& config)
+{
+    if (data == nullptr) {
+        return false;
+    }
+    SnapshotReader reader(data, size);
+    return ReadItem(reader, config, 0) && reader.IsEnd();
+}
+
+bool XmlConfigSnapshot::IsEqual(const XmlConfigBase::ConfigItem& lhs, const XmlConfigBase::ConfigItem& rhs)
+{
+    using ValueType = XmlConfigBase::ValueType;
+    if (lhs.type_ != rhs.type_ || !IsItemMapEqual(lhs.property_, rhs.property_)) {
+        return false;
+    }
+    switch (lhs.type_) {
+        case ValueType::MAP:
+            return IsItemMapEqual(lhs.mapValue_, rhs.mapValue_);
+        case ValueType::BOOL:
+            return lhs.boolValue_ == rhs.boolValue_;
+        case ValueType::STRING:
+            return lhs.stringValue_ == rhs.stringValue_;
+        case ValueType::INTS:
+            return *lhs.intsValue_ == *rhs.intsValue_;
+        case ValueType::FLOATS:
+            return *lhs.floatsValue_ == *rhs.floatsValue_;
+        case ValueType::STRINGS:
+            return *lhs.stringsValue_ == *rhs.stringsValue_;
+        default:
+            return true;
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "persistent_storage.h"
+#include "persistent_storage_write_behind.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -107,6 +108,66 @@ HWTEST_F(PersistentStorageTest, StorageOperate, TestSize.Level1)
     LOG_SetCallback(nullptr);
 }
 
+/**
+ * @tc.name: WriteBehind
+ * @tc.desc: changed keys are batched and written on FlushAll
+ * @tc.type: FUNC
+ */
+HWTEST_F(PersistentStorageTest, WriteBehind, TestSize.Level1)
+{
+    auto& writeBehind = PersistentStorageWriteBehind::GetInstance();
+    constexpr uint64_t batchIntervalMs = 60 * 1000;
+    writeBehind.SetBatchInterval(batchIntervalMs);
+    writeBehind.FlushAll(true);
+    EXPECT_EQ(writeBehind.GetPendingKeyCount(), 0);
+    uint64_t fileWriteCount = writeBehind.GetFileWriteCount();
+    uint64_t flushedKeyCount = writeBehind.GetFlushedKeyCount();
+
+    float ratio = 0;
+    PersistentStorage::Insert("writeBehind1", 1.0f, PersistentStorageType::ASPECT_RATIO);
+    PersistentStorage::Insert("writeBehind1", 2.0f, PersistentStorageType::ASPECT_RATIO);
+    PersistentStorage::Insert("writeBehind2", 3.0f, PersistentStorageType::ASPECT_RATIO);
+    PersistentStorage::Get("writeBehind1", ratio, PersistentStorageType::ASPECT_RATIO);
+    EXPECT_EQ(ratio, 2.0f);
+    EXPECT_EQ(writeBehind.GetPendingKeyCount(), 2);
+    EXPECT_EQ(writeBehind.GetFileWriteCount(), fileWriteCount);
+
+    PersistentStorage::Delete("writeBehind1", PersistentStorageType::ASPECT_RATIO);
+    PersistentStorage::Delete("writeBehind2", PersistentStorageType::ASPECT_RATIO);
+    writeBehind.FlushAll(true);
+    EXPECT_EQ(writeBehind.GetPendingKeyCount(), 0);
+    EXPECT_EQ(writeBehind.GetFileWriteCount(), fileWriteCount + 1);
+    EXPECT_EQ(writeBehind.GetFlushedKeyCount(), flushedKeyCount + 2);
+    EXPECT_EQ(writeBehind.GetPreference("/data/service/el1/public/window/window_aspect_ratio.xml"),
+        writeBehind.GetPreference("/data/service/el1/public/window/window_aspect_ratio.xml"));
+}
+
+/**
+ * @tc.name: WriteBehindDumpInfo
+ * @tc.desc: pending, flushed and written counts are dumped
+ * @tc.type: FUNC
+ */
+HWTEST_F(PersistentStorageTest, WriteBehindDumpInfo, TestSize.Level1)
+{
+    auto& writeBehind = PersistentStorageWriteBehind::GetInstance();
+    constexpr uint64_t batchIntervalMs = 60 * 1000;
+    writeBehind.SetBatchInterval(batchIntervalMs);
+    writeBehind.FlushAll(true);
+    PersistentStorage::Insert("writeBehindDump", 1.0f, PersistentStorageType::ASPECT_RATIO);
+
+    std::string dumpInfo;
+    writeBehind.DumpInfo(dumpInfo);
+    EXPECT_NE(dumpInfo.find("PendingKeys: 1"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("FlushedKeys: " + std::to_string(writeBehind.GetFlushedKeyCount())), std::string::npos);
+    EXPECT_NE(dumpInfo.find("FileWrites: "), std::string::npos);
+
+    PersistentStorage::Delete("writeBehindDump", PersistentStorageType::ASPECT_RATIO);
+    writeBehind.FlushAll(true);
+    dumpInfo.clear();
+    writeBehind.DumpInfo(dumpInfo);
+    EXPECT_NE(dumpInfo.find("PendingKeys: 0"), std::string::npos);
+}
+
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "xml_config_snapshot.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+const std::string XML_PATH = "/data/local/tmp/xml_config_snapshot_test.xml";
+const std::string SNAPSHOT_PATH = "/data/local/tmp/xml_config_snapshot_test.bin";
+const std::string SNAPSHOT_NAME = "xml_config_snapshot_test";
+constexpr uint32_t PARSER_VERSION = 1;
+
+void WriteXml(const std::string& content)
+{
+    std::ofstream file(XML_PATH, std::ios::trunc);
+    file << content;
+}
+
+XmlConfigBase::ConfigItem CreateConfig()
+{
+    XmlConfigBase::ConfigItem config;
+    config.SetValue(std::map<std::string, XmlConfigBase::ConfigItem>());
+    auto& configMap = *config.mapValue_;
+    configMap["ints"].SetValue(std::vector<int>({ 1, -2, 3 }));
+    configMap["floats"].SetValue(std::vector<float>({ 0.5f, 1.25f }));
+    configMap["string"].SetValue(std::string("value"));
+    configMap["strings"].SetValue(std::vector<std::string>({ "a", "bc" }));
+    configMap["bool"].SetValue(true);
+    std::map<std::string, XmlConfigBase::ConfigItem> property;
+    property["enable"].SetValue(false);
+    configMap["map"].SetProperty(property);
+    configMap["map"].SetValue(std::map<std::string, XmlConfigBase::ConfigItem>());
+    (*configMap["map"].mapValue_)["empty"].SetValue(std::vector<int>());
+    return config;
+}
+} // namespace
+
+class XmlConfigSnapshotTest : public testing::Test {
+public:
+    void TearDown() override
+    {
+        unlink(XML_PATH.c_str());
+        unlink(SNAPSHOT_PATH.c_str());
+        unlink(XmlConfigSnapshot::GetSnapshotPath(SNAPSHOT_NAME).c_str());
+    }
+};
+
+namespace {
+/**
+ * @tc.name: SerializeRoundTrip
+ * @tc.desc: serialized config is deserialized to an equal config, truncated data is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(XmlConfigSnapshotTest, SerializeRoundTrip, TestSize.Level1)
+{
+    auto config = CreateConfig();
+    std::string data;
+    XmlConfigSnapshot::Serialize(config, data);
+
+    XmlConfigBase::ConfigItem result;
+    ASSERT_TRUE(XmlConfigSnapshot::Deserialize(reinterpret_cast<const uint8_t*>(data.data()), data.size(), result));
+    EXPECT_TRUE(XmlConfigSnapshot::IsEqual(config, result));
+    EXPECT_EQ(result["map"].GetProp("enable").boolValue_, false);
+
+    for (size_t size = 0; size < data.size(); size++) {
+        XmlConfigBase::ConfigItem truncated;
+        EXPECT_FALSE(XmlConfigSnapshot::Deserialize(reinterpret_cast<const uint8_t*>(data.data()), size, truncated));
+    }
+    (*result.mapValue_)["ints"].SetValue(std::vector<int>({ 1 }));
+    EXPECT_FALSE(XmlConfigSnapshot::IsEqual(config, result));
+}
+
+/**
+ * @tc.name: SaveAndLoad
+ * @tc.desc: snapshot is loaded until the xml changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(XmlConfigSnapshotTest, SaveAndLoad, TestSize.Level1)
+{
+    WriteXml("<Configs></Configs>");
+    auto config = CreateConfig();
+    ASSERT_TRUE(XmlConfigSnapshot::Save(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, config, 100));
+
+    XmlConfigBase::ConfigItem result;
+    int64_t parseCostUs = 0;
+    ASSERT_TRUE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, result, &parseCostUs));
+    EXPECT_TRUE(XmlConfigSnapshot::IsEqual(config, result));
+    EXPECT_EQ(parseCostUs, 100);
+
+    WriteXml("<Configs> </Configs>");
+    XmlConfigBase::ConfigItem staleResult;
+    EXPECT_FALSE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, staleResult));
+    EXPECT_FALSE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH + ".none", PARSER_VERSION, staleResult));
+}
+
+/**
+ * @tc.name: LoadStaleVersion
+ * @tc.desc: snapshot saved by another parser version or another build is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(XmlConfigSnapshotTest, LoadStaleVersion, TestSize.Level1)
+{
+    WriteXml("<Configs></Configs>");
+    auto config = CreateConfig();
+    ASSERT_TRUE(XmlConfigSnapshot::Save(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, config));
+    XmlConfigBase::ConfigItem result;
+    EXPECT_FALSE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION + 1, result));
+    ASSERT_TRUE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, result));
+
+    std::fstream file(SNAPSHOT_PATH, std::ios::in | std::ios::out | std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    uint64_t buildHash = XmlConfigSnapshot::GetBuildHash();
+    auto pos = data.find(std::string(reinterpret_cast<const char*>(&buildHash), sizeof(buildHash)));
+    ASSERT_NE(pos, std::string::npos);
+    uint64_t otherBuildHash = buildHash + 1;
+    file.seekp(pos);
+    file.write(reinterpret_cast<const char*>(&otherBuildHash), sizeof(otherBuildHash));
+    file.close();
+    EXPECT_FALSE(XmlConfigSnapshot::Load(XML_PATH, SNAPSHOT_PATH, PARSER_VERSION, result));
+}
+
+/**
+ * @tc.name: LoadOrParse
+ * @tc.desc: xml is only parsed when there is no valid snapshot
+ * @tc.type: FUNC
+ */
+HWTEST_F(XmlConfigSnapshotTest, LoadOrParse, TestSize.Level1)
+{
+    WriteXml("<Configs></Configs>");
+    uint32_t parseCount = 0;
+    auto parseFunc = [&parseCount](const std::string& xmlPath, XmlConfigBase::ConfigItem& config) {
+        parseCount++;
+        config = CreateConfig();
+        return true;
+    };
+    XmlConfigBase::ConfigItem config;
+    ASSERT_TRUE(XmlConfigSnapshot::LoadOrParse(XML_PATH, SNAPSHOT_NAME, PARSER_VERSION, parseFunc, config));
+    EXPECT_EQ(parseCount, 1);
+    EXPECT_TRUE(XmlConfigSnapshot::IsEqual(config, CreateConfig()));
+    if (access(XmlConfigSnapshot::GetSnapshotPath(SNAPSHOT_NAME).c_str(), F_OK) != 0) {
+        GTEST_LOG_(INFO) << "snapshot dir is not writable";
+        return;
+    }
+
+    XmlConfigBase::ConfigItem loadedConfig;
+    ASSERT_TRUE(XmlConfigSnapshot::LoadOrParse(XML_PATH, SNAPSHOT_NAME, PARSER_VERSION, parseFunc, loadedConfig));
+    EXPECT_EQ(parseCount, 1);
+    EXPECT_TRUE(XmlConfigSnapshot::IsEqual(loadedConfig, config));
+    EXPECT_TRUE(XmlConfigSnapshot::Check(XML_PATH, SNAPSHOT_NAME, PARSER_VERSION, parseFunc));
+}
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -26,6 +26,7 @@ public:
     explicit SafeTaskScheduler(const std::string& threadName): TaskScheduler(threadName) {};
     ~SafeTaskScheduler() {};
 
+    using TaskScheduler::PostAsyncTask;
     void PostAsyncTask(Task&& task, const std::string& name, int64_t delayTime = 0) override;
     void PostVoidSyncTask(Task&& task, const std::string& name) override;
 };
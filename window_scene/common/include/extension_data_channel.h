@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_EXTENSION_DATA_CHANNEL_H
+#define OHOS_ROSEN_EXTENSION_DATA_CHANNEL_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <ashmem.h>
+#include <parcel.h>
+
+namespace OHOS::Rosen::Extension {
+/**
+ * @brief Bytes of one payload in the ring, positions count all bytes ever written and never wrap.
+ *
+ * [begin, end) is the space the payload holds, including the padding skipped at the end of the ring,
+ * the payload itself is the last length bytes of it.
+ */
+struct DataChannelRange {
+    uint64_t begin { 0 };
+    uint64_t end { 0 };
+    uint32_t length { 0 };
+};
+
+struct DataChannelHeader;
+
+/**
+ * @class DataChannel
+ * @brief Shared memory ring carrying large payloads in one direction between the host and the provider.
+ *
+ * The sender creates the ring and writes each payload contiguously, the receiver maps the same memory from the
+ * ashmem sent along with the message. The receiver publishes the position it has consumed up to in the shared
+ * header, so the sender knows how much space it may reuse. A payload that does not fit is not written and the
+ * caller falls back to the parcel.
+ */
+class DataChannel {
+public:
+    static std::shared_ptr<DataChannel> Create(uint32_t capacity);
+    static std::shared_ptr<DataChannel> Map(const sptr<Ashmem>& ashmem);
+    ~DataChannel();
+
+    sptr<Ashmem> GetAshmem() const { return ashmem_; }
+    uint32_t GetCapacity() const { return capacity_; }
+
+    // sender side
+    bool Write(const void* data, uint32_t length, DataChannelRange& range);
+    void Cancel(const DataChannelRange& range);
+
+    // receiver side
+    bool Read(const DataChannelRange& range, Parcel& parcel) const;
+    void Complete(const DataChannelRange& range);
+
+private:
+    DataChannel(const sptr<Ashmem>& ashmem, void* memory, size_t memorySize);
+    bool IsValidRange(const DataChannelRange& range) const;
+
+    sptr<Ashmem> ashmem_;
+    void* memory_ { nullptr };
+    size_t memorySize_ { 0 };
+    DataChannelHeader* header_ { nullptr };
+    uint8_t* data_ { nullptr };
+    uint32_t capacity_ { 0 };
+
+    std::mutex writeMutex_;
+    uint64_t writePos_ { 0 };
+    bool isBroken_ { false };
+
+    std::mutex readMutex_;
+    uint64_t readPos_ { 0 };
+    // begin -> end of the payloads consumed ahead of readPos_
+    std::map<uint64_t, uint64_t> completedRanges_;
+};
+}  // namespace OHOS::Rosen::Extension
+
+#endif  // OHOS_ROSEN_EXTENSION_DATA_CHANNEL_H
@@ -17,6 +17,7 @@
 #define OHOS_ROSEN_EXTENSION_DATA_HANDLER_H
 
 #include "data_handler_interface.h"
+#include "extension_data_channel.h"
 
 #include <cstdint>
 #include <mutex>
@@ -37,6 +38,10 @@ struct DataTransferConfig : public Parcelable {
     bool needReply { false };
     SubSystemId subSystemId { SubSystemId::INVALID };
     uint32_t customId { 0 };
+    // the want is carried by the shared memory channel instead of the parcel
+    bool useSharedMemory { false };
+    // the message only carries the ashmem of the channel, sent once before the first payload
+    bool isChannelSetup { false };
 };
 
 using Task = std::function<void()>;
@@ -61,17 +66,37 @@ protected:
                                       const DataTransferConfig& config);
     virtual DataHandlerErr SendData(const AAFwk::Want& toSend, AAFwk::Want& reply,
                                     const DataTransferConfig& config) = 0;
-    DataHandlerErr PrepareSendData(MessageParcel& data, const DataTransferConfig& config, const AAFwk::Want& toSend);
+    DataHandlerErr PrepareSendData(MessageParcel& data, const DataTransferConfig& config, const AAFwk::Want& toSend,
+                                   DataChannelRange& range);
+    // gives back the channel space of a message that was not delivered
+    void CancelSendData(const DataChannelRange& range);
     virtual bool WriteInterfaceToken(MessageParcel& data) = 0;
     DataHandlerErr ParseReply(MessageParcel& recieved, AAFwk::Want& reply, const DataTransferConfig& config);
     void PostAsyncTask(Task&& task, const std::string& name, int64_t delayTime);
     bool IsProxyObject() const;
 
+private:
+    bool WriteToChannel(MessageParcel& wantParcel, DataChannelRange& range);
+    sptr<AAFwk::Want> ReadFromChannel(MessageParcel& recieved);
+    std::shared_ptr<DataChannel> GetSendChannel();
+    std::shared_ptr<DataChannel> GetOrCreateSendChannel();
+    DataHandlerErr PrepareChannelSetup(MessageParcel& data, const DataTransferConfig& config);
+    DataHandlerErr SetupRecvChannel(MessageParcel& recieved);
+
 protected:
     mutable std::mutex mutex_;
     std::unordered_map<SubSystemId, DataConsumeCallback> consumers_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
     sptr<IRemoteObject> remoteProxy_;
+
+private:
+    // created once per extension session, on the first payload large enough for it
+    std::mutex channelMutex_;
+    std::shared_ptr<DataChannel> sendChannel_;
+    // the channel whose ashmem is being sent to the receiver
+    std::shared_ptr<DataChannel> setupChannel_;
+    std::shared_ptr<DataChannel> recvChannel_;
+    bool isSendChannelFailed_ { false };
 };
 
 }  // namespace OHOS::Rosen::Extension
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_HOT_AREA_BUFFER_H
+#define OHOS_ROSEN_WINDOW_SCENE_HOT_AREA_BUFFER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "wm_common.h"
+
+namespace OHOS::Rosen {
+class HotAreaBuffer;
+using HotAreaBufferPtr = std::shared_ptr<const HotAreaBuffer>;
+
+/**
+ * @brief Immutable hot areas of a window stored as struct of arrays.
+ *
+ * A buffer is never modified after creation, so it can be shared by all readers without copying. Every buffer
+ * has a process-wide unique version, readers caching data derived from a buffer only need to compare versions.
+ */
+class HotAreaBuffer {
+public:
+    static HotAreaBufferPtr Create(const std::vector<Rect>& rects);
+
+    uint64_t GetVersion() const { return version_; }
+    size_t Size() const { return posX_.size(); }
+    bool Empty() const { return posX_.empty(); }
+    Rect GetRect(size_t index) const { return { posX_[index], posY_[index], width_[index], height_[index] }; }
+    const std::vector<int32_t>& GetPosX() const { return posX_; }
+    const std::vector<int32_t>& GetPosY() const { return posY_; }
+    const std::vector<uint32_t>& GetWidth() const { return width_; }
+    const std::vector<uint32_t>& GetHeight() const { return height_; }
+    std::vector<Rect> ToRects() const;
+
+private:
+    explicit HotAreaBuffer(uint64_t version) : version_(version) {}
+
+    const uint64_t version_;
+    std::vector<int32_t> posX_;
+    std::vector<int32_t> posY_;
+    std::vector<uint32_t> width_;
+    std::vector<uint32_t> height_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_HOT_AREA_BUFFER_H
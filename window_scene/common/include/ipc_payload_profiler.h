@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_IPC_PAYLOAD_PROFILER_H
+#define OHOS_ROSEN_WINDOW_SCENE_IPC_PAYLOAD_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <message_parcel.h>
+
+#include "common/include/latency_histogram.h"
+#include "wm_single_instance.h"
+
+namespace OHOS::Rosen {
+/**
+ * @brief Side of the transaction an IPC payload is recorded on.
+ */
+enum class IpcSide : uint32_t {
+    PROXY = 0,
+    STUB,
+    SIDE_END,
+};
+
+/**
+ * @brief Calls, parcel bytes and latency per interface and transaction code.
+ *
+ * The proxies and stubs record into it only when built with WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER,
+ * see window_manager_feature_ipc_payload_profiler. The proxy side latency is the round trip, the stub side
+ * latency is the handling time. The stubs with an IpcLatencyScope record through LatencyHistogramManager.
+ */
+class IpcPayloadProfiler {
+WM_DECLARE_SINGLE_INSTANCE(IpcPayloadProfiler)
+public:
+    // codes beyond this number of entries per side are counted under OVERFLOW_CODE
+    static constexpr size_t MAX_STATS_NUM_PER_SIDE = 1024;
+    static constexpr uint32_t OVERFLOW_CODE = UINT32_MAX;
+
+    struct Snapshot {
+        uint64_t count_ = 0;
+        uint64_t requestBytes_ = 0;
+        uint64_t replyBytes_ = 0;
+        uint64_t maxRequestBytes_ = 0;
+        uint64_t maxReplyBytes_ = 0;
+        LatencyHistogram::Snapshot latency_;
+    };
+
+    /**
+     * @param interfaceName Name with static storage, only the view is kept.
+     */
+    void Record(IpcSide side, std::string_view interfaceName, uint32_t code, size_t requestBytes, size_t replyBytes,
+        int64_t latencyUs);
+    bool GetSnapshot(IpcSide side, std::string_view interfaceName, uint32_t code, Snapshot& snapshot);
+
+    /**
+     * @brief Dump the codes whose interface name contains nameFilter, the most bytes first.
+     */
+    void Dump(std::ostringstream& oss, const std::string& nameFilter = "");
+    void DumpCsv(std::ostringstream& oss);
+    void Reset();
+
+    /**
+     * @brief Hidumper entry, params are "reset", "csv" or an interface name filter.
+     */
+    void DumpInfo(const std::vector<std::string>& params, std::string& dumpInfo);
+
+private:
+    struct Stats {
+        std::atomic<uint64_t> count_ { 0 };
+        std::atomic<uint64_t> requestBytes_ { 0 };
+        std::atomic<uint64_t> replyBytes_ { 0 };
+        std::atomic<uint64_t> maxRequestBytes_ { 0 };
+        std::atomic<uint64_t> maxReplyBytes_ { 0 };
+        LatencyHistogram latency_;
+
+        Snapshot GetSnapshot() const;
+    };
+    using StatsKey = std::pair<std::string_view, uint32_t>;
+    using SnapshotList = std::vector<std::pair<StatsKey, Snapshot>>;
+
+    Stats* GetOrCreateStats(IpcSide side, std::string_view interfaceName, uint32_t code);
+    SnapshotList GetSortedSnapshots(IpcSide side, const std::string& nameFilter);
+
+    std::shared_mutex statsMutex_;
+    std::array<std::map<StatsKey, std::unique_ptr<Stats>>, static_cast<size_t>(IpcSide::SIDE_END)> statsMaps_;
+};
+
+/**
+ * @brief Record the parcel sizes and the elapsed time of its scope, the reply is measured when it ends.
+ */
+class IpcPayloadScope {
+public:
+    IpcPayloadScope(IpcSide side, std::string_view interfaceName, uint32_t code, const MessageParcel& data,
+        const MessageParcel& reply)
+        : side_(side), interfaceName_(interfaceName), code_(code), data_(data), reply_(reply),
+          startTimeUs_(TimeUtil::GetCurrentTimeUs()) {}
+    ~IpcPayloadScope()
+    {
+        IpcPayloadProfiler::GetInstance().Record(side_, interfaceName_, code_, data_.GetDataSize(),
+            reply_.GetDataSize(), TimeUtil::GetCurrentTimeUs() - startTimeUs_);
+    }
+
+private:
+    IpcSide side_;
+    std::string_view interfaceName_;
+    uint32_t code_;
+    const MessageParcel& data_;
+    const MessageParcel& reply_;
+    int64_t startTimeUs_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_IPC_PAYLOAD_PROFILER_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_LATENCY_HISTOGRAM_H
+#define OHOS_ROSEN_WINDOW_SCENE_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <message_parcel.h>
+
+#include "time_util.h"
+#include "wm_single_instance.h"
+
+namespace OHOS::Rosen {
+/**
+ * @brief Category of latency histogram
+ */
+enum class LatencyCategory : uint32_t {
+    TASK_WAIT = 0,
+    TASK_RUN,
+    IPC,
+    CATEGORY_END,
+};
+
+/**
+ * @brief Log-linear latency histogram in microseconds.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t MAX_EXPONENT = 27; // about 134s, larger value goes to the last bucket
+    static constexpr uint32_t SUB_BUCKET_NUM = 2;
+    // bucket 0 is for 0us, bucket 1 is for 1us, each larger power of two has SUB_BUCKET_NUM buckets
+    static constexpr uint32_t BUCKET_NUM = 2 + (MAX_EXPONENT - 1) * SUB_BUCKET_NUM;
+    // counters are striped over SHARD_NUM shards, threads take the shards in turn when they first record
+    static constexpr uint32_t SHARD_NUM = 4;
+
+    struct Snapshot {
+        uint64_t count_ = 0;
+        uint64_t sumUs_ = 0;
+        uint64_t maxUs_ = 0;
+        std::array<uint64_t, BUCKET_NUM> buckets_ = {};
+
+        /**
+         * @brief Get the upper bound of the bucket which contains the percentile.
+         *
+         * @param percentile The percentile in [0, 100].
+         */
+        uint64_t GetPercentile(double percentile) const;
+    };
+
+    void Record(int64_t valueUs);
+    void Reset();
+    Snapshot GetSnapshot() const;
+
+    static uint32_t GetBucketIndex(uint64_t valueUs);
+    static uint64_t GetBucketLowerBound(uint32_t index);
+
+private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<uint64_t>, BUCKET_NUM> buckets_ = {};
+        std::atomic<uint64_t> count_ { 0 };
+        std::atomic<uint64_t> sumUs_ { 0 };
+        std::atomic<uint64_t> maxUs_ { 0 };
+    };
+    std::array<Shard, SHARD_NUM> shards_;
+};
+
+class LatencyHistogramManager {
+WM_DECLARE_SINGLE_INSTANCE(LatencyHistogramManager)
+public:
+    void Record(LatencyCategory category, const std::string& name, int64_t valueUs);
+    void RecordIpc(const char* interfaceName, uint32_t code, int64_t valueUs);
+    /**
+     * @brief Record a handled transaction, the parcel sizes go to the IPC payload profiler when it is built in.
+     */
+    void RecordIpc(const char* interfaceName, uint32_t code, int64_t valueUs, size_t requestBytes,
+        size_t replyBytes);
+    /**
+     * @brief Get the histogram of a transaction code, the histogram lives as long as the manager.
+     */
+    LatencyHistogram* GetIpcHistogram(const char* interfaceName, uint32_t code);
+
+    /**
+     * @brief Dump the histograms whose name contains nameFilter, dump all when nameFilter is empty.
+     */
+    void Dump(std::ostringstream& oss, const std::string& nameFilter = "");
+    void Reset();
+
+private:
+    LatencyHistogram* GetOrCreateHistogram(LatencyCategory category, const std::string& name);
+
+    std::shared_mutex histogramMutex_;
+    std::array<std::unordered_map<std::string, std::unique_ptr<LatencyHistogram>>,
+        static_cast<size_t>(LatencyCategory::CATEGORY_END)> histogramMaps_;
+};
+
+/**
+ * @brief Histograms of one stub indexed by transaction code, each one is resolved by name only once.
+ *
+ * Codes not less than MAX_CODE_NUM fall back to LatencyHistogramManager::RecordIpc.
+ */
+class IpcLatencyTable {
+public:
+    static constexpr uint32_t MAX_CODE_NUM = 4096;
+
+    explicit IpcLatencyTable(const char* interfaceName);
+    void Record(uint32_t code, int64_t valueUs, size_t requestBytes, size_t replyBytes);
+
+private:
+    const char* interfaceName_;
+    std::unique_ptr<std::atomic<LatencyHistogram*>[]> histograms_;
+};
+
+/**
+ * @brief Record the elapsed time and the parcel sizes of a stub transaction, the reply is measured when it ends.
+ */
+class IpcLatencyScope {
+public:
+    IpcLatencyScope(IpcLatencyTable& table, uint32_t code, const MessageParcel& data, const MessageParcel& reply)
+        : table_(table), code_(code), data_(data), reply_(reply), startTimeUs_(TimeUtil::GetCurrentTimeUs()) {}
+    ~IpcLatencyScope()
+    {
+        table_.Record(code_, TimeUtil::GetCurrentTimeUs() - startTimeUs_, data_.GetDataSize(), reply_.GetDataSize());
+    }
+
+private:
+    IpcLatencyTable& table_;
+    uint32_t code_;
+    const MessageParcel& data_;
+    const MessageParcel& reply_;
+    int64_t startTimeUs_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_LATENCY_HISTOGRAM_H
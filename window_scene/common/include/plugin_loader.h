@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_PLUGIN_LOADER_H
+#define OHOS_ROSEN_WINDOW_SCENE_PLUGIN_LOADER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "time_util.h"
+#include "wm_single_instance.h"
+
+namespace OHOS::Rosen {
+class TaskScheduler;
+
+class PluginLoader {
+WM_DECLARE_SINGLE_INSTANCE(PluginLoader)
+public:
+    static constexpr uint32_t DEFAULT_RETRY_TIMES = 3;
+    static constexpr uint32_t DEFAULT_WAIT_TIMEOUT_MS = 3000;
+
+    /**
+     * @brief dlopen with retry, only sleeps before retrying a failed attempt.
+     */
+    static void* OpenLibrary(const std::string& path, int32_t flags, uint32_t retryTimes = DEFAULT_RETRY_TIMES);
+
+    /**
+     * @brief dlsym with retry, only sleeps before retrying a failed attempt.
+     */
+    static void* LoadSymbol(void* handle, const char* symbolName, uint32_t retryTimes = DEFAULT_RETRY_TIMES);
+
+    /**
+     * @brief Post loadFunc to taskScheduler, so the plugin is loaded in parallel with the caller.
+     */
+    void LoadAsync(const std::string& pluginName, std::function<bool()>&& loadFunc,
+        const std::shared_ptr<TaskScheduler>& taskScheduler);
+
+    /**
+     * @brief Wait for the plugin posted by LoadAsync, a load that has not started runs on the calling thread.
+     *
+     * @return false if loading failed or timed out, true if it succeeded or was never posted.
+     * Globals written by loadFunc must not be touched when it returns false.
+     */
+    bool WaitLoaded(const std::string& pluginName, uint32_t timeoutMs = DEFAULT_WAIT_TIMEOUT_MS);
+
+    void RecordStartupPhase(const std::string& phaseName, int64_t startTimeUs, int64_t endTimeUs);
+    void DumpStartupTimeline(std::string& dumpInfo);
+
+private:
+    enum class LoadStatus : uint32_t {
+        PENDING,
+        LOADING,
+        DONE,
+    };
+
+    struct LoadState {
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::function<bool()> loadFunc_;
+        LoadStatus status_ = LoadStatus::PENDING;
+        bool result_ = false;
+    };
+
+    void RunLoad(const std::string& pluginName, const std::shared_ptr<LoadState>& loadState);
+
+    struct StartupPhase {
+        std::string name_;
+        int64_t startTimeUs_ = 0;
+        int64_t endTimeUs_ = 0;
+    };
+
+    std::mutex loadStateMutex_;
+    std::unordered_map<std::string, std::shared_ptr<LoadState>> loadStates_;
+    std::mutex timelineMutex_;
+    std::vector<StartupPhase> timeline_;
+};
+
+/**
+ * @brief Record the duration of its scope as a startup phase.
+ */
+class StartupPhaseScope {
+public:
+    explicit StartupPhaseScope(const std::string& phaseName)
+        : phaseName_(phaseName), startTimeUs_(TimeUtil::GetCurrentTimeUs()) {}
+    ~StartupPhaseScope()
+    {
+        PluginLoader::GetInstance().RecordStartupPhase(phaseName_, startTimeUs_, TimeUtil::GetCurrentTimeUs());
+    }
+
+private:
+    std::string phaseName_;
+    int64_t startTimeUs_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_PLUGIN_LOADER_H
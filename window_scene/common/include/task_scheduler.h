@@ -16,17 +16,177 @@
 #ifndef OHOS_ROSEN_WINDOW_SCENE_TASK_SCHEDULER_H
 #define OHOS_ROSEN_WINDOW_SCENE_TASK_SCHEDULER_H
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <event_handler.h>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <type_traits>
+#include <vector>
 
 #include <unistd.h>
+#include "time_util.h"
 #include "window_manager_hilog.h"
 
 namespace OHOS::Rosen {
 
 void StartTraceForSyncTask(const std::string& name);
 void FinishTraceForSyncTask();
+void RecordTaskLatency(const std::string& name, int64_t postTimeUs, int64_t startTimeUs);
 
-class TaskScheduler {
+/**
+ * @brief Lane of a task, lanes take effect only when lane mode is enabled.
+ *
+ * Async tasks of INPUT_CRITICAL are posted with VIP priority and async tasks of BACKGROUND with LOW priority,
+ * so they may run before or after tasks posted earlier. LAYOUT tasks, sync tasks of any lane and tasks without
+ * a lane stay in the IMMEDIATE queue and run in the order they are posted. Callers which rely on earlier tasks,
+ * e.g. focus requests which need the lifecycle tasks posted before them, must use LAYOUT.
+ */
+enum class TaskLane : uint32_t {
+    INPUT_CRITICAL = 0,
+    LAYOUT,
+    BACKGROUND,
+    LANE_END,
+};
+
+/**
+ * @brief Task name interned once, the queue and trace names are built at the same time.
+ */
+class TaskName {
+public:
+    TaskName(const std::string& name, uint32_t id);
+
+    /**
+     * @brief Get the interned name, same name always returns the same object which is never released.
+     */
+    static const TaskName& Intern(const char* name);
+
+    const std::string& GetName() const { return name_; }
+    const std::string& GetQueueName() const { return queueName_; }
+    const std::string& GetTraceName() const { return traceName_; }
+    uint32_t GetId() const { return id_; }
+
+private:
+    std::string name_;
+    std::string queueName_;
+    std::string traceName_;
+    uint32_t id_;
+};
+
+/*
+ * Intern the task name once per call site, name must be the same on every call, e.g. a literal or __func__.
+ */
+#define WMS_TASK_NAME(name)                                                                             \
+    ([](const char* taskName) -> const ::OHOS::Rosen::TaskName& {                                      \
+        static const ::OHOS::Rosen::TaskName& internedName = ::OHOS::Rosen::TaskName::Intern(taskName); \
+        return internedName;                                                                            \
+    }(name))
+
+/**
+ * @brief Move-only callable, stores small callables inline to avoid heap allocation.
+ */
+class TaskFunctor {
+public:
+    static constexpr size_t INLINE_SIZE = 64;
+
+    TaskFunctor() = default;
+    template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, TaskFunctor>>>
+    TaskFunctor(Func&& func) // NOLINT: implicit conversion like std::function
+    {
+        using FuncType = std::decay_t<Func>;
+        if constexpr (IsInline<FuncType>()) {
+            new (storage_) FuncType(std::forward<Func>(func));
+            ops_ = &InlineOps<FuncType>::OPS;
+        } else {
+            *reinterpret_cast<FuncType**>(storage_) = new FuncType(std::forward<Func>(func));
+            ops_ = &HeapOps<FuncType>::OPS;
+        }
+    }
+    TaskFunctor(TaskFunctor&& other) noexcept { MoveFrom(other); }
+    TaskFunctor& operator=(TaskFunctor&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+    TaskFunctor(const TaskFunctor&) = delete;
+    TaskFunctor& operator=(const TaskFunctor&) = delete;
+    ~TaskFunctor() { Reset(); }
+
+    void operator()()
+    {
+        if (ops_ != nullptr) {
+            ops_->invoke(storage_);
+        }
+    }
+    explicit operator bool() const { return ops_ != nullptr; }
+    bool IsStoredInline() const { return ops_ != nullptr && ops_->isInline; }
+    void Reset()
+    {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+        bool isInline;
+    };
+
+    template<typename FuncType>
+    static constexpr bool IsInline()
+    {
+        return sizeof(FuncType) <= INLINE_SIZE && alignof(FuncType) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<FuncType>;
+    }
+
+    template<typename FuncType>
+    struct InlineOps {
+        static void Invoke(void* storage) { (*static_cast<FuncType*>(storage))(); }
+        static void Move(void* dst, void* src)
+        {
+            new (dst) FuncType(std::move(*static_cast<FuncType*>(src)));
+            static_cast<FuncType*>(src)->~FuncType();
+        }
+        static void Destroy(void* storage) { static_cast<FuncType*>(storage)->~FuncType(); }
+        static constexpr Ops OPS = { Invoke, Move, Destroy, true };
+    };
+
+    template<typename FuncType>
+    struct HeapOps {
+        static void Invoke(void* storage) { (**static_cast<FuncType**>(storage))(); }
+        static void Move(void* dst, void* src) { *static_cast<FuncType**>(dst) = *static_cast<FuncType**>(src); }
+        static void Destroy(void* storage) { delete *static_cast<FuncType**>(storage); }
+        static constexpr Ops OPS = { Invoke, Move, Destroy, false };
+    };
+
+    void MoveFrom(TaskFunctor& other) noexcept
+    {
+        if (other.ops_ != nullptr) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[INLINE_SIZE];
+    const Ops* ops_ = nullptr;
+};
+
+/*
+ * Pooled tasks only run while the scheduler is alive, a scheduler not owned by std::shared_ptr
+ * posts them as std::function instead.
+ */
+class TaskScheduler : public std::enable_shared_from_this<TaskScheduler> {
 public:
     explicit TaskScheduler(const std::string& threadName);
     virtual ~TaskScheduler() = default;
@@ -37,7 +197,40 @@ public:
     virtual void PostAsyncTaskToExportHandler(Task&& task, const std::string& name, int64_t delayTime = 0);
     virtual void PostAsyncTask(Task&& task, const std::string& name, int64_t delayTime = 0);
     void PostTask(Task&& task, const std::string& name, int64_t delayTime = 0);
+    /*
+     * Post task with the priority of its lane and count it in the lane,
+     * the same as PostAsyncTask when lane mode is disabled.
+     */
+    void PostLaneTask(Task&& task, const std::string& name, TaskLane lane, int64_t delayTime = 0);
+    void SetLaneModeEnabled(bool enabled);
+    bool IsLaneModeEnabled() const;
+    uint32_t GetLaneQueueDepth(TaskLane lane) const;
+    void DumpLaneInfo(std::ostringstream& oss) const;
     void RemoveTask(const std::string& name);
+
+    /*
+     * Post task with interned name, the task and its bookkeeping are kept in a pooled slot,
+     * so posting does not allocate in the scheduler when the task fits TaskFunctor::INLINE_SIZE.
+     */
+    template<typename Func>
+    void PostAsyncTask(Func&& func, const TaskName& taskName, TaskLane lane = TaskLane::LAYOUT,
+        int64_t delayTime = 0)
+    {
+        if (delayTime == 0 && handler_->GetEventRunner()->IsCurrentRunnerThread()) {
+            StartTraceForTask(taskName);
+            func();
+            FinishTraceForSyncTask();
+            return;
+        }
+        TaskSlot* slot = taskSlotPool_->Acquire(*this);
+        if (slot == nullptr) {
+            PostLaneTask(MakeTask(std::forward<Func>(func)), taskName.GetName(), lane, delayTime);
+            return;
+        }
+        slot->task_ = TaskFunctor(std::forward<Func>(func));
+        PostTaskSlot(slot, taskName, lane, delayTime);
+    }
+    void RemoveTask(const TaskName& taskName);
     virtual void PostVoidSyncTask(Task&& task, const std::string& name = "ssmTask");
     template<typename SyncTask, typename Return = std::invoke_result_t<SyncTask>>
     Return PostSyncTask(SyncTask&& task, const std::string& name = "ssmTask")
@@ -49,10 +242,12 @@ public:
             FinishTraceForSyncTask();
             return ret;
         }
-        auto syncTask = [this, &ret, &task, &name] {
+        auto syncTask = [this, &ret, &task, &name, postTimeUs = TimeUtil::GetCurrentTimeUs()] {
+            int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
             StartTraceForSyncTask(name);
             ret = task();
             FinishTraceForSyncTask();
+            RecordTaskLatency(name, postTimeUs, startTimeUs);
             ExecuteExportTask();
         };
         AppExecFwk::EventQueue::Priority priority = AppExecFwk::EventQueue::Priority::IMMEDIATE;
@@ -67,6 +262,32 @@ public:
         return ret;
     }
 
+    /*
+     * Post sync task and count it in its lane, the same as PostSyncTask when lane mode is disabled.
+     * Sync tasks keep post order in every lane.
+     */
+    template<typename SyncTask, typename Return = std::invoke_result_t<SyncTask>>
+    Return PostSyncTask(SyncTask&& task, const std::string& name, TaskLane lane)
+    {
+        if (lane >= TaskLane::LANE_END || !IsLaneModeEnabled() ||
+            handler_->GetEventRunner()->IsCurrentRunnerThread()) {
+            return PostSyncTask(std::forward<SyncTask>(task), name);
+        }
+        auto laneIndex = static_cast<size_t>(lane);
+        EnterLaneQueue(laneIndex);
+        bool isLeft = false;
+        int64_t postTimeUs = TimeUtil::GetCurrentTimeUs();
+        Return ret = PostSyncTask([this, &task, &isLeft, laneIndex, postTimeUs] {
+            isLeft = true;
+            LeaveLaneQueue(laneIndex, postTimeUs);
+            return task();
+        }, name);
+        if (!isLeft) {
+            LeaveLaneQueue(laneIndex, -1);
+        }
+        return ret;
+    }
+
     void SetExportHandler(const std::shared_ptr<AppExecFwk::EventHandler>& handler);
     /*
      * Add export task, which will be executed after a task OS_SceneSession,
@@ -75,8 +296,81 @@ public:
     void AddExportTask(std::string taskName, Task&& task);
 
 private:
+    class TaskSlotPool;
+
+    struct TaskSlot {
+        TaskFunctor task_;
+        const TaskName* taskName_ = nullptr;
+        int64_t postTimeUs_ = 0;
+        TaskLane lane_ = TaskLane::LAYOUT;
+        bool isInLaneQueue_ = false;
+        std::atomic<uint32_t> refCount_ { 0 };
+        // keeps the pool alive while the slot is in use, the event queue may outlive the scheduler
+        std::shared_ptr<TaskSlotPool> pool_;
+        TaskSlot* next_ = nullptr;
+    };
+
+    class TaskSlotPool : public std::enable_shared_from_this<TaskSlotPool> {
+    public:
+        // returns nullptr when the scheduler is not owned by std::shared_ptr
+        TaskSlot* Acquire(TaskScheduler& scheduler);
+        static void Release(TaskSlot* slot);
+        std::shared_ptr<TaskScheduler> LockOwner();
+
+    private:
+        std::mutex mutex_;
+        std::weak_ptr<TaskScheduler> owner_;
+        TaskSlot* freeTaskSlot_ = nullptr;
+        std::vector<std::unique_ptr<TaskSlot[]>> taskSlotChunks_;
+    };
+
+    /*
+     * Refcounted handle posted to the event handler, small enough for the inline buffer of std::function.
+     */
+    class TaskSlotRef {
+    public:
+        explicit TaskSlotRef(TaskSlot* slot) noexcept;
+        TaskSlotRef(const TaskSlotRef& other) noexcept;
+        TaskSlotRef& operator=(const TaskSlotRef&) = delete;
+        ~TaskSlotRef();
+        void operator()() const;
+
+    private:
+        TaskSlot* slot_;
+    };
+
+    template<typename Func>
+    static Task MakeTask(Func&& func)
+    {
+        using FuncType = std::decay_t<Func>;
+        if constexpr (std::is_copy_constructible_v<FuncType>) {
+            return Task(std::forward<Func>(func));
+        } else {
+            auto sharedFunc = std::make_shared<FuncType>(std::forward<Func>(func));
+            return [sharedFunc] { (*sharedFunc)(); };
+        }
+    }
+
+    void PostTaskSlot(TaskSlot* slot, const TaskName& taskName, TaskLane lane, int64_t delayTime);
+    void RunTaskSlot(TaskSlot* slot);
+    void EnterLaneQueue(size_t laneIndex);
+    void LeaveLaneQueue(TaskSlot* slot);
+    // postTimeUs is negative when the task is dropped without running
+    void LeaveLaneQueue(size_t laneIndex, int64_t postTimeUs);
+    static void StartTraceForTask(const TaskName& taskName);
+
+    std::shared_ptr<TaskSlotPool> taskSlotPool_ = std::make_shared<TaskSlotPool>();
+
+    struct LaneStat {
+        std::atomic<uint32_t> queueDepth_ { 0 };
+        std::atomic<uint32_t> maxQueueDepth_ { 0 };
+        std::atomic<uint64_t> postCount_ { 0 };
+    };
+
     std::unordered_map<std::string, Task> exportFuncMap_; // ONLY Accessed in OS_SceneSession
     std::shared_ptr<AppExecFwk::EventHandler> exportHandler_;
+    std::atomic<bool> isLaneModeEnabled_ { false };
+    std::array<LaneStat, static_cast<size_t>(TaskLane::LANE_END)> laneStats_;
 
 protected:
     void ExecuteExportTask();
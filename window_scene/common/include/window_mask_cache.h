@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_WINDOW_MASK_CACHE_H
+#define OHOS_ROSEN_WINDOW_SCENE_WINDOW_MASK_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "pixel_map.h"
+#include "wm_single_instance.h"
+
+namespace OHOS::Rosen {
+/**
+ * @brief Window masks interned by content.
+ *
+ * A mask set again with the same pixels gets back the instance already held, so the input flush, which compares
+ * the masks of two flushes by instance, sees it unchanged. Windows with the same shape share one instance.
+ * Only weak references are kept, a mask goes away with the last window using it.
+ * The pixels are only hashed once another mask of the same size and format is interned, so a new mask of a new
+ * shape costs no pass over its buffer.
+ */
+class WindowMaskCache {
+WM_DECLARE_SINGLE_INSTANCE(WindowMaskCache)
+public:
+    std::shared_ptr<Media::PixelMap> Intern(const std::shared_ptr<Media::PixelMap>& mask);
+    size_t Size();
+
+    static uint64_t HashLayout(const Media::PixelMap& mask);
+    static uint64_t HashContent(const Media::PixelMap& mask);
+    static bool IsSameLayout(const Media::PixelMap& left, const Media::PixelMap& right);
+    static bool IsSameContent(const Media::PixelMap& left, const Media::PixelMap& right);
+
+private:
+    struct MaskEntry {
+        std::weak_ptr<Media::PixelMap> mask_;
+        uint64_t contentHash_ = 0;
+        bool hasContentHash_ = false;
+    };
+
+    void PruneLocked();
+
+    std::mutex mutex_;
+    // layout hash -> masks with that layout
+    std::unordered_multimap<uint64_t, MaskEntry> masks_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_WINDOW_MASK_CACHE_H
@@ -16,10 +16,12 @@
 #ifndef OHOS_ROSEN_WINDOW_SESSION_PROPERTY_H
 #define OHOS_ROSEN_WINDOW_SESSION_PROPERTY_H
 
+#include <array>
 #include <refbase.h>
 #include <string>
 #include <unordered_map>
 #include <parcel.h>
+#include "common/include/hot_area_buffer.h"
 #include "interfaces/include/ws_common.h"
 #include "interfaces/include/ws_common_inner.h"
 #include "wm_common.h"
@@ -188,6 +190,13 @@ public:
     bool IsFloatingWindowAppType() const;
     void GetTouchHotAreas(std::vector<Rect>& rects) const;
     KeyboardTouchHotAreas GetKeyboardTouchHotAreas() const;
+
+    /**
+     * @brief Borrow the touch hot areas without copying, the buffer is replaced once the hot areas change.
+     */
+    HotAreaBufferPtr GetTouchHotAreaBuffer() const;
+    HotAreaBufferPtr GetKeyboardHotAreaBuffer(bool isPanel, bool isLandscape) const;
+    DisplayId GetKeyboardTouchHotAreasDisplayId() const;
     bool GetKeepKeyboardFlag() const;
     uint32_t GetCallingSessionId() const;
     PiPTemplateInfo GetPiPTemplateInfo() const;
@@ -462,7 +471,7 @@ public:
     bool GetDockHoverShowEnabled() const;
 
 private:
-    void setTouchHotAreasInner(const std::vector<Rect>& rects, std::vector<Rect>& touchHotAreas);
+    bool setTouchHotAreasInner(const std::vector<Rect>& rects, std::vector<Rect>& touchHotAreas);
     bool MarshallingTouchHotAreasInner(const std::vector<Rect>& touchHotAreas, Parcel& parcel) const;
     bool MarshallingTouchHotAreas(Parcel& parcel) const;
     bool MarshallingKeyboardTouchHotAreas(Parcel& parcel) const;
@@ -603,6 +612,10 @@ private:
     mutable std::mutex keyboardParamsMutex_;
     std::vector<Rect> touchHotAreas_;  // coordinates relative to window.
     KeyboardTouchHotAreas keyboardTouchHotAreas_;  // coordinates relative to window.
+    // built on first borrow and reset when the hot areas change, guarded by touchHotAreasMutex_
+    mutable HotAreaBufferPtr touchHotAreaBuffer_;
+    // landscape keyboard, portrait keyboard, landscape panel, portrait panel
+    mutable std::array<HotAreaBufferPtr, 4> keyboardHotAreaBuffers_;
     bool hideNonSystemFloatingWindows_ = false;
     bool isSkipSelfWhenShowOnVirtualScreen_ = false;
     bool isSkipEventOnCastPlus_ = false;
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/include/extension_data_channel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <iterator>
+#include <new>
+#include <sys/mman.h>
+
+#include <securec.h>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen::Extension {
+struct DataChannelHeader {
+    uint32_t magic;
+    uint32_t capacity;
+    // written by the receiver, read by the sender
+    std::atomic<uint64_t> consumed;
+};
+
+namespace {
+constexpr uint32_t DATA_CHANNEL_MAGIC = 0x55454443; // "UEDC"
+// the payloads start on their own cache line
+constexpr size_t DATA_OFFSET = 64;
+static_assert(sizeof(DataChannelHeader) <= DATA_OFFSET, "header overlaps the payloads");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "the consumed position is shared between processes");
+// payloads consumed ahead of the first pending one, a peer sending more is not trusted
+constexpr size_t MAX_COMPLETED_RANGE_NUM = 256;
+
+void* MapMemory(const sptr<Ashmem>& ashmem, size_t size)
+{
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, ashmem->GetAshmemFd(), 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+}
+} // namespace
+
+std::shared_ptr<DataChannel> DataChannel::Create(uint32_t capacity)
+{
+    if (capacity == 0 || capacity > INT32_MAX - DATA_OFFSET) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "invalid capacity: %{public}u", capacity);
+        return nullptr;
+    }
+    size_t memorySize = DATA_OFFSET + capacity;
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem("uiext_data_channel", static_cast<int32_t>(memorySize));
+    if (ashmem == nullptr) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "create ashmem failed, capacity: %{public}u", capacity);
+        return nullptr;
+    }
+    void* memory = MapMemory(ashmem, memorySize);
+    if (memory == nullptr) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "map failed, capacity: %{public}u", capacity);
+        return nullptr;
+    }
+    auto header = new (memory) DataChannelHeader();
+    header->magic = DATA_CHANNEL_MAGIC;
+    header->capacity = capacity;
+    header->consumed.store(0, std::memory_order_release);
+    return std::shared_ptr<DataChannel>(new DataChannel(ashmem, memory, memorySize));
+}
+
+std::shared_ptr<DataChannel> DataChannel::Map(const sptr<Ashmem>& ashmem)
+{
+    if (ashmem == nullptr) {
+        return nullptr;
+    }
+    int32_t ashmemSize = ashmem->GetAshmemSize();
+    if (ashmemSize <= static_cast<int32_t>(DATA_OFFSET)) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "invalid size: %{public}d", ashmemSize);
+        return nullptr;
+    }
+    size_t memorySize = static_cast<size_t>(ashmemSize);
+    void* memory = MapMemory(ashmem, memorySize);
+    if (memory == nullptr) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "map failed, size: %{public}d", ashmemSize);
+        return nullptr;
+    }
+    auto header = static_cast<DataChannelHeader*>(memory);
+    if (header->magic != DATA_CHANNEL_MAGIC || header->capacity != memorySize - DATA_OFFSET) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "invalid header, size: %{public}d", ashmemSize);
+        munmap(memory, memorySize);
+        return nullptr;
+    }
+    auto channel = std::shared_ptr<DataChannel>(new DataChannel(ashmem, memory, memorySize));
+    channel->readPos_ = header->consumed.load(std::memory_order_acquire);
+    return channel;
+}
+
+DataChannel::DataChannel(const sptr<Ashmem>& ashmem, void* memory, size_t memorySize)
+    : ashmem_(ashmem), memory_(memory), memorySize_(memorySize)
+{
+    header_ = static_cast<DataChannelHeader*>(memory_);
+    data_ = static_cast<uint8_t*>(memory_) + DATA_OFFSET;
+    capacity_ = static_cast<uint32_t>(memorySize_ - DATA_OFFSET);
+}
+
+DataChannel::~DataChannel()
+{
+    if (memory_ != nullptr) {
+        munmap(memory_, memorySize_);
+    }
+}
+
+bool DataChannel::Write(const void* data, uint32_t length, DataChannelRange& range)
+{
+    if (data == nullptr || length == 0 || length > capacity_) {
+        return false;
+    }
+    std::lock_guard lock(writeMutex_);
+    if (isBroken_) {
+        return false;
+    }
+    uint64_t consumed = header_->consumed.load(std::memory_order_acquire);
+    uint64_t used = writePos_ - consumed;
+    uint64_t offset = writePos_ % capacity_;
+    // a payload never wraps, the tail of the ring is skipped instead
+    uint64_t padding = offset + length > capacity_ ? capacity_ - offset : 0;
+    if (used + padding + length > capacity_) {
+        TLOGD(WmsLogTag::WMS_UIEXT, "ring full, used: %{public}" PRIu64 ", length: %{public}u", used, length);
+        return false;
+    }
+    range.begin = writePos_;
+    range.end = writePos_ + padding + length;
+    range.length = length;
+    uint64_t dataOffset = (range.end - length) % capacity_;
+    if (memcpy_s(data_ + dataOffset, capacity_ - dataOffset, data, length) != EOK) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "copy failed, length: %{public}u", length);
+        return false;
+    }
+    writePos_ = range.end;
+    return true;
+}
+
+void DataChannel::Cancel(const DataChannelRange& range)
+{
+    std::lock_guard lock(writeMutex_);
+    if (header_->consumed.load(std::memory_order_acquire) >= range.end) {
+        return;
+    }
+    if (writePos_ == range.end) {
+        writePos_ = range.begin;
+        return;
+    }
+    // the space of a lost payload in the middle is never consumed, stop using the ring
+    TLOGW(WmsLogTag::WMS_UIEXT, "payload lost, begin: %{public}" PRIu64 ", end: %{public}" PRIu64,
+          range.begin, range.end);
+    isBroken_ = true;
+}
+
+bool DataChannel::IsValidRange(const DataChannelRange& range) const
+{
+    if (range.end <= range.begin || range.end - range.begin > capacity_ || range.length == 0 ||
+        range.length > range.end - range.begin) {
+        return false;
+    }
+    uint64_t dataOffset = (range.end - range.length) % capacity_;
+    return dataOffset + range.length <= capacity_;
+}
+
+bool DataChannel::Read(const DataChannelRange& range, Parcel& parcel) const
+{
+    if (!IsValidRange(range)) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "invalid range, begin: %{public}" PRIu64 ", end: %{public}" PRIu64
+              ", length: %{public}u", range.begin, range.end, range.length);
+        return false;
+    }
+    uint64_t dataOffset = (range.end - range.length) % capacity_;
+    return parcel.SetMaxCapacity(std::max(parcel.GetMaxCapacity(), static_cast<size_t>(range.length))) &&
+           parcel.WriteBuffer(data_ + dataOffset, range.length);
+}
+
+void DataChannel::Complete(const DataChannelRange& range)
+{
+    if (!IsValidRange(range)) {
+        return;
+    }
+    std::lock_guard lock(readMutex_);
+    // the sender never writes more than one ring ahead of the consumed position
+    if (range.begin < readPos_ || range.end - readPos_ > capacity_) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "range out of ring, begin: %{public}" PRIu64 ", end: %{public}" PRIu64
+              ", readPos: %{public}" PRIu64, range.begin, range.end, readPos_);
+        return;
+    }
+    auto next = completedRanges_.lower_bound(range.begin);
+    bool isOverlapped = (next != completedRanges_.end() && next->first < range.end) ||
+        (next != completedRanges_.begin() && std::prev(next)->second > range.begin);
+    if (isOverlapped || completedRanges_.size() >= MAX_COMPLETED_RANGE_NUM) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "range rejected, begin: %{public}" PRIu64 ", overlapped: %{public}d, "
+              "completed: %{public}zu", range.begin, isOverlapped, completedRanges_.size());
+        return;
+    }
+    completedRanges_.emplace_hint(next, range.begin, range.end);
+    // the payloads may be consumed out of order, only the contiguous prefix is given back
+    while (!completedRanges_.empty() && completedRanges_.begin()->first == readPos_) {
+        readPos_ = completedRanges_.begin()->second;
+        completedRanges_.erase(completedRanges_.begin());
+    }
+    header_->consumed.store(readPos_, std::memory_order_release);
+}
+}  // namespace OHOS::Rosen::Extension
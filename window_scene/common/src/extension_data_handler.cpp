@@ -15,6 +15,7 @@
 
 #include "common/include/extension_data_handler.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include <hitrace_meter.h>
@@ -26,11 +27,17 @@
 #include "window_manager_hilog.h"
 
 namespace OHOS::Rosen::Extension {
+namespace {
+// smaller wants are cheaper to copy through the parcel than to stage in the channel
+constexpr uint32_t DATA_CHANNEL_THRESHOLD = 64 * 1024;
+constexpr uint32_t DATA_CHANNEL_CAPACITY = 4 * 1024 * 1024;
+} // namespace
 
 bool DataTransferConfig::Marshalling(Parcel& parcel) const
 {
     return parcel.WriteUint8(static_cast<uint8_t>(subSystemId)) && parcel.WriteUint32(customId) &&
-           parcel.WriteBool(needReply) && parcel.WriteBool(needSyncSend);
+           parcel.WriteBool(needReply) && parcel.WriteBool(needSyncSend) && parcel.WriteBool(useSharedMemory) &&
+           parcel.WriteBool(isChannelSetup);
 }
 
 DataTransferConfig* DataTransferConfig::Unmarshalling(Parcel& parcel)
@@ -42,7 +49,8 @@ DataTransferConfig* DataTransferConfig::Unmarshalling(Parcel& parcel)
         return nullptr;
     }
     if (!parcel.ReadUint32(config->customId) || !parcel.ReadBool(config->needReply) ||
-        !parcel.ReadBool(config->needSyncSend)) {
+        !parcel.ReadBool(config->needSyncSend) || !parcel.ReadBool(config->useSharedMemory) ||
+        !parcel.ReadBool(config->isChannelSetup)) {
         delete config;
         return nullptr;
     }
@@ -56,8 +64,9 @@ std::string DataTransferConfig::ToString() const
     constexpr int BUFFER_SIZE = 128;
     char buffer[BUFFER_SIZE] = { 0 };
     if (snprintf_s(buffer, sizeof(buffer), sizeof(buffer) - 1,
-                   "subSystemId: %hhu, customId: %u, needReply: %d, needSyncSend: %d", subSystemId, customId, needReply,
-                   needSyncSend) > 0) {
+                   "subSystemId: %hhu, customId: %u, needReply: %d, needSyncSend: %d, useSharedMemory: %d, "
+                   "isChannelSetup: %d", subSystemId, customId, needReply, needSyncSend, useSharedMemory,
+                   isChannelSetup) > 0) {
         str.append(buffer);
     }
     return str;
@@ -89,25 +98,170 @@ bool DataHandler::IsProxyObject() const
 }
 
 DataHandlerErr DataHandler::PrepareSendData(MessageParcel& data, const DataTransferConfig& config,
-                                            const AAFwk::Want& toSend)
+                                            const AAFwk::Want& toSend, DataChannelRange& range)
 {
     if (IsProxyObject() && !WriteInterfaceToken(data)) {
         TLOGE(WmsLogTag::WMS_UIEXT, "write interface token failed, %{public}s", config.ToString().c_str());
         return DataHandlerErr::WRITE_PARCEL_ERROR;
     }
 
-    if (!data.WriteParcelable(&config)) {
-        TLOGE(WmsLogTag::WMS_UIEXT, "write config failed, %{public}s", config.ToString().c_str());
-        return DataHandlerErr::WRITE_PARCEL_ERROR;
+    if (config.isChannelSetup) {
+        return PrepareChannelSetup(data, config);
     }
 
-    if (!data.WriteParcelable(&toSend)) {
+    // the want is serialized once, then either staged in the channel or appended to the parcel
+    MessageParcel wantParcel;
+    wantParcel.SetMaxCapacity(std::max(wantParcel.GetMaxCapacity(), static_cast<size_t>(DATA_CHANNEL_CAPACITY)));
+    if (!wantParcel.WriteParcelable(&toSend)) {
         TLOGE(WmsLogTag::WMS_UIEXT, "write toSend failed, %{public}s", config.ToString().c_str());
         return DataHandlerErr::WRITE_PARCEL_ERROR;
     }
+    range = {};
+    DataTransferConfig sendConfig = config;
+    sendConfig.useSharedMemory = WriteToChannel(wantParcel, range);
+
+    if (!data.WriteParcelable(&sendConfig)) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "write config failed, %{public}s", sendConfig.ToString().c_str());
+        CancelSendData(range);
+        return DataHandlerErr::WRITE_PARCEL_ERROR;
+    }
+
+    if (!sendConfig.useSharedMemory) {
+        if (!data.Append(wantParcel)) {
+            TLOGE(WmsLogTag::WMS_UIEXT, "write toSend failed, %{public}s", sendConfig.ToString().c_str());
+            return DataHandlerErr::WRITE_PARCEL_ERROR;
+        }
+        return DataHandlerErr::OK;
+    }
+
+    // the receiver mapped the ashmem at channel setup, only the range goes with the message
+    if (!data.WriteUint64(range.begin) || !data.WriteUint64(range.end) || !data.WriteUint32(range.length)) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "write channel range failed, %{public}s", sendConfig.ToString().c_str());
+        CancelSendData(range);
+        return DataHandlerErr::WRITE_PARCEL_ERROR;
+    }
+    return DataHandlerErr::OK;
+}
+
+void DataHandler::CancelSendData(const DataChannelRange& range)
+{
+    if (range.length == 0) {
+        return;
+    }
+    if (auto channel = GetSendChannel()) {
+        channel->Cancel(range);
+    }
+}
+
+std::shared_ptr<DataChannel> DataHandler::GetSendChannel()
+{
+    std::lock_guard lock(channelMutex_);
+    return sendChannel_;
+}
+
+DataHandlerErr DataHandler::PrepareChannelSetup(MessageParcel& data, const DataTransferConfig& config)
+{
+    std::shared_ptr<DataChannel> channel;
+    {
+        std::lock_guard lock(channelMutex_);
+        channel = setupChannel_;
+    }
+    if (channel == nullptr || !data.WriteParcelable(&config) || !data.WriteAshmem(channel->GetAshmem())) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "write channel setup failed, %{public}s", config.ToString().c_str());
+        return DataHandlerErr::WRITE_PARCEL_ERROR;
+    }
+    return DataHandlerErr::OK;
+}
+
+std::shared_ptr<DataChannel> DataHandler::GetOrCreateSendChannel()
+{
+    {
+        std::lock_guard lock(channelMutex_);
+        // the messages sent while the channel is being set up go through the parcel
+        if (sendChannel_ != nullptr || isSendChannelFailed_ || setupChannel_ != nullptr) {
+            return sendChannel_;
+        }
+        setupChannel_ = DataChannel::Create(DATA_CHANNEL_CAPACITY);
+        if (setupChannel_ == nullptr) {
+            isSendChannelFailed_ = true;
+            return nullptr;
+        }
+    }
+    // the ashmem is sent once, synchronously, so the receiver has mapped it before the first payload arrives
+    DataTransferConfig config;
+    config.needSyncSend = true;
+    config.needReply = true;
+    config.isChannelSetup = true;
+    AAFwk::Want reply;
+    auto ret = SendData(AAFwk::Want(), reply, config);
+    if (ret != DataHandlerErr::OK) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "channel setup failed, ret: %{public}u", static_cast<uint32_t>(ret));
+    }
+    std::lock_guard lock(channelMutex_);
+    if (ret == DataHandlerErr::OK) {
+        sendChannel_ = setupChannel_;
+    } else {
+        isSendChannelFailed_ = true;
+    }
+    setupChannel_ = nullptr;
+    return sendChannel_;
+}
+
+bool DataHandler::WriteToChannel(MessageParcel& wantParcel, DataChannelRange& range)
+{
+    size_t dataSize = wantParcel.GetDataSize();
+    // binder objects and fds can only be carried by the parcel
+    if (dataSize < DATA_CHANNEL_THRESHOLD || dataSize > DATA_CHANNEL_CAPACITY || wantParcel.GetOffsetsSize() != 0 ||
+        wantParcel.ContainFileDescriptors()) {
+        return false;
+    }
+    auto channel = GetOrCreateSendChannel();
+    if (channel == nullptr) {
+        return false;
+    }
+    // a full ring falls back to the parcel instead of waiting for the receiver
+    return channel->Write(reinterpret_cast<const void*>(wantParcel.GetData()), static_cast<uint32_t>(dataSize),
+                          range);
+}
+
+DataHandlerErr DataHandler::SetupRecvChannel(MessageParcel& recieved)
+{
+    auto channel = DataChannel::Map(recieved.ReadAshmem());
+    if (channel == nullptr) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "map channel failed");
+        return DataHandlerErr::READ_PARCEL_ERROR;
+    }
+    std::lock_guard lock(channelMutex_);
+    recvChannel_ = channel;
     return DataHandlerErr::OK;
 }
 
+sptr<AAFwk::Want> DataHandler::ReadFromChannel(MessageParcel& recieved)
+{
+    DataChannelRange range;
+    if (!recieved.ReadUint64(range.begin) || !recieved.ReadUint64(range.end) || !recieved.ReadUint32(range.length)) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "read channel range failed");
+        return nullptr;
+    }
+    std::shared_ptr<DataChannel> channel;
+    {
+        std::lock_guard lock(channelMutex_);
+        channel = recvChannel_;
+    }
+    if (channel == nullptr) {
+        TLOGE(WmsLogTag::WMS_UIEXT, "channel not set up");
+        return nullptr;
+    }
+    MessageParcel wantParcel;
+    bool isRead = channel->Read(range, wantParcel);
+    // the want is copied out, so the space is given back before the consumer runs
+    channel->Complete(range);
+    if (!isRead) {
+        return nullptr;
+    }
+    return wantParcel.ReadParcelable<AAFwk::Want>();
+}
+
 DataHandlerErr DataHandler::ParseReply(MessageParcel& replyParcel, AAFwk::Want& reply, const DataTransferConfig& config)
 {
     if (!config.needReply) {
@@ -142,7 +296,15 @@ void DataHandler::NotifyDataConsumer(MessageParcel& recieved, MessageParcel& rep
         return;
     }
 
-    sptr<AAFwk::Want> sendWant = recieved.ReadParcelable<AAFwk::Want>();
+    if (config->isChannelSetup) {
+        AAFwk::Want replyWant;
+        reply.WriteUint32(static_cast<uint32_t>(SetupRecvChannel(recieved)));
+        reply.WriteParcelable(&replyWant);
+        return;
+    }
+
+    sptr<AAFwk::Want> sendWant =
+        config->useSharedMemory ? ReadFromChannel(recieved) : recieved.ReadParcelable<AAFwk::Want>();
     if (sendWant == nullptr) {
         TLOGE(WmsLogTag::WMS_UIEXT, "read want failed");
         reply.WriteUint32(static_cast<uint32_t>(DataHandlerErr::READ_PARCEL_ERROR));
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hot_area_buffer.h"
+
+#include <atomic>
+
+namespace OHOS::Rosen {
+namespace {
+std::atomic<uint64_t> g_hotAreaBufferVersion { 0 };
+} // namespace
+
+HotAreaBufferPtr HotAreaBuffer::Create(const std::vector<Rect>& rects)
+{
+    // version 0 is reserved for no buffer
+    auto buffer = std::shared_ptr<HotAreaBuffer>(
+        new HotAreaBuffer(g_hotAreaBufferVersion.fetch_add(1, std::memory_order_relaxed) + 1));
+    auto size = rects.size();
+    buffer->posX_.reserve(size);
+    buffer->posY_.reserve(size);
+    buffer->width_.reserve(size);
+    buffer->height_.reserve(size);
+    for (const auto& rect : rects) {
+        buffer->posX_.push_back(rect.posX_);
+        buffer->posY_.push_back(rect.posY_);
+        buffer->width_.push_back(rect.width_);
+        buffer->height_.push_back(rect.height_);
+    }
+    return buffer;
+}
+
+std::vector<Rect> HotAreaBuffer::ToRects() const
+{
+    std::vector<Rect> rects;
+    rects.reserve(Size());
+    for (size_t i = 0; i < Size(); i++) {
+        rects.push_back(GetRect(i));
+    }
+    return rects;
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/include/ipc_payload_profiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr int IPC_NAME_WIDTH = 28;
+constexpr int IPC_CODE_WIDTH = 8;
+constexpr int IPC_VALUE_WIDTH = 12;
+constexpr double PERCENT_P50 = 50.0;
+constexpr double PERCENT_P99 = 99.0;
+constexpr std::string_view OVERFLOW_INTERFACE_NAME = "others";
+const std::string ARG_IPC_PAYLOAD_RESET = "reset";
+const std::string ARG_IPC_PAYLOAD_CSV = "csv";
+const std::array<std::string, static_cast<size_t>(IpcSide::SIDE_END)> SIDE_NAMES = { "Proxy", "Stub" };
+
+void UpdateMax(std::atomic<uint64_t>& maxValue, uint64_t value)
+{
+    uint64_t current = maxValue.load(std::memory_order_relaxed);
+    while (value > current && !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t GetAverage(uint64_t sum, uint64_t count)
+{
+    return count == 0 ? 0 : sum / count;
+}
+} // namespace
+
+WM_IMPLEMENT_SINGLE_INSTANCE(IpcPayloadProfiler)
+
+IpcPayloadProfiler::Snapshot IpcPayloadProfiler::Stats::GetSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.count_ = count_.load(std::memory_order_relaxed);
+    snapshot.requestBytes_ = requestBytes_.load(std::memory_order_relaxed);
+    snapshot.replyBytes_ = replyBytes_.load(std::memory_order_relaxed);
+    snapshot.maxRequestBytes_ = maxRequestBytes_.load(std::memory_order_relaxed);
+    snapshot.maxReplyBytes_ = maxReplyBytes_.load(std::memory_order_relaxed);
+    snapshot.latency_ = latency_.GetSnapshot();
+    return snapshot;
+}
+
+IpcPayloadProfiler::Stats* IpcPayloadProfiler::GetOrCreateStats(IpcSide side, std::string_view interfaceName,
+    uint32_t code)
+{
+    auto& statsMap = statsMaps_[static_cast<size_t>(side)];
+    StatsKey key(interfaceName, code);
+    {
+        std::shared_lock<std::shared_mutex> lock(statsMutex_);
+        auto iter = statsMap.find(key);
+        if (iter != statsMap.end()) {
+            return iter->second.get();
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(statsMutex_);
+    auto iter = statsMap.find(key);
+    if (iter != statsMap.end()) {
+        return iter->second.get();
+    }
+    // the stub side codes come from the callers, bound the memory for unknown ones
+    if (statsMap.size() >= MAX_STATS_NUM_PER_SIDE) {
+        key = StatsKey(OVERFLOW_INTERFACE_NAME, OVERFLOW_CODE);
+    }
+    auto& stats = statsMap[key];
+    if (stats == nullptr) {
+        stats = std::make_unique<Stats>();
+    }
+    return stats.get();
+}
+
+void IpcPayloadProfiler::Record(IpcSide side, std::string_view interfaceName, uint32_t code, size_t requestBytes,
+    size_t replyBytes, int64_t latencyUs)
+{
+    if (side >= IpcSide::SIDE_END) {
+        return;
+    }
+    Stats* stats = GetOrCreateStats(side, interfaceName, code);
+    stats->count_.fetch_add(1, std::memory_order_relaxed);
+    stats->requestBytes_.fetch_add(requestBytes, std::memory_order_relaxed);
+    stats->replyBytes_.fetch_add(replyBytes, std::memory_order_relaxed);
+    UpdateMax(stats->maxRequestBytes_, requestBytes);
+    UpdateMax(stats->maxReplyBytes_, replyBytes);
+    stats->latency_.Record(latencyUs);
+}
+
+bool IpcPayloadProfiler::GetSnapshot(IpcSide side, std::string_view interfaceName, uint32_t code,
+    Snapshot& snapshot)
+{
+    if (side >= IpcSide::SIDE_END) {
+        return false;
+    }
+    std::shared_lock<std::shared_mutex> lock(statsMutex_);
+    const auto& statsMap = statsMaps_[static_cast<size_t>(side)];
+    auto iter = statsMap.find(StatsKey(interfaceName, code));
+    if (iter == statsMap.end()) {
+        return false;
+    }
+    snapshot = iter->second->GetSnapshot();
+    return true;
+}
+
+auto IpcPayloadProfiler::GetSortedSnapshots(IpcSide side, const std::string& nameFilter) -> SnapshotList
+{
+    SnapshotList snapshots;
+    {
+        std::shared_lock<std::shared_mutex> lock(statsMutex_);
+        for (const auto& [key, stats] : statsMaps_[static_cast<size_t>(side)]) {
+            if (!nameFilter.empty() && key.first.find(nameFilter) == std::string_view::npos) {
+                continue;
+            }
+            auto snapshot = stats->GetSnapshot();
+            if (snapshot.count_ != 0) {
+                snapshots.emplace_back(key, snapshot);
+            }
+        }
+    }
+    std::stable_sort(snapshots.begin(), snapshots.end(), [](const auto& left, const auto& right) {
+        return left.second.requestBytes_ + left.second.replyBytes_ >
+            right.second.requestBytes_ + right.second.replyBytes_;
+    });
+    return snapshots;
+}
+
+void IpcPayloadProfiler::Dump(std::ostringstream& oss, const std::string& nameFilter)
+{
+    for (size_t side = 0; side < SIDE_NAMES.size(); side++) {
+        oss << "[" << SIDE_NAMES[side] << "]" << std::endl;
+        oss << std::left << std::setw(IPC_NAME_WIDTH) << "Interface"
+            << std::setw(IPC_CODE_WIDTH) << "Code"
+            << std::setw(IPC_VALUE_WIDTH) << "Count"
+            << std::setw(IPC_VALUE_WIDTH) << "Bytes"
+            << std::setw(IPC_VALUE_WIDTH) << "AvgReq(B)"
+            << std::setw(IPC_VALUE_WIDTH) << "MaxReq(B)"
+            << std::setw(IPC_VALUE_WIDTH) << "AvgRep(B)"
+            << std::setw(IPC_VALUE_WIDTH) << "MaxRep(B)"
+            << std::setw(IPC_VALUE_WIDTH) << "Avg(us)"
+            << std::setw(IPC_VALUE_WIDTH) << "P50(us)"
+            << std::setw(IPC_VALUE_WIDTH) << "P99(us)"
+            << std::setw(IPC_VALUE_WIDTH) << "Max(us)" << std::endl;
+        for (const auto& [key, snapshot] : GetSortedSnapshots(static_cast<IpcSide>(side), nameFilter)) {
+            oss << std::left << std::setw(IPC_NAME_WIDTH) << key.first
+                << std::setw(IPC_CODE_WIDTH) << key.second
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.count_
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.requestBytes_ + snapshot.replyBytes_
+                << std::setw(IPC_VALUE_WIDTH) << GetAverage(snapshot.requestBytes_, snapshot.count_)
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.maxRequestBytes_
+                << std::setw(IPC_VALUE_WIDTH) << GetAverage(snapshot.replyBytes_, snapshot.count_)
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.maxReplyBytes_
+                << std::setw(IPC_VALUE_WIDTH) << GetAverage(snapshot.latency_.sumUs_, snapshot.latency_.count_)
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.latency_.GetPercentile(PERCENT_P50)
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.latency_.GetPercentile(PERCENT_P99)
+                << std::setw(IPC_VALUE_WIDTH) << snapshot.latency_.maxUs_ << std::endl;
+        }
+    }
+}
+
+void IpcPayloadProfiler::DumpCsv(std::ostringstream& oss)
+{
+    oss << "side,interface,code,count,request_bytes,max_request_bytes,reply_bytes,max_reply_bytes,"
+        << "latency_sum_us,latency_p50_us,latency_p99_us,latency_max_us" << std::endl;
+    for (size_t side = 0; side < SIDE_NAMES.size(); side++) {
+        for (const auto& [key, snapshot] : GetSortedSnapshots(static_cast<IpcSide>(side), "")) {
+            oss << SIDE_NAMES[side] << "," << key.first << "," << key.second << "," << snapshot.count_ << ","
+                << snapshot.requestBytes_ << "," << snapshot.maxRequestBytes_ << ","
+                << snapshot.replyBytes_ << "," << snapshot.maxReplyBytes_ << ","
+                << snapshot.latency_.sumUs_ << "," << snapshot.latency_.GetPercentile(PERCENT_P50) << ","
+                << snapshot.latency_.GetPercentile(PERCENT_P99) << "," << snapshot.latency_.maxUs_ << std::endl;
+        }
+    }
+}
+
+void IpcPayloadProfiler::Reset()
+{
+    TLOGI(WmsLogTag::WMS_PIPELINE, "reset ipc payload stats");
+    std::shared_lock<std::shared_mutex> lock(statsMutex_);
+    for (auto& statsMap : statsMaps_) {
+        for (auto& [key, stats] : statsMap) {
+            stats->count_.store(0, std::memory_order_relaxed);
+            stats->requestBytes_.store(0, std::memory_order_relaxed);
+            stats->replyBytes_.store(0, std::memory_order_relaxed);
+            stats->maxRequestBytes_.store(0, std::memory_order_relaxed);
+            stats->maxReplyBytes_.store(0, std::memory_order_relaxed);
+            stats->latency_.Reset();
+        }
+    }
+}
+
+void IpcPayloadProfiler::DumpInfo(const std::vector<std::string>& params, std::string& dumpInfo)
+{
+    if (!params.empty() && params[0] == ARG_IPC_PAYLOAD_RESET) {
+        Reset();
+        dumpInfo.append("IPC payload stats reset\n");
+        return;
+    }
+    std::ostringstream oss;
+    if (!params.empty() && params[0] == ARG_IPC_PAYLOAD_CSV) {
+        DumpCsv(oss);
+        dumpInfo.append(oss.str());
+        return;
+    }
+    oss << "----------------------------------IpcPayload"
+        << "-----------------------------------" << std::endl;
+#ifndef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    oss << "not recording, build with window_manager_feature_ipc_payload_profiler = true" << std::endl;
+#endif
+    Dump(oss, params.empty() ? "" : params[0]);
+    dumpInfo.append(oss.str());
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/include/latency_histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+#include "window_manager_hilog.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
+
+namespace OHOS::Rosen {
+namespace {
+constexpr size_t MAX_HISTOGRAM_NUM_PER_CATEGORY = 1024;
+constexpr int LATENCY_NAME_WIDTH = 48;
+constexpr int LATENCY_VALUE_WIDTH = 10;
+constexpr double PERCENT_P50 = 50.0;
+constexpr double PERCENT_P90 = 90.0;
+constexpr double PERCENT_P99 = 99.0;
+constexpr double PERCENT_MAX = 100.0;
+const std::string OVERFLOW_HISTOGRAM_NAME = "others";
+const std::array<std::string, static_cast<size_t>(LatencyCategory::CATEGORY_END)> CATEGORY_NAMES = {
+    "TaskWait", "TaskRun", "Ipc"
+};
+
+std::atomic<uint32_t> g_nextShardIndex { 0 };
+
+uint32_t GetCurrentShardIndex()
+{
+    // hashing thread ids may put the busy binder threads on one shard, so hand the shards out in turn
+    thread_local uint32_t shardIndex =
+        g_nextShardIndex.fetch_add(1, std::memory_order_relaxed) % LatencyHistogram::SHARD_NUM;
+    return shardIndex;
+}
+} // namespace
+
+uint32_t LatencyHistogram::GetBucketIndex(uint64_t valueUs)
+{
+    if (valueUs <= 1) {
+        return static_cast<uint32_t>(valueUs);
+    }
+    uint32_t exponent = static_cast<uint32_t>(63 - __builtin_clzll(valueUs)); // 63: highest bit index of uint64
+    if (exponent >= MAX_EXPONENT) {
+        return BUCKET_NUM - 1;
+    }
+    uint32_t subIndex = static_cast<uint32_t>((valueUs >> (exponent - 1)) & (SUB_BUCKET_NUM - 1));
+    return 2 + (exponent - 1) * SUB_BUCKET_NUM + subIndex; // 2: buckets of 0us and 1us
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBound(uint32_t index)
+{
+    if (index <= 1) {
+        return index;
+    }
+    uint32_t exponent = (index - 2) / SUB_BUCKET_NUM + 1; // 2: buckets of 0us and 1us
+    uint32_t subIndex = (index - 2) % SUB_BUCKET_NUM; // 2: buckets of 0us and 1us
+    return (1ULL << exponent) + (static_cast<uint64_t>(subIndex) << (exponent - 1));
+}
+
+void LatencyHistogram::Record(int64_t valueUs)
+{
+    uint64_t value = valueUs > 0 ? static_cast<uint64_t>(valueUs) : 0;
+    Shard& shard = shards_[GetCurrentShardIndex()];
+    shard.buckets_[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.count_.fetch_add(1, std::memory_order_relaxed);
+    shard.sumUs_.fetch_add(value, std::memory_order_relaxed);
+    uint64_t maxUs = shard.maxUs_.load(std::memory_order_relaxed);
+    while (value > maxUs && !shard.maxUs_.compare_exchange_weak(maxUs, value, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto& shard : shards_) {
+        for (auto& bucket : shard.buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        shard.count_.store(0, std::memory_order_relaxed);
+        shard.sumUs_.store(0, std::memory_order_relaxed);
+        shard.maxUs_.store(0, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+    for (const auto& shard : shards_) {
+        for (uint32_t i = 0; i < BUCKET_NUM; i++) {
+            snapshot.buckets_[i] += shard.buckets_[i].load(std::memory_order_relaxed);
+        }
+        snapshot.count_ += shard.count_.load(std::memory_order_relaxed);
+        snapshot.sumUs_ += shard.sumUs_.load(std::memory_order_relaxed);
+        snapshot.maxUs_ = std::max(snapshot.maxUs_, shard.maxUs_.load(std::memory_order_relaxed));
+    }
+    return snapshot;
+}
+
+uint64_t LatencyHistogram::Snapshot::GetPercentile(double percentile) const
+{
+    uint64_t total = 0;
+    for (auto bucket : buckets_) {
+        total += bucket;
+    }
+    if (total == 0) {
+        return 0;
+    }
+    auto target = static_cast<uint64_t>(static_cast<double>(total) * percentile / PERCENT_MAX);
+    target = std::clamp<uint64_t>(target, 1, total);
+    uint64_t accumulated = 0;
+    for (uint32_t i = 0; i < BUCKET_NUM; i++) {
+        accumulated += buckets_[i];
+        if (accumulated >= target) {
+            uint64_t upperBound = i + 1 < BUCKET_NUM ? GetBucketLowerBound(i + 1) - 1 : maxUs_;
+            return std::min(upperBound, maxUs_);
+        }
+    }
+    return maxUs_;
+}
+
+WM_IMPLEMENT_SINGLE_INSTANCE(LatencyHistogramManager)
+
+LatencyHistogram* LatencyHistogramManager::GetOrCreateHistogram(LatencyCategory category, const std::string& name)
+{
+    auto& histogramMap = histogramMaps_[static_cast<size_t>(category)];
+    {
+        std::shared_lock<std::shared_mutex> lock(histogramMutex_);
+        auto iter = histogramMap.find(name);
+        if (iter != histogramMap.end()) {
+            return iter->second.get();
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(histogramMutex_);
+    auto iter = histogramMap.find(name);
+    if (iter != histogramMap.end()) {
+        return iter->second.get();
+    }
+    // bound the memory when names are unexpectedly dynamic
+    const std::string& histogramName =
+        histogramMap.size() >= MAX_HISTOGRAM_NUM_PER_CATEGORY ? OVERFLOW_HISTOGRAM_NAME : name;
+    auto& histogram = histogramMap[histogramName];
+    if (histogram == nullptr) {
+        histogram = std::make_unique<LatencyHistogram>();
+    }
+    return histogram.get();
+}
+
+void LatencyHistogramManager::Record(LatencyCategory category, const std::string& name, int64_t valueUs)
+{
+    if (category >= LatencyCategory::CATEGORY_END) {
+        return;
+    }
+    GetOrCreateHistogram(category, name)->Record(valueUs);
+}
+
+LatencyHistogram* LatencyHistogramManager::GetIpcHistogram(const char* interfaceName, uint32_t code)
+{
+    std::string name = interfaceName == nullptr ? "" : interfaceName;
+    name.append(":").append(std::to_string(code));
+    return GetOrCreateHistogram(LatencyCategory::IPC, name);
+}
+
+void LatencyHistogramManager::RecordIpc(const char* interfaceName, uint32_t code, int64_t valueUs)
+{
+    GetIpcHistogram(interfaceName, code)->Record(valueUs);
+}
+
+void LatencyHistogramManager::RecordIpc(const char* interfaceName, uint32_t code, int64_t valueUs,
+    size_t requestBytes, size_t replyBytes)
+{
+    RecordIpc(interfaceName, code, valueUs);
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadProfiler::GetInstance().Record(IpcSide::STUB, interfaceName == nullptr ? "" : interfaceName, code,
+        requestBytes, replyBytes, valueUs);
+#endif
+}
+
+IpcLatencyTable::IpcLatencyTable(const char* interfaceName)
+    : interfaceName_(interfaceName), histograms_(std::make_unique<std::atomic<LatencyHistogram*>[]>(MAX_CODE_NUM))
+{
+    for (uint32_t code = 0; code < MAX_CODE_NUM; code++) {
+        histograms_[code].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void IpcLatencyTable::Record(uint32_t code, int64_t valueUs, size_t requestBytes, size_t replyBytes)
+{
+    if (code >= MAX_CODE_NUM) {
+        LatencyHistogramManager::GetInstance().RecordIpc(interfaceName_, code, valueUs, requestBytes, replyBytes);
+        return;
+    }
+    LatencyHistogram* histogram = histograms_[code].load(std::memory_order_acquire);
+    if (histogram == nullptr) {
+        // histograms are never released, racing threads resolve the same one
+        histogram = LatencyHistogramManager::GetInstance().GetIpcHistogram(interfaceName_, code);
+        histograms_[code].store(histogram, std::memory_order_release);
+    }
+    histogram->Record(valueUs);
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadProfiler::GetInstance().Record(IpcSide::STUB, interfaceName_ == nullptr ? "" : interfaceName_, code,
+        requestBytes, replyBytes, valueUs);
+#endif
+}
+
+void LatencyHistogramManager::Dump(std::ostringstream& oss, const std::string& nameFilter)
+{
+    oss << std::left << std::setw(LATENCY_NAME_WIDTH) << "Name"
+        << std::setw(LATENCY_VALUE_WIDTH) << "Count"
+        << std::setw(LATENCY_VALUE_WIDTH) << "Avg(us)"
+        << std::setw(LATENCY_VALUE_WIDTH) << "P50(us)"
+        << std::setw(LATENCY_VALUE_WIDTH) << "P90(us)"
+        << std::setw(LATENCY_VALUE_WIDTH) << "P99(us)"
+        << std::setw(LATENCY_VALUE_WIDTH) << "Max(us)" << std::endl;
+    std::shared_lock<std::shared_mutex> lock(histogramMutex_);
+    for (size_t category = 0; category < histogramMaps_.size(); category++) {
+        oss << "[" << CATEGORY_NAMES[category] << "]" << std::endl;
+        std::map<std::string, LatencyHistogram::Snapshot> sortedSnapshots;
+        for (const auto& [name, histogram] : histogramMaps_[category]) {
+            if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) {
+                continue;
+            }
+            auto snapshot = histogram->GetSnapshot();
+            if (snapshot.count_ != 0) {
+                sortedSnapshots.emplace(name, snapshot);
+            }
+        }
+        for (const auto& [name, snapshot] : sortedSnapshots) {
+            oss << std::left << std::setw(LATENCY_NAME_WIDTH) << name
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.count_
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.sumUs_ / snapshot.count_
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.GetPercentile(PERCENT_P50)
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.GetPercentile(PERCENT_P90)
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.GetPercentile(PERCENT_P99)
+                << std::setw(LATENCY_VALUE_WIDTH) << snapshot.maxUs_ << std::endl;
+        }
+    }
+}
+
+void LatencyHistogramManager::Reset()
+{
+    TLOGI(WmsLogTag::WMS_PIPELINE, "reset latency histograms");
+    std::shared_lock<std::shared_mutex> lock(histogramMutex_);
+    for (auto& histogramMap : histogramMaps_) {
+        for (auto& [name, histogram] : histogramMap) {
+            histogram->Reset();
+        }
+    }
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/include/plugin_loader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <dlfcn.h>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+#include "common/include/task_scheduler.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr uint32_t RETRY_SLEEP_TIME_US = 10000;
+constexpr size_t MAX_STARTUP_PHASE_NUM = 128;
+constexpr int PHASE_NAME_WIDTH = 40;
+constexpr int PHASE_VALUE_WIDTH = 14;
+const std::string LOAD_PHASE_PREFIX = "load:";
+} // namespace
+
+WM_IMPLEMENT_SINGLE_INSTANCE(PluginLoader)
+
+void* PluginLoader::OpenLibrary(const std::string& path, int32_t flags, uint32_t retryTimes)
+{
+    void* handle = nullptr;
+    for (uint32_t cnt = 1; cnt <= retryTimes; cnt++) {
+        handle = dlopen(path.c_str(), flags);
+        if (handle != nullptr) {
+            TLOGI(WmsLogTag::DMS, "dlopen %{public}s, cnt: %{public}u", path.c_str(), cnt);
+            break;
+        }
+        const char* dlopenError = dlerror();
+        TLOGE(WmsLogTag::DMS, "dlopen %{public}s failed, cnt: %{public}u, error: %{public}s", path.c_str(), cnt,
+            dlopenError == nullptr ? "" : dlopenError);
+        if (cnt < retryTimes) {
+            usleep(RETRY_SLEEP_TIME_US);
+        }
+    }
+    return handle;
+}
+
+void* PluginLoader::LoadSymbol(void* handle, const char* symbolName, uint32_t retryTimes)
+{
+    if (handle == nullptr || symbolName == nullptr) {
+        TLOGE(WmsLogTag::DMS, "handle or symbol name is nullptr");
+        return nullptr;
+    }
+    void* symbol = nullptr;
+    for (uint32_t cnt = 1; cnt <= retryTimes; cnt++) {
+        symbol = dlsym(handle, symbolName);
+        if (symbol != nullptr) {
+            break;
+        }
+        const char* dlsymError = dlerror();
+        TLOGE(WmsLogTag::DMS, "dlsym %{public}s failed, cnt: %{public}u, error: %{public}s", symbolName, cnt,
+            dlsymError == nullptr ? "" : dlsymError);
+        if (cnt < retryTimes) {
+            usleep(RETRY_SLEEP_TIME_US);
+        }
+    }
+    return symbol;
+}
+
+void PluginLoader::LoadAsync(const std::string& pluginName, std::function<bool()>&& loadFunc,
+    const std::shared_ptr<TaskScheduler>& taskScheduler)
+{
+    auto loadState = std::make_shared<LoadState>();
+    loadState->loadFunc_ = std::move(loadFunc);
+    {
+        std::lock_guard<std::mutex> lock(loadStateMutex_);
+        if (loadStates_.find(pluginName) != loadStates_.end()) {
+            TLOGW(WmsLogTag::DMS, "%{public}s is already loading", pluginName.c_str());
+            return;
+        }
+        loadStates_[pluginName] = loadState;
+    }
+    if (taskScheduler == nullptr) {
+        TLOGW(WmsLogTag::DMS, "task scheduler is nullptr, %{public}s loads on first wait", pluginName.c_str());
+        return;
+    }
+    taskScheduler->PostAsyncTask([this, pluginName, loadState] {
+        RunLoad(pluginName, loadState);
+    }, "LoadPlugin:" + pluginName);
+}
+
+void PluginLoader::RunLoad(const std::string& pluginName, const std::shared_ptr<LoadState>& loadState)
+{
+    std::function<bool()> loadFunc;
+    {
+        std::lock_guard<std::mutex> lock(loadState->mutex_);
+        if (loadState->status_ != LoadStatus::PENDING) {
+            return;
+        }
+        loadState->status_ = LoadStatus::LOADING;
+        loadFunc = std::move(loadState->loadFunc_);
+    }
+    int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
+    bool result = loadFunc != nullptr && loadFunc();
+    RecordStartupPhase(LOAD_PHASE_PREFIX + pluginName, startTimeUs, TimeUtil::GetCurrentTimeUs());
+    TLOGI(WmsLogTag::DMS, "%{public}s loaded, result: %{public}d", pluginName.c_str(), result);
+    {
+        std::lock_guard<std::mutex> lock(loadState->mutex_);
+        loadState->status_ = LoadStatus::DONE;
+        loadState->result_ = result;
+    }
+    loadState->cv_.notify_all();
+}
+
+bool PluginLoader::WaitLoaded(const std::string& pluginName, uint32_t timeoutMs)
+{
+    std::shared_ptr<LoadState> loadState;
+    {
+        std::lock_guard<std::mutex> lock(loadStateMutex_);
+        auto iter = loadStates_.find(pluginName);
+        if (iter == loadStates_.end()) {
+            return true;
+        }
+        loadState = iter->second;
+    }
+    // the queued load may be behind the caller on the same thread, run it here instead of waiting for it
+    RunLoad(pluginName, loadState);
+    std::unique_lock<std::mutex> lock(loadState->mutex_);
+    if (!loadState->cv_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+        [&loadState] { return loadState->status_ == LoadStatus::DONE; })) {
+        TLOGE(WmsLogTag::DMS, "wait %{public}s timeout", pluginName.c_str());
+        return false;
+    }
+    return loadState->result_;
+}
+
+void PluginLoader::RecordStartupPhase(const std::string& phaseName, int64_t startTimeUs, int64_t endTimeUs)
+{
+    std::lock_guard<std::mutex> lock(timelineMutex_);
+    if (timeline_.size() >= MAX_STARTUP_PHASE_NUM) {
+        return;
+    }
+    timeline_.push_back({ phaseName, startTimeUs, endTimeUs });
+}
+
+void PluginLoader::DumpStartupTimeline(std::string& dumpInfo)
+{
+    std::vector<StartupPhase> timeline;
+    {
+        std::lock_guard<std::mutex> lock(timelineMutex_);
+        timeline = timeline_;
+    }
+    std::sort(timeline.begin(), timeline.end(), [](const StartupPhase& left, const StartupPhase& right) {
+        return left.startTimeUs_ < right.startTimeUs_;
+    });
+    std::ostringstream oss;
+    oss << "----------------------------------StartupTimeline"
+        << "----------------------------------" << std::endl;
+    oss << std::left << std::setw(PHASE_NAME_WIDTH) << "Phase"
+        << std::setw(PHASE_VALUE_WIDTH) << "Start(us)"
+        << std::setw(PHASE_VALUE_WIDTH) << "Cost(us)" << std::endl;
+    int64_t baseTimeUs = timeline.empty() ? 0 : timeline.front().startTimeUs_;
+    for (const auto& phase : timeline) {
+        oss << std::left << std::setw(PHASE_NAME_WIDTH) << phase.name_
+            << std::setw(PHASE_VALUE_WIDTH) << phase.startTimeUs_ - baseTimeUs
+            << std::setw(PHASE_VALUE_WIDTH) << phase.endTimeUs_ - phase.startTimeUs_ << std::endl;
+    }
+    dumpInfo.append(oss.str());
+}
+} // namespace OHOS::Rosen
@@ -14,10 +14,156 @@
  */
 
 #include "common/include/task_scheduler.h"
+
+#include <iomanip>
+#include <unordered_map>
+
+#include "common/include/latency_histogram.h"
 #include "hitrace_meter.h"
 #include "window_manager_hilog.h"
 
 namespace OHOS::Rosen {
+namespace {
+constexpr int64_t US_PER_MS = 1000;
+constexpr size_t TASK_SLOT_CHUNK_SIZE = 64;
+constexpr int LANE_NAME_WIDTH = 20;
+constexpr int LANE_VALUE_WIDTH = 12;
+const std::array<std::string, static_cast<size_t>(TaskLane::LANE_END)> LANE_NAMES = {
+    "lane:input", "lane:layout", "lane:background"
+};
+
+/*
+ * Leaves the lane queue when the task starts, or when it is destroyed without running, e.g. removed.
+ */
+class LaneQueueToken {
+public:
+    explicit LaneQueueToken(std::atomic<uint32_t>& queueDepth) : queueDepth_(queueDepth) {}
+    ~LaneQueueToken()
+    {
+        Leave();
+    }
+
+    void Leave()
+    {
+        if (!isLeft_.exchange(true)) {
+            queueDepth_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<uint32_t>& queueDepth_;
+    std::atomic<bool> isLeft_ { false };
+};
+
+AppExecFwk::EventQueue::Priority GetLanePriority(TaskLane lane)
+{
+    switch (lane) {
+        case TaskLane::INPUT_CRITICAL:
+            return AppExecFwk::EventQueue::Priority::VIP;
+        case TaskLane::BACKGROUND:
+            return AppExecFwk::EventQueue::Priority::LOW;
+        default:
+            return AppExecFwk::EventQueue::Priority::IMMEDIATE;
+    }
+}
+} // namespace
+
+TaskName::TaskName(const std::string& name, uint32_t id)
+    : name_(name), queueName_("wms:" + name), traceName_("ssm:" + name), id_(id)
+{
+}
+
+const TaskName& TaskName::Intern(const char* name)
+{
+    static std::mutex internMutex;
+    static std::unordered_map<std::string, std::unique_ptr<TaskName>> internedNames;
+    std::string nameStr = name == nullptr ? "" : name;
+    std::lock_guard<std::mutex> lock(internMutex);
+    auto& taskName = internedNames[nameStr];
+    if (taskName == nullptr) {
+        taskName = std::make_unique<TaskName>(nameStr, static_cast<uint32_t>(internedNames.size()));
+    }
+    return *taskName;
+}
+
+TaskScheduler::TaskSlot* TaskScheduler::TaskSlotPool::Acquire(TaskScheduler& scheduler)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (owner_.expired()) {
+        owner_ = scheduler.weak_from_this();
+        if (owner_.expired()) {
+            TLOGD(WmsLogTag::DEFAULT, "scheduler is not owned by shared_ptr");
+            return nullptr;
+        }
+    }
+    if (freeTaskSlot_ == nullptr) {
+        auto chunk = std::make_unique<TaskSlot[]>(TASK_SLOT_CHUNK_SIZE);
+        for (size_t i = 0; i < TASK_SLOT_CHUNK_SIZE; i++) {
+            chunk[i].next_ = freeTaskSlot_;
+            freeTaskSlot_ = &chunk[i];
+        }
+        taskSlotChunks_.push_back(std::move(chunk));
+        TLOGD(WmsLogTag::DEFAULT, "task slot chunk num: %{public}zu", taskSlotChunks_.size());
+    }
+    TaskSlot* slot = freeTaskSlot_;
+    freeTaskSlot_ = slot->next_;
+    slot->next_ = nullptr;
+    slot->pool_ = shared_from_this();
+    return slot;
+}
+
+void TaskScheduler::TaskSlotPool::Release(TaskSlot* slot)
+{
+    slot->task_.Reset();
+    slot->taskName_ = nullptr;
+    slot->isInLaneQueue_ = false;
+    // the pool is destroyed after unlock if this is the last slot in use and the scheduler is released
+    std::shared_ptr<TaskSlotPool> pool = std::move(slot->pool_);
+    std::lock_guard<std::mutex> lock(pool->mutex_);
+    slot->next_ = pool->freeTaskSlot_;
+    pool->freeTaskSlot_ = slot;
+}
+
+std::shared_ptr<TaskScheduler> TaskScheduler::TaskSlotPool::LockOwner()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return owner_.lock();
+}
+
+TaskScheduler::TaskSlotRef::TaskSlotRef(TaskSlot* slot) noexcept : slot_(slot)
+{
+    slot_->refCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+TaskScheduler::TaskSlotRef::TaskSlotRef(const TaskSlotRef& other) noexcept : slot_(other.slot_)
+{
+    slot_->refCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+TaskScheduler::TaskSlotRef::~TaskSlotRef()
+{
+    if (slot_->refCount_.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    // the task was removed before running
+    if (slot_->isInLaneQueue_) {
+        if (auto scheduler = slot_->pool_->LockOwner()) {
+            scheduler->LeaveLaneQueue(slot_);
+        }
+    }
+    TaskSlotPool::Release(slot_);
+}
+
+void TaskScheduler::TaskSlotRef::operator()() const
+{
+    auto scheduler = slot_->pool_->LockOwner();
+    if (scheduler == nullptr) {
+        TLOGW(WmsLogTag::DEFAULT, "scheduler released, drop task");
+        return;
+    }
+    scheduler->RunTaskSlot(slot_);
+}
+
 TaskScheduler::TaskScheduler(const std::string& threadName)
 {
     auto runner = AppExecFwk::EventRunner::Create(threadName);
@@ -51,9 +197,12 @@ void TaskScheduler::PostAsyncTask(Task&& task, const std::string& name, int64_t
         task();
         return;
     }
-    auto localTask = [this, task = std::move(task), name] {
+    auto localTask = [this, task = std::move(task), name,
+        postTimeUs = TimeUtil::GetCurrentTimeUs() + delayTime * US_PER_MS] {
+        int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
         HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", name.c_str());
         task();
+        RecordTaskLatency(name, postTimeUs, startTimeUs);
         ExecuteExportTask();
     };
     handler_->PostTask(std::move(localTask), "wms:" + name, delayTime, AppExecFwk::EventQueue::Priority::IMMEDIATE);
@@ -64,6 +213,141 @@ void TaskScheduler::PostTask(Task&& task, const std::string& name, int64_t delay
     PostAsyncTask(std::move(task), name, delayTime);
 }
 
+void TaskScheduler::PostLaneTask(Task&& task, const std::string& name, TaskLane lane, int64_t delayTime)
+{
+    if (lane >= TaskLane::LANE_END || !isLaneModeEnabled_.load(std::memory_order_relaxed)) {
+        PostAsyncTask(std::move(task), name, delayTime);
+        return;
+    }
+    if (delayTime == 0 && handler_->GetEventRunner()->IsCurrentRunnerThread()) {
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", name.c_str());
+        task();
+        return;
+    }
+    auto laneIndex = static_cast<size_t>(lane);
+    EnterLaneQueue(laneIndex);
+    auto token = std::make_shared<LaneQueueToken>(laneStats_[laneIndex].queueDepth_);
+    auto localTask = [this, task = std::move(task), name, laneIndex, token,
+        postTimeUs = TimeUtil::GetCurrentTimeUs() + delayTime * US_PER_MS] {
+        int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
+        token->Leave();
+        LatencyHistogramManager::GetInstance().Record(LatencyCategory::TASK_WAIT, LANE_NAMES[laneIndex],
+            startTimeUs - postTimeUs);
+        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", name.c_str());
+        task();
+        RecordTaskLatency(name, postTimeUs, startTimeUs);
+        ExecuteExportTask();
+    };
+    handler_->PostTask(std::move(localTask), "wms:" + name, delayTime, GetLanePriority(lane));
+}
+
+void TaskScheduler::EnterLaneQueue(size_t laneIndex)
+{
+    auto& laneStat = laneStats_[laneIndex];
+    laneStat.postCount_.fetch_add(1, std::memory_order_relaxed);
+    uint32_t queueDepth = laneStat.queueDepth_.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint32_t maxQueueDepth = laneStat.maxQueueDepth_.load(std::memory_order_relaxed);
+    while (queueDepth > maxQueueDepth &&
+        !laneStat.maxQueueDepth_.compare_exchange_weak(maxQueueDepth, queueDepth, std::memory_order_relaxed)) {
+    }
+}
+
+void TaskScheduler::LeaveLaneQueue(TaskSlot* slot)
+{
+    if (slot->isInLaneQueue_) {
+        slot->isInLaneQueue_ = false;
+        laneStats_[static_cast<size_t>(slot->lane_)].queueDepth_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void TaskScheduler::LeaveLaneQueue(size_t laneIndex, int64_t postTimeUs)
+{
+    laneStats_[laneIndex].queueDepth_.fetch_sub(1, std::memory_order_relaxed);
+    if (postTimeUs >= 0) {
+        LatencyHistogramManager::GetInstance().Record(LatencyCategory::TASK_WAIT, LANE_NAMES[laneIndex],
+            TimeUtil::GetCurrentTimeUs() - postTimeUs);
+    }
+}
+
+void TaskScheduler::PostTaskSlot(TaskSlot* slot, const TaskName& taskName, TaskLane lane, int64_t delayTime)
+{
+    if (lane >= TaskLane::LANE_END) {
+        lane = TaskLane::LAYOUT;
+    }
+    bool isLaneModeEnabled = isLaneModeEnabled_.load(std::memory_order_relaxed);
+    slot->taskName_ = &taskName;
+    slot->postTimeUs_ = TimeUtil::GetCurrentTimeUs() + delayTime * US_PER_MS;
+    slot->lane_ = lane;
+    slot->isInLaneQueue_ = isLaneModeEnabled;
+    if (isLaneModeEnabled) {
+        EnterLaneQueue(static_cast<size_t>(lane));
+    }
+    // the slot is released when the last copy of the handle held by event queue is destroyed
+    handler_->PostTask(TaskSlotRef(slot), taskName.GetQueueName(), delayTime,
+        isLaneModeEnabled ? GetLanePriority(lane) : AppExecFwk::EventQueue::Priority::IMMEDIATE);
+}
+
+void TaskScheduler::RunTaskSlot(TaskSlot* slot)
+{
+    int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
+    if (slot->isInLaneQueue_) {
+        LeaveLaneQueue(slot);
+        LatencyHistogramManager::GetInstance().Record(LatencyCategory::TASK_WAIT,
+            LANE_NAMES[static_cast<size_t>(slot->lane_)], startTimeUs - slot->postTimeUs_);
+    }
+    const TaskName& taskName = *slot->taskName_;
+    StartTraceForTask(taskName);
+    slot->task_();
+    FinishTraceForSyncTask();
+    RecordTaskLatency(taskName.GetName(), slot->postTimeUs_, startTimeUs);
+    ExecuteExportTask();
+}
+
+void TaskScheduler::StartTraceForTask(const TaskName& taskName)
+{
+    StartTrace(HITRACE_TAG_WINDOW_MANAGER, taskName.GetTraceName());
+}
+
+void TaskScheduler::RemoveTask(const TaskName& taskName)
+{
+    handler_->RemoveTask(taskName.GetQueueName());
+}
+
+void TaskScheduler::SetLaneModeEnabled(bool enabled)
+{
+    TLOGI(WmsLogTag::DEFAULT, "enabled: %{public}d", enabled);
+    isLaneModeEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool TaskScheduler::IsLaneModeEnabled() const
+{
+    return isLaneModeEnabled_.load(std::memory_order_relaxed);
+}
+
+uint32_t TaskScheduler::GetLaneQueueDepth(TaskLane lane) const
+{
+    if (lane >= TaskLane::LANE_END) {
+        return 0;
+    }
+    return laneStats_[static_cast<size_t>(lane)].queueDepth_.load(std::memory_order_relaxed);
+}
+
+void TaskScheduler::DumpLaneInfo(std::ostringstream& oss) const
+{
+    oss << "LaneMode: " << (IsLaneModeEnabled() ? "enabled" : "disabled") << std::endl;
+    oss << std::left << std::setw(LANE_NAME_WIDTH) << "Lane"
+        << std::setw(LANE_VALUE_WIDTH) << "Posted"
+        << std::setw(LANE_VALUE_WIDTH) << "Depth"
+        << std::setw(LANE_VALUE_WIDTH) << "MaxDepth" << std::endl;
+    for (size_t i = 0; i < laneStats_.size(); i++) {
+        oss << std::left << std::setw(LANE_NAME_WIDTH) << LANE_NAMES[i]
+            << std::setw(LANE_VALUE_WIDTH) << laneStats_[i].postCount_.load(std::memory_order_relaxed)
+            << std::setw(LANE_VALUE_WIDTH) << laneStats_[i].queueDepth_.load(std::memory_order_relaxed)
+            << std::setw(LANE_VALUE_WIDTH) << laneStats_[i].maxQueueDepth_.load(std::memory_order_relaxed)
+            << std::endl;
+    }
+}
+
 void TaskScheduler::RemoveTask(const std::string& name)
 {
     handler_->RemoveTask("wms:" + name);
@@ -76,9 +360,11 @@ void TaskScheduler::PostVoidSyncTask(Task&& task, const std::string& name)
         task();
         return;
     }
-    auto localTask = [this, &task, &name] {
+    auto localTask = [this, &task, &name, postTimeUs = TimeUtil::GetCurrentTimeUs()] {
+        int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
         HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:%s", name.c_str());
         task();
+        RecordTaskLatency(name, postTimeUs, startTimeUs);
         ExecuteExportTask();
     };
     handler_->PostSyncTask(std::move(localTask), "wms:" + name, AppExecFwk::EventQueue::Priority::IMMEDIATE);
@@ -121,4 +407,11 @@ void FinishTraceForSyncTask()
 {
     FinishTrace(HITRACE_TAG_WINDOW_MANAGER);
 }
+
+void RecordTaskLatency(const std::string& name, int64_t postTimeUs, int64_t startTimeUs)
+{
+    auto& manager = LatencyHistogramManager::GetInstance();
+    manager.Record(LatencyCategory::TASK_WAIT, name, startTimeUs - postTimeUs);
+    manager.Record(LatencyCategory::TASK_RUN, name, TimeUtil::GetCurrentTimeUs() - startTimeUs);
+}
 } // namespace OHOS::Rosen
\ No newline at end of file
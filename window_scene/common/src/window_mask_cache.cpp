@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/include/window_mask_cache.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr uint64_t HASH_SEED = 0x9e3779b97f4a7c15ULL;
+
+void HashCombine(uint64_t& hash, uint64_t value)
+{
+    hash ^= value + HASH_SEED + (hash << 6) + (hash >> 2); // 6, 2: shifts of the usual hash combine
+}
+} // namespace
+
+WM_IMPLEMENT_SINGLE_INSTANCE(WindowMaskCache)
+
+uint64_t WindowMaskCache::HashLayout(const Media::PixelMap& mask)
+{
+    uint64_t hash = 0;
+    HashCombine(hash, static_cast<uint64_t>(mask.GetWidth()));
+    HashCombine(hash, static_cast<uint64_t>(mask.GetHeight()));
+    HashCombine(hash, static_cast<uint64_t>(mask.GetPixelFormat()));
+    HashCombine(hash, static_cast<uint64_t>(mask.GetRowBytes()));
+    HashCombine(hash, static_cast<uint64_t>(mask.GetByteCount()));
+    return hash;
+}
+
+uint64_t WindowMaskCache::HashContent(const Media::PixelMap& mask)
+{
+    uint64_t hash = HashLayout(mask);
+    const uint8_t* pixels = mask.GetPixels();
+    int32_t byteCount = mask.GetByteCount();
+    if (pixels != nullptr && byteCount > 0) {
+        HashCombine(hash, std::hash<std::string_view>{}(
+            std::string_view(reinterpret_cast<const char*>(pixels), static_cast<size_t>(byteCount))));
+    }
+    return hash;
+}
+
+bool WindowMaskCache::IsSameLayout(const Media::PixelMap& left, const Media::PixelMap& right)
+{
+    return left.GetWidth() == right.GetWidth() && left.GetHeight() == right.GetHeight() &&
+        left.GetPixelFormat() == right.GetPixelFormat() && left.GetRowBytes() == right.GetRowBytes() &&
+        left.GetByteCount() == right.GetByteCount();
+}
+
+bool WindowMaskCache::IsSameContent(const Media::PixelMap& left, const Media::PixelMap& right)
+{
+    if (!IsSameLayout(left, right)) {
+        return false;
+    }
+    const uint8_t* leftPixels = left.GetPixels();
+    const uint8_t* rightPixels = right.GetPixels();
+    if (leftPixels == nullptr || rightPixels == nullptr) {
+        return false;
+    }
+    return std::memcmp(leftPixels, rightPixels, static_cast<size_t>(left.GetByteCount())) == 0;
+}
+
+std::shared_ptr<Media::PixelMap> WindowMaskCache::Intern(const std::shared_ptr<Media::PixelMap>& mask)
+{
+    // a mask without readable pixels is never shared
+    if (mask == nullptr || mask->GetPixels() == nullptr || mask->GetByteCount() <= 0) {
+        return mask;
+    }
+    uint64_t layoutHash = HashLayout(*mask);
+    std::lock_guard<std::mutex> lock(mutex_);
+    PruneLocked();
+    auto range = masks_.equal_range(layoutHash);
+    bool hasSameLayout = false;
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        auto internedMask = iter->second.mask_.lock();
+        if (internedMask == mask) {
+            return mask;
+        }
+        hasSameLayout = hasSameLayout || (internedMask != nullptr && IsSameLayout(*internedMask, *mask));
+    }
+    MaskEntry newEntry = { mask, 0, false };
+    if (!hasSameLayout) {
+        masks_.emplace(layoutHash, std::move(newEntry));
+        return mask;
+    }
+    newEntry.contentHash_ = HashContent(*mask);
+    newEntry.hasContentHash_ = true;
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        auto internedMask = iter->second.mask_.lock();
+        if (internedMask == nullptr || !IsSameLayout(*internedMask, *mask)) {
+            continue;
+        }
+        if (!iter->second.hasContentHash_) {
+            iter->second.contentHash_ = HashContent(*internedMask);
+            iter->second.hasContentHash_ = true;
+        }
+        if (iter->second.contentHash_ == newEntry.contentHash_ && IsSameContent(*internedMask, *mask)) {
+            TLOGD(WmsLogTag::WMS_EVENT, "same mask, hash: %{public}" PRIu64, newEntry.contentHash_);
+            return internedMask;
+        }
+    }
+    masks_.emplace(layoutHash, std::move(newEntry));
+    return mask;
+}
+
+size_t WindowMaskCache::Size()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    PruneLocked();
+    return masks_.size();
+}
+
+void WindowMaskCache::PruneLocked()
+{
+    for (auto iter = masks_.begin(); iter != masks_.end();) {
+        if (iter->second.mask_.expired()) {
+            iter = masks_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+} // namespace OHOS::Rosen
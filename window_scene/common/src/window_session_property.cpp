@@ -28,6 +28,11 @@ namespace {
 constexpr uint32_t TOUCH_HOT_AREA_MAX_NUM = 50;
 constexpr uint32_t TRANSITION_ANIMATION_MAP_SIZE_MAX_NUM = 100;
 
+size_t GetKeyboardHotAreaBufferIndex(bool isPanel, bool isLandscape)
+{
+    return (isPanel ? 2 : 0) + (isLandscape ? 0 : 1); // 2: panel buffers follow the keyboard buffers
+}
+
 bool IsValidPiPTemplateType(uint32_t type)
 {
     return type < static_cast<uint32_t>(PiPTemplateType::END);
@@ -910,9 +915,12 @@ bool WindowSessionProperty::IsFloatingWindowAppType() const
     return isFloatingWindowAppType_;
 }
 
-void WindowSessionProperty::setTouchHotAreasInner(const std::vector<Rect>& rects, std::vector<Rect>& touchHotAreas)
+bool WindowSessionProperty::setTouchHotAreasInner(const std::vector<Rect>& rects, std::vector<Rect>& touchHotAreas)
 {
-    if (GetPersistentId() != 0 && rects != touchHotAreas) {
+    if (rects == touchHotAreas) {
+        return false;
+    }
+    if (GetPersistentId() != 0) {
         std::ostringstream oss;
         for (const auto& rect : rects) {
             oss << "[" << rect.posX_ << "," << rect.posY_ << "," << rect.width_ << "," << rect.height_ << "]";
@@ -920,13 +928,16 @@ void WindowSessionProperty::setTouchHotAreasInner(const std::vector<Rect>& rects
         TLOGI(WmsLogTag::WMS_EVENT, "id:%{public}d hot:%{public}s", GetPersistentId(), oss.str().c_str());
     }
     touchHotAreas = rects;
+    return true;
 }
 
 void WindowSessionProperty::SetTouchHotAreas(const std::vector<Rect>& rects)
 {
     {
         std::lock_guard lock(touchHotAreasMutex_);
-        setTouchHotAreasInner(rects, touchHotAreas_);
+        if (setTouchHotAreasInner(rects, touchHotAreas_)) {
+            touchHotAreaBuffer_ = nullptr;
+        }
     }
     if (touchHotAreasChangeCallback_) {
         touchHotAreasChangeCallback_();
@@ -937,14 +948,22 @@ void WindowSessionProperty::SetKeyboardTouchHotAreas(const KeyboardTouchHotAreas
 {
     {
         std::lock_guard lock(touchHotAreasMutex_);
-        setTouchHotAreasInner(
-            keyboardTouchHotAreas.landscapeKeyboardHotAreas_, keyboardTouchHotAreas_.landscapeKeyboardHotAreas_);
-        setTouchHotAreasInner(
-            keyboardTouchHotAreas.portraitKeyboardHotAreas_, keyboardTouchHotAreas_.portraitKeyboardHotAreas_);
-        setTouchHotAreasInner(
-            keyboardTouchHotAreas.landscapePanelHotAreas_, keyboardTouchHotAreas_.landscapePanelHotAreas_);
-        setTouchHotAreasInner(
-            keyboardTouchHotAreas.portraitPanelHotAreas_, keyboardTouchHotAreas_.portraitPanelHotAreas_);
+        if (setTouchHotAreasInner(keyboardTouchHotAreas.landscapeKeyboardHotAreas_,
+            keyboardTouchHotAreas_.landscapeKeyboardHotAreas_)) {
+            keyboardHotAreaBuffers_[GetKeyboardHotAreaBufferIndex(false, true)] = nullptr;
+        }
+        if (setTouchHotAreasInner(keyboardTouchHotAreas.portraitKeyboardHotAreas_,
+            keyboardTouchHotAreas_.portraitKeyboardHotAreas_)) {
+            keyboardHotAreaBuffers_[GetKeyboardHotAreaBufferIndex(false, false)] = nullptr;
+        }
+        if (setTouchHotAreasInner(keyboardTouchHotAreas.landscapePanelHotAreas_,
+            keyboardTouchHotAreas_.landscapePanelHotAreas_)) {
+            keyboardHotAreaBuffers_[GetKeyboardHotAreaBufferIndex(true, true)] = nullptr;
+        }
+        if (setTouchHotAreasInner(keyboardTouchHotAreas.portraitPanelHotAreas_,
+            keyboardTouchHotAreas_.portraitPanelHotAreas_)) {
+            keyboardHotAreaBuffers_[GetKeyboardHotAreaBufferIndex(true, false)] = nullptr;
+        }
         keyboardTouchHotAreas_.displayId_ = keyboardTouchHotAreas.displayId_;
     }
     if (touchHotAreasChangeCallback_) {
@@ -964,6 +983,36 @@ KeyboardTouchHotAreas WindowSessionProperty::GetKeyboardTouchHotAreas() const
     return keyboardTouchHotAreas_;
 }
 
+DisplayId WindowSessionProperty::GetKeyboardTouchHotAreasDisplayId() const
+{
+    std::lock_guard lock(touchHotAreasMutex_);
+    return keyboardTouchHotAreas_.displayId_;
+}
+
+HotAreaBufferPtr WindowSessionProperty::GetTouchHotAreaBuffer() const
+{
+    std::lock_guard lock(touchHotAreasMutex_);
+    if (touchHotAreaBuffer_ == nullptr) {
+        touchHotAreaBuffer_ = HotAreaBuffer::Create(touchHotAreas_);
+    }
+    return touchHotAreaBuffer_;
+}
+
+HotAreaBufferPtr WindowSessionProperty::GetKeyboardHotAreaBuffer(bool isPanel, bool isLandscape) const
+{
+    std::lock_guard lock(touchHotAreasMutex_);
+    auto& buffer = keyboardHotAreaBuffers_[GetKeyboardHotAreaBufferIndex(isPanel, isLandscape)];
+    if (buffer == nullptr) {
+        const auto& hotAreas = isPanel ?
+            (isLandscape ? keyboardTouchHotAreas_.landscapePanelHotAreas_ :
+                keyboardTouchHotAreas_.portraitPanelHotAreas_) :
+            (isLandscape ? keyboardTouchHotAreas_.landscapeKeyboardHotAreas_ :
+                keyboardTouchHotAreas_.portraitKeyboardHotAreas_);
+        buffer = HotAreaBuffer::Create(hotAreas);
+    }
+    return buffer;
+}
+
 void WindowSessionProperty::KeepKeyboardOnFocus(bool keepKeyboardFlag)
 {
     keepKeyboardFlag_ = keepKeyboardFlag;
@@ -1930,8 +1979,16 @@ void WindowSessionProperty::CopyFrom(const sptr<WindowSessionProperty>& property
     animationFlag_ = property->animationFlag_;
     trans_ = property->trans_;
     isFloatingWindowAppType_ = property->isFloatingWindowAppType_;
-    touchHotAreas_ = property->touchHotAreas_;
-    keyboardTouchHotAreas_ = property->keyboardTouchHotAreas_;
+    std::vector<Rect> touchHotAreas;
+    property->GetTouchHotAreas(touchHotAreas);
+    KeyboardTouchHotAreas keyboardTouchHotAreas = property->GetKeyboardTouchHotAreas();
+    {
+        std::lock_guard lock(touchHotAreasMutex_);
+        touchHotAreas_ = std::move(touchHotAreas);
+        keyboardTouchHotAreas_ = std::move(keyboardTouchHotAreas);
+        touchHotAreaBuffer_ = nullptr;
+        keyboardHotAreaBuffers_.fill(nullptr);
+    }
     hideNonSystemFloatingWindows_ = property->hideNonSystemFloatingWindows_;
     isSkipSelfWhenShowOnVirtualScreen_ = property->isSkipSelfWhenShowOnVirtualScreen_;
     isSkipEventOnCastPlus_ = property->isSkipEventOnCastPlus_;
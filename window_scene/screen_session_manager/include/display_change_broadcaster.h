@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_DISPLAY_CHANGE_BROADCASTER_H
+#define OHOS_ROSEN_DISPLAY_CHANGE_BROADCASTER_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "display_info.h"
+#include "dm_common.h"
+#include "zidl/idisplay_manager_agent.h"
+
+namespace OHOS {
+namespace Rosen {
+class FfrtQueueHelper;
+
+struct DisplayChangeAgentStats {
+    int32_t pid_ = -1;
+    uint64_t sentCount_ = 0;
+    // change events replaced by a newer change of the same display and type before being sent
+    uint64_t droppedCount_ = 0;
+    // one-way sends taking longer than the slow send threshold
+    uint64_t slowSendCount_ = 0;
+    // from broadcast to send completion
+    int64_t totalLatencyUs_ = 0;
+    int64_t maxLatencyUs_ = 0;
+};
+
+/**
+ * @brief Fan out display create, change and destroy events to display event listeners.
+ *
+ * Every agent has one ordered queue of all its display events drained on a bounded worker pool through the agent
+ * proxy, so a slow agent only delays its own events. A queued change is replaced in place by a newer change of the
+ * same display and type, unless a create or destroy of that display is queued after it.
+ * The proxy marshals the event once per agent, the display info is not serialized once for all agents.
+ */
+class DisplayChangeBroadcaster {
+public:
+    using SubmitFunc = std::function<void(std::function<void()>&&)>;
+
+    /**
+     * @param submitFunc Worker pool the agent queues are drained on, a dedicated ffrt concurrent queue if null.
+     * @param slowSendThresholdUs One-way sends taking longer are counted as slow sends of the agent.
+     */
+    explicit DisplayChangeBroadcaster(SubmitFunc submitFunc = nullptr, int64_t slowSendThresholdUs = 100000);
+    ~DisplayChangeBroadcaster() = default;
+
+    void Broadcast(const sptr<DisplayInfo>& displayInfo, DisplayChangeEvent event,
+        const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids);
+    void BroadcastCreate(const sptr<DisplayInfo>& displayInfo,
+        const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids);
+    void BroadcastDestroy(DisplayId displayId, const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids);
+    void RemoveAgent(const sptr<IRemoteObject>& remoteObject);
+    std::vector<DisplayChangeAgentStats> GetAgentStats();
+    void Dump(std::string& dumpInfo);
+
+private:
+    enum class PayloadType : uint32_t {
+        CREATE,
+        CHANGE,
+        DESTROY,
+    };
+
+    struct Payload {
+        PayloadType type_ = PayloadType::CHANGE;
+        DisplayId displayId_ = DISPLAY_ID_INVALID;
+        DisplayChangeEvent event_ = DisplayChangeEvent::UNKNOWN;
+        int64_t broadcastTimeUs_ = 0;
+        sptr<DisplayInfo> displayInfo_;
+    };
+
+    struct AgentChannel {
+        sptr<IDisplayManagerAgent> agent_;
+        std::mutex mutex_;
+        std::deque<std::shared_ptr<const Payload>> queue_;
+        bool isDraining_ = false;
+        DisplayChangeAgentStats stats_;
+    };
+
+    void Enqueue(const std::shared_ptr<const Payload>& payload,
+        const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids);
+    static bool Supersede(AgentChannel& channel, const std::shared_ptr<const Payload>& payload);
+    std::shared_ptr<AgentChannel> GetOrCreateChannel(const sptr<IDisplayManagerAgent>& agent, int32_t pid);
+    static void Drain(const std::shared_ptr<AgentChannel>& channel, int64_t slowSendThresholdUs);
+    static void Send(const sptr<IDisplayManagerAgent>& agent, const Payload& payload);
+
+    std::shared_ptr<FfrtQueueHelper> ffrtQueueHelper_;
+    SubmitFunc submitFunc_;
+    int64_t slowSendThresholdUs_;
+    std::mutex channelMutex_;
+    std::map<sptr<IRemoteObject>, std::shared_ptr<AgentChannel>> channels_;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_DISPLAY_CHANGE_BROADCASTER_H
@@ -16,6 +16,7 @@
 #ifndef OHOS_ROSEN_WINDOW_SCENE_SECONDARY_DISPLAY_FOLD_POLICY_H
 #define OHOS_ROSEN_WINDOW_SCENE_SECONDARY_DISPLAY_FOLD_POLICY_H
 
+#include <condition_variable>
 #include <refbase.h>
 
 #include "common/include/task_scheduler.h"
@@ -55,6 +56,8 @@ private:
     void UpdatePositionZForDualDisplayNode();
     void RecoverWhenBootAnimationExit();
     void ReportFoldDisplayModeChange(FoldDisplayMode displayMode);
+    bool WaitCoordinationExit();
+    void NotifyCoordinationExit();
     void SendPropertyChangeResult(sptr<ScreenSession> screenSession, ScreenId screenId,
         ScreenPropertyChangeReason reason, FoldDisplayMode displayMode);
     void SetStatusConditionalActiveRectAndTpFeature(ScreenProperty &screenProperty);
@@ -70,6 +73,9 @@ private:
         std::vector<DMRect>& foldCreaseRect) const;
     std::recursive_mutex& displayInfoMutex_;
     std::mutex coordinationMutex_;
+    // only guards the wait, the display mode itself is guarded by displayModeMutex_
+    std::mutex coordinationExitMutex_;
+    std::condition_variable coordinationExitCV_;
     std::shared_ptr<TaskScheduler> screenPowerTaskScheduler_;
     std::vector<uint32_t> screenParams_;
     bool changeScreenWhenBootCompleted_ = false;
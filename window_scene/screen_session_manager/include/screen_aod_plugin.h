@@ -31,6 +31,9 @@ extern const std::string PLUGIN_AOD_SO_PATH;
 extern const std::string PLUGIN_AOD_SO_PATH;
 #endif
 
+// name used to load the aod plugin asynchronously by PluginLoader
+inline const std::string AOD_PLUGIN_NAME = "dms_aod";
+
 bool LoadAodLib(void);
 void UnloadAodLib(void);
 bool IsInAod();
@@ -37,6 +37,8 @@ typedef struct MotionSensorEvent {
 using OnMotionChangedPtr = void (*)(const MotionSensorEvent&);
 using MotionSubscribeCallbackPtr =  bool (*)(int32_t, OnMotionChangedPtr);
 using MotionUnsubscribeCallbackPtr = bool (*)(int32_t, OnMotionChangedPtr);
+// name used to load the motion plugin asynchronously by PluginLoader
+inline const std::string MOTION_PLUGIN_NAME = "dms_motion";
 
 bool LoadMotionSensor(void);
 void UnloadMotionSensor(void);
@@ -601,6 +601,9 @@ public:
     void SetRSScreenPowerStatus(ScreenId screenId, ScreenPowerStatus status, ScreenPowerEvent event);
     bool SetRSScreenPowerStatusExt(ScreenId screenId, ScreenPowerStatus status,
         ScreenPowerOnReason reason = ScreenPowerOnReason::DEFAULT);
+    uint64_t GetRSScreenPowerRequestSeq(ScreenId screenId);
+    bool WaitRSScreenPowerStatus(ScreenId screenId, ScreenPowerStatus status, uint64_t lastRequestSeq,
+        uint32_t timeoutMs);
     void NotifyScreenMaskAppear() override;
     bool IsSystemSleep();
     bool IsNeedAddInputServiceAbility();
@@ -20,6 +20,7 @@
 #include "dm_common.h"
 #include "wm_single_instance.h"
 #include "client_agent_container.h"
+#include "display_change_broadcaster.h"
 #include "zidl/idisplay_manager_agent.h"
 
 namespace OHOS {
@@ -65,9 +66,12 @@ public:
         int32_t uid = INVALID_UID);
     bool IsAgentListenedAttributes(std::set<std::string>& listenedAttributes,
         const std::vector<std::string>& attributes);
+    void DumpDisplayChangeStats(std::string& dumpInfo);
 private:
-    ScreenSessionManagerAdapter() {}
+    ScreenSessionManagerAdapter();
     virtual ~ScreenSessionManagerAdapter() = default;
+
+    DisplayChangeBroadcaster displayChangeBroadcaster_;
 };
 }
 }
@@ -17,6 +17,7 @@
 #ifndef OHOS_ROSEN_DMS_SCREEN_POWER_MGR_H
 #define OHOS_ROSEN_DMS_SCREEN_POWER_MGR_H
  
+#include <condition_variable>
 #include <map>
 #include <mutex>
  
@@ -39,11 +40,39 @@ public:
  
     virtual void DoSetScreenPowerStatus(ScreenId rsScreenId, ScreenPowerStatus status);
  
+    /**
+     * @brief Sequence number of the last power status request of the screen, read it before setting the status
+     * to wait for.
+     */
+    uint64_t GetScreenPowerRequestSeq(ScreenId rsScreenId);
+
+    /**
+     * @brief Wait until a power status requested after lastRequestSeq takes effect, instead of sleeping a fixed time.
+     * POWER_STATUS_ON completes on the first frame committed by RS, other statuses complete when RS acks them.
+     * Acks of older requests never complete the wait, so it times out if no new status was set.
+     *
+     * @param timeoutMs Fallback when no completion event arrives.
+     * @return false if timeout.
+     */
+    bool WaitScreenPowerStatusApplied(ScreenId rsScreenId, ScreenPowerStatus status, uint64_t lastRequestSeq,
+        uint32_t timeoutMs);
+    void NotifyFirstFrameCommit(ScreenId rsScreenId);
+ 
 protected:
     ScreenPowerMgr();
     void SetTpFeatureConfig(int32_t tpType, const std::string& tpConfig);
+    virtual ScreenPowerStatus GetRSScreenPowerStatus(ScreenId rsScreenId);
+    uint64_t AddScreenPowerRequest(ScreenId rsScreenId);
+
+    struct ScreenPowerAck {
+        uint64_t requestSeq_ = 0;
+        uint64_t ackedSeq_ = 0;
+    };
     std::mutex screenPowerStatusMapMutex_;
     std::map<ScreenId, ScreenPowerStatus> screenPowerStatusMap_;
+    std::mutex screenPowerAckMutex_;
+    std::condition_variable screenPowerAckCV_;
+    std::map<ScreenId, ScreenPowerAck> screenPowerAckMap_;
 };
  
 }  // namespace DMS
@@ -15,6 +15,10 @@
  
 #include "screen_power_mgr.h"
  
+#include <algorithm>
+#include <chrono>
+ 
+#include "dms_global_mutex.h"
 #include "product_ext_wrapper.h"
 #include "window_manager_hilog.h"
  
@@ -90,6 +94,7 @@ void ScreenPowerMgr::DoSetScreenPowerStatus(ScreenId rsScreenId, ScreenPowerStat
             rsScreenId, status);
         status = ScreenPowerStatus::POWER_STATUS_OFF_ADVANCED;
     }
+    AddScreenPowerRequest(rsScreenId);
     RSInterfaces::GetInstance().SetScreenPowerStatus(rsScreenId, status);
     {
         std::lock_guard<std::mutex> lock(screenPowerStatusMapMutex_);
@@ -97,6 +102,53 @@ void ScreenPowerMgr::DoSetScreenPowerStatus(ScreenId rsScreenId, ScreenPowerStat
     }
 }
  
+ScreenPowerStatus ScreenPowerMgr::GetRSScreenPowerStatus(ScreenId rsScreenId)
+{
+    return RSInterfaces::GetInstance().GetScreenPowerStatus(rsScreenId);
+}
+ 
+uint64_t ScreenPowerMgr::AddScreenPowerRequest(ScreenId rsScreenId)
+{
+    std::lock_guard<std::mutex> lock(screenPowerAckMutex_);
+    return ++screenPowerAckMap_[rsScreenId].requestSeq_;
+}
+ 
+uint64_t ScreenPowerMgr::GetScreenPowerRequestSeq(ScreenId rsScreenId)
+{
+    std::lock_guard<std::mutex> lock(screenPowerAckMutex_);
+    return screenPowerAckMap_[rsScreenId].requestSeq_;
+}
+ 
+void ScreenPowerMgr::NotifyFirstFrameCommit(ScreenId rsScreenId)
+{
+    std::lock_guard<std::mutex> lock(screenPowerAckMutex_);
+    auto& ack = screenPowerAckMap_[rsScreenId];
+    ack.ackedSeq_ = ack.requestSeq_;
+    screenPowerAckCV_.notify_all();
+}
+ 
+bool ScreenPowerMgr::WaitScreenPowerStatusApplied(ScreenId rsScreenId, ScreenPowerStatus status,
+    uint64_t lastRequestSeq, uint32_t timeoutMs)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    uint64_t requestSeq = GetScreenPowerRequestSeq(rsScreenId);
+    // RS handles the requests of one connection in order, so reading back the new status acks the sets before it
+    bool isAcked = status != ScreenPowerStatus::POWER_STATUS_ON && requestSeq > lastRequestSeq &&
+        GetRSScreenPowerStatus(rsScreenId) == status;
+    std::unique_lock<std::mutex> lock(screenPowerAckMutex_);
+    auto& ack = screenPowerAckMap_[rsScreenId];
+    if (isAcked) {
+        ack.ackedSeq_ = std::max(ack.ackedSeq_, requestSeq);
+    }
+    bool isApplied = DmUtils::safe_wait_for(screenPowerAckCV_, lock, std::chrono::milliseconds(timeoutMs),
+        [&ack, lastRequestSeq] { return ack.ackedSeq_ > lastRequestSeq; });
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    TLOGNFI(WmsLogTag::DMS, "[UL_POWER]screenId: %{public}" PRIu64 ", status: %{public}u, applied: %{public}d, "
+        "cost: %{public}lld ms", rsScreenId, static_cast<uint32_t>(status), isApplied, static_cast<long long>(costMs));
+    return isApplied;
+}
+ 
 void ScreenPowerMgr::SetTpFeatureConfig(int32_t tpType, const std::string& tpConfig)
 {
     TLOGI(WmsLogTag::DMS, "ScreenPowerMgr SetTpFeatureConfig+");
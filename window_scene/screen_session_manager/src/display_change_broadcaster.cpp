@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "display_change_broadcaster.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "ffrt_queue_helper.h"
+#include "time_util.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t STATS_PID_WIDTH = 10;
+constexpr int32_t STATS_VALUE_WIDTH = 12;
+} // namespace
+
+DisplayChangeBroadcaster::DisplayChangeBroadcaster(SubmitFunc submitFunc, int64_t slowSendThresholdUs)
+    : submitFunc_(std::move(submitFunc)), slowSendThresholdUs_(slowSendThresholdUs)
+{
+    if (submitFunc_ == nullptr) {
+        ffrtQueueHelper_ = std::make_shared<FfrtQueueHelper>();
+        submitFunc_ = [ffrtQueueHelper = ffrtQueueHelper_](std::function<void()>&& task) {
+            ffrtQueueHelper->SubmitTask(std::move(task));
+        };
+    }
+}
+
+void DisplayChangeBroadcaster::Broadcast(const sptr<DisplayInfo>& displayInfo, DisplayChangeEvent event,
+    const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids)
+{
+    if (displayInfo == nullptr || agentPids.empty()) {
+        return;
+    }
+    auto payload = std::make_shared<Payload>();
+    payload->type_ = PayloadType::CHANGE;
+    payload->displayId_ = displayInfo->GetDisplayId();
+    payload->event_ = event;
+    payload->displayInfo_ = displayInfo;
+    payload->broadcastTimeUs_ = TimeUtil::GetCurrentTimeUs();
+    Enqueue(payload, agentPids);
+}
+
+void DisplayChangeBroadcaster::BroadcastCreate(const sptr<DisplayInfo>& displayInfo,
+    const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids)
+{
+    if (displayInfo == nullptr || agentPids.empty()) {
+        return;
+    }
+    auto payload = std::make_shared<Payload>();
+    payload->type_ = PayloadType::CREATE;
+    payload->displayId_ = displayInfo->GetDisplayId();
+    payload->displayInfo_ = displayInfo;
+    payload->broadcastTimeUs_ = TimeUtil::GetCurrentTimeUs();
+    Enqueue(payload, agentPids);
+}
+
+void DisplayChangeBroadcaster::BroadcastDestroy(DisplayId displayId,
+    const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids)
+{
+    if (agentPids.empty()) {
+        return;
+    }
+    auto payload = std::make_shared<Payload>();
+    payload->type_ = PayloadType::DESTROY;
+    payload->displayId_ = displayId;
+    payload->broadcastTimeUs_ = TimeUtil::GetCurrentTimeUs();
+    Enqueue(payload, agentPids);
+}
+
+void DisplayChangeBroadcaster::Enqueue(const std::shared_ptr<const Payload>& payload,
+    const std::map<sptr<IDisplayManagerAgent>, int32_t>& agentPids)
+{
+    for (const auto& [agent, pid] : agentPids) {
+        auto channel = GetOrCreateChannel(agent, pid);
+        if (channel == nullptr) {
+            continue;
+        }
+        bool needDrain = false;
+        {
+            std::lock_guard<std::mutex> lock(channel->mutex_);
+            if (!Supersede(*channel, payload)) {
+                channel->queue_.push_back(payload);
+            }
+            if (!channel->isDraining_) {
+                channel->isDraining_ = true;
+                needDrain = true;
+            }
+        }
+        if (needDrain) {
+            submitFunc_([channel, slowSendThresholdUs = slowSendThresholdUs_] {
+                Drain(channel, slowSendThresholdUs);
+            });
+        }
+    }
+}
+
+bool DisplayChangeBroadcaster::Supersede(AgentChannel& channel, const std::shared_ptr<const Payload>& payload)
+{
+    if (payload->type_ != PayloadType::CHANGE) {
+        return false;
+    }
+    // a change must not pass a create or destroy of its display, so only look behind the last of them
+    for (auto iter = channel.queue_.rbegin(); iter != channel.queue_.rend(); ++iter) {
+        const auto& queued = *iter;
+        if (queued->displayId_ != payload->displayId_) {
+            continue;
+        }
+        if (queued->type_ != PayloadType::CHANGE) {
+            return false;
+        }
+        if (queued->event_ == payload->event_) {
+            *iter = payload;
+            channel.stats_.droppedCount_++;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<DisplayChangeBroadcaster::AgentChannel> DisplayChangeBroadcaster::GetOrCreateChannel(
+    const sptr<IDisplayManagerAgent>& agent, int32_t pid)
+{
+    if (agent == nullptr || agent->AsObject() == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    auto& channel = channels_[agent->AsObject()];
+    if (channel == nullptr) {
+        channel = std::make_shared<AgentChannel>();
+        channel->agent_ = agent;
+    }
+    std::lock_guard<std::mutex> channelLock(channel->mutex_);
+    channel->stats_.pid_ = pid;
+    return channel;
+}
+
+void DisplayChangeBroadcaster::Drain(const std::shared_ptr<AgentChannel>& channel, int64_t slowSendThresholdUs)
+{
+    while (true) {
+        std::shared_ptr<const Payload> payload;
+        int32_t pid = -1;
+        {
+            std::lock_guard<std::mutex> lock(channel->mutex_);
+            if (channel->queue_.empty()) {
+                channel->isDraining_ = false;
+                return;
+            }
+            payload = channel->queue_.front();
+            channel->queue_.pop_front();
+            pid = channel->stats_.pid_;
+        }
+        int64_t sendStartUs = TimeUtil::GetCurrentTimeUs();
+        Send(channel->agent_, *payload);
+        int64_t sendEndUs = TimeUtil::GetCurrentTimeUs();
+        bool isSlowSend = sendEndUs - sendStartUs > slowSendThresholdUs;
+        {
+            std::lock_guard<std::mutex> lock(channel->mutex_);
+            auto& stats = channel->stats_;
+            int64_t latencyUs = sendEndUs - payload->broadcastTimeUs_;
+            stats.sentCount_++;
+            stats.totalLatencyUs_ += latencyUs;
+            stats.maxLatencyUs_ = std::max(stats.maxLatencyUs_, latencyUs);
+            if (isSlowSend) {
+                stats.slowSendCount_++;
+            }
+        }
+        if (isSlowSend) {
+            TLOGW(WmsLogTag::DMS, "send slow, pid:%{public}d, type:%{public}u, event:%{public}u, "
+                "cost:%{public}" PRId64 "us", pid, static_cast<uint32_t>(payload->type_),
+                static_cast<uint32_t>(payload->event_), sendEndUs - sendStartUs);
+        }
+    }
+}
+
+void DisplayChangeBroadcaster::Send(const sptr<IDisplayManagerAgent>& agent, const Payload& payload)
+{
+    switch (payload.type_) {
+        case PayloadType::CREATE:
+            agent->OnDisplayCreate(payload.displayInfo_);
+            break;
+        case PayloadType::CHANGE:
+            agent->OnDisplayChange(payload.displayInfo_, payload.event_);
+            break;
+        case PayloadType::DESTROY:
+            agent->OnDisplayDestroy(payload.displayId_);
+            break;
+        default:
+            break;
+    }
+}
+
+void DisplayChangeBroadcaster::RemoveAgent(const sptr<IRemoteObject>& remoteObject)
+{
+    if (remoteObject == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    auto iter = channels_.find(remoteObject);
+    if (iter == channels_.end()) {
+        return;
+    }
+    {
+        // the running drain task holds the channel, clearing the queue lets it finish after the current send
+        std::lock_guard<std::mutex> channelLock(iter->second->mutex_);
+        iter->second->queue_.clear();
+    }
+    channels_.erase(iter);
+}
+
+std::vector<DisplayChangeAgentStats> DisplayChangeBroadcaster::GetAgentStats()
+{
+    std::vector<DisplayChangeAgentStats> agentStats;
+    std::lock_guard<std::mutex> lock(channelMutex_);
+    for (const auto& [remoteObject, channel] : channels_) {
+        std::lock_guard<std::mutex> channelLock(channel->mutex_);
+        agentStats.push_back(channel->stats_);
+    }
+    return agentStats;
+}
+
+void DisplayChangeBroadcaster::Dump(std::string& dumpInfo)
+{
+    auto agentStats = GetAgentStats();
+    std::sort(agentStats.begin(), agentStats.end(), [](const auto& left, const auto& right) {
+        return left.maxLatencyUs_ > right.maxLatencyUs_;
+    });
+    std::ostringstream oss;
+    oss << "----------------------------------DisplayChangeAgents"
+        << "----------------------------------" << std::endl;
+    oss << std::left << std::setw(STATS_PID_WIDTH) << "Pid"
+        << std::setw(STATS_VALUE_WIDTH) << "Sent"
+        << std::setw(STATS_VALUE_WIDTH) << "Dropped"
+        << std::setw(STATS_VALUE_WIDTH) << "SlowSend"
+        << std::setw(STATS_VALUE_WIDTH) << "Avg(us)"
+        << std::setw(STATS_VALUE_WIDTH) << "Max(us)" << std::endl;
+    for (const auto& stats : agentStats) {
+        int64_t avgLatencyUs = stats.sentCount_ == 0 ? 0 :
+            stats.totalLatencyUs_ / static_cast<int64_t>(stats.sentCount_);
+        oss << std::left << std::setw(STATS_PID_WIDTH) << stats.pid_
+            << std::setw(STATS_VALUE_WIDTH) << stats.sentCount_
+            << std::setw(STATS_VALUE_WIDTH) << stats.droppedCount_
+            << std::setw(STATS_VALUE_WIDTH) << stats.slowSendCount_
+            << std::setw(STATS_VALUE_WIDTH) << avgLatencyUs
+            << std::setw(STATS_VALUE_WIDTH) << stats.maxLatencyUs_ << std::endl;
+    }
+    dumpInfo.append(oss.str());
+}
+} // namespace Rosen
+} // namespace OHOS
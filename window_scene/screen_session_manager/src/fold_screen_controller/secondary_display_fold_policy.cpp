@@ -18,6 +18,7 @@
 #include <hitrace_meter.h>
 #include <transaction/rs_interfaces.h>
 #include <parameters.h>
+#include "dms_global_mutex.h"
 #include "rs_adapter.h"
 #include "session/screen/include/screen_session.h"
 #include "screen_session_manager.h"
@@ -52,7 +53,7 @@ constexpr float ROTATION_TRANSLATE_X = 612;
 constexpr float ROTATION_TRANSLATE_Y = -612;
 constexpr float FULL_NODE_POSITION_Z = 0.0f;
 constexpr float MAIN_NODE_POSITION_Z = 1.0f;
-const static uint32_t COORDINATION_DELAY_TIMEOUT = 600000;
+const static uint32_t COORDINATION_DELAY_TIMEOUT_MS = 600;
 constexpr int32_t FOLD_CREASE_RECT_SIZE = 8; // numbers of parameter on the current device is 8
 const std::string g_FoldScreenRect = system::GetParameter("const.display.foldscreen.crease_region", "");
 const std::string FOLD_CREASE_DELIMITER = ",;";
@@ -251,8 +252,7 @@ void SecondaryDisplayFoldPolicy::ChangeScreenDisplayMode(FoldDisplayMode display
     }
     if (reason == DisplayModeChangeReason::SETMODE && currentDisplayMode_ == FoldDisplayMode::COORDINATION &&
         displayMode == FoldDisplayMode::FULL) {
-        usleep(COORDINATION_DELAY_TIMEOUT);
-        if (currentDisplayMode_ != FoldDisplayMode::COORDINATION) {
+        if (WaitCoordinationExit()) {
             TLOGE(WmsLogTag::DMS, "currentDisplayMode is not coordination, exist");
             return;
         }
@@ -282,6 +282,7 @@ void SecondaryDisplayFoldPolicy::ChangeScreenDisplayMode(FoldDisplayMode display
         std::lock_guard<std::recursive_mutex> lock_mode(displayModeMutex_);
         currentDisplayMode_ = displayMode;
     }
+    NotifyCoordinationExit();
     uint32_t deviceStatus = (displayMode == FoldDisplayMode::GLOBAL_FULL) ?
         static_cast<uint32_t>(DMDeviceStatus::STATUS_GLOBAL_FULL) :
         static_cast<uint32_t>(DMDeviceStatus::UNKNOWN);
@@ -421,11 +422,30 @@ void SecondaryDisplayFoldPolicy::ExitCoordination()
     RSInterfaces::GetInstance().SetTpFeatureConfig(TP_TYPE, STATUS_FULL, TpFeatureConfigType::AFT_TP_FEATURE);
 #endif
     FoldDisplayMode displayMode = GetModeMatchStatus();
-    currentDisplayMode_ = displayMode;
-    lastDisplayMode_ = displayMode;
+    {
+        std::lock_guard<std::recursive_mutex> lock_mode(displayModeMutex_);
+        currentDisplayMode_ = displayMode;
+        lastDisplayMode_ = displayMode;
+    }
+    NotifyCoordinationExit();
     TLOGI(WmsLogTag::DMS, "Exit coordination, current display mode:%{public}d", displayMode);
 }
 
+bool SecondaryDisplayFoldPolicy::WaitCoordinationExit()
+{
+    std::unique_lock<std::mutex> lock(coordinationExitMutex_);
+    return DmUtils::safe_wait_for(coordinationExitCV_, lock,
+        std::chrono::milliseconds(COORDINATION_DELAY_TIMEOUT_MS),
+        [this] { return GetCurrentDisplayMode() != FoldDisplayMode::COORDINATION; });
+}
+
+void SecondaryDisplayFoldPolicy::NotifyCoordinationExit()
+{
+    // call after the display mode is written, without holding coordinationMutex_
+    std::unique_lock<std::mutex> lock(coordinationExitMutex_);
+    coordinationExitCV_.notify_all();
+}
+
 void SecondaryDisplayFoldPolicy::SetOnBootAnimation(bool onBootAnimation)
 {
     TLOGW(WmsLogTag::DMS, "onBootAnimation: %{public}d", onBootAnimation);
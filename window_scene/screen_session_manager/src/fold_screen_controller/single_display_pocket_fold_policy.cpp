@@ -612,17 +612,19 @@ void SingleDisplayPocketFoldPolicy::ChangeScreenDisplayModeToFullOnBootAnimation
 
 void SingleDisplayPocketFoldPolicy::BootAnimationFinishPowerInit()
 {
-    int64_t timeStamp = 50;
+    uint32_t powerTimeoutMs = 50;
     auto bootPowerTask = [=] {
         if (screenId_ == SCREEN_ID_FULL) {
             TLOGI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Full animation Init 1.");
             ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_FULL,
                 ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
             ScreenSessionManager::GetInstance().SetNeedAnotherScreenKeepOffFake(true);
+            uint64_t mainRequestSeq = ScreenSessionManager::GetInstance().GetRSScreenPowerRequestSeq(SCREEN_ID_MAIN);
             ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
                 ScreenPowerStatus::POWER_STATUS_ON);
             ScreenSessionManager::GetInstance().SetNeedAnotherScreenKeepOffFake(false);
-            std::this_thread::sleep_for(std::chrono::milliseconds(timeStamp));
+            ScreenSessionManager::GetInstance().WaitRSScreenPowerStatus(SCREEN_ID_MAIN,
+                ScreenPowerStatus::POWER_STATUS_ON, mainRequestSeq, powerTimeoutMs);
             TLOGI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Full animation Init 2.");
 #ifdef TP_FEATURE_ENABLE
             RSInterfaces::GetInstance().SetTpFeatureConfig(TP_TYPE, FULL_TP.c_str());
@@ -636,10 +638,12 @@ void SingleDisplayPocketFoldPolicy::BootAnimationFinishPowerInit()
             ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
                 ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
             ScreenSessionManager::GetInstance().SetNeedAnotherScreenKeepOffFake(true);
+            uint64_t fullRequestSeq = ScreenSessionManager::GetInstance().GetRSScreenPowerRequestSeq(SCREEN_ID_FULL);
             ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_FULL,
                 ScreenPowerStatus::POWER_STATUS_ON);
             ScreenSessionManager::GetInstance().SetNeedAnotherScreenKeepOffFake(false);
-            std::this_thread::sleep_for(std::chrono::milliseconds(timeStamp));
+            ScreenSessionManager::GetInstance().WaitRSScreenPowerStatus(SCREEN_ID_FULL,
+                ScreenPowerStatus::POWER_STATUS_ON, fullRequestSeq, powerTimeoutMs);
             TLOGI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Main animation Init 4.");
 #ifdef TP_FEATURE_ENABLE
             RSInterfaces::GetInstance().SetTpFeatureConfig(TP_TYPE, MAIN_TP.c_str());
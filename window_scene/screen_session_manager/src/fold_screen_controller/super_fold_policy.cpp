@@ -31,7 +31,7 @@ constexpr uint64_t SCREEN_ID_SIZE_ONE = 1;
 constexpr DMRect FULL_SCREEN_RECORD_DMRECT = {0, 0, 0, 0};
 constexpr DMRect FULL_SCREEN_RECORD_PHYDMRECT = {0, 0, DISPLAY_A_WIDTH, DISPLAY_A_HEIGHT};
 const uint32_t MODE_CHANGE_TIMEOUT_MS = 2000;
-const int64_t POWER_INIT_TIME_MS = 50;
+const uint32_t POWER_INIT_TIME_MS = 50;
 #ifdef TP_FEATURE_ENABLE
 const int32_t TP_TYPE = 12;
 #endif
@@ -212,9 +212,11 @@ void SuperFoldPolicy::BootAnimationFinishPowerInit()
         TLOGI(WmsLogTag::DMS, "Fold Screen Power main screen off.");
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_FULL,
             ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
+        uint64_t mainRequestSeq = ScreenSessionManager::GetInstance().GetRSScreenPowerRequestSeq(SCREEN_ID_MAIN);
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
             ScreenPowerStatus::POWER_STATUS_ON);
-        std::this_thread::sleep_for(std::chrono::milliseconds(POWER_INIT_TIME_MS));
+        ScreenSessionManager::GetInstance().WaitRSScreenPowerStatus(SCREEN_ID_MAIN,
+            ScreenPowerStatus::POWER_STATUS_ON, mainRequestSeq, POWER_INIT_TIME_MS);
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
             ScreenPowerStatus::POWER_STATUS_OFF);
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_FULL,
@@ -224,10 +226,13 @@ void SuperFoldPolicy::BootAnimationFinishPowerInit()
         TLOGI(WmsLogTag::DMS, "Fold Screen Power all screen off.");
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
             ScreenPowerStatus::POWER_STATUS_OFF);
+        uint64_t fullRequestSeq = ScreenSessionManager::GetInstance().GetRSScreenPowerRequestSeq(SCREEN_ID_FULL);
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_FULL,
             ScreenPowerStatus::POWER_STATUS_OFF);
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(POWER_INIT_TIME_MS));
+        // the ack of the last request also covers the main screen set before it
+        ScreenSessionManager::GetInstance().WaitRSScreenPowerStatus(SCREEN_ID_FULL,
+            ScreenPowerStatus::POWER_STATUS_OFF, fullRequestSeq, POWER_INIT_TIME_MS);
         TLOGI(WmsLogTag::DMS, "Fold Screen Power main screen on.");
         ScreenSessionManager::GetInstance().SetRSScreenPowerStatusExt(SCREEN_ID_MAIN,
             ScreenPowerStatus::POWER_STATUS_ON);
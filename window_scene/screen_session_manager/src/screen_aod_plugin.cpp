@@ -14,13 +14,10 @@
  */
 #include "screen_aod_plugin.h"
 
+#include "common/include/plugin_loader.h"
+
 namespace OHOS {
 namespace Rosen {
-namespace {
-    constexpr uint32_t SLEEP_TIME_US = 10000;
-    constexpr uint32_t RETRY_TIMES = 3;
-}
-
 #if (defined(__aarch64__) || defined(__x86_64__))
 const std::string PLUGIN_AOD_SO_PATH = "/system/lib64/libaod_native.z.so";
 #else
@@ -38,24 +35,17 @@ bool LoadAodLib(void)
         TLOGW(WmsLogTag::DMS, "aod plugin has already exits.");
         return true;
     }
-    int32_t cnt = 0;
-    const char* dlopenError = nullptr;
-    do {
-        cnt++;
-        g_handle = dlopen(PLUGIN_AOD_SO_PATH.c_str(), RTLD_LAZY);
-        dlopenError = dlerror();
-        if (dlopenError) {
-            TLOGE(WmsLogTag::DMS, "dlopen error: %{public}s", dlopenError);
-        }
-        TLOGI(WmsLogTag::DMS, "dlopen %{public}s, retry cnt: %{public}d", PLUGIN_AOD_SO_PATH.c_str(), cnt);
-        usleep(SLEEP_TIME_US);
-    } while (!g_handle && cnt < RETRY_TIMES);
+    g_handle = PluginLoader::OpenLibrary(PLUGIN_AOD_SO_PATH, RTLD_LAZY);
     return g_handle != nullptr;
 }
 
 void UnloadAodLib(void)
 {
     TLOGI(WmsLogTag::DMS, "unload aod plugin.");
+    if (!PluginLoader::GetInstance().WaitLoaded(AOD_PLUGIN_NAME)) {
+        TLOGW(WmsLogTag::DMS, "aod plugin is not loaded, skip unload");
+        return;
+    }
     if (g_handle != nullptr) {
         dlclose(g_handle);
         g_handle = nullptr;
@@ -66,23 +56,16 @@ void UnloadAodLib(void)
 
 __attribute__((no_sanitize("cfi"))) bool IsInAod()
 {
+    if (!PluginLoader::GetInstance().WaitLoaded(AOD_PLUGIN_NAME)) {
+        TLOGE(WmsLogTag::DMS, "aod plugin is not loaded");
+        return false;
+    }
     if (g_handle == nullptr) {
         TLOGE(WmsLogTag::DMS, "g_handle is nullptr");
         return false;
     }
     if (g_isInAodFunc == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_isInAodFunc = reinterpret_cast<IsInAodFunc>(dlsym(g_handle, "IsInAod"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::DMS, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::DMS, "dlsym %{public}s, retry cnt: %{public}d", "IsInAod", cnt);
-        } while (!g_isInAodFunc && cnt < RETRY_TIMES);
+        g_isInAodFunc = reinterpret_cast<IsInAodFunc>(PluginLoader::LoadSymbol(g_handle, "IsInAod"));
     }
     if (g_isInAodFunc == nullptr) {
         return false;
@@ -93,23 +76,16 @@ __attribute__((no_sanitize("cfi"))) bool IsInAod()
 
 __attribute__((no_sanitize("cfi"))) bool StopAod(int32_t status)
 {
+    if (!PluginLoader::GetInstance().WaitLoaded(AOD_PLUGIN_NAME)) {
+        TLOGE(WmsLogTag::DMS, "aod plugin is not loaded");
+        return false;
+    }
     if (g_handle == nullptr) {
         TLOGE(WmsLogTag::DMS, "g_handle is nullptr");
         return false;
     }
     if (g_stopAodFunc == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_stopAodFunc = reinterpret_cast<StopAodFunc>(dlsym(g_handle, "Stop"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::DMS, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::DMS, "dlsym %{public}s, retry cnt: %{public}d", "Stop", cnt);
-        } while (!g_stopAodFunc && cnt < RETRY_TIMES);
+        g_stopAodFunc = reinterpret_cast<StopAodFunc>(PluginLoader::LoadSymbol(g_handle, "Stop"));
     }
     if (g_stopAodFunc == nullptr) {
         return false;
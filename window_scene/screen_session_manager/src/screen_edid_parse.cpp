@@ -15,13 +15,14 @@
 
 #include "screen_edid_parse.h"
 
+#include "common/include/plugin_loader.h"
+
 namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr uint32_t CHECK_INDEX_BEGIN = 0x8;
 constexpr uint32_t CHECK_INDEX_END = 0x11;
 constexpr int32_t CHECK_CODE_INVALID = -1;
-constexpr uint32_t SLEEP_TIME_US = 10000;
 #if (defined(__aarch64__) || defined(__x86_64__))
 const std::string EDID_PARSE_SO_PATH = "/system/lib64/libedid_parse.z.so";
 #else
@@ -30,6 +31,7 @@ const std::string EDID_PARSE_SO_PATH = "/system/lib/libedid_parse.z.so";
 }
 
 static void *g_libHandle = nullptr;
+static ParseEdidFunc g_parseBaseEdidFunc = nullptr;
 
 bool LoadEdidPlugin(void)
 {
@@ -37,17 +39,7 @@ bool LoadEdidPlugin(void)
         TLOGW(WmsLogTag::DMS, "edid plugin has already exists.");
         return true;
     }
-    int32_t cnt = 0;
-    int32_t retryTimes = 3;
-    do {
-        cnt++;
-        g_libHandle = dlopen(EDID_PARSE_SO_PATH.c_str(), RTLD_LAZY);
-        TLOGI(WmsLogTag::DMS, "dlopen %{public}s, retry cnt: %{public}d", EDID_PARSE_SO_PATH.c_str(), cnt);
-        if (g_libHandle == nullptr) {
-            TLOGE(WmsLogTag::DMS, "dlopen failed: %{public}s", dlerror());
-        }
-        usleep(SLEEP_TIME_US);
-    } while (!g_libHandle && cnt < retryTimes);
+    g_libHandle = PluginLoader::OpenLibrary(EDID_PARSE_SO_PATH, RTLD_LAZY);
     return g_libHandle != nullptr;
 }
 
@@ -58,6 +50,7 @@ void UnloadEdidPlugin(void)
         dlclose(g_libHandle);
         g_libHandle = nullptr;
     }
+    g_parseBaseEdidFunc = nullptr;
 }
 
 bool GetEdid(ScreenId rsScreenId, struct BaseEdid &edid)
@@ -77,13 +70,15 @@ bool GetEdid(ScreenId rsScreenId, struct BaseEdid &edid)
         TLOGE(WmsLogTag::DMS, "dlopen failed.");
         return false;
     }
-    ParseEdidFunc ParseBaseEdid = (ParseEdidFunc)(dlsym(g_libHandle, "ParseBaseEdid"));
-    if (ParseBaseEdid == nullptr) {
+    if (g_parseBaseEdidFunc == nullptr) {
+        g_parseBaseEdidFunc = reinterpret_cast<ParseEdidFunc>(PluginLoader::LoadSymbol(g_libHandle, "ParseBaseEdid"));
+    }
+    if (g_parseBaseEdidFunc == nullptr) {
         TLOGE(WmsLogTag::DMS, "ParseBaseEdid null.");
         UnloadEdidPlugin();
         return false;
     }
-    int32_t getEdid = ParseBaseEdid(edidData.data(), edidSize, &edid);
+    int32_t getEdid = g_parseBaseEdidFunc(edidData.data(), edidSize, &edid);
     if (getEdid != 0) {
         TLOGE(WmsLogTag::DMS, "parse EDID failed.");
         return false;
@@ -15,11 +15,11 @@
 
 #include "screen_sensor_plugin.h"
 
+#include "common/include/plugin_loader.h"
+
 namespace OHOS {
 namespace Rosen {
 namespace {
-    constexpr uint32_t SLEEP_TIME_US = 10000;
-    constexpr uint32_t RETRY_TIMES = 3;
 #if (defined(__aarch64__) || defined(__x86_64__))
 const std::string PLUGIN_SO_PATH = "/system/lib64/platformsdk/libmotion_agent.z.so";
 #else
@@ -37,24 +37,17 @@ bool LoadMotionSensor(void)
         TLOGW(WmsLogTag::DMS, "motion plugin has already exits.");
         return true;
     }
-    int32_t cnt = 0;
-    const char* dlopenError = nullptr;
-    do {
-        cnt++;
-        g_handle = dlopen(PLUGIN_SO_PATH.c_str(), RTLD_LAZY);
-        dlopenError = dlerror();
-        if (dlopenError) {
-            TLOGE(WmsLogTag::DMS, "dlopen error: %{public}s", dlopenError);
-        }
-        TLOGI(WmsLogTag::DMS, "dlopen %{public}s, retry cnt: %{public}d", PLUGIN_SO_PATH.c_str(), cnt);
-        usleep(SLEEP_TIME_US);
-    } while (!g_handle && cnt < RETRY_TIMES);
+    g_handle = PluginLoader::OpenLibrary(PLUGIN_SO_PATH, RTLD_LAZY);
     return g_handle != nullptr;
 }
 
 void UnloadMotionSensor(void)
 {
     TLOGI(WmsLogTag::DMS, "unload motion plugin.");
+    if (!PluginLoader::GetInstance().WaitLoaded(MOTION_PLUGIN_NAME)) {
+        TLOGW(WmsLogTag::DMS, "motion plugin is not loaded, skip unload");
+        return;
+    }
     if (g_handle != nullptr) {
         dlclose(g_handle);
         g_handle = nullptr;
@@ -69,24 +62,17 @@ __attribute__((no_sanitize("cfi"))) bool SubscribeCallback(int32_t motionType, O
         TLOGE(WmsLogTag::DMS, "callback is nullptr");
         return false;
     }
+    if (!PluginLoader::GetInstance().WaitLoaded(MOTION_PLUGIN_NAME)) {
+        TLOGE(WmsLogTag::DMS, "motion plugin is not loaded");
+        return false;
+    }
     if (g_handle == nullptr) {
         TLOGE(WmsLogTag::DMS, "g_handle is nullptr");
         return false;
     }
     if (g_motionSubscribeCallbackPtr == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_motionSubscribeCallbackPtr = reinterpret_cast<MotionSubscribeCallbackPtr>(
-                dlsym(g_handle, "MotionSubscribeCallback"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::DMS, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::DMS, "dlsym %{public}s, retry cnt: %{public}d", "MotionSubscribeCallback", cnt);
-        } while (!g_motionSubscribeCallbackPtr && cnt < RETRY_TIMES);
+        g_motionSubscribeCallbackPtr = reinterpret_cast<MotionSubscribeCallbackPtr>(
+            PluginLoader::LoadSymbol(g_handle, "MotionSubscribeCallback"));
     }
     if (g_motionSubscribeCallbackPtr == nullptr) {
         return false;
@@ -101,24 +87,17 @@ __attribute__((no_sanitize("cfi"))) bool UnsubscribeCallback(int32_t motionType,
         TLOGE(WmsLogTag::DMS, "callback is nullptr");
         return false;
     }
+    if (!PluginLoader::GetInstance().WaitLoaded(MOTION_PLUGIN_NAME)) {
+        TLOGE(WmsLogTag::DMS, "motion plugin is not loaded");
+        return false;
+    }
     if (g_handle == nullptr) {
         TLOGE(WmsLogTag::DMS, "g_handle is nullptr");
         return false;
     }
     if (g_motionUnsubscribeCallbackPtr == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_motionUnsubscribeCallbackPtr = reinterpret_cast<MotionUnsubscribeCallbackPtr>(
-                dlsym(g_handle, "MotionUnsubscribeCallback"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::DMS, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::DMS, "dlsym %{public}s, retry cnt: %{public}d", "MotionUnsubscribeCallback", cnt);
-        } while (!g_motionUnsubscribeCallbackPtr && cnt < RETRY_TIMES);
+        g_motionUnsubscribeCallbackPtr = reinterpret_cast<MotionUnsubscribeCallbackPtr>(
+            PluginLoader::LoadSymbol(g_handle, "MotionUnsubscribeCallback"));
     }
     if (g_motionUnsubscribeCallbackPtr == nullptr) {
         return false;
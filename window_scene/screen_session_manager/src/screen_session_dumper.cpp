@@ -21,6 +21,7 @@
 
 #include "unique_fd.h"
 #include "screen_session_manager.h"
+#include "screen_session_manager_adapter.h"
 #include "session_permission.h"
 #include "screen_rotation_property.h"
 #include "screen_scene_config.h"
@@ -35,6 +36,8 @@
 
 #include "fold_screen_common.h"
 #include "screen_sensor_mgr.h"
+#include "common/include/ipc_payload_profiler.h"
+#include "common/include/plugin_loader.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -51,6 +54,9 @@ constexpr int DUMPER_PARAM_INDEX_FOUR = 4;
 constexpr int DUMPER_PARAM_INDEX_FIVE = 5;
 constexpr int DUMPER_PARAM_INDEX_SIX = 6;
 const std::string ARG_DUMP_LCD_STATUS = "-lcd";
+const std::string ARG_DUMP_STARTUP = "-startup";
+const std::string ARG_DUMP_DISPLAY_CHANGE = "-displaychange";
+const std::string ARG_DUMP_IPC_PAYLOAD = "-ipc";
 
 constexpr int MOTION_SENSOR_PARAM_SIZE = 2;
 const std::string STATUS_FOLD_HALF = "-z";
@@ -233,6 +239,13 @@ void ScreenSessionDumper::ExecuteDumpCmd()
     } else if (params_[0] == ARG_DUMP_LCD_STATUS) {
         ShowCurrentLcdStatus(SCREEN_ID_FULL);
         ShowCurrentLcdStatus(SCREEN_ID_MAIN);
+    } else if (params_[0] == ARG_DUMP_STARTUP) {
+        PluginLoader::GetInstance().DumpStartupTimeline(dumpInfo_);
+    } else if (params_[0] == ARG_DUMP_DISPLAY_CHANGE) {
+        ScreenSessionManagerAdapter::GetInstance().DumpDisplayChangeStats(dumpInfo_);
+    } else if (params_[0] == ARG_DUMP_IPC_PAYLOAD) {
+        std::vector<std::string> ipcParams(params_.begin() + 1, params_.end());
+        IpcPayloadProfiler::GetInstance().DumpInfo(ipcParams, dumpInfo_);
     }
     ExecuteInjectCmd();
     OutputDumpInfo();
@@ -413,6 +426,12 @@ void ScreenSessionDumper::ShowHelpInfo()
         .append("|help text for the tool\n")
         .append(" -a                             ")
         .append("|dump all screen information in the system\n")
+        .append(" -startup                       ")
+        .append("|dump startup phase and plugin loading timeline\n")
+        .append(" -displaychange                 ")
+        .append("|dump display change delivery stats of each listener\n")
+        .append(" -ipc [csv|reset|interface]      ")
+        .append("|dump ipc payload stats of each interface and code\n")
         .append(" -z                             ")
         .append("|switch to fold half status\n")
         .append(" -y                             ")
@@ -82,6 +82,7 @@
 #include "fold_screen_controller/super_fold_policy.h"
 #endif
 #include "screen_aod_plugin.h"
+#include "common/include/plugin_loader.h"
 #include "wm_single_instance.h"
 #include "dms_global_mutex.h"
 #include "dms_task_scheduler.h"
@@ -156,7 +157,6 @@ const unsigned int XCOLLIE_TIMEOUT_10S = 10;
 const unsigned int XCOLLIE_TIMEOUT_30S = 30;
 constexpr int32_t CAST_WIRED_PROJECTION_START = 1005;
 constexpr int32_t CAST_WIRED_PROJECTION_STOP = 1007;
-constexpr uint32_t SLEEP_TIME_US = 10000;
 constexpr int32_t RES_FAILURE_FOR_PRIVACY_WINDOW = -2;
 constexpr int32_t IRREGULAR_REFRESH_RATE_SKIP_THRETHOLD = 10;
 constexpr float EXTEND_SCREEN_DPI_DEFAULT_PARAMETER = 1.0f;
@@ -344,21 +344,12 @@ static void* g_dmsExtHandler = nullptr;
 void ScreenSessionManager::LoadDmsExtension()
 {
     TLOGNFE(WmsLogTag::DMS, "LoadDmsExtension start");
+    StartupPhaseScope phaseScope("dms:LoadDmsExtension");
     if (g_dmsExtHandler != nullptr) {
         dlclose(g_dmsExtHandler);
         g_dmsExtHandler = nullptr;
     }
-    int32_t cnt = 0;
-    int32_t retryTimes = 3;
-    do {
-        cnt++;
-        g_dmsExtHandler = dlopen(EXT_PLUGIN_SO_PATH.c_str(), RTLD_NOW | RTLD_NODELETE);
-        TLOGNFI(WmsLogTag::DMS, "dlopen %{public}s, retry cnt: %{public}d", EXT_PLUGIN_SO_PATH.c_str(), cnt);
-        if (g_dmsExtHandler == nullptr) {
-            TLOGNFE(WmsLogTag::DMS, "dlopen failed: %{public}s", dlerror());
-        }
-        usleep(SLEEP_TIME_US);
-    } while (!g_dmsExtHandler && cnt < retryTimes);
+    g_dmsExtHandler = PluginLoader::OpenLibrary(EXT_PLUGIN_SO_PATH, RTLD_NOW | RTLD_NODELETE);
 }
 bool ScreenSessionManager::GetScreenSessionMngSystemAbility()
 {
@@ -573,7 +564,7 @@ void ScreenSessionManager::FoldScreenPowerInit()
 void ScreenSessionManager::PostBootPowerTask() {
 #ifdef FOLD_ABILITY_ENABLE
     ScreenId currentScreenId = foldScreenController_->GetCurrentScreenId();
-    int64_t timeStamp = 50;
+    uint32_t powerTimeoutMs = 50;
 #ifdef TP_FEATURE_ENABLE
     int32_t tpType = 12;
     std::string fullTpChange = "0";
@@ -582,13 +573,19 @@ void ScreenSessionManager::PostBootPowerTask() {
     auto bootPowerTask = [&] {
         if (currentScreenId == SCREEN_ID_FULL) {
             TLOGNFI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Full animation Init 1.");
+            uint64_t fullRequestSeq = GetRSScreenPowerRequestSeq(SCREEN_ID_FULL);
             SetRSScreenPowerStatusExt(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
             if (IsSupportCoordination()) {
                 SetNeedAnotherScreenKeepOffFake(true);
+                uint64_t mainRequestSeq = GetRSScreenPowerRequestSeq(SCREEN_ID_MAIN);
                 SetRSScreenPowerStatusExt(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
                 SetNeedAnotherScreenKeepOffFake(false);
+                WaitRSScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON, mainRequestSeq,
+                    powerTimeoutMs);
+            } else {
+                WaitRSScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF_FAKE, fullRequestSeq,
+                    powerTimeoutMs);
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(timeStamp));
             TLOGNFI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Full animation Init 2.");
 #ifdef TP_FEATURE_ENABLE
             rsInterface_.SetTpFeatureConfig(tpType, fullTpChange.c_str());
@@ -599,13 +596,19 @@ void ScreenSessionManager::PostBootPowerTask() {
                 ScreenPowerOnReason::SAME_DISPLAY_TO_SINGLE_DISPLAY);
         } else if (currentScreenId == SCREEN_ID_MAIN) {
             TLOGNFI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Main animation Init 3.");
+            uint64_t mainRequestSeq = GetRSScreenPowerRequestSeq(SCREEN_ID_MAIN);
             SetRSScreenPowerStatusExt(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
             if (IsSupportCoordination()) {
                 SetNeedAnotherScreenKeepOffFake(true);
+                uint64_t fullRequestSeq = GetRSScreenPowerRequestSeq(SCREEN_ID_FULL);
                 SetRSScreenPowerStatusExt(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_ON);
                 SetNeedAnotherScreenKeepOffFake(false);
+                WaitRSScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_ON, fullRequestSeq,
+                    powerTimeoutMs);
+            } else {
+                WaitRSScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_OFF_FAKE, mainRequestSeq,
+                    powerTimeoutMs);
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(timeStamp));
             TLOGNFI(WmsLogTag::DMS, "ScreenSessionManager Fold Screen Power Main animation Init 4.");
 #ifdef TP_FEATURE_ENABLE
             rsInterface_.SetTpFeatureConfig(tpType, mainTpChange.c_str());
@@ -655,10 +658,15 @@ void ScreenSessionManager::Init()
         TLOGNFI(WmsLogTag::DMS, "Dms in rescue mode, not need watchdog.");
         screenEventTracker_.RecordEvent("Dms in rescue mode, not need watchdog.");
     }
-    if (!LoadMotionSensor()) {
-        screenEventTracker_.RecordEvent("Dms load motion plugin failed.");
-        TLOGNFW(WmsLogTag::DMS, "load motion plugin failed.");
-    }
+    // plugins load in parallel with the rest of init, their users wait for them on first call
+    PluginLoader::GetInstance().LoadAsync(MOTION_PLUGIN_NAME, [this] {
+        if (!LoadMotionSensor()) {
+            screenEventTracker_.RecordEvent("Dms load motion plugin failed.");
+            TLOGNFW(WmsLogTag::DMS, "load motion plugin failed.");
+            return false;
+        }
+        return true;
+    }, taskScheduler_);
     AodLibInit();
     RegisterScreenChangeListener();
     RegisterRSListeners();
@@ -1015,9 +1023,13 @@ void ScreenSessionManager::AodLibInit()
         FoldScreenStateInternel::IsSingleDisplayFoldDevice() ||
         FoldScreenStateInternel::IsLoadDmsExt();
     if (isNeedLoadAodLib) {
-        if (!LoadAodLib()) {
-            TLOGNFE(WmsLogTag::DMS, "load aod lib failed");
-        }
+        PluginLoader::GetInstance().LoadAsync(AOD_PLUGIN_NAME, [] {
+            if (!LoadAodLib()) {
+                TLOGNFE(WmsLogTag::DMS, "load aod lib failed");
+                return false;
+            }
+            return true;
+        }, taskScheduler_);
     }
 }
 
@@ -1026,7 +1038,11 @@ void ScreenSessionManager::OnStart()
     TLOGNFI(WmsLogTag::DMS, "start");
     DmsXcollie dmsXcollie("DMS:OnStart", XCOLLIE_TIMEOUT_10S,
         [this](void *) { screenEventTracker_.LogWarningAllInfos(); });
-    Init();
+    {
+        StartupPhaseScope phaseScope("dms:Init");
+        Init();
+    }
+    StartupPhaseScope phaseScope("dms:Publish");
     sptr<ScreenSessionManager> dms(this);
     dms->IncStrongRef(nullptr);
     if (!Publish(dms)) {
@@ -1488,6 +1504,7 @@ void ScreenSessionManager::RegisterFirstFrameCommitCallback()
 #ifdef FOLD_ABILITY_ENABLE
     TLOGNFI(WmsLogTag::DMS, "[UL_FOLD]start");
     auto callback = [=](uint64_t screenId, int64_t rsFirstFrameTime) {
+        DMS::ScreenPowerMgr::GetInstance().NotifyFirstFrameCommit(screenId);
         ReportFoldDisplayTime(screenId, rsFirstFrameTime);
     };
     RSInterfaces::GetInstance().RegisterFirstFrameCommitCallback(DmUtils::wrap_callback(callback));
@@ -16651,6 +16668,31 @@ bool ScreenSessionManager::SetRSScreenPowerStatusExt(ScreenId screenId, ScreenPo
     return true;
 }
 
+uint64_t ScreenSessionManager::GetRSScreenPowerRequestSeq(ScreenId screenId)
+{
+    ScreenId rsScreenId = screenId;
+    if (IsConcurrentUser()) {
+        if (!screenIdManager_.ConvertToRsScreenId(screenId, rsScreenId)) {
+            rsScreenId = screenId;
+        }
+    }
+    return DMS::ScreenPowerMgr::GetInstance().GetScreenPowerRequestSeq(rsScreenId);
+}
+
+bool ScreenSessionManager::WaitRSScreenPowerStatus(ScreenId screenId, ScreenPowerStatus status,
+    uint64_t lastRequestSeq, uint32_t timeoutMs)
+{
+    ScreenId rsScreenId = screenId;
+    if (IsConcurrentUser()) {
+        if (!screenIdManager_.ConvertToRsScreenId(screenId, rsScreenId)) {
+            rsScreenId = screenId;
+        }
+    }
+    // a set cancelled by CheckAnotherScreenStatus adds no request, so the wait times out instead of taking an old ack
+    return DMS::ScreenPowerMgr::GetInstance().WaitScreenPowerStatusApplied(rsScreenId, status, lastRequestSeq,
+        timeoutMs);
+}
+
 #ifdef FOLD_ABILITY_ENABLE
 void ScreenSessionManager::CheckAnotherScreenStatus(ScreenId screenId, ScreenPowerStatus status,
     bool& isNeedToCancelSetScreenStatus) {
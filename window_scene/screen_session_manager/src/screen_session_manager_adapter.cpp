@@ -25,6 +25,13 @@ namespace Rosen {
 WM_IMPLEMENT_SINGLE_INSTANCE(ScreenSessionManagerAdapter)
 #define INIT_PROXY_CHECK_RETURN() FREE_GLOBAL_LOCK_FOR_IPC()
 
+ScreenSessionManagerAdapter::ScreenSessionManagerAdapter()
+{
+    dmAgentContainer_.SetAgentDeathCallback([this](const sptr<IRemoteObject>& remoteObject) {
+        displayChangeBroadcaster_.RemoveAgent(remoteObject);
+    });
+}
+
 DMError ScreenSessionManagerAdapter::RegisterDisplayManagerAgent(
     const sptr<IDisplayManagerAgent>& displayManagerAgent,
     DisplayManagerAgentType type)
@@ -36,6 +43,9 @@ DMError ScreenSessionManagerAdapter::UnregisterDisplayManagerAgent(
     const sptr<IDisplayManagerAgent>& displayManagerAgent,
     DisplayManagerAgentType type)
 {
+    if (type == DisplayManagerAgentType::DISPLAY_EVENT_LISTENER && displayManagerAgent != nullptr) {
+        displayChangeBroadcaster_.RemoveAgent(displayManagerAgent->AsObject());
+    }
     return dmAgentContainer_.UnregisterAgent(displayManagerAgent, type) ? DMError::DM_OK : DMError::DM_ERROR_NULLPTR;
 }
 
@@ -52,6 +62,7 @@ void ScreenSessionManagerAdapter::OnDisplayChange(sptr<DisplayInfo> displayInfo,
         TLOGE(WmsLogTag::DMS, "agents is empty");
         return;
     }
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids;
     for (const auto& agent : agents) {
         int32_t agentPid = dmAgentContainer_.GetAgentPid(agent);
         if (ScreenSessionManager::GetInstance().GetStoredPidFromUid(uid, agentPid)) {
@@ -59,10 +70,16 @@ void ScreenSessionManagerAdapter::OnDisplayChange(sptr<DisplayInfo> displayInfo,
             continue;
         }
         if (!ScreenSessionManager::GetInstance().IsFreezed(agentPid, DisplayManagerAgentType::DISPLAY_EVENT_LISTENER)) {
-            agent->OnDisplayChange(displayInfo, event);
+            agentPids[agent] = agentPid;
             TLOGE(WmsLogTag::DMS, "notify, pid: %{public}d", agentPid);
         }
     }
+    displayChangeBroadcaster_.Broadcast(displayInfo, event, agentPids);
+}
+
+void ScreenSessionManagerAdapter::DumpDisplayChangeStats(std::string& dumpInfo)
+{
+    displayChangeBroadcaster_.Dump(dumpInfo);
 }
 
 void ScreenSessionManagerAdapter::OnDisplayChange(sptr<DisplayInfo> displayInfo, DisplayChangeEvent event)
@@ -80,13 +97,15 @@ void ScreenSessionManagerAdapter::OnDisplayChange(sptr<DisplayInfo> displayInfo,
         return;
     }
     std::ostringstream notifiedPids;
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids;
     for (auto& agent : agents) {
         int32_t agentPid = dmAgentContainer_.GetAgentPid(agent);
         if (!ScreenSessionManager::GetInstance().IsFreezed(agentPid, DisplayManagerAgentType::DISPLAY_EVENT_LISTENER)) {
-            agent->OnDisplayChange(displayInfo, event);
+            agentPids[agent] = agentPid;
             notifiedPids << ' ' << agentPid;
         }
     }
+    displayChangeBroadcaster_.Broadcast(displayInfo, event, agentPids);
     if (event == DisplayChangeEvent::UPDATE_REFRESHRATE) {
         TLOGD(WmsLogTag::DMS,
             "event:%{public}d, displayId:%{public}" PRIu64 ", agent size: %{public}u, notified: [%{public}s]",
@@ -235,12 +254,14 @@ void ScreenSessionManagerAdapter::OnDisplayCreate(sptr<DisplayInfo> displayInfo)
         TLOGE(WmsLogTag::DMS, "agent is null");
         return;
     }
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids;
     for (auto& agent : agents) {
         int32_t agentPid = dmAgentContainer_.GetAgentPid(agent);
         if (!ScreenSessionManager::GetInstance().IsFreezed(agentPid, DisplayManagerAgentType::DISPLAY_EVENT_LISTENER)) {
-            agent->OnDisplayCreate(displayInfo);
+            agentPids[agent] = agentPid;
         }
     }
+    displayChangeBroadcaster_.BroadcastCreate(displayInfo, agentPids);
 }
 
 void ScreenSessionManagerAdapter::OnDisplayDestroy(DisplayId displayId)
@@ -252,12 +273,14 @@ void ScreenSessionManagerAdapter::OnDisplayDestroy(DisplayId displayId)
         TLOGE(WmsLogTag::DMS, "agent is null");
         return;
     }
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids;
     for (auto& agent : agents) {
         int32_t agentPid = dmAgentContainer_.GetAgentPid(agent);
         if (!ScreenSessionManager::GetInstance().IsFreezed(agentPid, DisplayManagerAgentType::DISPLAY_EVENT_LISTENER)) {
-            agent->OnDisplayDestroy(displayId);
+            agentPids[agent] = agentPid;
         }
     }
+    displayChangeBroadcaster_.BroadcastDestroy(displayId, agentPids);
 }
 
 void ScreenSessionManagerAdapter::NotifyPrivateWindowStateChanged(bool hasPrivate)
@@ -17,10 +17,22 @@
 #include "zidl/screen_session_manager_proxy.h"
 
 #include "marshalling_helper.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
 
 namespace OHOS::Rosen {
 namespace {
 constexpr uint32_t  MAX_CREASE_REGION_SIZE = 20;
+
+int SendIpcRequest(const sptr<IRemoteObject>& remote, uint32_t code, MessageParcel& data, MessageParcel& reply,
+    MessageOption& option)
+{
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadScope payloadScope(IpcSide::PROXY, "ScreenSessionManager", code, data, reply);
+#endif
+    return remote->SendRequest(code, data, reply, option);
+}
 }
 
 sptr<DisplayInfo> OHOS::Rosen::ScreenSessionManagerProxy::GetDefaultDisplayInfo(int32_t userId)
@@ -42,7 +54,7 @@ sptr<DisplayInfo> OHOS::Rosen::ScreenSessionManagerProxy::GetDefaultDisplayInfo(
         TLOGE(WmsLogTag::DMS, "Write userId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DEFAULT_DISPLAY_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DEFAULT_DISPLAY_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -74,7 +86,7 @@ DMError ScreenSessionManagerProxy::SetScreenActiveMode(ScreenId screenId, uint32
         TLOGE(WmsLogTag::DMS, "write screenId/modeId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ACTIVE_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ACTIVE_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -101,7 +113,7 @@ DMError ScreenSessionManagerProxy::SetVirtualPixelRatio(ScreenId screenId, float
         TLOGE(WmsLogTag::DMS, "write screenId/modeId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_PIXEL_RATIO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_PIXEL_RATIO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -128,7 +140,7 @@ DMError ScreenSessionManagerProxy::SetVirtualPixelRatioSystem(ScreenId screenId,
         TLOGE(WmsLogTag::DMS, "write screenId/modeId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_PIXEL_RATIO_SYSTEM),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_PIXEL_RATIO_SYSTEM),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -155,7 +167,7 @@ DMError ScreenSessionManagerProxy::SetDefaultDensityDpi(ScreenId screenId, float
         TLOGE(WmsLogTag::DMS, "write screenId/virtualPixelRatio failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DEFAULT_DENSITY_DPI),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DEFAULT_DENSITY_DPI),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -184,7 +196,7 @@ DMError ScreenSessionManagerProxy::SetResolution(ScreenId screenId, uint32_t wid
         TLOGE(WmsLogTag::DMS, "write screenId/width/height/virtualPixelRatio failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_RESOLUTION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_RESOLUTION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -211,7 +223,7 @@ DMError ScreenSessionManagerProxy::GetDensityInCurResolution(ScreenId screenId,
         TLOGE(WmsLogTag::DMS, "write screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DENSITY_IN_CURRENT_RESOLUTION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DENSITY_IN_CURRENT_RESOLUTION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -239,7 +251,7 @@ DMError ScreenSessionManagerProxy::GetScreenColorGamut(ScreenId screenId, Screen
         TLOGW(WmsLogTag::DMS, "WriteUint64 uint64_t failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_COLOR_GAMUT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_COLOR_GAMUT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -271,7 +283,7 @@ DMError ScreenSessionManagerProxy::SetScreenColorGamut(ScreenId screenId, int32_
         TLOGW(WmsLogTag::DMS, "Write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_GAMUT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_GAMUT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -298,7 +310,7 @@ DMError ScreenSessionManagerProxy::GetScreenGamutMap(ScreenId screenId, ScreenGa
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_GAMUT_MAP),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_GAMUT_MAP),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -330,7 +342,7 @@ DMError ScreenSessionManagerProxy::SetScreenGamutMap(ScreenId screenId, ScreenGa
         TLOGW(WmsLogTag::DMS, "Writ failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_GAMUT_MAP),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_GAMUT_MAP),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -357,7 +369,7 @@ DMError ScreenSessionManagerProxy::SetScreenColorTransform(ScreenId screenId)
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_TRANSFORM),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_TRANSFORM),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -384,7 +396,7 @@ DMError ScreenSessionManagerProxy::GetPixelFormat(ScreenId screenId, GraphicPixe
         TLOGW(WmsLogTag::DMS, "WriteUint64 uint64_t failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_PIXEL_FORMAT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_PIXEL_FORMAT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -416,7 +428,7 @@ DMError ScreenSessionManagerProxy::SetPixelFormat(ScreenId screenId, GraphicPixe
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_PIXEL_FORMAT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_PIXEL_FORMAT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -443,7 +455,7 @@ DMError ScreenSessionManagerProxy::GetSupportedHDRFormats(ScreenId screenId, std
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_HDR_FORMAT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_HDR_FORMAT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -482,7 +494,7 @@ DMError ScreenSessionManagerProxy::GetScreenHDRFormat(ScreenId screenId, ScreenH
         TLOGW(WmsLogTag::DMS, "WriteUint64 uint64_t failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_HDR_FORMAT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_HDR_FORMAT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -514,7 +526,7 @@ DMError ScreenSessionManagerProxy::SetScreenHDRFormat(ScreenId screenId, int32_t
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_HDR_FORMAT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_HDR_FORMAT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -542,7 +554,7 @@ DMError ScreenSessionManagerProxy::GetSupportedColorSpaces(ScreenId screenId,
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_COLOR_SPACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_COLOR_SPACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -581,7 +593,7 @@ DMError ScreenSessionManagerProxy::GetScreenColorSpace(ScreenId screenId, Graphi
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_COLOR_SPACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_COLOR_SPACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -613,7 +625,7 @@ DMError ScreenSessionManagerProxy::SetScreenColorSpace(ScreenId screenId, Graphi
         TLOGW(WmsLogTag::DMS, "Write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_SPACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_COLOR_SPACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -653,7 +665,7 @@ DMError ScreenSessionManagerProxy::RegisterDisplayManagerAgent(const sptr<IDispl
         return DMError::DM_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DISPLAY_MANAGER_AGENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DISPLAY_MANAGER_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -693,7 +705,7 @@ DMError ScreenSessionManagerProxy::RegisterDisplayAttributeAgent(const std::vect
         return DMError::DM_ERROR_IPC_FAILED;
     }
  
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DISPLAY_ATTRIBUTE_AGENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DISPLAY_ATTRIBUTE_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -733,7 +745,7 @@ DMError ScreenSessionManagerProxy::UnRegisterDisplayAttribute(const std::vector<
         return DMError::DM_ERROR_IPC_FAILED;
     }
  
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UNREGISTER_DISPLAY_ATTRIBUTE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UNREGISTER_DISPLAY_ATTRIBUTE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -773,7 +785,7 @@ DMError ScreenSessionManagerProxy::UnregisterDisplayManagerAgent(const sptr<IDis
         return DMError::DM_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UNREGISTER_DISPLAY_MANAGER_AGENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UNREGISTER_DISPLAY_MANAGER_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -801,7 +813,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::WakeUpBegin(PowerStateChangeReason
         TLOGE(WmsLogTag::DMS, "[UL_POWER]WakeUpBegin: Write PowerStateChangeReason failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_WAKE_UP_BEGIN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_WAKE_UP_BEGIN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]WakeUpBegin: SendRequest failed");
         return false;
@@ -825,7 +837,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::WakeUpEnd()
         TLOGE(WmsLogTag::DMS, "[UL_POWER]WakeUpEnd: WriteInterfaceToken failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_WAKE_UP_END),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_WAKE_UP_END),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]WakeUpEnd: SendRequest failed");
         return false;
@@ -853,7 +865,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SuspendBegin(PowerStateChangeReason
         TLOGE(WmsLogTag::DMS, "[UL_POWER]SuspendBegin: Write PowerStateChangeReason failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SUSPEND_BEGIN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SUSPEND_BEGIN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SuspendBegin: SendRequest failed");
         return false;
@@ -877,7 +889,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SuspendEnd()
         TLOGE(WmsLogTag::DMS, "[UL_POWER]SuspendEnd: WriteInterfaceToken failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SUSPEND_END),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SUSPEND_END),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SuspendEnd: SendRequest failed");
         return false;
@@ -901,7 +913,7 @@ ScreenId OHOS::Rosen::ScreenSessionManagerProxy::GetInternalScreenId()
         TLOGE(WmsLogTag::DMS, "[UL_POWER]GetInternalScreenId: WriteInterfaceToken failed");
         return SCREEN_ID_INVALID;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_INTERNAL_SCREEN_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_INTERNAL_SCREEN_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]GetInternalScreenId: SendRequest failed");
         return SCREEN_ID_INVALID;
@@ -937,7 +949,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SetScreenPowerById(ScreenId screenI
         TLOGE(WmsLogTag::DMS, "[UL_POWER]Write PowerStateChangeReason failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_POWER_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_POWER_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SendRequest failed");
         return false;
@@ -964,7 +976,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SetDisplayState(DisplayState state)
         TLOGE(WmsLogTag::DMS, "[UL_POWER]Write DisplayState failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DISPLAY_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DISPLAY_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SendRequest failed");
         return false;
@@ -1000,7 +1012,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SetSpecifiedScreenPower(ScreenId sc
         TLOGE(WmsLogTag::DMS, "[UL_POWER]Write PowerStateChangeReason failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SPECIFIED_SCREEN_POWER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SPECIFIED_SCREEN_POWER),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SendRequest failed");
         return false;
@@ -1031,7 +1043,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::SetScreenPowerForAll(ScreenPowerSta
         TLOGE(WmsLogTag::DMS, "[UL_POWER]Write PowerStateChangeReason failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_POWER_FOR_ALL),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_POWER_FOR_ALL),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SendRequest failed");
         return false;
@@ -1058,7 +1070,7 @@ DisplayState OHOS::Rosen::ScreenSessionManagerProxy::GetDisplayState(DisplayId d
         TLOGE(WmsLogTag::DMS, "Write displayId failed");
         return DisplayState::UNKNOWN;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DisplayState::UNKNOWN;
@@ -1085,7 +1097,7 @@ void OHOS::Rosen::ScreenSessionManagerProxy::NotifyDisplayEvent(DisplayEvent eve
         TLOGE(WmsLogTag::DMS, "[UL_POWER]Write DisplayEvent failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]SendRequest failed");
         return;
@@ -1111,7 +1123,7 @@ ScreenPowerState OHOS::Rosen::ScreenSessionManagerProxy::GetScreenPower(ScreenId
         TLOGE(WmsLogTag::DMS, "Write dmsScreenId failed");
         return ScreenPowerState::INVALID_STATE;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_POWER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_POWER),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return ScreenPowerState::INVALID_STATE;
@@ -1134,7 +1146,7 @@ ScreenPowerState OHOS::Rosen::ScreenSessionManagerProxy::GetScreenPower()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return ScreenPowerState::INVALID_STATE;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_POWER_AUTO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_POWER_AUTO),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return ScreenPowerState::INVALID_STATE;
@@ -1158,7 +1170,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::TryToCancelScreenOff()
         TLOGE(WmsLogTag::DMS, "[UL_POWER]TryToCancelScreenOff: WriteInterfaceToken failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_TRY_TO_CANCEL_SCREEN_OFF),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_TRY_TO_CANCEL_SCREEN_OFF),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "[UL_POWER]TryToCancelScreenOff: SendRequest failed");
         return false;
@@ -1213,7 +1225,7 @@ ScreenId ScreenSessionManagerProxy::CreateVirtualScreen(VirtualScreenOption virt
         TLOGE(WmsLogTag::DMS, "SCB: ScreenSessionManagerProxy::Write data failed");
         return SCREEN_ID_INVALID;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_CREATE_VIRTUAL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_CREATE_VIRTUAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return SCREEN_ID_INVALID;
@@ -1243,7 +1255,7 @@ bool ScreenSessionManagerProxy::RegisterClientDeathListener(sptr<IRemoteObject>
         TLOGE(WmsLogTag::DMS, "Write reverseDeathAgent failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DEATH_LISTENER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REGISTER_DEATH_LISTENER),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "sendRequest failed");
         return false;
@@ -1281,7 +1293,7 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenSurface(ScreenId screenId, sp
         TLOGW(WmsLogTag::DMS, "SCB: Write screenId/surface failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_SURFACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_SURFACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1323,7 +1335,7 @@ DMError ScreenSessionManagerProxy::AddVirtualScreenSurface(ScreenId screenId,
         TLOGW(WmsLogTag::DMS, "SCB: Write screenId/surface/surfaceRegion failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_ADD_VIRTUAL_SCREEN_SURFACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_ADD_VIRTUAL_SCREEN_SURFACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1360,7 +1372,7 @@ DMError ScreenSessionManagerProxy::RemoveVirtualScreenSurface(ScreenId screenId,
         TLOGW(WmsLogTag::DMS, "SCB: Write screenId/surface failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REMOVE_VIRTUAL_SCREEN_SURFACE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REMOVE_VIRTUAL_SCREEN_SURFACE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1393,7 +1405,7 @@ DMError ScreenSessionManagerProxy::AddVirtualScreenBlockList(const std::vector<i
             return DMError::DM_ERROR_IPC_FAILED;
         }
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_ADD_VIRTUAL_SCREEN_BLOCK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -1427,7 +1439,7 @@ DMError ScreenSessionManagerProxy::RemoveVirtualScreenBlockList(const std::vecto
             return DMError::DM_ERROR_IPC_FAILED;
         }
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_REMOVE_VIRTUAL_SCREEN_BLOCK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -1476,7 +1488,7 @@ DMError ScreenSessionManagerProxy::SendVirtualScreenWhiteListRequest(ScreenId sc
         return DMError::DM_ERROR_IPC_FAILED;
     }
 
-    int32_t errCode = remote->SendRequest(static_cast<uint32_t>(transId), data, reply, option);
+    int32_t errCode = SendIpcRequest(remote, static_cast<uint32_t>(transId), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed, transId:%{public}d", static_cast<uint32_t>(transId));
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1521,7 +1533,7 @@ DMError ScreenSessionManagerProxy::SetScreenPrivacyMaskImage(ScreenId screenId,
             return DMError::DM_ERROR_IPC_FAILED;
         }
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_MASKIMAGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_MASKIMAGE),
         data, reply, option) != ERR_NONE) {
     TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
     return DMError::DM_ERROR_IPC_FAILED;
@@ -1548,7 +1560,7 @@ DMError ScreenSessionManagerProxy::IsOnboardDisplay(DisplayId displayId, bool& i
         TLOGE(WmsLogTag::DMS, "write displayId failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_IS_ON_BOARD_DISPLAY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_IS_ON_BOARD_DISPLAY),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "send request failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1590,7 +1602,8 @@ DMError ScreenSessionManagerProxy::SetVirtualMirrorScreenCanvasRotation(ScreenId
         TLOGW(WmsLogTag::DMS, "SCB:Write screenId/canvasRotation failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_CANVAS_ROTATION),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_CANVAS_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1621,7 +1634,7 @@ DMError ScreenSessionManagerProxy::SetVirtualMirrorScreenScaleMode(ScreenId scre
         TLOGE(WmsLogTag::DMS, "Write screenId/scaleMode failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_SCALE_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_SCALE_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1667,7 +1680,7 @@ DMError ScreenSessionManagerProxy::ResizeVirtualScreen(ScreenId screenId, uint32
         TLOGE(WmsLogTag::DMS, "WriteUnit32 renderHeight failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RESIZE_VIRTUAL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RESIZE_VIRTUAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_NULLPTR;
@@ -1699,7 +1712,7 @@ DMError ScreenSessionManagerProxy::DestroyVirtualScreen(ScreenId screenId, bool
         TLOGE(WmsLogTag::DMS, "SCB: WriteBool isCallingByThirdParty failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DESTROY_VIRTUAL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DESTROY_VIRTUAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1731,7 +1744,7 @@ DMError ScreenSessionManagerProxy::MakeMirror(ScreenId mainScreenId, std::vector
         TLOGE(WmsLogTag::DMS, "SCB: create mirror fail: data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: create mirror fail: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1764,7 +1777,7 @@ DMError ScreenSessionManagerProxy::MakeMirrorForRecord(const std::vector<ScreenI
         TLOGE(WmsLogTag::DMS, "SCB: create mirror fail: data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR_FOR_RECORD),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR_FOR_RECORD),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: create mirror fail: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1794,7 +1807,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::QueryMultiScreenCapture(
         TLOGE(WmsLogTag::DMS, "Write param failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_QUERY_MULTI_SCREEN_CAPTURE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_QUERY_MULTI_SCREEN_CAPTURE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1834,7 +1847,7 @@ DMError ScreenSessionManagerProxy::MakeMirror(ScreenId mainScreenId, std::vector
         TLOGE(WmsLogTag::DMS, "Write mainScreenRegion failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR_WITH_REGION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_MIRROR_WITH_REGION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "create mirror fail: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1867,7 +1880,7 @@ DMError ScreenSessionManagerProxy::SetMultiScreenMode(ScreenId mainScreenId, Scr
         TLOGE(WmsLogTag::DMS, "data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_MULTI_SCREEN_MODE_SWITCH),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_MULTI_SCREEN_MODE_SWITCH),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1900,7 +1913,7 @@ DMError ScreenSessionManagerProxy::SetMultiScreenRelativePosition(MultiScreenPos
         TLOGE(WmsLogTag::DMS, "data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_MULTI_SCREEN_POSITION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_MULTI_SCREEN_POSITION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1929,7 +1942,7 @@ DMError ScreenSessionManagerProxy::StopMirror(const std::vector<ScreenId>& mirro
         TLOGE(WmsLogTag::DMS, "data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_STOP_MIRROR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_STOP_MIRROR),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1957,7 +1970,7 @@ DMError ScreenSessionManagerProxy::DisableMirror(bool disableOrNot)
         TLOGE(WmsLogTag::DMS, "data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_DISABLE_MIRROR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_DISABLE_MIRROR),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -1992,7 +2005,7 @@ DMError ScreenSessionManagerProxy::MakeExpand(std::vector<ScreenId> screenId, st
         TLOGE(WmsLogTag::DMS, "SCB: write startPoint failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_EXPAND),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_MAKE_EXPAND),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SCB: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2022,7 +2035,7 @@ DMError ScreenSessionManagerProxy::StopExpand(const std::vector<ScreenId>& expan
         TLOGE(WmsLogTag::DMS, "data write failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_STOP_EXPAND),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_STOP_EXPAND),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2050,7 +2063,7 @@ sptr<ScreenGroupInfo> ScreenSessionManagerProxy::GetScreenGroupInfoById(ScreenId
         TLOGE(WmsLogTag::DMS, "SCB: Write screenId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_GROUP_INFO_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_GROUP_INFO_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return nullptr;
@@ -2085,7 +2098,7 @@ void ScreenSessionManagerProxy::RemoveVirtualScreenFromGroup(std::vector<ScreenI
         TLOGE(WmsLogTag::DMS, "SCB: write screens failed.");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         DisplayManagerMessage::TRANS_ID_REMOVE_VIRTUAL_SCREEN_FROM_SCREEN_GROUP),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
@@ -2125,7 +2138,7 @@ std::shared_ptr<Media::PixelMap> ScreenSessionManagerProxy::GetDisplaySnapshot(D
         return nullptr;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_SNAPSHOT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_SNAPSHOT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return nullptr;
@@ -2181,7 +2194,7 @@ std::vector<std::shared_ptr<Media::PixelMap>> ScreenSessionManagerProxy::GetDisp
         return { nullptr, nullptr };
     }
  
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_HDR_SNAPSHOT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_HDR_SNAPSHOT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SCB: SendRequest failed");
         return { nullptr, nullptr };
@@ -2214,7 +2227,7 @@ std::shared_ptr<Media::PixelMap> ScreenSessionManagerProxy::GetSnapshotByPicker(
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SNAPSHOT_BY_PICKER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SNAPSHOT_BY_PICKER),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -2256,7 +2269,7 @@ sptr<DisplayInfo> ScreenSessionManagerProxy::GetDisplayInfoById(DisplayId displa
         TLOGW(WmsLogTag::DMS, "WriteBool isGetActualInfo failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -2289,7 +2302,8 @@ sptr<DisplayInfo> ScreenSessionManagerProxy::GetVisibleAreaDisplayInfoById(Displ
         TLOGW(WmsLogTag::DMS, "WriteUint64 displayId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_VISIBLE_AREA_DISPLAY_INFO_BY_ID),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_VISIBLE_AREA_DISPLAY_INFO_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -2322,7 +2336,7 @@ sptr<DisplayInfo> ScreenSessionManagerProxy::GetDisplayInfoByScreen(ScreenId scr
         TLOGW(WmsLogTag::DMS, "fail to get displayInfo by screenId: WriteUint64 displayId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_BY_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_BY_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "fail to get displayInfo by screenId: SendRequest failed");
         return nullptr;
@@ -2356,7 +2370,7 @@ std::vector<DisplayId> ScreenSessionManagerProxy::GetAllDisplayIds(int32_t userI
         TLOGE(WmsLogTag::DMS, "WriteInt32 userId failed");
         return allDisplayIds;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_DISPLAYIDS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_DISPLAYIDS),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return allDisplayIds;
@@ -2384,7 +2398,7 @@ sptr<ScreenInfo> ScreenSessionManagerProxy::GetScreenInfoById(ScreenId screenId,
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_INFO_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_INFO_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -2421,7 +2435,7 @@ DMError ScreenSessionManagerProxy::GetAllScreenInfos(std::vector<sptr<ScreenInfo
         TLOGW(WmsLogTag::DMS, "Write isFromNapi failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_SCREEN_INFOS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_SCREEN_INFOS),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "GetAllScreenInfos: SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2451,7 +2465,7 @@ DMError ScreenSessionManagerProxy::GetScreenSupportedColorGamuts(ScreenId screen
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_COLOR_GAMUTS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTED_COLOR_GAMUTS),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2490,7 +2504,7 @@ DMError ScreenSessionManagerProxy::GetBrightnessInfo(DisplayId displayId, Screen
         TLOGW(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SCREEN_BRIGHTNESS_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SCREEN_BRIGHTNESS_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2541,7 +2555,7 @@ DMError ScreenSessionManagerProxy::GetSupportsInput(DisplayId displayId, bool& s
         TLOGW(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTS_INPUT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_SUPPORTS_INPUT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2584,7 +2598,7 @@ DMError ScreenSessionManagerProxy::SetSupportsInput(DisplayId displayId, bool su
         TLOGW(WmsLogTag::DMS, "Write supportsInput failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_SUPPORTS_INPUT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_SET_SUPPORTS_INPUT),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2619,7 +2633,7 @@ DMError ScreenSessionManagerProxy::GetBundleName(DisplayId displayId, std::strin
         TLOGW(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_BUNDLE_NAME),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCREEN_GET_BUNDLE_NAME),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2651,7 +2665,7 @@ DMError ScreenSessionManagerProxy::GetRoundedCorner(DisplayId displayId, int& ra
         TLOGW(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ROUNDED_CORNER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ROUNDED_CORNER),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2683,7 +2697,7 @@ DMError ScreenSessionManagerProxy::GetPhysicalScreenIds(std::vector<ScreenId>& s
         TLOGW(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return DMError::DM_ERROR_WRITE_INTERFACE_TOKEN_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PHYSICAL_SCREEN_IDS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PHYSICAL_SCREEN_IDS),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2735,7 +2749,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::SetOrientation(ScreenId screenId
         TLOGW(WmsLogTag::DMS, "Write isFromNapi failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_ORIENTATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_ORIENTATION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2779,7 +2793,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::SetOrientation(ScreenId screenId
         TLOGW(WmsLogTag::DMS, "Write isFromNapi failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_ORIENTATION_WITH_OPTIONS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_ORIENTATION_WITH_OPTIONS),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2806,7 +2820,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::SetScreenRotationLocked(bool isL
         TLOGE(WmsLogTag::DMS, "write isLocked failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ROTATION_LOCKED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ROTATION_LOCKED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2833,7 +2847,8 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::SetScreenRotationLockedFromJs(bo
         TLOGE(WmsLogTag::DMS, "write isLocked failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ROTATION_LOCKED_FROM_JS),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ROTATION_LOCKED_FROM_JS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2856,7 +2871,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::IsScreenRotationLocked(bool& isL
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return DMError::DM_ERROR_WRITE_INTERFACE_TOKEN_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_IS_SCREEN_ROTATION_LOCKED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_IS_SCREEN_ROTATION_LOCKED),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2884,7 +2899,7 @@ sptr<CutoutInfo> ScreenSessionManagerProxy::GetCutoutInfo(DisplayId displayId)
         TLOGE(WmsLogTag::DMS, "write displayId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CUTOUT_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CUTOUT_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "GetCutoutInfo failed");
         return nullptr;
@@ -2924,7 +2939,7 @@ sptr<CutoutInfo> ScreenSessionManagerProxy::GetCutoutInfo(DisplayId displayId, i
         TLOGE(WmsLogTag::DMS, "write rotation failed!");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CUTOUT_INFO_WITH_ROTATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CUTOUT_INFO_WITH_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "GetCutoutInfoWithRotation failed");
         return nullptr;
@@ -2952,7 +2967,7 @@ DMError ScreenSessionManagerProxy::HasImmersiveWindow(ScreenId screenId, bool& i
         return DMError::DM_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_HAS_IMMERSIVE_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_HAS_IMMERSIVE_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -2982,7 +2997,7 @@ bool OHOS::Rosen::ScreenSessionManagerProxy::ConvertScreenIdToRsScreenId(ScreenI
         return false;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_CONVERT_SCREENID_TO_RSSCREENID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_CONVERT_SCREENID_TO_RSSCREENID),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -3012,7 +3027,7 @@ DMError OHOS::Rosen::ScreenSessionManagerProxy::HasPrivateWindow(DisplayId displ
         return DMError::DM_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_HAS_PRIVATE_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_HAS_PRIVATE_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -3036,7 +3051,7 @@ void ScreenSessionManagerProxy::DumpAllScreensInfo(std::string& dumpInfo)
         TLOGE(WmsLogTag::DMS, "failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_DUMP_ALL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_DUMP_ALL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "failed");
         return;
@@ -3062,7 +3077,7 @@ void ScreenSessionManagerProxy::DumpSpecialScreenInfo(ScreenId id, std::string&
         TLOGE(WmsLogTag::DMS, "write ScreenId failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_DUMP_SPECIAL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_DUMP_SPECIAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "failed");
         return;
@@ -3089,7 +3104,7 @@ void ScreenSessionManagerProxy::SetFoldDisplayMode(const FoldDisplayMode display
         TLOGE(WmsLogTag::DMS, "Write displayMode failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_SET_FOLD_DISPLAY_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_SET_FOLD_DISPLAY_MODE),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SCENE_BOARD_SET_FOLD_DISPLAY_MODE request failed");
     }
@@ -3118,7 +3133,7 @@ DMError ScreenSessionManagerProxy::SetFoldDisplayModeFromJs(const FoldDisplayMod
         TLOGE(WmsLogTag::DMS, "Write reason failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_FOLD_DISPLAY_MODE_FROM_JS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_FOLD_DISPLAY_MODE_FROM_JS),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send request failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -3148,7 +3163,7 @@ void ScreenSessionManagerProxy::SetDisplayScale(ScreenId screenId, float scaleX,
         TLOGE(WmsLogTag::DMS, "Write screen scale info failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_SET_DISPLAY_SCALE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_SET_DISPLAY_SCALE),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SCENE_BOARD_SET_DISPLAY_SCALE request failed");
     }
@@ -3172,7 +3187,7 @@ void ScreenSessionManagerProxy::SetFoldStatusLocked(bool locked)
         TLOGE(WmsLogTag::DMS, "Write lock fold display status failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             DisplayManagerMessage::TRANS_ID_SCENE_BOARD_LOCK_FOLD_DISPLAY_STATUS),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SCENE_BOARD_LOCK_FOLD_DISPLAY_STATUS request failed");
@@ -3198,7 +3213,7 @@ DMError ScreenSessionManagerProxy::SetFoldStatusLockedFromJs(bool locked)
         TLOGE(WmsLogTag::DMS, "Write lock fold display status failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             DisplayManagerMessage::TRANS_ID_SET_LOCK_FOLD_DISPLAY_STATUS_FROM_JS),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send request failed");
@@ -3232,7 +3247,7 @@ DMError ScreenSessionManagerProxy::ForceSetFoldStatusAndLock(FoldStatus targetFo
         TLOGE(WmsLogTag::DMS, "Write lock fold display status failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             DisplayManagerMessage::TRANS_ID_SET_TARGET_FOLD_STATUS_AND_LOCK),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SET_TARGET_FOLD_STATUS_AND_LOCK request failed");
@@ -3261,7 +3276,7 @@ DMError ScreenSessionManagerProxy::RestorePhysicalFoldStatus()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken Failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             DisplayManagerMessage::TRANS_ID_UNLOCK_TARGET_FOLD_STATUS),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_UNLOCK_TARGET_FOLD_STATUS request failed");
@@ -3294,7 +3309,7 @@ void ScreenSessionManagerProxy::SetFoldStatusExpandAndLocked(bool locked)
         TLOGE(WmsLogTag::DMS, "Write lock fold display status failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             DisplayManagerMessage::TRANS_ID_SET_FOLD_STATUS_EXPAND_AND_LOCKED),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SET_FOLD_STATUS_EXPAND_AND_LOCKED request failed");
@@ -3315,7 +3330,7 @@ FoldDisplayMode ScreenSessionManagerProxy::GetFoldDisplayMode()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken Failed");
         return FoldDisplayMode::UNKNOWN;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_FOLD_DISPLAY_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_FOLD_DISPLAY_MODE),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_SCENE_BOARD_GET_FOLD_DISPLAY_MODE request failed");
         return FoldDisplayMode::UNKNOWN;
@@ -3338,7 +3353,7 @@ bool ScreenSessionManagerProxy::IsFoldable()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_IS_FOLDABLE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_IS_FOLDABLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -3361,7 +3376,7 @@ bool ScreenSessionManagerProxy::IsCaptured()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DEVICE_IS_CAPTURE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DEVICE_IS_CAPTURE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -3388,7 +3403,7 @@ bool ScreenSessionManagerProxy::IsCapturedByBundleNameList(const std::vector<std
         TLOGE(WmsLogTag::DMS, "Write bundleNameList failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DEVICE_IS_CAPTURE_BY_BUNDLE_LIST),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DEVICE_IS_CAPTURE_BY_BUNDLE_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -3411,7 +3426,7 @@ FoldStatus ScreenSessionManagerProxy::GetFoldStatus()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return FoldStatus::UNKNOWN;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_FOLD_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_FOLD_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return FoldStatus::UNKNOWN;
@@ -3434,7 +3449,7 @@ SuperFoldStatus ScreenSessionManagerProxy::GetSuperFoldStatus()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return SuperFoldStatus::UNKNOWN;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_SUPER_FOLD_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_SUPER_FOLD_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return SuperFoldStatus::UNKNOWN;
@@ -3457,7 +3472,7 @@ float ScreenSessionManagerProxy::GetSuperRotation()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return -1.f;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_SUPER_ROTATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_SUPER_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return -1.f;
@@ -3484,7 +3499,7 @@ void ScreenSessionManagerProxy::SetLandscapeLockStatus(bool isLocked)
         TLOGE(WmsLogTag::DMS, "Write isLocked failed");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_LANDSCAPE_LOCK_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -3515,7 +3530,7 @@ void ScreenSessionManagerProxy::SetForceCloseHdr(ScreenId screenId, bool isForce
         TLOGE(WmsLogTag::DMS, "Write isForceCloseHdr failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_FORCE_CLOSE_HDR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_FORCE_CLOSE_HDR),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -3537,7 +3552,7 @@ ExtendScreenConnectStatus ScreenSessionManagerProxy::GetExtendScreenConnectStatu
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return ExtendScreenConnectStatus::UNKNOWN;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_EXTEND_SCREEN_CONNECT_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_EXTEND_SCREEN_CONNECT_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return ExtendScreenConnectStatus::UNKNOWN;
@@ -3560,7 +3575,7 @@ sptr<FoldCreaseRegion> ScreenSessionManagerProxy::GetCurrentFoldCreaseRegion()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return nullptr;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_CURRENT_FOLD_CREASE_REGION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -3584,7 +3599,7 @@ DMError ScreenSessionManagerProxy::GetLiveCreaseRegion(FoldCreaseRegion& region)
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return DMError::DM_ERROR_WRITE_INTERFACE_TOKEN_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_GET_LIVE_CREASE_REGION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -3659,7 +3674,7 @@ DMError ScreenSessionManagerProxy::MakeUniqueScreen(const std::vector<ScreenId>&
           "IPC Proxy sending parameters, isRotationLocked: %{public}d, rotation: %{public}d",
           rotationOptions.isRotationLocked_, rotationOptions.rotation_);
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SCENE_BOARD_MAKE_UNIQUE_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -3688,7 +3703,7 @@ void ScreenSessionManagerProxy::SetClient(const sptr<IScreenSessionManagerClient
         TLOGE(WmsLogTag::DMS, "WriteRemoteObject failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_CLIENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_CLIENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -3710,7 +3725,7 @@ void ScreenSessionManagerProxy::SwitchUser()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SWITCH_USER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SWITCH_USER),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -3736,7 +3751,7 @@ ScreenProperty ScreenSessionManagerProxy::GetScreenProperty(ScreenId screenId)
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return {};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_PROPERTY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_PROPERTY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return {};
@@ -3768,7 +3783,7 @@ std::shared_ptr<RSDisplayNode> ScreenSessionManagerProxy::GetDisplayNode(ScreenI
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_NODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_NODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -3801,7 +3816,7 @@ ScreenCombination ScreenSessionManagerProxy::GetScreenCombination(ScreenId scree
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return ScreenCombination::SCREEN_ALONE;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_COMBINATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_COMBINATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return ScreenCombination::SCREEN_ALONE;
@@ -3849,7 +3864,7 @@ void ScreenSessionManagerProxy::UpdateScreenDirectionInfo(ScreenId screenId, con
         TLOGE(WmsLogTag::DMS, "Write bounds failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SCREEN_DIRECTION_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SCREEN_DIRECTION_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -3892,7 +3907,7 @@ void ScreenSessionManagerProxy::UpdateScreenRotationProperty(ScreenId screenId,
         TLOGE(WmsLogTag::DMS, "Write isSwitchUser failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SCREEN_ROTATION_PROPERTY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SCREEN_ROTATION_PROPERTY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -3914,7 +3929,8 @@ uint32_t ScreenSessionManagerProxy::GetCurvedCompressionArea()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return 0;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CURVED_SCREEN_COMPRESSION_AREA),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_CURVED_SCREEN_COMPRESSION_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return 0;
@@ -3942,7 +3958,7 @@ ScreenProperty ScreenSessionManagerProxy::GetPhyScreenProperty(ScreenId screenId
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return {};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PHY_SCREEN_PROPERTY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PHY_SCREEN_PROPERTY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return {};
@@ -3974,7 +3990,7 @@ void ScreenSessionManagerProxy::NotifyDisplayChangeInfoChanged(const sptr<Displa
         TLOGE(WmsLogTag::DMS, "Write display change info failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_CHANGE_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_CHANGE_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4000,7 +4016,7 @@ void ScreenSessionManagerProxy::SetScreenPrivacyState(bool hasPrivate)
         TLOGE(WmsLogTag::DMS, "Write hasPrivate failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4036,7 +4052,7 @@ void ScreenSessionManagerProxy::SetPrivacyStateByDisplayId(std::unordered_map<Di
             return;
         }
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREENID_PRIVACY_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREENID_PRIVACY_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4066,7 +4082,7 @@ void ScreenSessionManagerProxy::SetScreenPrivacyWindowList(DisplayId id, std::ve
         TLOGE(WmsLogTag::DMS, "Write privacyWindowList failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_WINDOW_LIST),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_WINDOW_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4097,7 +4113,7 @@ void ScreenSessionManagerProxy::UpdateAvailableArea(ScreenId screenId, DMRect ar
         TLOGE(WmsLogTag::DMS, "Write area failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_AVAILABLE_AREA),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_AVAILABLE_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4133,7 +4149,7 @@ void ScreenSessionManagerProxy::UpdateSuperFoldAvailableArea(ScreenId screenId,
         TLOGE(WmsLogTag::DMS, "Write cArea failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SUPER_FOLD_AVAILABLE_AREA),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SUPER_FOLD_AVAILABLE_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4164,7 +4180,7 @@ void ScreenSessionManagerProxy::UpdateSuperFoldExpandAvailableArea(ScreenId scre
         TLOGE(WmsLogTag::DMS, "Write area failed");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_UPDATE_SUPER_FOLD_EXPAND_AVAILABLE_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -4191,7 +4207,7 @@ int32_t ScreenSessionManagerProxy::SetScreenOffDelayTime(int32_t delay)
         TLOGE(WmsLogTag::DMS, "Write delay failed");
         return 0;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_OFF_DELAY_TIME),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_OFF_DELAY_TIME),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return 0;
@@ -4218,7 +4234,7 @@ int32_t ScreenSessionManagerProxy::SetScreenOnDelayTime(int32_t delay)
         TLOGE(WmsLogTag::DMS, "Write delay failed");
         return 0;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ON_DELAY_TIME),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_ON_DELAY_TIME),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return 0;
@@ -4249,7 +4265,7 @@ void ScreenSessionManagerProxy::SetCameraStatus(int32_t cameraStatus, int32_t ca
         TLOGE(WmsLogTag::DMS, "Write cameraPosition failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_CAMERA_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_CAMERA_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4275,7 +4291,7 @@ DMError ScreenSessionManagerProxy::GetAvailableArea(DisplayId displayId, DMRect&
         TLOGE(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_AVAILABLE_AREA),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_AVAILABLE_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4308,7 +4324,7 @@ DMError ScreenSessionManagerProxy::GetExpandAvailableArea(DisplayId displayId, D
         TLOGE(WmsLogTag::DMS, "Write displayId failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_EXPAND_AVAILABLE_AREA),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_EXPAND_AVAILABLE_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4341,7 +4357,7 @@ void ScreenSessionManagerProxy::NotifyFoldToExpandCompletion(bool foldToExpand)
         TLOGE(WmsLogTag::DMS, "Write foldToExpand failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_FOLD_TO_EXPAND_COMPLETION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_FOLD_TO_EXPAND_COMPLETION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4367,7 +4383,7 @@ void ScreenSessionManagerProxy::NotifyScreenConnectCompletion(ScreenId screenId)
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SCREEN_CONNECT_COMPLETION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SCREEN_CONNECT_COMPLETION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4397,7 +4413,7 @@ void ScreenSessionManagerProxy::NotifyAodOpCompletion(AodOP operation, int32_t r
         TLOGE(WmsLogTag::DMS, "Write operation result failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_AOD_OP_COMPLETION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_AOD_OP_COMPLETION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4423,7 +4439,7 @@ void ScreenSessionManagerProxy::SetPowerStateForAod(ScreenPowerState state)
         TLOGE(WmsLogTag::DMS, "Write state failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_POWER_STATE_AOD),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_POWER_STATE_AOD),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4453,7 +4469,7 @@ void ScreenSessionManagerProxy::RecordEventFromScb(std::string description, bool
         TLOGE(WmsLogTag::DMS, "Write needRecordEvent failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RECORD_EVENT_FROM_SCB),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RECORD_EVENT_FROM_SCB),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4482,7 +4498,7 @@ VirtualScreenFlag ScreenSessionManagerProxy::GetVirtualScreenFlag(ScreenId scree
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return VirtualScreenFlag::DEFAULT;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_VIRTUAL_SCREEN_FLAG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_VIRTUAL_SCREEN_FLAG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return VirtualScreenFlag::DEFAULT;
@@ -4515,7 +4531,7 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenFlag(ScreenId screenId, Virtu
         TLOGE(WmsLogTag::DMS, "Write screenId or screenFlag failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_FLAG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_FLAG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4537,7 +4553,7 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenRefreshRate(ScreenId screenId
         TLOGE(WmsLogTag::DMS, "Write screenId or refreshInterval failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (Remote()->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_REFRESH_RATE),
+    if (SendIpcRequest(Remote(), static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_REFRESH_RATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4560,7 +4576,7 @@ DeviceScreenConfig ScreenSessionManagerProxy::GetDeviceScreenConfig()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return {};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DEVICE_SCREEN_CONFIG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DEVICE_SCREEN_CONFIG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return {};
@@ -4601,7 +4617,7 @@ DMError ScreenSessionManagerProxy::ProxyForFreeze(const std::set<int32_t>& pidLi
         TLOGE(WmsLogTag::DMS, "proxy for freeze write date: failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_PROXY_FOR_FREEZE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_PROXY_FOR_FREEZE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "proxy for freeze send request: failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4623,7 +4639,7 @@ DMError ScreenSessionManagerProxy::ResetAllFreezeStatus()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RESET_ALL_FREEZE_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_RESET_ALL_FREEZE_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4662,7 +4678,7 @@ void ScreenSessionManagerProxy::SetVirtualScreenBlackList(ScreenId screenId, std
         TLOGE(WmsLogTag::DMS, "Write typeBlackList failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_BLACK_LIST),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_BLACK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4692,7 +4708,7 @@ void ScreenSessionManagerProxy::SetVirtualDisplayMuteFlag(ScreenId screenId, boo
         return;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_DISPLAY_MUTE_FLAG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_DISPLAY_MUTE_FLAG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4717,7 +4733,7 @@ void ScreenSessionManagerProxy::DisablePowerOffRenderControl(ScreenId screenId)
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DISABLE_POWEROFF_RENDER_CONTROL),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_DISABLE_POWEROFF_RENDER_CONTROL),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4762,7 +4778,7 @@ void OHOS::Rosen::ScreenSessionManagerProxy::UpdateDisplayHookInfo(int32_t uid,
             return;
         }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_HOOK_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_DISPLAY_HOOK_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4791,7 +4807,7 @@ void ScreenSessionManagerProxy::GetDisplayHookInfo(int32_t uid, DMHookInfo& hook
         return;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_HOOK_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_HOOK_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4825,7 +4841,8 @@ void ScreenSessionManagerProxy::NotifyIsFullScreenInForceSplitMode(int32_t uid,
         TLOGE(WmsLogTag::DMS, "Write isFullScreen failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_IS_FULL_SCREEN_IN_FORCE_SPLIT),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_IS_FULL_SCREEN_IN_FORCE_SPLIT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -4860,7 +4877,7 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenSecurityExemption(ScreenId sc
         TLOGE(WmsLogTag::DMS, "write date: failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_SECURITY_EXEMPTION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "send request: failed");
@@ -4883,7 +4900,8 @@ std::vector<DisplayPhysicalResolution> ScreenSessionManagerProxy::GetAllDisplayP
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return std::vector<DisplayPhysicalResolution> {};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_PHYSICAL_DISPLAY_RESOLUTION),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_ALL_PHYSICAL_DISPLAY_RESOLUTION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return std::vector<DisplayPhysicalResolution> {};
@@ -4919,7 +4937,7 @@ DMError ScreenSessionManagerProxy::GetDisplayCapability(std::string& capabilitIn
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return DMError::DM_ERROR_WRITE_INTERFACE_TOKEN_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_CAPABILITY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_CAPABILITY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -4956,7 +4974,7 @@ bool ScreenSessionManagerProxy::SetVirtualScreenStatus(ScreenId screenId, Virtua
         return false;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -4991,7 +5009,8 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenMaxRefreshRate(ScreenId id, u
         TLOGE(WmsLogTag::DMS, "WriteUnit32 width failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_MAX_REFRESHRATE),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_MAX_REFRESHRATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_NULLPTR;
@@ -5021,7 +5040,7 @@ std::shared_ptr<Media::PixelMap> ScreenSessionManagerProxy::GetScreenCapture(con
         TLOGE(WmsLogTag::DMS, "Write displayId or isNeedNotify or isNeedPointer failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_CAPTURE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_CAPTURE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -5052,7 +5071,7 @@ sptr<DisplayInfo> ScreenSessionManagerProxy::GetPrimaryDisplayInfo()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PRIMARY_DISPLAY_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PRIMARY_DISPLAY_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -5079,7 +5098,7 @@ DisplayId ScreenSessionManagerProxy::GetPrimaryDisplayId()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return SCREEN_ID_INVALID;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PRIMARY_DISPLAY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_PRIMARY_DISPLAY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return SCREEN_ID_INVALID;
@@ -5119,7 +5138,7 @@ std::shared_ptr<Media::PixelMap> ScreenSessionManagerProxy::GetDisplaySnapshotWi
         TLOGE(WmsLogTag::DMS, "Write scale or rect failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_SNAPSHOT_WITH_OPTION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_DISPLAY_SNAPSHOT_WITH_OPTION),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return nullptr;
@@ -5161,7 +5180,7 @@ std::vector<std::shared_ptr<Media::PixelMap>> ScreenSessionManagerProxy::GetDisp
         TLOGE(WmsLogTag::DMS, "Write displayId or isNeedNotify or isNeedPointer or displayIntent failed");
         return { nullptr, nullptr };
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         DisplayManagerMessage::TRANS_ID_GET_DISPLAY_HDR_SNAPSHOT_WITH_OPTION), data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return { nullptr, nullptr };
@@ -5199,7 +5218,7 @@ DMError ScreenSessionManagerProxy::SetScreenSkipProtectedWindow(const std::vecto
         TLOGE(WmsLogTag::DMS, "Write isEnable failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_SKIP_PROTECTED_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_SKIP_PROTECTED_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5225,7 +5244,7 @@ bool ScreenSessionManagerProxy::GetIsRealScreen(ScreenId screenId)
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_IS_REAL_SCREEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_IS_REAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return false;
@@ -5247,7 +5266,7 @@ void ScreenSessionManagerProxy::SetDefaultMultiScreenModeWhenSwitchUser()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DEFAULT_MODE_WHEN_SWITCH_USER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_DEFAULT_MODE_WHEN_SWITCH_USER),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -5270,7 +5289,8 @@ void ScreenSessionManagerProxy::NotifyExtendScreenCreateFinish()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_EXTEND_SCREEN_CREATE_FINISH),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_EXTEND_SCREEN_CREATE_FINISH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -5292,7 +5312,8 @@ void ScreenSessionManagerProxy::NotifyExtendScreenDestroyFinish()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_EXTEND_SCREEN_DESTROY_FINISH),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_EXTEND_SCREEN_DESTROY_FINISH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -5314,7 +5335,7 @@ void ScreenSessionManagerProxy::NotifyScreenMaskAppear()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SCREEN_MASK_APPEAR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SCREEN_MASK_APPEAR),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -5345,7 +5366,7 @@ DMError ScreenSessionManagerProxy::GetScreenAreaOfDisplayArea(DisplayId displayI
         TLOGE(WmsLogTag::DMS, "Write displayArea failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_AREA_OF_DISPLAY_AREA),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_AREA_OF_DISPLAY_AREA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5379,7 +5400,7 @@ DMError ScreenSessionManagerProxy::SetPrimaryDisplaySystemDpi(float dpi)
         TLOGE(WmsLogTag::DMS, "write dpi failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_PRIMARY_DISPLAY_SYSTEM_DPI),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_PRIMARY_DISPLAY_SYSTEM_DPI),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5411,7 +5432,7 @@ DMError ScreenSessionManagerProxy::SetVirtualScreenAutoRotation(ScreenId screenI
         TLOGE(WmsLogTag::DMS, "Write enable failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_AUTO_ROTATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_VIRTUAL_SCREEN_AUTO_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5451,7 +5472,8 @@ DMError ScreenSessionManagerProxy::SetScreenPrivacyWindowTagSwitch(ScreenId scre
         TLOGE(WmsLogTag::DMS, "Write enable failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_WINDOW_TAG_SWITCH),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_WINDOW_TAG_SWITCH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5477,7 +5499,8 @@ void ScreenSessionManagerProxy::NotifySwitchUserAnimationFinish()
         TLOGE(WmsLogTag::DMS, "WriteInterfaceToken failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SWITCH_USER_ANIMATION_FINISH),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_NOTIFY_SWITCH_USER_ANIMATION_FINISH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
@@ -5507,7 +5530,7 @@ DMError ScreenSessionManagerProxy::SyncScreenPropertyChangedToServer(ScreenId sc
         TLOGE(WmsLogTag::DMS, "Write screenSession failed");
         return DMError::DM_ERROR_WRITE_DATA_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         DisplayManagerMessage::TRANS_ID_UPDATE_SCREEN_PROPERTY_BY_FOLD_STATE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
@@ -5539,7 +5562,7 @@ DMError ScreenSessionManagerProxy::GetScreenCapability(ScreenId screenId, Screen
         TLOGW(WmsLogTag::DMS, "WriteUint64 screenId failed");
         return DMError::DM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_CAPABILITY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_SCREEN_CAPABILITY),
         data, reply, option) != ERR_NONE) {
         TLOGW(WmsLogTag::DMS, "SendRequest failed");
         return DMError::DM_ERROR_IPC_FAILED;
@@ -5573,7 +5596,7 @@ sptr<IRemoteObject> ScreenSessionManagerProxy::GetRenderSession(ScreenId screenI
         TLOGE(WmsLogTag::DMS, "Write screenId failed");
         return nullptr;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_RENDER_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_GET_RENDER_SESSION),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "Send TRANS_ID_GET_RENDER_SESSION request failed");
         return nullptr;
@@ -5599,7 +5622,7 @@ void ScreenSessionManagerProxy::SetHoverBlockList(const std::vector<std::string>
         TLOGE(WmsLogTag::DMS, "Write hoverBlockList failed");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_HOVER_BLOCK_LIST),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(DisplayManagerMessage::TRANS_ID_SET_HOVER_BLOCK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed");
         return;
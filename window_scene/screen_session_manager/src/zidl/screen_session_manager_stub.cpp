@@ -16,6 +16,7 @@
 #include "zidl/screen_session_manager_stub.h"
 
 #include "common/rs_rect.h"
+#include "common/include/latency_histogram.h"
 #include "dm_common.h"
 #include "ws_common.h"
 #include "session_permission.h"
@@ -39,6 +40,8 @@ int32_t ScreenSessionManagerStub::OnRemoteRequest(uint32_t code, MessageParcel&
     MessageOption& option)
 {
     DmUtils::HoldLock callbackLock;
+    static IpcLatencyTable latencyTable("ScreenSessionManager");
+    IpcLatencyScope latencyScope(latencyTable, code, data, reply);
     int32_t result = OnRemoteRequestInner(code, data, reply, option);
     return result;
 }
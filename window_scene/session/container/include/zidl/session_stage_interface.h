@@ -126,7 +126,13 @@ public:
     virtual void NotifyOccupiedAreaChangeInfo(sptr<OccupiedAreaChangeInfo> info,
         const std::shared_ptr<RSTransaction>& rsTransaction, const Rect& callingSessionRect,
         const std::map<AvoidAreaType, AvoidArea>& avoidAreas) = 0;
-    virtual WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) = 0;
+    /**
+     * @brief Push an avoid area to the client.
+     *
+     * @param rect The window rect the avoid area is computed for, empty if unknown.
+     */
+    virtual WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) = 0;
     virtual void NotifyScreenshot() = 0;
     virtual WSError NotifyScreenshotAppEvent(ScreenshotEventType type) = 0;
     virtual void DumpSessionElementInfo(const std::vector<std::string>& params) = 0;
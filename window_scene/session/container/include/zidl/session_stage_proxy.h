@@ -50,7 +50,8 @@ public:
     void NotifyOccupiedAreaChangeInfo(sptr<OccupiedAreaChangeInfo> info,
         const std::shared_ptr<RSTransaction>& rsTransaction, const Rect& callingSessionRect,
         const std::map<AvoidAreaType, AvoidArea>& avoidAreas) override;
-    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) override;
     void NotifyScreenshot() override;
     WSError NotifyScreenshotAppEvent(ScreenshotEventType type) override;
     void DumpSessionElementInfo(const std::vector<std::string>& params)  override;
@@ -24,6 +24,9 @@
 
 #include "window_manager_hilog.h"
 #include "ws_common.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
 
 namespace OHOS::Rosen {
 namespace {
@@ -109,6 +112,15 @@ bool ReadLargeStringVectorFromParcel(MessageParcel& reply, std::vector<std::stri
 
     return true;
 }
+
+int SendIpcRequest(const sptr<IRemoteObject>& remote, uint32_t code, MessageParcel& data, MessageParcel& reply,
+    MessageOption& option)
+{
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadScope payloadScope(IpcSide::PROXY, "SessionStage", code, data, reply);
+#endif
+    return remote->SendRequest(code, data, reply, option);
+}
 }
 
 WSError SessionStageProxy::SetActive(bool active)
@@ -132,7 +144,7 @@ WSError SessionStageProxy::SetActive(bool active)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_ACTIVE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_ACTIVE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -162,7 +174,7 @@ WSError SessionStageProxy::UpdateDisplayId(uint64_t displayId)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DISPLAYID_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DISPLAYID_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -241,7 +253,7 @@ WSError SessionStageProxy::UpdateRect(const WSRect& rect, SizeChangeReason reaso
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SIZE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SIZE_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -273,7 +285,7 @@ WSError SessionStageProxy::UpdateGlobalDisplayRectFromServer(const WSRect& rect,
     }
     MessageParcel reply;
     MessageOption option(MessageOption::TF_ASYNC);
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_GLOBAL_DISPLAY_RECT), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Failed to send request, error = %{public}d", sendRet);
@@ -298,7 +310,7 @@ void SessionStageProxy::UpdateDensity()
         return;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DENSITY_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DENSITY_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -321,7 +333,7 @@ WSError SessionStageProxy::UpdateOrientation()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_ORIENTATION_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_ORIENTATION_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DMS, "SendRequest failed.");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -354,7 +366,7 @@ WSError SessionStageProxy::UpdateSessionViewportConfig(const SessionViewportConf
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_SESSION_VIEWPORT_CONFIG),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -380,7 +392,7 @@ WSError SessionStageProxy::HandleBackEvent()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_HANDLE_BACK_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_HANDLE_BACK_EVENT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -419,7 +431,7 @@ WSError SessionStageProxy::SwitchFreeMultiWindow(bool enable, const std::set<Scr
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SWITCH_FREEMULTIWINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SWITCH_FREEMULTIWINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -455,7 +467,7 @@ WSError SessionStageProxy::UpdateScreenSupportMultiWindow(
         return WSError::WS_ERROR_IPC_FAILED;
     }
  
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_SCREEN_SUPPORT_MULTI_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
@@ -484,7 +496,7 @@ WSError SessionStageProxy::ConfigDockAutoHide(bool isDockAutoHide)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_CONFIG_DOCK_AUTO_HIDE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_CONFIG_DOCK_AUTO_HIDE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -513,7 +525,7 @@ WSError SessionStageProxy::GetUIContentRemoteObj(sptr<IRemoteObject>& uiContentR
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_UI_CONTENT_REMOTE_OBJ),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_UI_CONTENT_REMOTE_OBJ),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -548,7 +560,7 @@ WSError SessionStageProxy::NotifyDestroy()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DESTROY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DESTROY),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -573,7 +585,7 @@ WSError SessionStageProxy::NotifyCloseExistPipWindow()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_CLOSE_EXIST_PIP_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_CLOSE_EXIST_PIP_WINDOW),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -613,7 +625,7 @@ WSError SessionStageProxy::UpdateFocus(const sptr<FocusNotifyInfo>& focusNotifyI
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_FOCUS_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_FOCUS_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFW("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -643,7 +655,7 @@ WSError SessionStageProxy::NotifyTransferComponentData(const AAFwk::WantParams&
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TRANSFER_COMPONENT_DATA),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -676,7 +688,7 @@ WSErrorCode SessionStageProxy::NotifyTransferComponentDataSync(const AAFwk::Want
         return WSErrorCode::WS_ERROR_TRANSFER_DATA_FAILED;
     }
 
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TRANSFER_COMPONENT_DATA_SYNC),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -749,7 +761,7 @@ void SessionStageProxy::NotifyOccupiedAreaChangeInfo(sptr<OccupiedAreaChangeInfo
         return;
     }
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_OCCUPIED_AREA_CHANGE_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_KEYBOARD, "SendRequest failed");
@@ -758,7 +770,7 @@ void SessionStageProxy::NotifyOccupiedAreaChangeInfo(sptr<OccupiedAreaChangeInfo
     return;
 }
 
-WSError SessionStageProxy::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
+WSError SessionStageProxy::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type, const WSRect& rect)
 {
     MessageParcel data;
     MessageParcel reply;
@@ -775,12 +787,17 @@ WSError SessionStageProxy::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, Avo
         TLOGE(WmsLogTag::WMS_IMMS, "Write AvoidAreaType failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
+    if (!(data.WriteInt32(rect.posX_) && data.WriteInt32(rect.posY_) &&
+        data.WriteUint32(rect.width_) && data.WriteUint32(rect.height_))) {
+        TLOGE(WmsLogTag::WMS_IMMS, "Write rect failed");
+        return WSError::WS_ERROR_IPC_FAILED;
+    }
     sptr<IRemoteObject> remote = Remote();
     if (remote == nullptr) {
         TLOGE(WmsLogTag::WMS_IMMS, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_AVOID_AREA), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_IMMS, "SendRequest failed, code: %{public}d", sendCode);
@@ -807,7 +824,7 @@ void SessionStageProxy::DumpSessionElementInfo(const std::vector<std::string>& p
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_DUMP_SESSSION_ELEMENT_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_DUMP_SESSSION_ELEMENT_INFO),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -828,7 +845,7 @@ void SessionStageProxy::NotifyScreenshot()
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SCREEN_SHOT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SCREEN_SHOT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -853,7 +870,7 @@ WSError SessionStageProxy::NotifyScreenshotAppEvent(ScreenshotEventType type)
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SCREEN_SHOT_APP_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SCREEN_SHOT_APP_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -875,7 +892,7 @@ WSError SessionStageProxy::NotifyTouchOutside()
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TOUCH_OUTSIDE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TOUCH_OUTSIDE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -903,7 +920,7 @@ WSError SessionStageProxy::NotifyExtensionSecureLimitChange(bool isLimit)
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SECURE_LIMIT_CHANGE), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code:%{public}d", sendCode);
@@ -933,7 +950,7 @@ WSError SessionStageProxy::NotifyWindowVisibility(bool isVisible)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(messageCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, messageCode, data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -959,7 +976,7 @@ WSError SessionStageProxy::NotifyWindowOcclusionState(const WindowVisibilityStat
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "stage remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_OCCLUSION_STATE),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -1002,7 +1019,7 @@ WSError SessionStageProxy::UpdateWindowMode(const WindowModeInfo& windowModeInfo
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_MODE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_MODE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1025,7 +1042,7 @@ WSError SessionStageProxy::GetTopNavDestinationName(std::string& topNavDestName)
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "stage remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_TOP_NAV_DEST_NAME), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send stage request failed, errCode: %{public}d", reqErrCode);
@@ -1068,7 +1085,7 @@ WSError SessionStageProxy::NotifyLayoutFinishAfterWindowModeChange(WindowMode mo
     }
     uint32_t messageCode =
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_LAYOUT_FINISH_AFTER_WINDOW_MODE_CHANGE);
-    if (remote->SendRequest(messageCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, messageCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -1098,7 +1115,7 @@ WSError SessionStageProxy::NotifySubWindowAfterParentWindowSizeChange(Rect rect)
     }
     uint32_t messageCode =
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SUB_WINDOW_AFTER_PARENT_WINDOW_SIZE_CHANGE);
-    if (remote->SendRequest(messageCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, messageCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -1136,7 +1153,7 @@ WSError SessionStageProxy::NotifySubWindowAfterParentWindowStatusChange(WindowMo
     }
     uint32_t messageCode =
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SUB_WINDOW_AFTER_PARENT_WINDOW_STATUS_CHANGE);
-    if (remote->SendRequest(messageCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, messageCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -1166,7 +1183,7 @@ WMError SessionStageProxy::UpdateWindowModeForUITest(int32_t updateMode)
     }
     uint32_t requestCode =
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_WINDOW_MODE_FOR_UI_TEST);
-    if (remote->SendRequest(requestCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, requestCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -1193,7 +1210,7 @@ void SessionStageProxy::NotifyForegroundInteractiveStatus(bool interactive)
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_FOREGROUND_INTERACTIVE_STATUS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -1220,7 +1237,7 @@ void SessionStageProxy::NotifyAppUseControlStatus(bool isUseControl)
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return;
     }
-    int sendResult = remote->SendRequest(
+    int sendResult = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_USE_CONTROL_STATUS),
         data, reply, option);
     if (sendResult != ERR_NONE) {
@@ -1243,7 +1260,7 @@ void SessionStageProxy::NotifyLifecyclePausedStatus()
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return;
     }
-    int sendResult = remote->SendRequest(
+    int sendResult = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PAUSED_STATUS),
         data, reply, option);
     if (sendResult != ERR_NONE) {
@@ -1271,7 +1288,7 @@ WSError SessionStageProxy::UpdateMaximizeMode(MaximizeMode mode)
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_MAXIMIZE_MODE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_MAXIMIZE_MODE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1303,7 +1320,7 @@ void  SessionStageProxy::NotifySessionForeground(uint32_t reason, bool withAnima
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SESSION_FOREGROUND),
         data, reply, option) != ERR_NONE) {
         WLOGFE("Send NotifySessionForeground Request failed");
@@ -1328,7 +1345,7 @@ void SessionStageProxy::NotifySessionFullScreen(bool fullScreen)
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "Write fullScreen failed");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SESSION_FULLSCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "Send Request failed");
@@ -1362,7 +1379,7 @@ void SessionStageProxy::NotifySessionBackground(uint32_t reason, bool withAnimat
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SESSION_BACKGROUND),
         data, reply, option) != ERR_NONE) {
         WLOGFE("Send NotifySessionBackground Request failed");
@@ -1395,7 +1412,7 @@ WSError SessionStageProxy::UpdateTitleInTargetPos(bool isShow, int32_t height)
         TLOGE(WmsLogTag::WMS_DECOR, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TITLE_POSITION_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TITLE_POSITION_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_DECOR, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1424,7 +1441,7 @@ void SessionStageProxy::NotifyTransformChange(const Transform& transform)
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TRANSFORM_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_TRANSFORM_CHANGE),
                             data, reply, option) != ERR_NONE) {
         WLOGFE("Send NotifyTransformChange Requset failed");
     }
@@ -1450,7 +1467,7 @@ void SessionStageProxy::NotifySingleHandTransformChange(const SingleHandTransfor
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SINGLE_HAND_TRANSFORM),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_SINGLE_HAND_TRANSFORM),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Send Requset failed");
     }
@@ -1477,7 +1494,7 @@ void SessionStageProxy::NotifyGlobalScaledRectChange(const Rect& globalScaledRec
         return;
     }
     auto requestCode = static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_GLOBAL_SCALED_RECT);
-    if (remote->SendRequest(requestCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, requestCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
     }
 }
@@ -1507,7 +1524,7 @@ WSError SessionStageProxy::NotifyDensityFollowHost(bool isFollowHost, float dens
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DENSITY_FOLLOW_HOST), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -1537,7 +1554,7 @@ WSError SessionStageProxy::NotifyDialogStateChange(bool isForeground)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DIALOG_STATE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DIALOG_STATE_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1570,7 +1587,7 @@ WSError SessionStageProxy::SetPipActionEvent(const std::string& action, int32_t
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_PIP_ACTION_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_PIP_ACTION_EVENT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1603,7 +1620,7 @@ WSError SessionStageProxy::SendFbActionEvent(const std::string& action, const st
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_FB_ACTION_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_FB_ACTION_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1636,7 +1653,7 @@ WSError SessionStageProxy::SendFvActionEvent(const std::string& action, const st
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_FV_ACTION_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_FV_ACTION_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1669,7 +1686,7 @@ WSError SessionStageProxy::SyncFvWindowInfo(const FloatViewWindowInfo& windowInf
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SYNC_FV_WINDOW_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SYNC_FV_WINDOW_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1707,7 +1724,7 @@ WSError SessionStageProxy::SyncFvLimits(const std::map<uint32_t, FloatViewLimits
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SYNC_FV_LIMITS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SYNC_FV_LIMITS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1746,7 +1763,7 @@ WSError SessionStageProxy::NotifyPipWindowSizeChange(double width, double height
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PIPSIZE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PIPSIZE_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1775,7 +1792,7 @@ WSError SessionStageProxy::NotifyPiPActiveStatusChange(bool status)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_ACTIVE_STATUS_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_ACTIVE_STATUS_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1809,7 +1826,7 @@ WSError SessionStageProxy::SetPiPControlEvent(WsPiPControlType controlType, WsPi
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_PIP_CONTROL_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_PIP_CONTROL_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1842,7 +1859,7 @@ void SessionStageProxy::NotifyDisplayMove(DisplayId from, DisplayId to)
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DISPLAY_MOVE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DISPLAY_MOVE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest notify display move failed");
         return;
@@ -1869,7 +1886,7 @@ void SessionStageProxy::NotifyKeyboardPanelInfoChange(const KeyboardPanelInfo& k
         TLOGE(WmsLogTag::WMS_KEYBOARD, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_KEYBOARD_INFO_CHANGE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -1894,7 +1911,7 @@ WSError SessionStageProxy::PcAppInPadNormalClose()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_PCAPPINPADNORMAL_CLOSE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
@@ -1921,7 +1938,7 @@ WSError SessionStageProxy::NotifyCompatibleModePropertyChange(const sptr<Compati
         TLOGE(WmsLogTag::DEFAULT, "Write enable failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_COMPATIBLE_MODE_PROPERTY_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SCB, "SendRequest failed");
@@ -1954,7 +1971,7 @@ void SessionStageProxy::SetUniqueVirtualPixelRatio(bool useUniqueDensity, float
         return;
     }
  
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DENSITY_UNIQUE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DENSITY_UNIQUE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return;
@@ -1981,7 +1998,7 @@ void SessionStageProxy::UpdateAnimationSpeed(float speed)
         return;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_ANIMATION_SPEED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_ANIMATION_SPEED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return;
@@ -2006,7 +2023,7 @@ WSError SessionStageProxy::NotifyDumpInfo(const std::vector<std::string>& params
         TLOGE(WmsLogTag::WMS_UIEXT, "Write params failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DUMP_INFO),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_DUMP_INFO),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2048,7 +2065,7 @@ WSError SessionStageProxy::SetUIExtensionTransparent()
         TLOGE(WmsLogTag::WMS_UIEXT, "WriteInterfaceToken failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_UIEXTENSION_TRANSPARENT), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2065,8 +2082,9 @@ WSError SessionStageProxy::SendExtensionData(MessageParcel& data, MessageParcel&
         return WSError::WS_ERROR_NULLPTR;
     }
 
-    auto ret = remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_EXTENSION_DATA), data,
-                                   reply, option);
+    auto ret = SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_EXTENSION_DATA),
+        data, reply, option);
     if (ret != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, ret: %{public}d", ret);
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2088,7 +2106,7 @@ WSError SessionStageProxy::LinkKeyFrameNode()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_LINK_KEYFRAME_NODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_LINK_KEYFRAME_NODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2114,7 +2132,7 @@ WSError SessionStageProxy::SetStageKeyFramePolicy(const KeyFramePolicy& keyFrame
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_STAGE_KEYFRAME_POLICY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_STAGE_KEYFRAME_POLICY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2140,7 +2158,7 @@ WSError SessionStageProxy::SetDragActivated(uint32_t dragActivatedBitmap)
         TLOGE(WmsLogTag::WMS_LAYOUT, "Remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_DRAG_ACTIVATED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_DRAG_ACTIVATED),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2166,7 +2184,7 @@ WSError SessionStageProxy::SetSplitButtonVisible(bool isVisible)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_SPLIT_BUTTON_VISIBLE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_SPLIT_BUTTON_VISIBLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2192,7 +2210,7 @@ WSError SessionStageProxy::SetEnableDragBySystem(bool dragEnable)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_ENABLE_DRAG_BY_SYSTEM),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_ENABLE_DRAG_BY_SYSTEM),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2218,7 +2236,7 @@ WSError SessionStageProxy::SetFullScreenWaterfallMode(bool isWaterfallMode)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_FULLSCREEN_WATERFALL_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_FULLSCREEN_WATERFALL_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2244,7 +2262,7 @@ WSError SessionStageProxy::SetSupportEnterWaterfallMode(bool isSupportEnter)
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SessionStageInterfaceCode::TRANS_ID_SET_SUPPORT_ENTER_WATERFALL_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
@@ -2275,7 +2293,7 @@ WSError SessionStageProxy::SendContainerModalEvent(const std::string& eventName,
         TLOGE(WmsLogTag::WMS_EVENT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_CONTAINER_MODAL_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SEND_CONTAINER_MODAL_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2314,7 +2332,7 @@ WSError SessionStageProxy::NotifyHighlightChange(const sptr<HighlightNotifyInfo>
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_HIGHLIGHT_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_HIGHLIGHT_CHANGE),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2340,7 +2358,7 @@ void SessionStageProxy::NotifyWindowCrossAxisChange(CrossAxisState state)
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_CROSS_AXIS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_CROSS_AXIS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return;
@@ -2365,7 +2383,7 @@ WSError SessionStageProxy::NotifyWindowAttachStateChange(bool isAttach)
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_ATTACH_STATE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
@@ -2394,7 +2412,7 @@ void SessionStageProxy::NotifyKeyboardAnimationCompleted(const KeyboardPanelInfo
         TLOGE(WmsLogTag::WMS_KEYBOARD, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_KEYBOARD_ANIMATION_COMPLETED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2424,7 +2442,7 @@ WSError SessionStageProxy::SetCurrentRotation(int32_t currentRotation)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_CURRENT_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2447,7 +2465,7 @@ WSError SessionStageProxy::GetSceneNodeCount(uint32_t& nodeCount)
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_SCREEN_NODE_COUNT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2478,7 +2496,7 @@ WSError SessionStageProxy::GetSceneNodeCount(const sptr<IRemoteObject>& callback
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_SCENE_NODE_COUNT_WITH_CALLBACK),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2509,7 +2527,7 @@ WSError SessionStageProxy::NotifyOrientationExecutionResult(uint32_t promiseId,
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_ORIENTATION_EXECUTION_RESULT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2587,7 +2605,7 @@ WSError SessionStageProxy::NotifyTargetRotationInfo(OrientationInfo& info, Orien
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_ROTATION_PROPERTY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2610,7 +2628,8 @@ WSError SessionStageProxy::NotifyPageRotationIsIgnored()
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PAGE_ROTATION_ISIGNORED),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PAGE_ROTATION_ISIGNORED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2652,7 +2671,7 @@ RotationChangeResult SessionStageProxy::NotifyRotationChange(const RotationChang
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return rotationChangeResult;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_ROTATION_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -2715,7 +2734,7 @@ WSError SessionStageProxy::UpdateAttachedWindowLimits(int32_t sourcePersistentId
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_ATTACHED_WINDOW_LIMITS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_ATTACHED_WINDOW_LIMITS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2743,7 +2762,7 @@ WSError SessionStageProxy::RemoveAttachedWindowLimits(int32_t sourcePersistentId
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_REMOVE_ATTACHED_WINDOW_LIMITS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_REMOVE_ATTACHED_WINDOW_LIMITS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2791,7 +2810,7 @@ WSError SessionStageProxy::SyncAllAttachedLimitsToChild(
         return WSError::WS_ERROR_IPC_FAILED;
     }
     auto code = SessionStageInterfaceCode::TRANS_ID_SYNC_ALL_ATTACHED_LIMITS_TO_CHILD;
-    if (remote->SendRequest(static_cast<uint32_t>(code), data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, static_cast<uint32_t>(code), data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -2817,7 +2836,7 @@ WSError SessionStageProxy::NotifyRebindAttachAfterParentChange(int32_t newParent
         return WSError::WS_ERROR_IPC_FAILED;
     }
     auto code = SessionStageInterfaceCode::TRANS_ID_NOTIFY_REBIND_ATTACH_AFTER_PARENT_CHANGE;
-    if (remote->SendRequest(static_cast<uint32_t>(code), data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, static_cast<uint32_t>(code), data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
@@ -2840,7 +2859,7 @@ WSError SessionStageProxy::NotifyAppForceLandscapeConfigUpdated()
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_APP_FORCE_LANDSCAPE_CONFIG_UPDATED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SCB, "SendRequest failed");
@@ -2867,7 +2886,7 @@ WSError SessionStageProxy::UpdateAppHookWindowInfo(const HookWindowInfo& hookWin
         TLOGE(WmsLogTag::WMS_COMPAT, "write hookWindowInfo failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_APP_HOOK_WINDOW_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
@@ -2903,7 +2922,7 @@ WSError SessionStageProxy::SetForceSplitEnable(bool isForceSplitEnabled, bool ne
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_FORCE_SPLIT_ENABLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
@@ -2935,7 +2954,7 @@ void SessionStageProxy::NotifyKeyboardAnimationWillBegin(const KeyboardAnimation
         TLOGE(WmsLogTag::WMS_KEYBOARD, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_KEYBOARD_ANIMATION_WILLBEGIN),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2957,7 +2976,7 @@ WMError SessionStageProxy::GetRouterStackInfo(std::string& routerStackInfo)
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_ROUTER_STACK_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_GET_ROUTER_STACK_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -2985,7 +3004,7 @@ WSError SessionStageProxy::CloseSpecificScene()
         TLOGE(WmsLogTag::WMS_EVENT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_CLOSE_SPECIFIC_SCENE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_CLOSE_SPECIFIC_SCENE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3013,7 +3032,7 @@ WSError SessionStageProxy::UpdateIsShowDecorInFreeMultiWindow(bool isShow)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_UPDATE_SHOW_DECOR_IN_FREE_MULTI_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_DECOR, "SendRequest failed");
@@ -3045,7 +3064,7 @@ WSError SessionStageProxy::UpdateBrightness(float brightness)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_BRIGHTNESS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_BRIGHTNESS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3068,7 +3087,7 @@ WSError SessionStageProxy::AddSidebarBlur()
         TLOGE(WmsLogTag::WMS_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_ADD_SIDEBAR_BLUR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_ADD_SIDEBAR_BLUR),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3094,7 +3113,7 @@ WSError SessionStageProxy::SetSidebarBlurStyleWithType(SidebarBlurType type)
         TLOGE(WmsLogTag::WMS_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_SIDEBAR_BLUR_STYLE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_SIDEBAR_BLUR_STYLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3120,7 +3139,7 @@ WSError SessionStageProxy::UpdateWindowUIType(WindowUIType windowUIType)
         TLOGE(WmsLogTag::WMS_RECOVER, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_UI_TYPE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_WINDOW_UI_TYPE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_RECOVER, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3146,7 +3165,7 @@ WSError SessionStageProxy::UpdatePropertyWhenTriggerMode(const sptr<WindowSessio
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_PROPERTY_WHEN_TRIGGER_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -3173,7 +3192,7 @@ WSError SessionStageProxy::NotifyParentLifecycleEvent(ParentLifeCycleEvent event
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PARENT_LIFECYCLE_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_NOTIFY_PARENT_LIFECYCLE_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3195,7 +3214,7 @@ WSError SessionStageProxy::HideSubWindowZLevelAboveParentLoosened()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_HIDE_SUBWINDOW_ZLEVEL_ABOVE_PARENT_LOOSENED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
@@ -3218,7 +3237,7 @@ WSError SessionStageProxy::ShowSubWindowZLevelAboveParentLoosened()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SHOW_SUBWINDOW_ZLEVEL_ABOVE_PARENT_LOOSENED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
@@ -3241,7 +3260,7 @@ WSError SessionStageProxy::DestroySubWindowZLevelAboveParentLoosened()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_DESTROY_SUBWINDOW_ZLEVEL_ABOVE_PARENT_LOOSENED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
@@ -3268,7 +3287,7 @@ WSError SessionStageProxy::SetIsStartMoving(bool isStartMoving)
     }
     MessageParcel reply;
     MessageOption option(MessageOption::TF_ASYNC);
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_IS_START_MOVING), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Failed to send request, error = %{public}d", sendRet);
@@ -3298,7 +3317,7 @@ WSError SessionStageProxy::UpdateLSState(bool isLSState)
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_LS_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_LS_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
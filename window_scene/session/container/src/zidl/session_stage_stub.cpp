@@ -21,6 +21,9 @@
 
 #include "window_manager_hilog.h"
 #include "wm_common.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
 
 namespace OHOS::Rosen {
 namespace {
@@ -99,6 +102,9 @@ int SessionStageStub::OnRemoteRequest(uint32_t code, MessageParcel& data, Messag
         WLOGFE("Failed to check interface token!");
         return ERR_TRANSACTION_FAILED;
     }
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadScope payloadScope(IpcSide::STUB, "SessionStage", code, data, reply);
+#endif
 
     switch (code) {
         case static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_SET_ACTIVE):
@@ -598,7 +604,15 @@ int SessionStageStub::HandleUpdateAvoidArea(MessageParcel& data, MessageParcel&
         type >= static_cast<uint32_t>(AvoidAreaType::TYPE_END)) {
         return ERR_INVALID_VALUE;
     }
-    UpdateAvoidArea(avoidArea, static_cast<AvoidAreaType>(type));
+    int32_t posX = 0;
+    int32_t posY = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    if (!data.ReadInt32(posX) || !data.ReadInt32(posY) || !data.ReadUint32(width) || !data.ReadUint32(height)) {
+        TLOGE(WmsLogTag::WMS_IMMS, "read rect failed");
+        return ERR_INVALID_VALUE;
+    }
+    UpdateAvoidArea(avoidArea, static_cast<AvoidAreaType>(type), { posX, posY, width, height });
     return ERR_NONE;
 }
 
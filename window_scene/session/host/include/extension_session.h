@@ -98,7 +98,8 @@ public:
         int32_t apiVersion = API_VERSION_INVALID) override;
     int32_t GetStatusBarHeight() override;
 
-    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) override;
     WSError TransferAbilityResult(uint32_t resultCode, const AAFwk::Want& want) override;
     int32_t TransferExtensionData(const AAFwk::WantParams& wantParams) override;
     WSError TransferComponentData(const AAFwk::WantParams& wantParams);
@@ -53,7 +53,8 @@ public:
         int32_t apiVersion = API_VERSION_INVALID) override;
     AvoidArea GetAvoidAreaByTypeIgnoringVisibility(AvoidAreaType type,
         const WSRect& rect = WSRect::EMPTY_RECT) override;
-    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) override;
 
 private:
     LoadContentFunc loadContentFunc_;
@@ -20,6 +20,7 @@
 #include "preferences.h"
 #include "preferences_helper.h"
 
+#include "persistent_storage_write_behind.h"
 #include "window_manager_hilog.h"
 
 namespace OHOS {
@@ -64,7 +65,7 @@ public:
             default:
                 WLOGW("[ScenePersistentStorage] Unknown storage type!");
         }
-        pref->Flush();
+        PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], key);
     }
 
     template <typename T>
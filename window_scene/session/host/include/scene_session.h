@@ -200,6 +200,22 @@ struct FullInfoForMMI {
     std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
 };
 
+/**
+ * @brief Session state published at the end of FlushUIParams, never modified after being published.
+ */
+struct SessionQueryState {
+    WSRect rect_;
+    WindowMode mode_ = WindowMode::WINDOW_MODE_UNDEFINED;
+    bool isVisible_ = false;
+    uint32_t zOrder_ = 0;
+    DisplayId displayId_ = DISPLAY_ID_INVALID;
+    // only collected for visible sessions, avoidAreas_ is the result of GetAllAvoidAreas
+    bool hasAvoidAreas_ = false;
+    WSError avoidAreasRet_ = WSError::WS_OK;
+    std::map<AvoidAreaType, AvoidArea> avoidAreas_;
+};
+using SessionQueryStatePtr = std::shared_ptr<const SessionQueryState>;
+
 class SceneSession : public Session {
 public:
     friend class HidumpController;
@@ -383,6 +399,30 @@ public:
     WSError UpdateWindowAnimationFlag(bool needDefaultAnimationFlag) override;
     void SetZOrder(uint32_t zOrder) override;
     std::vector<Rect> GetTouchHotAreas() const override;
+    HotAreaBufferPtr GetTouchHotAreaBuffer() const;
+
+    /**
+     * @brief Hot areas converted for MMI from the hot area buffer of the version, shared until it changes.
+     *
+     * @return The cached hot areas, or nullptr if they were converted from another version.
+     */
+    std::shared_ptr<const std::vector<MMI::Rect>> GetMMIHotAreasCache(uint64_t version) const;
+    void SetMMIHotAreasCache(uint64_t version, const std::shared_ptr<const std::vector<MMI::Rect>>& hotAreas);
+
+    /*
+     * Query State
+     */
+    /**
+     * @brief Publish the live state, the avoid areas are recomputed unless given.
+     */
+    void PublishQueryState(const std::map<AvoidAreaType, AvoidArea>* avoidAreas = nullptr);
+    SessionQueryStatePtr GetQueryState() const;
+    /**
+     * @brief Whether the published state may differ from the live one, by the dirty flags, the published
+     *        fields or an avoid area update of the session.
+     */
+    bool IsQueryStateOutdated() const;
+    void MarkQueryStateOutdated() { isQueryStateOutdated_ = true; }
     void NotifyUILostFocus() override;
     void SetScale(float scaleX, float scaleY, float pivotX, float pivotY) override;
     void SetFloatingScale(float floatingScale) override;
@@ -617,7 +657,8 @@ public:
     WSError SetIsStatusBarVisibleInner(bool isVisible);
     WMError SetFloatNavigationEnabled(bool isEnabled) override;
     WSError HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidArea = AvoidAreaType::TYPE_END);
-    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) override;
     void UpdateRotationAvoidArea();
     bool CheckGetAvoidAreaAvailable(AvoidAreaType type) override;
     bool CheckGetSubWindowAvoidAreaAvailable(WindowMode winMode, AvoidAreaType type);
@@ -1396,6 +1437,7 @@ private:
     void PatchAINavigationBarArea(AvoidArea& avoidArea);
     AvoidArea GetAvoidAreaByTypeInner(AvoidAreaType type,
         const WSRect& rect = WSRect::EMPTY_RECT, bool ignoreVisibility = false);
+    WSError GetAllAvoidAreasInner(std::map<AvoidAreaType, AvoidArea>& avoidAreas);
     WSError GetAvoidAreasByRotation(Rotation rotation, const WSRect& rect,
         const std::map<WindowType, SystemBarProperty>& properties, std::map<AvoidAreaType, AvoidArea>& avoidAreas);
     void GetSystemBarAvoidAreaByRotation(Rotation rotation, AvoidAreaType type, const WSRect& rect,
@@ -1668,6 +1710,21 @@ private:
      */
     void PerformMoveResampleAt(int64_t sampleTimeUs, bool shouldRequestNextVsync = true);
 
+    /*
+     * Event Dispatch
+     */
+    mutable std::mutex mmiHotAreasCacheMutex_;
+    uint64_t mmiHotAreasCacheVersion_ = 0;
+    std::shared_ptr<const std::vector<MMI::Rect>> mmiHotAreasCache_;
+
+    /*
+     * Query State
+     */
+    bool CanReadQueryState() const;
+    mutable std::mutex queryStateMutex_;
+    SessionQueryStatePtr queryState_;
+    std::atomic_bool isQueryStateOutdated_ { false };
+
     /*
      * Window Decor
      */
@@ -106,12 +106,14 @@ using NotifySystemSessionPointerEventFunc = std::function<void(std::shared_ptr<M
 using NotifySessionInfoChangeNotifyManagerFunc = std::function<void(int32_t persistentid)>;
 using NotifySessionPropertyChangeNotifyManagerFunc =
     std::function<void(int32_t persistentid, WindowInfoKey windowInfoKey)>;
+using NotifyPropertyDirtyFunc = std::function<void(int32_t persistentId)>;
 using NotifySystemSessionKeyEventFunc = std::function<bool(std::shared_ptr<MMI::KeyEvent> keyEvent,
     bool isPreImeEvent)>;
 using NotifyContextTransparentFunc = std::function<void()>;
 using NotifyFrameLayoutFinishFunc = std::function<void()>;
 using NotifyClientDisplayIdChangeFunc = std::function<void(uint32_t windowId)>;
 using VisibilityChangedDetectFunc = std::function<void(int32_t pid, bool isVisible, bool newIsVisible)>;
+using NotifyScreenIdChangeFunc = std::function<void(int32_t persistentId, uint64_t screenId)>;
 using AcquireRotateAnimationConfigFunc = std::function<void(RotateAnimationConfig& config)>;
 using RequestVsyncFunc = std::function<void(const std::shared_ptr<VsyncCallback>& callback)>;
 using NotifyWindowMovingFunc = std::function<void(DisplayId displayId, int32_t pointerX, int32_t pointerY)>;
@@ -329,7 +331,8 @@ public:
         bool isPreImeEvent = false);
     WSError TransferFocusActiveEvent(bool isFocusActive);
     WSError TransferFocusStateEvent(bool focusState);
-    virtual WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) { return WSError::WS_OK; }
+    virtual WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) { return WSError::WS_OK; }
 
     int32_t GetPersistentId() const;
     int32_t GetCurrentRotation() const;
@@ -480,6 +483,7 @@ public:
     DisplayId GetScreenId() const;
     virtual void SetScreenId(uint64_t screenId);
     void SetScreenIdOnServer(uint64_t screenId);
+    void SetScreenIdChangeFunc(NotifyScreenIdChangeFunc&& func);
     WindowType GetWindowType() const;
     float GetAspectRatio() const;
     WSError SetAspectRatio(float ratio) override;
@@ -737,6 +741,11 @@ public:
     float GetIgnoreRotateScaleY() const;
     float GetPivotX() const;
     float GetPivotY() const;
+
+    /**
+     * @brief Bumped when the scale, pivot or current rotation changes, the input transform is recomputed on it.
+     */
+    uint64_t GetTransformVersion() const { return transformVersion_.load(); }
     void SetSCBKeepKeyboard(bool scbKeepKeyboardFlag);
     bool GetSCBKeepKeyboardFlag() const;
 
@@ -935,8 +944,13 @@ public:
     WindowMetaInfo GetWindowMetaInfoForWindowInfo() const;
     void SetClientDisplayIdChangeListener(const NotifyClientDisplayIdChangeFunc& func);
     uint32_t GetPropertyDirtyFlags() const { return propertyDirtyFlags_; };
-    void SetPropertyDirtyFlags(uint32_t dirtyFlags) { propertyDirtyFlags_ = dirtyFlags; }
-    void AddPropertyDirtyFlags(uint32_t dirtyFlags) { propertyDirtyFlags_ |= dirtyFlags; }
+    void SetPropertyDirtyFlags(uint32_t dirtyFlags);
+    void AddPropertyDirtyFlags(uint32_t dirtyFlags);
+
+    /**
+     * @brief Called when flags not dirty yet are added, so the manager only visits dirty sessions.
+     */
+    void SetPropertyDirtyListener(const NotifyPropertyDirtyFunc& func);
     WSError NotifyScreenshotAppEvent(ScreenshotEventType type);
     WSError UpdateBrightness(float brightness);
     void SetSurfaceNodeAlpha(float alpha) { property_->SetSurfaceNodeAlpha(alpha); }
@@ -1103,6 +1117,7 @@ protected:
     std::atomic_bool isExitSplitOnBackground_ = false;
     std::atomic_bool isVisible_ = false;
     int32_t currentRotation_ = 0;
+    std::atomic<uint64_t> transformVersion_ { 0 };
     std::string label_;
 
     NotifyChangeSessionVisibilityWithStatusBarFunc changeSessionVisibilityWithStatusBarFunc_;
@@ -1147,6 +1162,7 @@ protected:
     NotifySessionExceptionFunc sessionExceptionFunc_;
     NotifySessionExceptionFunc jsSceneSessionExceptionFunc_;
     VisibilityChangedDetectFunc visibilityChangedDetectFunc_ GUARDED_BY(SCENE_GUARD);
+    NotifyScreenIdChangeFunc screenIdChangeFunc_;
     NofitySessionLabelAndIconUpdatedFunc updateSessionLabelAndIconFunc_;
     NotifySessionGetTargetOrientationConfigInfoFunc sessionGetTargetOrientationConfigInfoFunc_;
     NotifyClearSubSessionFunc clearSubSessionFunc_;
@@ -1275,6 +1291,7 @@ protected:
      * Window Property
      */
     uint32_t propertyDirtyFlags_ = 0;
+    NotifyPropertyDirtyFunc propertyDirtyFunc_;
     void SetSurfaceNodeAlphaChangedCallback(const std::shared_ptr<RSSurfaceNode>& surfaceNode);
 
     template<typename T1, typename T2, typename Ret>
@@ -1366,7 +1383,7 @@ private:
     int32_t appIndex_ = { 0 };
     std::string callingBundleName_ { "unknown" };
     std::string sceneLastUsedPosition_;
-    bool isRSVisible_ {false};
+    std::atomic<bool> isRSVisible_ { false };
     WindowVisibilityState visibilityState_ { WINDOW_LAYER_STATE_MAX};
     bool needNotify_ {true};
     bool isRSDrawing_ {false};
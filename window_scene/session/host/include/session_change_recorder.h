@@ -16,11 +16,16 @@
 #ifndef OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
 #define OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "window_manager_hilog.h"
 #include "wm_single_instance.h"
@@ -40,6 +45,66 @@ enum class RecordType : uint32_t {
     RECORD_TYPE_END,
 };
 
+/**
+ * @brief Interned format of binary record, the args are formatted at dump time
+ */
+enum class RecordFormatId : uint16_t {
+    VISIBILITY_CHANGE = 0,
+    ORIENTATION_CHANGE,
+    PRIVACY_MODE_CHANGE,
+    SESSION_STATE_CHANGE,
+    FORMAT_ID_END,
+};
+
+constexpr uint32_t SESSION_CHANGE_RECORD_ARG_NUM = 2;
+
+/**
+ * @brief Fixed-size binary record of scene session change
+ */
+struct SessionChangeRecord {
+    int64_t timestampNs_ = 0; // steady clock
+    RecordType recordType_ = RecordType::RECORD_TYPE_BEGIN;
+    int32_t persistentId_ = INVALID_SESSION_ID;
+    RecordFormatId formatId_ = RecordFormatId::FORMAT_ID_END;
+    WmsLogTag logTag_ = WmsLogTag::DEFAULT;
+    int64_t args_[SESSION_CHANGE_RECORD_ARG_NUM] = { 0 };
+};
+
+/**
+ * @brief Ring buffer written only by its owner thread, readers never block the writer.
+ */
+class SessionChangeRingBuffer {
+public:
+    static constexpr uint32_t CAPACITY = 256;
+
+    void Push(const SessionChangeRecord& record);
+
+    /**
+     * @brief Copy records written since fromIndex, records overwritten meanwhile are skipped.
+     *
+     * @param fromIndex The write index to read from.
+     * @param records The read records in write order.
+     * @return The write index when read.
+     */
+    uint64_t ReadFrom(uint64_t fromIndex, std::vector<SessionChangeRecord>& records) const;
+
+    /**
+     * @brief Mark the owner thread exited, the buffer can be dropped once its records are logged.
+     */
+    void SetReleased() { released_.store(true, std::memory_order_release); }
+    bool IsReleased() const { return released_.load(std::memory_order_acquire); }
+    uint64_t GetWriteIndex() const { return writeIndex_.load(std::memory_order_acquire); }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq_ { 0 };
+        SessionChangeRecord record_;
+    };
+    std::array<Slot, CAPACITY> slots_;
+    std::atomic<uint64_t> writeIndex_ { 0 };
+    std::atomic<bool> released_ { false };
+};
+
 /**
  * @brief Scene session change info
  */
@@ -61,6 +126,19 @@ public:
      */
     WSError RecordSceneSessionChange(RecordType recordType, SceneSessionChangeInfo& changeInfo);
 
+    /**
+     * @brief Record scene session change as binary record without lock and string formatting.
+     *
+     * @param recordType The type of record info.
+     * @param persistentId The id of changed session.
+     * @param logTag The log tag of change.
+     * @param formatId The interned format of change info.
+     * @param arg0 The first arg of format.
+     * @param arg1 The second arg of format.
+     */
+    WSError RecordSceneSessionChange(RecordType recordType, int32_t persistentId, WmsLogTag logTag,
+        RecordFormatId formatId, int64_t arg0 = 0, int64_t arg1 = 0);
+
     /**
      * @brief Set record size
      *
@@ -71,6 +149,7 @@ public:
     WSError SetRecordSize(RecordType recordType, uint32_t recordSize);
 
     void Init();
+    uint64_t GetDroppedRecordNum() const { return droppedRecordNum_.load(std::memory_order_relaxed); }
     void GetSceneSessionNeedDumpInfo(const std::vector<std::string>& dumpParams, std::string& dumpInfo);
     std::atomic<bool> stopLogFlag_ { false };
     std::atomic<bool> isInitFlag_ { false };
@@ -85,6 +164,17 @@ private:
     std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>>& dumpMap);
     void SimplifyDumpInfo(std::string& dumpInfo, std::string preCompressInfo);
     int CompressString(const char* in_str, size_t in_len, std::string& out_str, int level);
+    std::shared_ptr<SessionChangeRingBuffer> GetThreadRingBuffer();
+    void PruneReleasedRingBuffersLocked();
+    void CollectBinaryRecords(std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>>& dumpMap);
+    void PrintBinaryLog();
+    void LogBinaryRecords(const std::vector<SessionChangeRecord>& records);
+    SceneSessionChangeInfo ConvertToChangeInfo(const SessionChangeRecord& record);
+
+    struct RingBufferEntry {
+        std::shared_ptr<SessionChangeRingBuffer> ringBuffer_;
+        uint64_t logReadIndex_ = 0;
+    };
 
     std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedLogMap_;
     std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>> sceneSessionChangeNeedDumpMap_;
@@ -92,6 +182,9 @@ private:
     std::mutex sessionChangeRecorderMutex_;
     uint32_t currentLogSize_ = 0;
     std::thread mThread;
+    std::vector<RingBufferEntry> ringBuffers_;
+    std::mutex ringBufferMutex_;
+    std::atomic<uint64_t> droppedRecordNum_ { 0 };
 };
 } // namespace OHOS::Rosen
 #endif // OHOS_ROSEN_SESSION_CHANGE_RECORDER_H
\ No newline at end of file
@@ -498,12 +498,12 @@ WSError ExtensionSession::TransferAccessibilityDumpChildInfo(
     return windowEventChannel_->TransferAccessibilityDumpChildInfo(params, info);
 }
 
-WSError ExtensionSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
+WSError ExtensionSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type, const WSRect& rect)
 {
     if (!IsSessionValid()) {
         return WSError::WS_ERROR_INVALID_SESSION;
     }
-    return sessionStage_->UpdateAvoidArea(avoidArea, type);
+    return sessionStage_->UpdateAvoidArea(avoidArea, type, rect);
 }
 
 AvoidArea ExtensionSession::GetAvoidAreaByType(AvoidAreaType type, const WSRect& rect, int32_t apiVersion)
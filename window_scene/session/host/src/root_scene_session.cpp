@@ -231,7 +231,7 @@ void RootSceneSession::SetRootSessionRect(const WSRect& rect)
     }
 }
 
-WSError RootSceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
+WSError RootSceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type, const WSRect& rect)
 {
     if (specificCallback_ == nullptr || specificCallback_->onNotifyAvoidAreaChange_ == nullptr) {
         TLOGE(WmsLogTag::WMS_IMMS, "callback is nullptr");
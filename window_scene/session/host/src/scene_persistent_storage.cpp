@@ -48,7 +48,7 @@ void ScenePersistentStorage::Delete(const std::string& key, ScenePersistentStora
         return;
     }
     pref->Delete(key);
-    pref->Flush();
+    PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], key);
     WLOGD("[ScenePersistentStorage] Delete key %{public}s", key.c_str());
 }
 
@@ -58,11 +58,7 @@ std::shared_ptr<PersistentPerference> ScenePersistentStorage::GetPreference(Scen
     if (iter == storagePath_.end()) {
         return nullptr;
     }
-    auto fileName = storagePath_[storageType];
-    int errCode;
-    auto pref = NativePreferences::PreferencesHelper::GetPreferences(fileName, errCode);
-    WLOGD("[ScenePersistentStorage] GetPreference file: %{public}s, errCode: %{public}d", fileName.c_str(), errCode);
-    return pref;
+    return PersistentStorageWriteBehind::GetInstance().GetPreference(iter->second);
 }
 
 void ScenePersistentStorage::InitDir(std::string dir)
@@ -105,6 +101,7 @@ void ScenePersistentStorage::RenameKeys(const std::map<std::string, std::string>
                 auto floatValue = pref->GetFloat(oldKey);
                 pref->PutFloat(newKey, floatValue);
                 pref->Delete(oldKey);
+                PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], newKey);
                 TLOGD(WmsLogTag::DEFAULT, "[ScenePersistentStorage] Rename OldKey: %{public}s to newKey: %{public}s",
                     oldKey.c_str(), newKey.c_str());
                 break;
@@ -113,6 +110,7 @@ void ScenePersistentStorage::RenameKeys(const std::map<std::string, std::string>
                 auto intValue = pref->GetInt(oldKey);
                 pref->PutInt(newKey, intValue);
                 pref->Delete(oldKey);
+                PersistentStorageWriteBehind::GetInstance().MarkDirty(storagePath_[storageType], newKey);
                 TLOGD(WmsLogTag::DEFAULT, "[ScenePersistentStorage] Rename OldKey: %{public}s to newKey: %{public}s",
                     oldKey.c_str(), newKey.c_str());
                 break;
@@ -121,7 +119,6 @@ void ScenePersistentStorage::RenameKeys(const std::map<std::string, std::string>
                 TLOGW(WmsLogTag::DEFAULT, "[ScenePersistentStorage] Unknown storage type");
         }
     }
-    pref->Flush();
 }
 } // namespace Rosen
 } // namespace OHOS
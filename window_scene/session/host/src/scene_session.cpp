@@ -64,6 +64,7 @@
 #include "window_display_isolation_policy.h"
 #include "window_helper.h"
 #include "window_manager_hilog.h"
+#include "window_mask_cache.h"
 #include "wm_math.h"
 #include <running_lock.h>
 #include "screen_manager.h"
@@ -2080,11 +2081,12 @@ WSError SceneSession::NotifyClientToUpdateRectTask(const std::string& updateReas
     }
 
     std::map<AvoidAreaType, AvoidArea> avoidAreas;
+    bool hasAvoidAreas = false;
     if (GetForegroundInteractiveStatus()) {
         if (IsImmersiveType() && updateReason == BOUNDS_CHANGED) {
             MarkAvoidAreaAsDirty();
         } else {
-            GetAllAvoidAreas(avoidAreas);
+            hasAvoidAreas = GetAllAvoidAreas(avoidAreas) == WSError::WS_OK;
         }
     } else {
         TLOGD(WmsLogTag::WMS_IMMS, "win [%{public}d] avoid area update rejected by recent", persistentId);
@@ -2101,6 +2103,10 @@ WSError SceneSession::NotifyClientToUpdateRectTask(const std::string& updateReas
     bool noNeedTrans = reason == SizeChangeReason::UNDEFINED || reason == SizeChangeReason::RESIZE ||
                        reason == SizeChangeReason::MOVE || reason == SizeChangeReason::DRAG_MOVE;
     auto transaction = noNeedTrans ? nullptr : rsTransaction;
+    if (IsScbCoreEnabled()) {
+        // the client may query right after receiving the rect, it must not read the state of the last flush
+        PublishQueryState(hasAvoidAreas ? &avoidAreas : nullptr);
+    }
     WSError ret = Session::UpdateRectWithLayoutInfo(winRect, reason, updateReason, transaction, avoidAreas);
 #ifdef DEVICE_STATUS_ENABLE
     // In window rotation scenarios, a transaction will be provided. By reusing this
@@ -3045,8 +3051,10 @@ WSError SceneSession::HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidAreaType)
         MarkAvoidAreaAsDirty();
         return WSError::WS_OK;
     }
+    // the client caches the pushed areas for the rect they are computed for
+    WSRect sessionRect = GetSessionRect();
     if (avoidAreaType != AvoidAreaType::TYPE_END) {
-        auto area = GetAvoidAreaByType(avoidAreaType);
+        auto area = GetAvoidAreaByType(avoidAreaType, sessionRect);
         // code below aims to check if ai bar avoid area reaches window rect's bottom
         // it should not be removed until unexpected window rect update issues were solved
         if (avoidAreaType == AvoidAreaType::TYPE_NAVIGATION_INDICATOR && isAINavigationBarAvoidAreaValid_ &&
@@ -3054,7 +3062,7 @@ WSError SceneSession::HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidAreaType)
             TLOGE(WmsLogTag::WMS_IMMS, "ai bar avoid area dose not reach the bottom of the rect");
             return WSError::WS_OK;
         }
-        UpdateAvoidArea(new AvoidArea(area), avoidAreaType);
+        UpdateAvoidArea(new AvoidArea(area), avoidAreaType, sessionRect);
         return WSError::WS_OK;
     } else {
         // avoidAreaType equal to TYPE_END means traversing and updating all avoid area types
@@ -3062,7 +3070,7 @@ WSError SceneSession::HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidAreaType)
         for (T avoidType = static_cast<T>(AvoidAreaType::TYPE_START);
             avoidType < static_cast<T>(AvoidAreaType::TYPE_END); avoidType++) {
             auto type = static_cast<AvoidAreaType>(avoidType);
-            auto area = GetAvoidAreaByType(type);
+            auto area = GetAvoidAreaByType(type, sessionRect);
             // code below aims to check if ai bar avoid area reaches window rect's bottom
             // it should not be removed until unexpected window rect update issues were solved
             if (type == AvoidAreaType::TYPE_NAVIGATION_INDICATOR && isAINavigationBarAvoidAreaValid_ &&
@@ -3072,7 +3080,7 @@ WSError SceneSession::HandleLayoutAvoidAreaUpdate(AvoidAreaType avoidAreaType)
                     "of the rect while traversing all avoid area type");
                 continue;
             }
-            UpdateAvoidArea(new AvoidArea(area), type);
+            UpdateAvoidArea(new AvoidArea(area), type, sessionRect);
         }
     }
     return WSError::WS_OK;
@@ -3875,6 +3883,14 @@ AvoidArea SceneSession::GetAvoidAreaByTypeInner(AvoidAreaType type, const WSRect
 
 AvoidArea SceneSession::GetAvoidAreaByType(AvoidAreaType type, const WSRect& rect, int32_t apiVersion)
 {
+    if (rect.IsEmpty() && CanReadQueryState()) {
+        auto queryState = GetQueryState();
+        if (queryState != nullptr && queryState->hasAvoidAreas_) {
+            if (auto iter = queryState->avoidAreas_.find(type); iter != queryState->avoidAreas_.end()) {
+                return iter->second;
+            }
+        }
+    }
     return PostSyncTask([weakThis = wptr(this), type, rect, where = __func__]() -> AvoidArea {
         auto session = weakThis.promote();
         if (!session) {
@@ -3899,36 +3915,48 @@ AvoidArea SceneSession::GetAvoidAreaByTypeIgnoringVisibility(AvoidAreaType type,
 
 WSError SceneSession::GetAllAvoidAreas(std::map<AvoidAreaType, AvoidArea>& avoidAreas)
 {
+    if (CanReadQueryState()) {
+        auto queryState = GetQueryState();
+        if (queryState != nullptr && queryState->hasAvoidAreas_) {
+            avoidAreas.insert(queryState->avoidAreas_.begin(), queryState->avoidAreas_.end());
+            return queryState->avoidAreasRet_;
+        }
+    }
     return PostSyncTask([weakThis = wptr(this), &avoidAreas, where = __func__] {
         auto session = weakThis.promote();
         if (!session) {
             TLOGNE(WmsLogTag::WMS_IMMS, "%{public}s session is null", where);
             return WSError::WS_ERROR_NULLPTR;
         }
-        float scaleX = INVALID_SCALE;
-        float scaleY = INVALID_SCALE;
-        if (session->GetScaleInLSState(scaleX, scaleY) == WSError::WS_ERROR_INVALID_PARAM) {
- 	        TLOGE(WmsLogTag::WMS_IMMS, "%{public}s id: %{public}d invalid scale", where, session->GetPersistentId());
- 	        return WSError::WS_ERROR_INVALID_PARAM;
- 	    }
-        using T = std::underlying_type_t<AvoidAreaType>;
-        for (T avoidType = static_cast<T>(AvoidAreaType::TYPE_START);
-            avoidType < static_cast<T>(AvoidAreaType::TYPE_END); avoidType++) {
-            auto type = static_cast<AvoidAreaType>(avoidType);
-            auto area = session->GetAvoidAreaByTypeInner(type);
-            // code below aims to check if ai bar avoid area reaches window rect's bottom
-            // it should not be removed until unexpected window rect update issues were solved
-            if (type == AvoidAreaType::TYPE_NAVIGATION_INDICATOR) {
-                if (session->isAINavigationBarAvoidAreaValid_ &&
-                    !session->isAINavigationBarAvoidAreaValid_(session->GetSessionProperty()->GetDisplayId(),
-                        area, session->GetSessionRect().height_)) {
-                    continue;
-                }
+        return session->GetAllAvoidAreasInner(avoidAreas);
+    }, __func__);
+}
+
+WSError SceneSession::GetAllAvoidAreasInner(std::map<AvoidAreaType, AvoidArea>& avoidAreas)
+{
+    float scaleX = INVALID_SCALE;
+    float scaleY = INVALID_SCALE;
+    if (GetScaleInLSState(scaleX, scaleY) == WSError::WS_ERROR_INVALID_PARAM) {
+        TLOGE(WmsLogTag::WMS_IMMS, "id: %{public}d invalid scale", GetPersistentId());
+        return WSError::WS_ERROR_INVALID_PARAM;
+    }
+    using T = std::underlying_type_t<AvoidAreaType>;
+    for (T avoidType = static_cast<T>(AvoidAreaType::TYPE_START);
+        avoidType < static_cast<T>(AvoidAreaType::TYPE_END); avoidType++) {
+        auto type = static_cast<AvoidAreaType>(avoidType);
+        auto area = GetAvoidAreaByTypeInner(type);
+        // code below aims to check if ai bar avoid area reaches window rect's bottom
+        // it should not be removed until unexpected window rect update issues were solved
+        if (type == AvoidAreaType::TYPE_NAVIGATION_INDICATOR) {
+            if (isAINavigationBarAvoidAreaValid_ &&
+                !isAINavigationBarAvoidAreaValid_(GetSessionProperty()->GetDisplayId(),
+                    area, GetSessionRect().height_)) {
+                continue;
             }
-            avoidAreas[type] = area;
         }
-        return WSError::WS_OK;
-    }, __func__);
+        avoidAreas[type] = area;
+    }
+    return WSError::WS_OK;
 }
 
 WSError SceneSession::GetAvoidAreasByRotation(Rotation rotation, const WSRect& rect,
@@ -4053,8 +4081,9 @@ void SceneSession::GetKeyboardAvoidAreaByRotation(Rotation rotation, const WSRec
     }
 }
 
-WSError SceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
+WSError SceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type, const WSRect& rect)
 {
+    MarkQueryStateOutdated();
     if (!sessionStage_) {
         return WSError::WS_ERROR_NULLPTR;
     }
@@ -4062,7 +4091,7 @@ WSError SceneSession::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAre
         TLOGD(WmsLogTag::WMS_IMMS, "win [%{public}d] avoid area update rejected by recent", GetPersistentId());
         return WSError::WS_DO_NOTHING;
     }
-    return sessionStage_->UpdateAvoidArea(avoidArea, type);
+    return sessionStage_->UpdateAvoidArea(avoidArea, type, rect);
 }
 
 WSError SceneSession::SetPipActionEvent(const std::string& action, int32_t status)
@@ -5875,12 +5904,8 @@ void SceneSession::UpdateNativeVisibility(bool visible)
         int32_t persistentId = session->GetPersistentId();
         TLOGNI(WmsLogTag::WMS_SCB, "%{public}s name: %{public}s, id: %{public}u, visible: %{public}u",
             where, session->sessionInfo_.bundleName_.c_str(), persistentId, visible);
-        SceneSessionChangeInfo changeInfo {
-            .persistentId_ = persistentId,
-            .changeInfo_ = "Visibility change to " + std::to_string(visible),
-            .logTag_ = WmsLogTag::WMS_ATTRIBUTE,
-        };
-        SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD, changeInfo);
+        SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD, persistentId,
+            WmsLogTag::WMS_ATTRIBUTE, RecordFormatId::VISIBILITY_CHANGE, visible);
         bool oldVisibleState = session->isVisible_.load();
         session->isVisible_.store(visible);
         if (session->visibilityChangedDetectFunc_) {
@@ -6338,6 +6363,74 @@ std::vector<Rect> SceneSession::GetTouchHotAreas() const
     return touchHotAreas;
 }
 
+HotAreaBufferPtr SceneSession::GetTouchHotAreaBuffer() const
+{
+    auto property = GetSessionProperty();
+    return property ? property->GetTouchHotAreaBuffer() : HotAreaBuffer::Create({});
+}
+
+std::shared_ptr<const std::vector<MMI::Rect>> SceneSession::GetMMIHotAreasCache(uint64_t version) const
+{
+    std::lock_guard<std::mutex> lock(mmiHotAreasCacheMutex_);
+    if (version == 0 || version != mmiHotAreasCacheVersion_) {
+        return nullptr;
+    }
+    return mmiHotAreasCache_;
+}
+
+void SceneSession::SetMMIHotAreasCache(uint64_t version,
+    const std::shared_ptr<const std::vector<MMI::Rect>>& hotAreas)
+{
+    std::lock_guard<std::mutex> lock(mmiHotAreasCacheMutex_);
+    mmiHotAreasCacheVersion_ = version;
+    mmiHotAreasCache_ = hotAreas;
+}
+
+void SceneSession::PublishQueryState(const std::map<AvoidAreaType, AvoidArea>* avoidAreas)
+{
+    auto queryState = std::make_shared<SessionQueryState>();
+    queryState->rect_ = GetSessionRect();
+    queryState->mode_ = GetWindowMode();
+    queryState->isVisible_ = IsVisible();
+    queryState->zOrder_ = GetZOrder();
+    queryState->displayId_ = GetSessionProperty()->GetDisplayId();
+    if (queryState->isVisible_) {
+        queryState->hasAvoidAreas_ = true;
+        if (avoidAreas != nullptr) {
+            queryState->avoidAreas_ = *avoidAreas;
+        } else {
+            queryState->avoidAreasRet_ = GetAllAvoidAreasInner(queryState->avoidAreas_);
+        }
+    }
+    isQueryStateOutdated_ = false;
+    std::lock_guard<std::mutex> lock(queryStateMutex_);
+    queryState_ = std::move(queryState);
+}
+
+bool SceneSession::IsQueryStateOutdated() const
+{
+    if (isQueryStateOutdated_ || GetDirtyFlags() != 0) {
+        return true;
+    }
+    auto queryState = GetQueryState();
+    return queryState == nullptr || queryState->rect_ != GetSessionRect() || queryState->mode_ != GetWindowMode() ||
+        queryState->isVisible_ != IsVisible() || queryState->zOrder_ != GetZOrder() ||
+        queryState->displayId_ != GetSessionProperty()->GetDisplayId();
+}
+
+SessionQueryStatePtr SceneSession::GetQueryState() const
+{
+    std::lock_guard<std::mutex> lock(queryStateMutex_);
+    return queryState_;
+}
+
+bool SceneSession::CanReadQueryState() const
+{
+    // on the session thread the live state may be newer than the last flush
+    auto handler = GetEventHandler();
+    return handler != nullptr && !handler->GetEventRunner()->IsCurrentRunnerThread();
+}
+
 PiPTemplateInfo SceneSession::GetPiPTemplateInfo() const
 {
     return pipTemplateInfo_;
@@ -7578,14 +7671,10 @@ WMError SceneSession::HandleActionUpdateOrientation(const sptr<WindowSessionProp
     WSPropertyChangeAction action)
 {
     SetRequestedOrientation(property->GetRequestedOrientation(), property->GetRequestedAnimation());
-    SceneSessionChangeInfo changeInfo {
-        .persistentId_ = property->GetPersistentId(),
-        .changeInfo_ = "Orientation change to " +
-            std::to_string(static_cast<uint32_t>(property->GetRequestedOrientation())) + ", animation change to "+
-            std::to_string(static_cast<uint32_t>(property->GetRequestedAnimation())),
-        .logTag_ = WmsLogTag::WMS_ROTATION,
-    };
-    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::ORIENTAION_RECORD, changeInfo);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::ORIENTAION_RECORD,
+        property->GetPersistentId(), WmsLogTag::WMS_ROTATION, RecordFormatId::ORIENTATION_CHANGE,
+        static_cast<uint32_t>(property->GetRequestedOrientation()),
+        static_cast<uint32_t>(property->GetRequestedAnimation()));
     return WMError::WM_OK;
 }
 
@@ -7617,12 +7706,8 @@ WMError SceneSession::HandleActionUpdatePrivacyMode(const sptr<WindowSessionProp
     bool isPrivacyMode = property->GetPrivacyMode() || property->GetSystemPrivacyMode();
     SetPrivacyMode(isPrivacyMode);
     NotifySessionChangeByActionNotifyManager(property, action);
-    SceneSessionChangeInfo changeInfo {
-        .persistentId_ = property->GetPersistentId(),
-        .changeInfo_ = "Privacy mode change to " + std::to_string(isPrivacyMode),
-        .logTag_ = WmsLogTag::WMS_ATTRIBUTE,
-    };
-    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::PRIVACY_MODE, changeInfo);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::PRIVACY_MODE,
+        property->GetPersistentId(), WmsLogTag::WMS_ATTRIBUTE, RecordFormatId::PRIVACY_MODE_CHANGE, isPrivacyMode);
     return WMError::WM_OK;
 }
 
@@ -7822,7 +7907,8 @@ WMError SceneSession::HandleActionUpdateWindowMask(const sptr<WindowSessionPrope
 {
     auto sessionProperty = GetSessionProperty();
     if (sessionProperty != nullptr) {
-        sessionProperty->SetWindowMask(property->GetWindowMask());
+        // a mask set again with the same pixels keeps its instance, so the input flush sees it unchanged
+        sessionProperty->SetWindowMask(WindowMaskCache::GetInstance().Intern(property->GetWindowMask()));
         sessionProperty->SetIsShaped(property->GetIsShaped());
         NotifySessionChangeByActionNotifyManager(property, action);
     }
@@ -9850,12 +9936,8 @@ bool SceneSession::UpdateVisibilityInner(bool visibility)
     if (notifyVisibleChangeFunc_ != nullptr) {
         notifyVisibleChangeFunc_(GetPersistentId());
     }
-    SceneSessionChangeInfo changeInfo {
-        .persistentId_ = GetPersistentId(),
-        .changeInfo_ = "Visibility change to " + std::to_string(visibility),
-        .logTag_ = WmsLogTag::WMS_ATTRIBUTE,
-    };
-    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD, changeInfo);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD, GetPersistentId(),
+        WmsLogTag::WMS_ATTRIBUTE, RecordFormatId::VISIBILITY_CHANGE, visibility);
     return true;
 }
 
@@ -10124,6 +10206,9 @@ void SceneSession::SetDefaultDisplayIdIfNeed()
     if (sessionInfo_.screenId_ == SCREEN_ID_INVALID) {
         auto defaultDisplayId = ScreenSessionManagerClient::GetInstance().GetDefaultScreenId();
         sessionInfo_.screenId_ = defaultDisplayId;
+        if (screenIdChangeFunc_) {
+            screenIdChangeFunc_(GetPersistentId(), defaultDisplayId);
+        }
         TLOGI(WmsLogTag::WMS_LIFE, "winId: %{public}d, update screen id %{public}" PRIu64,
             GetPersistentId(), defaultDisplayId);
         auto sessionProperty = GetSessionProperty();
@@ -10999,6 +11084,7 @@ WSError SceneSession::SetCurrentRotation(int32_t currentRotation)
             return;
         }
         session->currentRotation_ = currentRotation;
+        session->transformVersion_++;
         if (!session->sessionStage_) {
             return;
         }
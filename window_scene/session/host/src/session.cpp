@@ -570,6 +570,9 @@ void Session::SetScreenId(uint64_t screenId)
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "win=[%{public}d, %{public}s], hasStage=%{public}d, screenId=%{public}" PRIu64,
         GetPersistentId(), GetWindowName().c_str(), sessionStage_ != nullptr, screenId);
     sessionInfo_.screenId_ = screenId;
+    if (screenIdChangeFunc_) {
+        screenIdChangeFunc_(GetPersistentId(), screenId);
+    }
     if (sessionStage_) {
         sessionStage_->UpdateDisplayId(screenId);
     }
@@ -579,9 +582,17 @@ void Session::SetScreenId(uint64_t screenId)
 void Session::SetScreenIdOnServer(uint64_t screenId)
 {
     sessionInfo_.screenId_ = screenId;
+    if (screenIdChangeFunc_) {
+        screenIdChangeFunc_(GetPersistentId(), screenId);
+    }
     RSAdapterUtil::SetRSUIContext(GetSurfaceNode(), GetRSUIContext(), true);
 }
 
+void Session::SetScreenIdChangeFunc(NotifyScreenIdChangeFunc&& func)
+{
+    screenIdChangeFunc_ = std::move(func);
+}
+
 void Session::SetAppInstanceKey(const std::string& appInstanceKey)
 {
     sessionInfo_.appInstanceKey_ = appInstanceKey;
@@ -1378,6 +1389,25 @@ void Session::SetClientDisplayIdChangeListener(const NotifyClientDisplayIdChange
     clientDisplayIdChangeFunc_ = func;
 }
 
+void Session::SetPropertyDirtyFlags(uint32_t dirtyFlags)
+{
+    bool hasNewFlags = (dirtyFlags & ~propertyDirtyFlags_) != 0;
+    propertyDirtyFlags_ = dirtyFlags;
+    if (hasNewFlags && propertyDirtyFunc_) {
+        propertyDirtyFunc_(GetPersistentId());
+    }
+}
+
+void Session::AddPropertyDirtyFlags(uint32_t dirtyFlags)
+{
+    SetPropertyDirtyFlags(propertyDirtyFlags_ | dirtyFlags);
+}
+
+void Session::SetPropertyDirtyListener(const NotifyPropertyDirtyFunc& func)
+{
+    propertyDirtyFunc_ = func;
+}
+
 WSError Session::UpdateClientDisplayId(DisplayId displayId)
 {
     if (sessionStage_ == nullptr) {
@@ -5572,6 +5602,7 @@ float Session::GetFloatingScale() const
 void Session::SetScale(float scaleX, float scaleY, float pivotX, float pivotY)
 {
     layoutController_->SetScale(scaleX, scaleY, pivotX, pivotY);
+    transformVersion_++;
 }
 
 void Session::SetIgnoreRotateScale(float ignoreRotateScaleX, float ignoreRotateScaleY)
@@ -18,7 +18,10 @@
 #include <algorithm>
 #include <charconv>
 #include <chrono>
+#include <cinttypes>
+#include <securec.h>
 
+#include "time_util.h"
 #include "window_helper.h"
 #include "zlib.h"
 
@@ -31,11 +34,20 @@ constexpr uint32_t MAX_RECORD_TYPE_SIZE = 10;
 constexpr uint32_t MAX_RECORD_LOG_SIZE = 102400;
 constexpr uint32_t MAX_EVENT_DUMP_SIZE = 512 * 1024;
 constexpr int32_t SCHEDULE_SECONDS = 5;
+constexpr uint32_t MAX_RING_BUFFER_NUM = 64;
+constexpr size_t MAX_FORMAT_INFO_LEN = 128;
+constexpr const char* RECORD_FORMATS[] = {
+    "Visibility change to %" PRId64,
+    "Orientation change to %" PRId64 ", animation change to %" PRId64,
+    "Privacy mode change to %" PRId64,
+    "Session state change to %" PRId64,
+};
+static_assert(sizeof(RECORD_FORMATS) / sizeof(RECORD_FORMATS[0]) ==
+    static_cast<size_t>(RecordFormatId::FORMAT_ID_END), "record format count mismatch");
 
 // LCOV_EXCL_START
-std::string GetFormattedTime()
+std::string GetFormattedTime(std::chrono::system_clock::time_point now = std::chrono::system_clock::now())
 {
-    auto now = std::chrono::system_clock::now();
     std::time_t t = std::chrono::system_clock::to_time_t(now);
     struct tm timeBuffer;
     std::tm* tmPtr = localtime_r(&t, &timeBuffer);
@@ -52,6 +64,38 @@ std::string GetFormattedTime()
 
 WM_IMPLEMENT_SINGLE_INSTANCE(SessionChangeRecorder)
 
+void SessionChangeRingBuffer::Push(const SessionChangeRecord& record)
+{
+    uint64_t index = writeIndex_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[index % CAPACITY];
+    // odd seq marks the slot being written, readers drop it
+    slot.seq_.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record_ = record;
+    slot.seq_.store(index * 2 + 2, std::memory_order_release);
+    writeIndex_.store(index + 1, std::memory_order_release);
+}
+
+uint64_t SessionChangeRingBuffer::ReadFrom(uint64_t fromIndex, std::vector<SessionChangeRecord>& records) const
+{
+    uint64_t writeIndex = writeIndex_.load(std::memory_order_acquire);
+    uint64_t beginIndex = writeIndex > CAPACITY ? std::max(fromIndex, writeIndex - CAPACITY) : fromIndex;
+    for (uint64_t index = beginIndex; index < writeIndex; index++) {
+        const Slot& slot = slots_[index % CAPACITY];
+        uint64_t seq = slot.seq_.load(std::memory_order_acquire);
+        if (seq != index * 2 + 2) {
+            continue;
+        }
+        SessionChangeRecord record = slot.record_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq_.load(std::memory_order_relaxed) != seq) {
+            continue;
+        }
+        records.push_back(record);
+    }
+    return writeIndex;
+}
+
 void SessionChangeRecorder::Init()
 {
     TLOGD(WmsLogTag::DEFAULT, "In");
@@ -82,6 +126,7 @@ void SessionChangeRecorder::Init()
                 PrintLog(sceneSessionChangeNeedLogMapCopy);
                 sceneSessionChangeNeedLogMapCopy.clear();
             }
+            PrintBinaryLog();
             std::this_thread::sleep_for(std::chrono::seconds(SCHEDULE_SECONDS));
         }
     });
@@ -114,6 +159,142 @@ WSError SessionChangeRecorder::RecordSceneSessionChange(RecordType recordType, S
     return WSError::WS_OK;
 }
 
+WSError SessionChangeRecorder::RecordSceneSessionChange(RecordType recordType, int32_t persistentId,
+    WmsLogTag logTag, RecordFormatId formatId, int64_t arg0, int64_t arg1)
+{
+    if (logTag == WmsLogTag::DEFAULT || logTag >= WmsLogTag::END || formatId >= RecordFormatId::FORMAT_ID_END) {
+        TLOGD(WmsLogTag::DEFAULT, "Invalid log tag or format");
+        return WSError::WS_ERROR_INVALID_PARAM;
+    }
+    auto ringBuffer = GetThreadRingBuffer();
+    if (ringBuffer == nullptr) {
+        if (droppedRecordNum_.fetch_add(1, std::memory_order_relaxed) == 0) {
+            TLOGW(WmsLogTag::DEFAULT, "ring buffer num exceeds %{public}u, drop records", MAX_RING_BUFFER_NUM);
+        }
+        return WSError::WS_ERROR_NO_MEM;
+    }
+    SessionChangeRecord record {
+        .timestampNs_ = TimeUtil::GetCurrentTimeNs(),
+        .recordType_ = recordType,
+        .persistentId_ = persistentId,
+        .formatId_ = formatId,
+        .logTag_ = logTag,
+        .args_ = { arg0, arg1 },
+    };
+    ringBuffer->Push(record);
+    return WSError::WS_OK;
+}
+
+std::shared_ptr<SessionChangeRingBuffer> SessionChangeRecorder::GetThreadRingBuffer()
+{
+    // registered once per thread, later records are lock free
+    struct ThreadRingBufferHolder {
+        ~ThreadRingBufferHolder()
+        {
+            if (ringBuffer_ != nullptr) {
+                ringBuffer_->SetReleased();
+            }
+        }
+        std::shared_ptr<SessionChangeRingBuffer> ringBuffer_;
+    };
+    thread_local ThreadRingBufferHolder holder;
+    if (holder.ringBuffer_ != nullptr) {
+        return holder.ringBuffer_;
+    }
+    std::lock_guard<std::mutex> lock(ringBufferMutex_);
+    if (ringBuffers_.size() >= MAX_RING_BUFFER_NUM) {
+        PruneReleasedRingBuffersLocked();
+    }
+    if (ringBuffers_.size() >= MAX_RING_BUFFER_NUM) {
+        return nullptr;
+    }
+    holder.ringBuffer_ = std::make_shared<SessionChangeRingBuffer>();
+    ringBuffers_.push_back({ holder.ringBuffer_, 0 });
+    return holder.ringBuffer_;
+}
+
+void SessionChangeRecorder::PruneReleasedRingBuffersLocked()
+{
+    // the buffers of exited threads are kept for dump until new threads need the room
+    for (auto iter = ringBuffers_.begin(); iter != ringBuffers_.end();) {
+        if (!iter->ringBuffer_->IsReleased()) {
+            ++iter;
+            continue;
+        }
+        std::vector<SessionChangeRecord> records;
+        iter->ringBuffer_->ReadFrom(iter->logReadIndex_, records);
+        LogBinaryRecords(records);
+        iter = ringBuffers_.erase(iter);
+    }
+}
+
+SceneSessionChangeInfo SessionChangeRecorder::ConvertToChangeInfo(const SessionChangeRecord& record)
+{
+    SceneSessionChangeInfo changeInfo {
+        .persistentId_ = record.persistentId_,
+        .logTag_ = record.logTag_,
+    };
+    char buffer[MAX_FORMAT_INFO_LEN] = { 0 };
+    if (snprintf_s(buffer, sizeof(buffer), sizeof(buffer) - 1, RECORD_FORMATS[static_cast<size_t>(record.formatId_)],
+        record.args_[0], record.args_[1]) > 0) {
+        changeInfo.changeInfo_ = buffer;
+    }
+    auto elapsed = std::chrono::nanoseconds(TimeUtil::GetCurrentTimeNs() - record.timestampNs_);
+    changeInfo.time_ = GetFormattedTime(std::chrono::system_clock::now() -
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed));
+    return changeInfo;
+}
+
+void SessionChangeRecorder::CollectBinaryRecords(
+    std::unordered_map<RecordType, std::queue<SceneSessionChangeInfo>>& dumpMap)
+{
+    std::vector<SessionChangeRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(ringBufferMutex_);
+        for (const auto& entry : ringBuffers_) {
+            entry.ringBuffer_->ReadFrom(0, records);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.timestampNs_ < rhs.timestampNs_;
+    });
+    std::unordered_map<RecordType, uint32_t> recordSizeMapCopy;
+    {
+        std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
+        recordSizeMapCopy = recordSizeMap_;
+    }
+    for (const auto& record : records) {
+        auto& dumpQueue = dumpMap[record.recordType_];
+        dumpQueue.push(ConvertToChangeInfo(record));
+        uint32_t maxRecordTypeSize = recordSizeMapCopy.find(record.recordType_) != recordSizeMapCopy.end() ?
+            recordSizeMapCopy[record.recordType_] : MAX_RECORD_TYPE_SIZE;
+        while (dumpQueue.size() > maxRecordTypeSize) {
+            dumpQueue.pop();
+        }
+    }
+}
+
+void SessionChangeRecorder::PrintBinaryLog()
+{
+    std::vector<SessionChangeRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(ringBufferMutex_);
+        for (auto& entry : ringBuffers_) {
+            entry.logReadIndex_ = entry.ringBuffer_->ReadFrom(entry.logReadIndex_, records);
+        }
+    }
+    LogBinaryRecords(records);
+}
+
+void SessionChangeRecorder::LogBinaryRecords(const std::vector<SessionChangeRecord>& records)
+{
+    for (const auto& record : records) {
+        SceneSessionChangeInfo curChange = ConvertToChangeInfo(record);
+        TLOGD(curChange.logTag_, "winId: %{public}d, changeInfo: %{public}s, time: %{public}s",
+            curChange.persistentId_, curChange.changeInfo_.c_str(), curChange.time_.c_str());
+    }
+}
+
 WSError SessionChangeRecorder::SetRecordSize(RecordType recordType, uint32_t recordSize)
 {
     TLOGD(WmsLogTag::DEFAULT, "recordType: %{public}" PRIu32 ", size: %{public}d", recordType, recordSize);
@@ -172,6 +353,11 @@ void SessionChangeRecorder::GetSceneSessionNeedDumpInfo(
         std::lock_guard<std::mutex> lock(sessionChangeRecorderMutex_);
         sceneSessionChangeNeedDumpMapCopy = sceneSessionChangeNeedDumpMap_;
     }
+    CollectBinaryRecords(sceneSessionChangeNeedDumpMapCopy);
+    uint64_t droppedRecordNum = GetDroppedRecordNum();
+    if (droppedRecordNum != 0) {
+        oss << "Dropped records: " << droppedRecordNum << std::endl;
+    }
     std::string dumpInfoJsonString = FormatDumpInfoToJsonString(specifiedRecordType, specifiedWindowId,
         sceneSessionChangeNeedDumpMapCopy);
     oss << dumpInfoJsonString;
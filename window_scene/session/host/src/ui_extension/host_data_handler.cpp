@@ -38,7 +38,8 @@ DataHandlerErr HostDataHandler::SendData(const AAFwk::Want& toSend, AAFwk::Want&
 
     MessageParcel sendParcel;
     MessageOption option(config.needSyncSend ? MessageOption::TF_SYNC : MessageOption::TF_ASYNC);
-    auto err = PrepareSendData(sendParcel, config, toSend);
+    DataChannelRange range;
+    auto err = PrepareSendData(sendParcel, config, toSend, range);
     if (err != DataHandlerErr::OK) {
         return err;
     }
@@ -47,6 +48,7 @@ DataHandlerErr HostDataHandler::SendData(const AAFwk::Want& toSend, AAFwk::Want&
     auto ret = proxy->SendExtensionData(sendParcel, replyParcel, option);
     if (ret != WSError::WS_OK) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendExtensionData failed, %{public}s", config.ToString().c_str());
+        CancelSendData(range);
         return DataHandlerErr::IPC_SEND_FAILED;
     }
 
@@ -32,6 +32,9 @@
 #include "rate_limited_logger.h"
 #include "session/host/include/zidl/session_ipc_interface_code.h"
 #include "window_manager_hilog.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
 namespace OHOS::Rosen {
 namespace {
 constexpr HiviewDFX::HiLogLabel LABEL = { LOG_CORE, HILOG_DOMAIN_WINDOW, "SessionProxy" };
@@ -88,6 +91,15 @@ bool WriteRect(MessageParcel& data, const Rect& rect)
     }
     return true;
 }
+
+int SendIpcRequest(const sptr<IRemoteObject>& remote, uint32_t code, MessageParcel& data, MessageParcel& reply,
+    MessageOption& option)
+{
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadScope payloadScope(IpcSide::PROXY, "Session", code, data, reply);
+#endif
+    return remote->SendRequest(code, data, reply, option);
+}
 } // namespace
 
 WSError SessionProxy::Foreground(
@@ -125,7 +137,7 @@ WSError SessionProxy::Foreground(
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_FOREGROUND),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_FOREGROUND),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -161,7 +173,7 @@ WSError SessionProxy::Background(bool isFromClient, const std::string& identityT
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BACKGROUND),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BACKGROUND),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -198,7 +210,7 @@ WSError SessionProxy::Show(sptr<WindowSessionProperty> property)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SHOW),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SHOW),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -223,7 +235,7 @@ WSError SessionProxy::Hide()
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_HIDE),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_HIDE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -260,7 +272,7 @@ WSError SessionProxy::Disconnect(bool isFromClient, const std::string& identityT
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DISCONNECT),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DISCONNECT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -351,7 +363,7 @@ WSError SessionProxy::Connect(const sptr<ISessionStage>& sessionStage, const spt
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONNECT),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONNECT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed, code: %{public}d", sendCode);
@@ -462,7 +474,7 @@ WSError SessionProxy::DrawingCompleted()
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DRAWING_COMPLETED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DRAWING_COMPLETED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -484,7 +496,7 @@ WSError SessionProxy::RemoveStartingWindow()
         TLOGE(WmsLogTag::WMS_STARTUP_PAGE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_APP_REMOVE_STARTING_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_APP_REMOVE_STARTING_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_STARTUP_PAGE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -538,7 +550,7 @@ WSError SessionProxy::ChangeSessionVisibilityWithStatusBar(sptr<AAFwk::SessionIn
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SessionInterfaceCode::TRANS_ID_CHANGE_SESSION_VISIBILITY_WITH_STATUS_BAR),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -677,7 +689,7 @@ WSError SessionProxy::PendingSessionActivation(sptr<AAFwk::SessionInfo> abilityS
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_ACTIVE_PENDING_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_ACTIVE_PENDING_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -737,7 +749,7 @@ WSError SessionProxy::BatchPendingSessionsActivation(
         return WSError::WS_ERROR_IPC_FAILED;
     }
     TLOGI(WmsLogTag::WMS_LIFE, "batch pending session activations size: %{public}zu", abilitySessionInfos.size());
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BATCH_ACTIVE_PENDING_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BATCH_ACTIVE_PENDING_SESSION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -881,7 +893,7 @@ WSError SessionProxy::TerminateSession(const sptr<AAFwk::SessionInfo> abilitySes
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TERMINATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TERMINATE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -949,7 +961,7 @@ WSError SessionProxy::NotifySessionException(const sptr<AAFwk::SessionInfo> abil
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_EXCEPTION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_EXCEPTION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1009,7 +1021,7 @@ WSError SessionProxy::OnSessionEvent(SessionEvent event, const SessionEventParam
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SESSION_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SESSION_EVENT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1031,7 +1043,7 @@ WSError SessionProxy::SyncSessionEvent(SessionEvent event)
         TLOGE(WmsLogTag::WMS_LAYOUT, "Write event id failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (Remote()->SendRequest(static_cast<int32_t>(SessionInterfaceCode::TRANS_ID_SYNC_SESSION_EVENT),
+    if (SendIpcRequest(Remote(), static_cast<int32_t>(SessionInterfaceCode::TRANS_ID_SYNC_SESSION_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1058,7 +1070,7 @@ WSError SessionProxy::OnLayoutFullScreenChange(bool isLayoutFullScreen)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_LAYOUT_FULL_SCREEN_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_LAYOUT_FULL_SCREEN_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1085,7 +1097,7 @@ WSError SessionProxy::OnDefaultDensityEnabled(bool isDefaultDensityEnabled)
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DEFAULT_DENSITY_ENABLED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_DEFAULT_DENSITY_ENABLED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1116,7 +1128,7 @@ WMError SessionProxy::OnUpdateColorMode(const std::string& colorMode, bool hasDa
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_COLOR_MODE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -1144,7 +1156,7 @@ WSError SessionProxy::OnTitleAndDockHoverShowChange(bool isTitleHoverShown, bool
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TITLE_AND_DOCK_HOVER_SHOW_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TITLE_AND_DOCK_HOVER_SHOW_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1167,7 +1179,7 @@ WSError SessionProxy::OnRestoreMainWindow()
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RESTORE_MAIN_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RESTORE_MAIN_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1198,7 +1210,7 @@ WMError SessionProxy::RestoreFloatMainWindow(const std::shared_ptr<AAFwk::WantPa
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RESTORE_FLOAT_MAIN_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -1259,7 +1271,7 @@ WSError SessionProxy::UpdateSessionRect(const WSRect& rect, SizeChangeReason rea
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_SESSION_RECT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_SESSION_RECT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1292,7 +1304,7 @@ WSError SessionProxy::UpdateGlobalDisplayRectFromClient(const WSRect& rect, Size
     }
     MessageParcel reply;
     MessageOption option(MessageOption::TF_ASYNC);
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_GLOBAL_DISPLAY_RECT), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Failed to send request, error = %{public}d", sendRet);
@@ -1316,7 +1328,7 @@ WMError SessionProxy::GetGlobalScaledRect(Rect& globalScaledRect)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_GLOBAL_SCALED_RECT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_GLOBAL_SCALED_RECT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -1360,7 +1372,7 @@ WSError SessionProxy::UpdateClientRect(const WSRect& rect)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_CLIENT_RECT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_CLIENT_RECT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1384,7 +1396,7 @@ WSError SessionProxy::RaiseToAppTop()
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_TO_APP_TOP),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_TO_APP_TOP),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1420,7 +1432,7 @@ WSError SessionProxy::NotifyFrameLayoutFinishFromApp(bool notifyListener, const
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_FRAME_LAYOUT_FINISH),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_FRAME_LAYOUT_FINISH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1443,7 +1455,7 @@ WMError SessionProxy::NotifySnapshotUpdate()
         TLOGE(WmsLogTag::WMS_PATTERN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_SNAPSHOT_UPDATE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -1468,7 +1480,7 @@ WMError SessionProxy::NotifyRemovePrelaunchStartingWindow()
         TLOGE(WmsLogTag::WMS_PATTERN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_REMOVE_PRELAUNCH_STARTING_WINDOW),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -1496,7 +1508,7 @@ WSError SessionProxy::RaiseAboveTarget(int32_t subWindowId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_ABOVE_TARGET),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_ABOVE_TARGET),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1528,7 +1540,7 @@ WSError SessionProxy::RaiseMainWindowAboveTarget(int32_t targetId)
         TLOGE(WmsLogTag::WMS_HIERARCHY, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_MAIN_WINDOW_ABOVE_TARGET),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_MAIN_WINDOW_ABOVE_TARGET),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_HIERARCHY, "sendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1551,7 +1563,7 @@ WSError SessionProxy::RaiseAppMainWindowToTop()
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_APP_MAIN_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RAISE_APP_MAIN_WINDOW),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1578,7 +1590,7 @@ WSError SessionProxy::OnNeedAvoid(bool status)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NEED_AVOID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NEED_AVOID),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1616,7 +1628,7 @@ AvoidArea SessionProxy::GetAvoidAreaByType(AvoidAreaType type, const WSRect& rec
         TLOGE(WmsLogTag::WMS_IMMS, "remote is null");
         return avoidArea;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_AVOID_AREA),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_AVOID_AREA),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_IMMS, "SendRequest failed, code: %{public}d", sendCode);
@@ -1654,7 +1666,7 @@ AvoidArea SessionProxy::GetAvoidAreaByTypeIgnoringVisibility(AvoidAreaType type,
         TLOGE(WmsLogTag::WMS_IMMS, "remote is null");
         return avoidArea;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(
         SessionInterfaceCode::TRANS_ID_GET_AVOID_AREA_IGNORING_VISIBILITY),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -1682,7 +1694,7 @@ WSError SessionProxy::GetAllAvoidAreas(std::map<AvoidAreaType, AvoidArea>& avoid
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_ALL_AVOID_AREAS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_ALL_AVOID_AREAS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1780,7 +1792,7 @@ WSError SessionProxy::GetTargetOrientationConfigInfo(Orientation targetOrientati
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_TARGET_ORIENTATION_CONFIG_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_TARGET_ORIENTATION_CONFIG_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1816,7 +1828,7 @@ WSError SessionProxy::ConvertOrientationAndRotation(const RotationInfoType from,
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONVERT_ORIENTATION_AND_ROTATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONVERT_ORIENTATION_AND_ROTATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1860,7 +1872,8 @@ WMError SessionProxy::SetPreferredOrientationWithResult(
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_PREFERRED_ORIENTATION_WITH_RESULT),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_PREFERRED_ORIENTATION_WITH_RESULT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -1891,7 +1904,7 @@ WSError SessionProxy::RequestSessionBack(bool needMoveToBackground)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BACKPRESSED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_BACKPRESSED),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1918,7 +1931,7 @@ WSError SessionProxy::MarkProcessed(int32_t eventId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_MARK_PROCESSED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_MARK_PROCESSED),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1944,7 +1957,7 @@ WSError OHOS::Rosen::SessionProxy::SetGlobalMaximizeMode(MaximizeMode mode)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_MAXIMIZE_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_MAXIMIZE_MODE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1967,7 +1980,7 @@ WSError SessionProxy::GetGlobalMaximizeMode(MaximizeMode& mode)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_MAXIMIZE_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_MAXIMIZE_MODE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1996,7 +2009,7 @@ WSError SessionProxy::SetAspectRatio(float ratio)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_ASPECT_RATIO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_ASPECT_RATIO),
                             data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2032,7 +2045,7 @@ WSError SessionProxy::SetContentAspectRatio(float ratio, bool isPersistent, bool
     }
     MessageParcel reply;
     MessageOption option;
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_CONTENT_ASPECT_RATIO), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Failed to send request, error = %{public}d", sendRet);
@@ -2060,7 +2073,7 @@ WSError SessionProxy::UpdateWindowSceneAfterCustomAnimation(bool isAdd)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_CUSTOM_ANIMATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_CUSTOM_ANIMATION),
                             data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2087,7 +2100,7 @@ WSError SessionProxy::SetLandscapeMultiWindow(bool isLandscapeMultiWindow)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_LANDSCAPE_MULTI_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_LANDSCAPE_MULTI_WINDOW),
                             data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2110,7 +2123,7 @@ WSError SessionProxy::GetIsMidScene(bool& isMidScene)
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_IS_MID_SCENE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_IS_MID_SCENE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2145,7 +2158,7 @@ WSError SessionProxy::TransferAbilityResult(uint32_t resultCode, const AAFwk::Wa
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TRANSFER_ABILITY_RESULT),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TRANSFER_ABILITY_RESULT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2173,7 +2186,7 @@ int32_t SessionProxy::TransferExtensionData(const AAFwk::WantParams& wantParams)
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return IPC_PROXY_ERR;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TRANSFER_EXTENSION_DATA),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TRANSFER_EXTENSION_DATA),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2199,7 +2212,7 @@ void SessionProxy::NotifySyncOn()
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_SYNC_ON),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_SYNC_ON),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2220,7 +2233,7 @@ void SessionProxy::NotifyAsyncOn()
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_ASYNC_ON),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_ASYNC_ON),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2242,7 +2255,7 @@ void SessionProxy::NotifyExtensionDied()
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_DIED),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_DIED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2268,7 +2281,8 @@ void SessionProxy::NotifyExtensionTimeout(int32_t errorCode)
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_TIMEOUT),
+    int sendCode = SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_TIMEOUT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2289,7 +2303,7 @@ void SessionProxy::TriggerBindModalUIExtension()
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_TRIGGER_BIND_MODAL_UI_EXTENSION), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2314,7 +2328,7 @@ WSError SessionProxy::UpdateWindowAnimationFlag(bool needDefaultAnimationFlag)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_WINDOW_ANIMATION_FLAG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_WINDOW_ANIMATION_FLAG),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2347,7 +2361,7 @@ WSError SessionProxy::TransferAccessibilityEvent(const Accessibility::Accessibil
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_REPORT_ACCESSIBILITY_EVENT), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -2370,7 +2384,7 @@ void SessionProxy::NotifyPiPWindowPrepareClose()
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_PIP_WINDOW_PREPARE_CLOSE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_PIP_WINDOW_PREPARE_CLOSE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -2411,7 +2425,7 @@ WSError SessionProxy::UpdatePiPRect(const Rect& rect, SizeChangeReason reason)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_RECT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_RECT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2443,7 +2457,7 @@ WSError SessionProxy::UpdatePiPControlStatus(WsPiPControlType controlType, WsPiP
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_CONTROL_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_CONTROL_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2484,7 +2498,7 @@ WSError SessionProxy::SetAutoStartPiP(bool isAutoStart, uint32_t priority, uint3
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_AUTOSTART_PIP),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_AUTOSTART_PIP),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2511,7 +2525,7 @@ WMError SessionProxy::UpdateFloatingBall(const FloatingBallTemplateInfo& fbTempl
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto errCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_FLOATING_BALL),
+    auto errCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_FLOATING_BALL),
                                        data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -2548,7 +2562,7 @@ WMError SessionProxy::RestoreFbMainWindow(const std::shared_ptr<AAFwk::Want>& wa
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto errCode = remote->SendRequest(
+    auto errCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_START_FLOATING_BALL_MAIN_WINDOW), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -2577,7 +2591,7 @@ WMError SessionProxy::GetFloatingBallWindowId(uint32_t& windowId)
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto errCode = remote->SendRequest(
+    auto errCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_FLOATING_BALL_WINDOW_ID), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -2620,7 +2634,7 @@ WSError SessionProxy::ProcessPointDownSession(int32_t posX, int32_t posY)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_PROCESS_POINT_DOWN_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_PROCESS_POINT_DOWN_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2651,7 +2665,7 @@ WSError SessionProxy::SendPointEventForMoveDrag(const std::shared_ptr<MMI::Point
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_POINTEREVENT_FOR_MOVE_DRAG),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_POINTEREVENT_FOR_MOVE_DRAG),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2673,7 +2687,7 @@ bool SessionProxy::IsStartMoving()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return false;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_IS_START_MOVING),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_IS_START_MOVING),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return false;
@@ -2705,7 +2719,7 @@ WMError SessionProxy::SetSystemWindowEnableDrag(bool enableDrag)
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SYSTEM_DRAG_ENABLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
@@ -2733,7 +2747,7 @@ WSError SessionProxy::UpdateRectChangeListenerRegistered(bool isRegister)
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_RECTCHANGE_LISTENER_REGISTERED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
@@ -2761,7 +2775,7 @@ void SessionProxy::SetCallingSessionId(const uint32_t callingSessionId)
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_CALLING_SESSION_ID),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2788,7 +2802,7 @@ void SessionProxy::SetCustomDecorHeight(int32_t height)
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_CUSTOM_DECOR_HEIGHT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_CUSTOM_DECOR_HEIGHT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_DECOR, "SendRequest failed");
         return;
@@ -2813,7 +2827,7 @@ WSError SessionProxy::SetDecorVisible(bool isVisible)
     }
     MessageParcel reply;
     MessageOption option(MessageOption::TF_ASYNC);
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_DECOR_VISIBLE), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_DECOR, "Failed to send request, error = %{public}d", sendRet);
@@ -2840,7 +2854,7 @@ WSError SessionProxy::AdjustKeyboardLayout(const KeyboardLayoutParams& params)
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_ADJUST_KEYBOARD_LAYOUT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2868,7 +2882,7 @@ WSError SessionProxy::ChangeKeyboardEffectOption(const KeyboardEffectOption& eff
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CHANGE_KEYBOARD_VIEW_MODE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2913,7 +2927,7 @@ WMError SessionProxy::UpdateSessionPropertyByAction(const sptr<WindowSessionProp
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SessionInterfaceCode::TRANS_ID_UPDATE_SESSION_PROPERTY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
@@ -2937,7 +2951,7 @@ WMError SessionProxy::GetAppForceLandscapeConfig(AppForceLandscapeConfig& config
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_FORCE_LANDSCAPE_CONFIG),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -2967,7 +2981,7 @@ WMError SessionProxy::GetForceSplitEnable(bool& enable)
         return WMError::WM_ERROR_IPC_FAILED;
     }
     uint32_t requestCode = static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_FORCE_SPLIT_ENABLE);
-    if (remote->SendRequest(requestCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, requestCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2999,7 +3013,7 @@ WMError SessionProxy::GetSelectMode(SelectMode& selectMode)
         return WMError::WM_ERROR_IPC_FAILED;
     }
     uint32_t requestCode = static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_SELECT_MODE);
-    if (remote->SendRequest(requestCode, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, requestCode, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -3033,7 +3047,7 @@ void SessionProxy::NotifyWindowStatusDidChangeAfterShowWindow()
         return;
     }
     uint32_t requestCode = static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_WINDOW_STATUS_AFTER_SHOW_WINDOW);
-    int ret = remote->SendRequest(requestCode, data, reply, option);
+    int ret = SendIpcRequest(remote, requestCode, data, reply, option);
     if (ret != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed, ret: %{public}d", ret);
     }
@@ -3057,7 +3071,7 @@ WSError SessionProxy::SetDialogSessionBackGestureEnabled(bool isEnabled)
         TLOGE(WmsLogTag::WMS_DIALOG, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_DIALOG_SESSION_BACKGESTURE_ENABLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_DIALOG, "SendRequest failed");
@@ -3082,7 +3096,7 @@ int32_t SessionProxy::GetStatusBarHeight()
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return height;
     }
-    int sendCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_STATUSBAR_HEIGHT),
+    int sendCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_STATUSBAR_HEIGHT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_IMMS, "SendRequest failed, code: %{public}d", sendCode);
@@ -3110,7 +3124,7 @@ void SessionProxy::NotifyExtensionEventAsync(uint32_t notifyEvent)
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_EVENT_ASYNC), data, reply, option);
     if (sendCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, code: %{public}d", sendCode);
@@ -3135,7 +3149,7 @@ void SessionProxy::NotifyExtensionDetachToDisplay()
         return;
     }
 
-    auto ret = remote->SendRequest(
+    auto ret = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_EXTENSION_DETACH_TO_DISPLAY), data, reply, option);
     if (ret != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "UIExtOnLock: SendRequest failed, ret code: %{public}u", ret);
@@ -3150,7 +3164,7 @@ WSError SessionProxy::SendExtensionData(MessageParcel& data, MessageParcel& repl
         return WSError::WS_ERROR_IPC_FAILED;
     }
 
-    auto ret = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_EXTENSION_DATA), data,
+    auto ret = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_EXTENSION_DATA), data,
                                    reply, option);
     if (ret != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed, ret code: %{public}u", ret);
@@ -3178,7 +3192,7 @@ WMError SessionProxy::SetGestureBackEnabled(bool isEnabled)
         TLOGE(WmsLogTag::WMS_IMMS, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_GESTURE_BACK_ENABLE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_IMMS, "SendRequest failed");
@@ -3206,7 +3220,7 @@ WMError SessionProxy::SetFloatNavigationEnabled(bool isEnabled)
         TLOGE(WmsLogTag::WMS_IMMS, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FLOAT_NAVIGATION_AVOID_AREA_ENABLED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_IMMS, "SendRequest failed");
@@ -3234,7 +3248,7 @@ WSError SessionProxy::NotifySubModalTypeChange(SubWindowModalType subWindowModal
         TLOGE(WmsLogTag::WMS_HIERARCHY, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SUB_MODAL_TYPE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SUB_MODAL_TYPE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_HIERARCHY, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3260,7 +3274,7 @@ WSError SessionProxy::NotifyMainModalTypeChange(bool isModal)
         TLOGE(WmsLogTag::WMS_HIERARCHY, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_MAIN_MODAL_TYPE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_MAIN_MODAL_TYPE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_HIERARCHY, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3292,7 +3306,7 @@ WSError SessionProxy::OnSetWindowRectAutoSave(bool enabled, bool isSaveBySpecifi
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_RECT_AUTO_SAVE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_RECT_AUTO_SAVE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MAIN, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3330,7 +3344,7 @@ WSError SessionProxy::NotifySupportWindowModesChange(
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SUPPORT_WINDOW_MODES),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SUPPORT_WINDOW_MODES),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3361,7 +3375,7 @@ WSError SessionProxy::SetSessionLabelAndIcon(const std::string& label, const std
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SESSION_LABEL_AND_ICON),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SESSION_LABEL_AND_ICON),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MAIN, "sendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3393,7 +3407,7 @@ WSError SessionProxy::SetWindowCornerRadius(float cornerRadius)
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_CORNER_RADIUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_CORNER_RADIUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3422,7 +3436,7 @@ WSError SessionProxy::SetWindowShadows(const ShadowsInfo& shadowsInfo)
         TLOGE(WmsLogTag::WMS_ANIMATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_SHADOWS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_SHADOWS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3453,7 +3467,7 @@ WSError SessionProxy::RecoverWindowEffect(bool recoverCorner, bool recoverShadow
         TLOGE(WmsLogTag::WMS_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto sendRet = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RECOVER_WINDOW_EFFECT),
+    auto sendRet = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RECOVER_WINDOW_EFFECT),
         data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed, code: %{public}d", sendRet);
@@ -3481,7 +3495,7 @@ WSError SessionProxy::SetFollowParentWindowLayoutEnabled(bool isFollow)
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FOLLOW_PARENT_LAYOUT_ENABLED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FOLLOW_PARENT_LAYOUT_ENABLED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3512,7 +3526,7 @@ WSError SessionProxy::SetWindowAnchorInfo(const WindowAnchorInfo& windowAnchorIn
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_ANCHOR_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_ANCHOR_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3540,7 +3554,7 @@ WSError SessionProxy::KeyFrameAnimateEnd()
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_KEY_FRAME_ANIMATE_END),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_KEY_FRAME_ANIMATE_END),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3576,7 +3590,7 @@ WSError SessionProxy::SetWindowTransitionAnimation(WindowTransitionType transiti
         TLOGE(WmsLogTag::WMS_ANIMATION, "Remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_TRANSITION_ANIMATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_WINDOW_TRANSITION_ANIMATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3612,7 +3626,7 @@ WSError SessionProxy::UpdateKeyFrameCloneNode(std::shared_ptr<RSWindowKeyFrameNo
         TLOGE(WmsLogTag::WMS_LAYOUT, "write rsTransaction failed");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_KEY_FRAME_CLONE_NODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_KEY_FRAME_CLONE_NODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3643,7 +3657,7 @@ WSError SessionProxy::SetDragKeyFramePolicy(const KeyFramePolicy& keyFramePolicy
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_DRAG_KEY_FRAME_POLICY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_DRAG_KEY_FRAME_POLICY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3682,7 +3696,7 @@ WMError SessionProxy::StartMovingWithOptions(const StartMovingOptions& options)
 
     MessageParcel reply;
     MessageOption option(MessageOption::TF_SYNC);
-    int sendRet = remote->SendRequest(
+    int sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_START_MOVING_WITH_OPTIONS), data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "Failed to send request, error = %{public}d", sendRet);
@@ -3728,7 +3742,7 @@ WSError SessionProxy::StartMovingWithCoordinate(int32_t offsetX, int32_t offsetY
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_START_MOVING_WITH_COORDINATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_START_MOVING_WITH_COORDINATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3750,7 +3764,7 @@ WSError SessionProxy::GetCrossAxisState(CrossAxisState& state)
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_CROSS_AXIS_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_CROSS_AXIS_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT_PC, "sendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3778,7 +3792,7 @@ WSError SessionProxy::GetWaterfallMode(bool& isWaterfallMode)
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_WATERFALL_MODE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_WATERFALL_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "sendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3802,7 +3816,7 @@ WMError SessionProxy::IsMainWindowFullScreenAcrossDisplays(bool& isAcrossDisplay
         return WMError::WM_ERROR_IPC_FAILED;
     }
     uint32_t code = static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_MAIN_WINDOW_FULL_SCREEN_ACROSS_DISPLAYS);
-    if (remote->SendRequest(code, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, code, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "sendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -3840,7 +3854,7 @@ WSError SessionProxy::OnContainerModalEvent(const std::string& eventName, const
         TLOGE(WmsLogTag::WMS_EVENT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONTAINER_MODAL_EVENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_CONTAINER_MODAL_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3866,7 +3880,8 @@ WSError SessionProxy::NotifyFollowParentMultiScreenPolicy(bool enabled)
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FOLLOW_PARENT_MULTI_SCREEN_POLICY),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FOLLOW_PARENT_MULTI_SCREEN_POLICY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -3892,7 +3907,7 @@ void SessionProxy::NotifyKeyboardWillShowRegistered(bool registered)
         TLOGE(WmsLogTag::WMS_KEYBOARD, "Remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_KEYBOARD_WILL_SHOW_REGISTERED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3918,7 +3933,7 @@ void SessionProxy::NotifyKeyboardWillHideRegistered(bool registered)
         TLOGE(WmsLogTag::WMS_KEYBOARD, "Remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_KEYBOARD_WILL_HIDE_REGISTERED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3944,7 +3959,7 @@ void SessionProxy::NotifyKeyboardDidShowRegistered(bool registered)
         TLOGE(WmsLogTag::WMS_KEYBOARD, "Remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_KEYBOARD_DID_SHOW_REGISTERED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3970,7 +3985,7 @@ void SessionProxy::NotifyKeyboardDidHideRegistered(bool registered)
         TLOGE(WmsLogTag::WMS_KEYBOARD, "Remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_KEYBOARD_DID_HIDE_REGISTERED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3999,7 +4014,7 @@ WSError SessionProxy::UpdatePiPTemplateInfo(PiPTemplateInfo& pipTemplateInfo)
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_TEMPLATE_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_PIP_TEMPLATE_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4031,7 +4046,7 @@ WSError SessionProxy::SetPipParentWindowId(uint32_t windowId)
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_PIP_PARENT_WINDOWID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_PIP_PARENT_WINDOWID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4058,7 +4073,7 @@ WMError SessionProxy::IsPiPActive(bool& status)
         TLOGE(WmsLogTag::WMS_PIP, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_IS_PIP_ACTIVE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_IS_PIP_ACTIVE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4097,7 +4112,7 @@ WSError SessionProxy::UpdateRotationChangeRegistered(int32_t persistentId, bool
         TLOGE(WmsLogTag::WMS_ROTATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_ROTATION_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
@@ -4125,7 +4140,7 @@ WSError SessionProxy::UpdateFlag(const std::string& flag)
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_FLAG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MAIN, "SendRequest failed");
@@ -4156,7 +4171,7 @@ WMError SessionProxy::UpdateScreenshotAppEventRegistered(int32_t persistentId, b
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_SCREEN_SHOT_APP_EVENT_REGISTERED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -4189,7 +4204,7 @@ WMError SessionProxy::UpdateAcrossDisplaysChangeRegistered(bool isRegister)
         return WMError::WM_ERROR_IPC_FAILED;
     }
     uint32_t code = static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_ACROSS_DISPLAYS_REGISTERED);
-    if (remote->SendRequest(code, data, reply, option) != ERR_NONE) {
+    if (SendIpcRequest(remote, code, data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -4219,7 +4234,7 @@ WSError SessionProxy::RequestFocus(bool isFocused)
         TLOGE(WmsLogTag::WMS_FOCUS, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_REQUEST_FOCUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -4243,7 +4258,7 @@ WSError SessionProxy::GetIsHighlighted(bool& isHighlighted)
         TLOGE(WmsLogTag::WMS_FOCUS, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_GET_IS_HIGHLIGHTED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -4271,7 +4286,7 @@ WMError SessionProxy::NotifyDisableDelegatorChange()
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_DISABLE_DELEGATOR_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -4303,7 +4318,7 @@ void SessionProxy::NotifyWindowAttachStateListenerRegistered(bool registered)
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_WINDOW_ATTACH_STATE_LISTENER_REGISTERED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4330,7 +4345,7 @@ WSError OHOS::Rosen::SessionProxy::UseImplicitAnimation(bool useImplicit)
         TLOGE(WmsLogTag::WMS_PC, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_USE_IMPLICT_ANIMATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
@@ -4363,7 +4378,7 @@ WSError SessionProxy::SetSubWindowSource(SubWindowSource source)
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SUBWINDOW_SOURCE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_SUBWINDOW_SOURCE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4397,7 +4412,7 @@ WSError SessionProxy::SetFrameRectForPartialZoomIn(const Rect& frameRect)
         TLOGE(WmsLogTag::WMS_ANIMATION, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FRAMERECT_FOR_PARTIAL_ZOOMIN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SET_FRAMERECT_FOR_PARTIAL_ZOOMIN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4425,7 +4440,7 @@ void SessionProxy::NotifyFloatingBallPrepareClose()
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return;
     }
-    auto errCode = remote->SendRequest(
+    auto errCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_FLOATING_BALL_PREPARE_CLOSE), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -4448,7 +4463,7 @@ void SessionProxy::NotifyFloatViewPrepareClose()
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return;
     }
-    auto errCode = remote->SendRequest(
+    auto errCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_FLOAT_VIEW_PREPARE_CLOSE), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -4474,7 +4489,7 @@ WMError SessionProxy::UpdateFloatView(const OHOS::Rosen::FloatViewTemplateInfo&
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto errCode = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_FLOAT_VIEW),
+    auto errCode = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_UPDATE_FLOAT_VIEW),
                                        data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed code: %{public}d", errCode);
@@ -4506,7 +4521,7 @@ WMError SessionProxy::RestoreFloatViewMainWindow(const std::shared_ptr<AAFwk::Wa
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RESTORE_FLOAT_VIEW_MAIN_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
@@ -4538,7 +4553,8 @@ WSError SessionProxy::NotifyIsFullScreenInForceSplitMode(bool isFullScreen)
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_IS_FULL_SCREEN_IN_FORCE_SPLIT),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_IS_FULL_SCREEN_IN_FORCE_SPLIT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4569,7 +4585,7 @@ WMError SessionProxy::NotifySplitRatioChanged(float newRatio)
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_SPLIT_RATIO_CHANGED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_SPLIT_RATIO_CHANGED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4600,7 +4616,7 @@ WSError SessionProxy::NotifyCompatibleModeChange(CompatibleStyleMode mode)
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_COMPATIBLE_MODE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_COMPATIBLE_MODE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_COMPAT, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4628,7 +4644,7 @@ WSError SessionProxy::NotifyPageEnable(const std::string& action, const std::str
         TLOGE(WmsLogTag::WMS_COMPAT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_PAGE_ENABLE),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4658,7 +4674,7 @@ WSError SessionProxy::NotifyAttachedWindowsLimitsChanged(const WindowLimits& new
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_NOTIFY_RELATED_WINDOWS_LIMITS_CHANGED),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4690,7 +4706,7 @@ WSError SessionProxy::RestartApp(const std::shared_ptr<AAFwk::Want>& want)
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto errCode = remote->SendRequest(
+    auto errCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_RESTART_APP), data, reply, option);
     if (errCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed code: %{public}d", errCode);
@@ -4729,7 +4745,7 @@ WMError SessionProxy::SendCommonEvent(int32_t command, const std::vector<int32_t
         TLOGE(WmsLogTag::WMS_EVENT, "Remote is null.");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto sendRet = remote->SendRequest(static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_COMMAND_EVENT),
+    auto sendRet = SendIpcRequest(remote, static_cast<uint32_t>(SessionInterfaceCode::TRANS_ID_SEND_COMMAND_EVENT),
         data, reply, option);
     if (sendRet != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "Send request failed.code: %{public}d", sendRet);
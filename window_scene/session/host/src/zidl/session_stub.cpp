@@ -24,6 +24,7 @@
 #include "pointer_event.h"
 #include "key_event.h"
 
+#include "common/include/latency_histogram.h"
 #include "parcel/accessibility_event_info_parcel.h"
 #include "process_options.h"
 #include "start_window_option.h"
@@ -126,6 +127,8 @@ int SessionStub::OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParc
         return ERR_TRANSACTION_FAILED;
     }
 
+    static IpcLatencyTable latencyTable("Session");
+    IpcLatencyScope latencyScope(latencyTable, code, data, reply);
     return ProcessRemoteRequest(code, data, reply, option);
 }
 
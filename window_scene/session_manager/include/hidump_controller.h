@@ -26,6 +26,7 @@ WM_DECLARE_SINGLE_INSTANCE(HidumpController)
 public:
     void GetAllSessionDumpDetailedInfo(std::ostringstream& oss,
         const std::vector<sptr<SceneSession>>& allSession, const std::vector<sptr<SceneSession>>& backgroundSession);
+    void DumpLatencyHistogram(const std::vector<std::string>& params, std::string& dumpInfo);
 
 private:
     void DumpSceneSessionParamList(std::ostringstream& oss);
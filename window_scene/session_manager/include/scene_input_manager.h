@@ -67,17 +67,31 @@ public:
 
     void SetIsRotationBegin(bool isRotationBegin);
 
+    /*
+     * MMI client the window info is flushed to, tests replace it before the first flush
+     */
+    class MMIClient {
+    public:
+        virtual ~MMIClient() = default;
+        virtual int32_t UpdateDisplayInfo(const MMI::UserScreenInfo& userScreenInfo);
+        virtual int32_t UpdateWindowInfo(const MMI::WindowGroupInfo& windowGroupInfo);
+    };
+    void SetMMIClient(const std::shared_ptr<MMIClient>& mmiClient);
+
 protected:
     SceneInputManager() = default;
     virtual ~SceneInputManager() = default;
 
 private:
     void UpdateFocusedSessionId(int32_t focusedSessionId);
+    /*
+     * Sends the first windowCount slots of windowInfoList, they are moved into the display groups and back.
+     */
     void FlushFullInfoToMMI(const std::vector<MMI::ScreenInfo>& screenInfos,
         std::map<DisplayGroupId, MMI::DisplayGroupInfo>& displayGroupMap,
-        const std::vector<MMI::WindowInfo>& windowInfoList,
+        std::vector<MMI::WindowInfo>& windowInfoList, size_t windowCount,
         const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList, bool isOverBatchSize = false);
-    void FlushChangeInfoToMMI(const std::map<uint64_t, std::vector<MMI::WindowInfo>>& screenId2Windows);
+    void FlushChangeInfoToMMI(std::map<uint64_t, std::vector<MMI::WindowInfo>>& screenId2Windows);
 
     /**
      * Filter screens and windows currently in use.
@@ -96,7 +110,7 @@ private:
     void PrintWindowInfo(const std::vector<MMI::WindowInfo>& windowInfoList);
     void UpdateDisplayAndWindowInfo(const std::vector<MMI::ScreenInfo>& screenInfos,
         std::map<DisplayGroupId, MMI::DisplayGroupInfo>& displayGroupMap,
-        std::vector<MMI::WindowInfo> windowInfoList,
+        std::vector<MMI::WindowInfo>& windowInfoList,
         const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList);
     void ConstructDumpDisplayInfo(const MMI::DisplayInfo& displayInfo,
         std::ostringstream& dumpDisplayListStream);
@@ -107,6 +121,7 @@ private:
     std::shared_ptr<SceneSessionDirtyManager> sceneSessionDirty_;
     std::shared_ptr<AppExecFwk::EventRunner> eventLoop_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::shared_ptr<MMIClient> mmiClient_ = std::make_shared<MMIClient>();
     std::vector<MMI::ScreenInfo> lastScreenInfos_;
     std::vector<MMI::DisplayInfo> lastDisplayInfos_;
     std::vector<MMI::WindowInfo> lastWindowInfoList_;
@@ -63,6 +63,11 @@ public:
     void NotifyWindowInfoChange(const sptr<SceneSession>& sceneSession,
         const WindowUpdateType& type, const bool startMoving = false);
     FullInfoForMMI GetFullWindowInfoList();
+
+    /*
+     * Give back the lists of a flush once they have been sent, the next flush refills their slots in place.
+     */
+    void RecycleFullWindowInfoList(FullInfoForMMI&& fullInfo);
     void RegisterFlushWindowInfoCallback(FlushWindowInfoCallback&& callback);
     void ResetSessionDirty();
     void UpdateSecSurfaceInfo(const std::map<uint64_t, std::vector<SecSurfaceInfo>>& secSurfaceInfoMap);
@@ -76,17 +81,37 @@ public:
         std::vector<MMI::Rect>& dragDisabledAreas) const;
 
 private:
+    /*
+     * The transform of a session and its inverse, valid while the hash of the transform inputs is unchanged.
+     */
+    struct WindowTransformCache {
+        uint64_t hash_ = 0;
+        Matrix3f transform_;
+        Matrix3f inverseTransform_;
+    };
+
     std::vector<MMI::WindowInfo> FullSceneSessionInfoUpdate() const;
     bool IsFilterSession(const sptr<SceneSession>& sceneSession) const;
     std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> GetWindowInfo(const sptr<SceneSession>& sceneSession,
         const WindowAction& action) const;
+    /*
+     * Fill a reused slot, the vectors of the slot are cleared and refilled so they keep their capacity.
+     */
+    bool FillWindowInfo(const sptr<SceneSession>& sceneSession, const WindowAction& action,
+        MMI::WindowInfo& windowInfo, std::shared_ptr<Media::PixelMap>& pixelMap) const;
     SingleHandData GetSingleHandData(const sptr<SceneSession>& sceneSession) const;
     void CalNotRotateTransform(const sptr<SceneSession>& sceneSession, Matrix3f& transform,
         bool useUIExtension = false) const;
     void CalSpecialNotRotateTransform(const sptr<SceneSession>& sceneSession, ScreenProperty& screenProperty,
         Matrix3f& transform, bool useUIExtension = false) const;
     void CalTransform(const sptr<SceneSession>& sceneSession, Matrix3f& transform,
-        const SingleHandData& singleHandData, bool useUIExtension = false) const;
+        const SingleHandData& singleHandData, bool useUIExtension = false,
+        Matrix3f* inverseTransform = nullptr) const;
+    uint64_t GetWindowTransformHash(const sptr<SceneSession>& sceneSession, const ScreenProperty& screenProperty,
+        const SingleHandData& singleHandData, bool useUIExtension) const;
+    void CalTransformInner(const sptr<SceneSession>& sceneSession, ScreenProperty* screenPropertyPtr,
+        Matrix3f& transform, const SingleHandData& singleHandData, bool useUIExtension) const;
+    void PruneTransformCache(const std::map<int32_t, sptr<SceneSession>>& sessionMap) const;
     void UpdatePrivacyMode(const sptr<SceneSession>& sceneSession,
         MMI::WindowInfo& windowInfo) const;
     std::map<int32_t, sptr<SceneSession>> GetDialogSessionMap(
@@ -108,13 +133,13 @@ private:
     void GetModalUIExtensionInfo(std::vector<MMI::WindowInfo>& windowInfoList,
         const sptr<SceneSession>& sceneSession, const MMI::WindowInfo& hostWindowInfo);
     std::vector<MMI::WindowInfo> GetSecSurfaceWindowinfoList(const sptr<SceneSession>& sceneSession,
-        const MMI::WindowInfo& hostWindowinfo, const Matrix3f& hostTransform) const;
+        const MMI::WindowInfo& hostWindowinfo, const Matrix3f& hostInverseTransform) const;
     MMI::WindowInfo GetSecComponentWindowInfo(const SecSurfaceInfo& secSurfaceInfo,
         const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession,
-        const Matrix3f hostTransform) const;
+        const Matrix3f hostInverseTransform) const;
     MMI::WindowInfo GetHostComponentWindowInfo(const SecSurfaceInfo& secSurfaceInfo,
         const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession,
-        const Matrix3f hostTransform) const;
+        const Matrix3f hostInverseTransform) const;
     MMI::WindowInfo MakeWindowInfoFormHostWindow(const MMI::WindowInfo& hostWindowinfo) const;
     void ResetFlushWindowInfoTask();
     void CheckIfUpdatePointAreas(WindowType windowType, const sptr<SceneSession>& sceneSession,
@@ -128,6 +153,12 @@ private:
     std::atomic_bool hasPostTask_ { false };
     std::map<uint64_t, std::vector<SecSurfaceInfo>> secSurfaceInfoMap_;
     std::map<uint64_t, std::vector<SecSurfaceInfo>> constrainedModalUIExtInfoMap_;
+    // keyed by persistent id and useUIExtension, entries of destroyed sessions are pruned on each full update
+    mutable std::mutex transformCacheMutex_;
+    mutable std::map<std::pair<int32_t, bool>, WindowTransformCache> transformCache_;
+    // lists of the last flush given back by the consumer, taken by the next flush
+    std::mutex fullInfoArenaMutex_;
+    FullInfoForMMI fullInfoArena_;
 };
 } //namespace OHOS::Rosen
 
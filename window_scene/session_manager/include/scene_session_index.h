@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_INDEX_H
+#define OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_INDEX_H
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "session/host/include/scene_session.h"
+
+namespace OHOS::Rosen {
+/**
+ * @brief Loops over the sessions answered from SceneSessionIndex, counted for the dump.
+ */
+enum class SessionIndexLoop : uint32_t {
+    FLUSH_UI_PARAMS = 0,
+    SESSIONS_BY_TYPE,
+    SESSIONS_BY_TYPE_AND_DISPLAY,
+    KEYBOARD_SESSION,
+    LOOP_END,
+};
+
+/**
+ * @brief Secondary indices of the scene sessions by screen id and by window type.
+ *
+ * Sessions are added and removed only by the SceneSessionMap owning the index, screen moves are reported by the
+ * session. A session is looked up with the screen id of its SessionInfo, a caller filtering by the display id of
+ * the property still checks it on the sessions it gets. Every bucket is ordered by persistentId like the map.
+ */
+class SceneSessionIndex {
+public:
+    void UpdateScreenId(int32_t persistentId, ScreenId screenId);
+    size_t Size() const;
+
+    /**
+     * @brief Append the sessions of the screen to sessions.
+     */
+    void GetSessionsByScreen(ScreenId screenId, std::vector<sptr<SceneSession>>& sessions) const;
+
+    /**
+     * @brief Append the sessions of all the screens to sessions, in persistentId order across the screens.
+     */
+    void GetSessionsByScreens(const std::vector<ScreenId>& screenIds, std::vector<sptr<SceneSession>>& sessions) const;
+
+    /**
+     * @brief Append the sessions of the window type to sessions.
+     */
+    void GetSessionsByType(WindowType type, std::vector<sptr<SceneSession>>& sessions) const;
+
+    /**
+     * @brief Count one run of a loop.
+     *
+     * @param total Sessions in the map, the ones a full walk would visit.
+     * @param visited Sessions the loop got from the index.
+     * @param matched Sessions the loop acted on.
+     */
+    void RecordLoop(SessionIndexLoop loop, size_t total, size_t visited, size_t matched);
+    void DumpLoopStats(std::ostringstream& oss) const;
+    void ResetLoopStats();
+
+private:
+    friend class SceneSessionMap;
+
+    struct Entry {
+        sptr<SceneSession> session_;
+        ScreenId screenId_ = SCREEN_ID_INVALID;
+        WindowType type_ = WindowType::APP_MAIN_WINDOW_BASE;
+    };
+
+    struct LoopStats {
+        std::atomic<uint64_t> count_ { 0 };
+        std::atomic<uint64_t> total_ { 0 };
+        std::atomic<uint64_t> visited_ { 0 };
+        std::atomic<uint64_t> matched_ { 0 };
+    };
+
+    void Add(int32_t persistentId, const sptr<SceneSession>& sceneSession);
+    void Remove(int32_t persistentId);
+    void Rebuild(const std::map<int32_t, sptr<SceneSession>>& sceneSessionMap);
+    static Entry MakeEntry(const sptr<SceneSession>& sceneSession);
+    void AddLocked(int32_t persistentId, Entry&& entry);
+    void RemoveLocked(int32_t persistentId);
+
+    mutable std::mutex mutex_;
+    std::map<int32_t, Entry> entries_;
+    std::unordered_map<ScreenId, std::map<int32_t, sptr<SceneSession>>> screenSessions_;
+    std::unordered_map<WindowType, std::map<int32_t, sptr<SceneSession>>> typeSessions_;
+    std::array<LoopStats, static_cast<size_t>(SessionIndexLoop::LOOP_END)> loopStats_;
+};
+
+/**
+ * @brief The scene sessions by persistentId, with the SceneSessionIndex of them.
+ *
+ * Every insert and erase of a session also updates the index, so the index holds the sessions of the map at any
+ * time. Guarded by the lock of the owner like a plain map, iteration only gives const access to the sessions.
+ */
+class SceneSessionMap {
+public:
+    using MapType = std::map<int32_t, sptr<SceneSession>>;
+    using value_type = MapType::value_type;
+    using size_type = MapType::size_type;
+    using iterator = MapType::const_iterator;
+    using const_iterator = MapType::const_iterator;
+
+    SceneSessionMap() = default;
+    SceneSessionMap(const SceneSessionMap& other);
+    SceneSessionMap& operator=(const SceneSessionMap& other);
+    SceneSessionMap& operator=(const MapType& sceneSessionMap);
+    operator const MapType&() const { return map_; }
+
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator end() const { return map_.end(); }
+    const_iterator find(int32_t persistentId) const { return map_.find(persistentId); }
+    size_type count(int32_t persistentId) const { return map_.count(persistentId); }
+    size_type size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
+
+    std::pair<const_iterator, bool> insert(const value_type& value) { return emplace(value); }
+
+    template <typename Pair>
+    std::pair<const_iterator, bool> insert(Pair&& value) { return emplace(std::forward<Pair>(value)); }
+
+    template <typename... Args>
+    std::pair<const_iterator, bool> emplace(Args&&... args)
+    {
+        auto result = map_.emplace(std::forward<Args>(args)...);
+        if (result.second) {
+            index_.Add(result.first->first, result.first->second);
+        }
+        return result;
+    }
+
+    std::pair<const_iterator, bool> insert_or_assign(int32_t persistentId, const sptr<SceneSession>& sceneSession);
+    size_type erase(int32_t persistentId);
+    const_iterator erase(const_iterator iter);
+    void clear();
+
+    SceneSessionIndex& GetIndex() { return index_; }
+    const SceneSessionIndex& GetIndex() const { return index_; }
+
+private:
+    MapType map_;
+    SceneSessionIndex index_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_SCENE_SESSION_INDEX_H
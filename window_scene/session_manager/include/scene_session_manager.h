@@ -52,11 +52,14 @@
 #include "session/host/include/root_scene_session.h"
 #include "session_listener_controller.h"
 #include "ffrt_queue_helper.h"
+#include "session_manager/include/scene_session_index.h"
+#include "session_manager/include/window_hit_index.h"
 #include "session_manager/include/window_manager_lru.h"
 #include "session_manager/include/zidl/scene_session_manager_stub.h"
 #include "thread_safety_annotations.h"
 #include "transaction/rs_interfaces.h"
 #include "window_focus_controller.h"
+#include "window_property_change_batch.h"
 #include "window_scene_config.h"
 #include "wm_single_instance.h"
 #include "zidl/session_lifecycle_listener_interface.h"
@@ -153,6 +156,7 @@ using RootSceneProcessBackEventFunc = std::function<void()>;
 using ProcessCloseTargetFloatWindowFunc = std::function<void(const std::string& bundleName)>;
 using AbilityManagerCollaboratorRegisteredFunc = std::function<void()>;
 using OnFlushUIParamsFunc = std::function<void()>;
+using ScreenUIParamMap = std::unordered_map<ScreenId, std::unordered_map<int32_t, SessionUIParam>>;
 using IsRootSceneLastFrameLayoutFinishedFunc = std::function<bool()>;
 using NotifyStartPiPFailedFunc = std::function<void(DisplayId displayId)>;
 using NotifyAppUseControlListFunc =
@@ -703,6 +707,8 @@ public:
     WMError UnregisterWindowPropertyChangeAgent(WindowInfoKey windowInfoKey, uint32_t interestInfo,
         const sptr<IWindowManagerAgent>& windowManagerAgent, int32_t instanceUserId = INVALID_USER_ID) override;
     WMError RecoverWindowPropertyChangeFlag(uint32_t observedFlags, uint32_t interestedFlags) override;
+    WMError SetWindowManagerAgentFilter(WindowManagerAgentType type, const WindowManagerAgentFilter& filter,
+        const sptr<IWindowManagerAgent>& windowManagerAgent) override;
     WMError GetAllWindowLayoutInfo(DisplayId displayId, std::vector<sptr<WindowLayoutInfo>>& infos,
         const WindowInfoOptions& option = WindowInfoOptions(), bool useHookedSize = true) override;
     WMError SetWindowSnapshotSkip(int32_t windowId, bool isSkip) override;
@@ -1414,6 +1420,7 @@ private:
     bool IsNeedUpdateBrightness(int32_t persistentId, float brightness);
     void UpdateSessionDisplayIdBySessionInfo(sptr<SceneSession> sceneSession, const SessionInfo& sessionInfo);
     WSError RegisterSessionPropertyChangeNotifyManagerFunc(const sptr<SceneSession>& sceneSession);
+    void RegisterPropertyDirtyNotifyManagerFunc(const sptr<SceneSession>& sceneSession);
     WSError NotifySessionPropertyChangeFromSession(int32_t persistentId, WindowInfoKey windowInfoKey);
     WMError GetRootUIContentRemoteObjInner(DisplayId displayId, sptr<IRemoteObject>& uiContentRemoteObj);
 
@@ -1431,6 +1438,7 @@ private:
     void DestroyExtensionSession(const sptr<IRemoteObject>& remoteExtSession, bool isConstrainedModal = false);
     void EraseSceneSessionMapById(int32_t persistentId);
     void EraseSceneSessionAndMarkDirtyLocked(int32_t persistentId);
+    void UpdateWindowHitIndex(const sptr<SceneSession>& sceneSession);
     WSError GetAbilityInfosFromBundleInfo(const std::vector<AppExecFwk::BundleInfo>& bundleInfos,
         std::vector<SCBAbilityInfo>& scbAbilityInfos, int32_t userId = 0);
     void GetOrientationFromResourceManager(AppExecFwk::AbilityInfo& abilityInfo);
@@ -1525,7 +1533,8 @@ private:
     sptr<RootSceneSession> rootSceneSession_;
     std::weak_ptr<AbilityRuntime::Context> rootSceneContextWeak_;
     mutable std::shared_mutex sceneSessionMapMutex_;
-    std::map<int32_t, sptr<SceneSession>> sceneSessionMap_;
+    // sessions by persistentId, with the index of them by screen and by type
+    SceneSessionMap sceneSessionMap_;
     std::map<int32_t, sptr<SceneSession>> systemTopSceneSessionMap_;
     std::map<int32_t, sptr<SceneSession>> nonSystemFloatSceneSessionMap_;
     sptr<ScbSessionHandler> scbSessionHandler_;
@@ -1715,6 +1724,20 @@ private:
 
     std::vector<uint64_t> skipSurfaceNodeIds_;
     std::atomic_bool processingFlushUIParams_ { false };
+    void ProcessFlushUIParams(const ScreenUIParamMap& screenUIParams);
+    std::vector<std::pair<DisplayId, WSRect>> CollectDirtyAvoidAreasLocked(bool& isAllAvoidAreasDirty);
+    void AddPendingUIParams(ScreenId screenId, std::unordered_map<int32_t, SessionUIParam>&& uiParams);
+    void FlushPendingUIParams();
+    /*
+     * ui params of every screen received before the flush task runs, so a vsync with several screens is
+     * processed in one pass. A screen reporting again before the task runs replaces its pending frame.
+     */
+    bool isFlushUIParamsBatchEnabled_ = true;
+    std::mutex pendingUIParamsMutex_;
+    ScreenUIParamMap pendingUIParams_;
+    bool isFlushUIParamsTaskPending_ = false;
+    // avoid area windows changed since the last flush, the query states of the sessions they cover are republished
+    std::unordered_set<int32_t> dirtyAvoidProviderIds_;
 
     /*
      * PiP Window
@@ -1867,6 +1890,8 @@ private:
     std::unordered_set<std::string> snapshotSkipBundleNameSet_ GUARDED_BY(SCENE_GUARD);
 
     uint32_t sessionMapDirty_ { 0 };
+    // rects and hot areas of the windows per display, synced at the end of every FlushUIParams
+    WindowHitIndex windowHitIndex_;
     std::condition_variable nextFlushCompletedCV_;
     std::mutex nextFlushCompletedMutex_;
     RootSceneProcessBackEventFunc rootSceneProcessBackEventFunc_ = nullptr;
@@ -1961,8 +1986,16 @@ private:
     void NotifyWindowPropertyChangeByWindowInfoKey(
         const sptr<SceneSession>& sceneSession, WindowInfoKey windowInfoKey);
     void NotifyWindowPropertyChange(ScreenId screenId);
-    void PackWindowPropertyChangeInfo(const sptr<SceneSession>& sceneSession,
-        std::unordered_map<WindowInfoKey, WindowChangeInfoType>& windowPropertyChangeInfo);
+    void NotifyWindowPropertyChange(const std::vector<ScreenId>& screenIds);
+    void PackWindowPropertyChangeRecord(const sptr<SceneSession>& sceneSession, WindowPropertyChangeBatch& batch);
+    void AddPropertyDirtySession(int32_t persistentId);
+    std::vector<int32_t> TakePropertyDirtySessions();
+    std::mutex propertyDirtySessionIdsMutex_;
+    std::unordered_set<int32_t> propertyDirtySessionIds_;
+    // observed flags are added, the sessions dirty before are not in the dirty set, scan all sessions once
+    std::atomic<bool> needScanAllPropertyDirty_ { false };
+    // reused for every flush on the main thread
+    WindowPropertyChangeBatch propertyChangeBatch_;
     WMError AddSessionBlackListForSession(int32_t persistentId,
         const std::unordered_set<std::string>& privacyWindowTags);
     WMError RemoveSessionBlackListForSession(int32_t persistentId,
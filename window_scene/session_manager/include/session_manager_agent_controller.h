@@ -16,6 +16,7 @@
 #ifndef OHOS_ROSEN_SESSION_MANAGER_AGENT_CONTROLLER_H
 #define OHOS_ROSEN_SESSION_MANAGER_AGENT_CONTROLLER_H
 #include <mutex>
+#include <unordered_map>
 
 #include "client_agent_container.h"
 #include "window_manager.h"
@@ -24,6 +25,7 @@
 #include "window_visibility_info.h"
 #include "window_drawing_content_info.h"
 #include "window_pid_visibility_info.h"
+#include "window_property_change_batch.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -35,6 +37,13 @@ public:
     WMError UnregisterWindowManagerAgent(const sptr<IWindowManagerAgent>& windowManagerAgent,
         WindowManagerAgentType type, int32_t pid, int32_t instanceUserId = INVALID_USER_ID);
 
+    /**
+     * @brief Send the agent only the visibility or drawing content entries the filter matches, an agent with no
+     * matching entry gets no IPC. An empty filter sends every entry again. The agent must be registered for type.
+     */
+    WMError SetWindowManagerAgentFilter(const sptr<IWindowManagerAgent>& windowManagerAgent,
+        WindowManagerAgentType type, const WindowManagerAgentFilter& filter);
+
     void UpdateCameraFloatWindowStatus(uint32_t accessTokenId, bool isShowing);
     void UpdateFocusChangeInfo(const sptr<FocusChangeInfo>& focusChangeInfo, bool focused);
     void UpdateDisplayGroupInfo(DisplayGroupId displayGroupId, DisplayId displayId, bool isAdd);
@@ -53,6 +62,11 @@ public:
     void NotifyWindowSystemBarPropertyChange(WindowType type, const SystemBarProperty& systemBarProperty);
     void UpdatePiPWindowStateChanged(const std::string& bundleName, bool isForeground);
     void NotifyWindowPropertyChange(uint32_t propertyDirtyFlags, const WindowInfoList& windowInfoList);
+
+    /**
+     * @brief Send the batch to every property agent, nothing is sent if empty.
+     */
+    void NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch);
     void NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo);
     void NotifySessionSaveSnapShotComplete(int32_t persistentId);
 
@@ -65,6 +79,26 @@ private:
     }
     virtual ~SessionManagerAgentController() = default;
     void DoAfterAgentDeath(const sptr<IRemoteObject>& remoteObject);
+    void RemoveAgentFilter(const sptr<IRemoteObject>& remoteObject, WindowManagerAgentType type);
+
+    /**
+     * @brief Filtered agents of one agent type, each indexed by one of its restricted fields.
+     *
+     * An entry is looked up by its field values, the candidates found are then checked against the whole filter.
+     * Agents with no indexable field are checked against every entry.
+     */
+    struct AgentFilterIndex {
+        void Rebuild(bool hasAppInfo);
+        void Lookup(int32_t pid, uint32_t windowId, const std::string* bundleName, const DisplayId* displayId,
+            std::vector<sptr<IRemoteObject>>& candidates) const;
+
+        std::map<sptr<IRemoteObject>, WindowManagerAgentFilter> filters_;
+        std::unordered_map<uint32_t, std::vector<sptr<IRemoteObject>>> windowIdIndex_;
+        std::unordered_map<int32_t, std::vector<sptr<IRemoteObject>>> pidIndex_;
+        std::unordered_map<std::string, std::vector<sptr<IRemoteObject>>> bundleNameIndex_;
+        std::unordered_map<DisplayId, std::vector<sptr<IRemoteObject>>> displayIdIndex_;
+        std::vector<sptr<IRemoteObject>> scanAgents_;
+    };
 
     ClientAgentContainer<IWindowManagerAgent, WindowManagerAgentType> smAgentContainer_;
     std::map<int32_t, std::map<int32_t, std::map<WindowManagerAgentType, sptr<IWindowManagerAgent>>>>
@@ -72,6 +106,8 @@ private:
     std::map<sptr<IRemoteObject>, std::tuple<int32_t, int32_t, WindowManagerAgentType>> windowManagerAgentPairMap_;
     std::mutex windowManagerPidUserIdAgentMapMutex_;
     WindowManagementMode windowManagementMode_ { WindowManagementMode::UNDEFINED };
+    std::mutex agentFilterMutex_;
+    std::map<WindowManagerAgentType, AgentFilterIndex> agentFilterIndexes_;
 };
 }
 }
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_WINDOW_HIT_INDEX_H
+#define OHOS_ROSEN_WINDOW_SCENE_WINDOW_HIT_INDEX_H
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "dm_common.h"
+#include "interfaces/include/ws_common.h"
+
+namespace OHOS::Rosen {
+struct WindowHitInfo {
+    DisplayId displayId_ = DISPLAY_ID_INVALID;
+    uint32_t zOrder_ = 0;
+    WSRect rect_;
+    // relative to the display, the whole rect is hit when empty
+    std::vector<WSRect> hotAreas_;
+
+    bool operator==(const WindowHitInfo& other) const
+    {
+        return displayId_ == other.displayId_ && zOrder_ == other.zOrder_ && rect_ == other.rect_ &&
+            hotAreas_ == other.hotAreas_;
+    }
+};
+
+enum class WindowHitMode : uint32_t {
+    RECT = 0,
+    HOT_AREA,
+};
+
+/**
+ * @brief Per display uniform grid over window rects and hot areas.
+ *
+ * A window is registered in every cell its bounds cover, so a point query only tests the windows of one cell,
+ * instead of every window in z-order. Windows covering too many cells are kept in a per display list tested by
+ * every query. The hit order is zOrder from top to bottom, the larger persistentId first for the same zOrder.
+ */
+class WindowHitIndex {
+public:
+    static constexpr int32_t DEFAULT_CELL_SIZE = 256;
+    static constexpr size_t MAX_CELL_COUNT_PER_WINDOW = 1024;
+
+    explicit WindowHitIndex(int32_t cellSize = DEFAULT_CELL_SIZE);
+    ~WindowHitIndex() = default;
+
+    /**
+     * @brief Add or update a window, nothing is done if the info is unchanged.
+     *
+     * @return true if the index is changed.
+     */
+    bool Update(int32_t persistentId, const WindowHitInfo& info);
+    void Remove(int32_t persistentId);
+    void Clear();
+    bool Contains(int32_t persistentId) const;
+    size_t Size() const;
+
+    /**
+     * @brief Get all windows hit at the point, from top to bottom.
+     */
+    std::vector<int32_t> QueryAll(DisplayId displayId, int32_t x, int32_t y,
+        WindowHitMode mode = WindowHitMode::RECT) const;
+    int32_t QueryTopmost(DisplayId displayId, int32_t x, int32_t y, WindowHitMode mode = WindowHitMode::RECT) const;
+
+private:
+    struct Entry {
+        WindowHitInfo info_;
+        std::vector<uint64_t> cells_;
+        bool isOversized_ = false;
+    };
+
+    struct DisplayGrid {
+        std::unordered_map<uint64_t, std::vector<int32_t>> cells_;
+        std::unordered_set<int32_t> oversizedIds_;
+    };
+
+    void InsertLocked(int32_t persistentId, Entry& entry);
+    void EraseLocked(int32_t persistentId, const Entry& entry);
+    std::vector<std::pair<uint32_t, int32_t>> CollectHitsLocked(DisplayId displayId, int32_t x, int32_t y,
+        WindowHitMode mode) const;
+    int32_t GetCellIndex(int32_t value) const;
+    static uint64_t GetCellKey(int32_t cellX, int32_t cellY);
+    static bool IsHit(const WindowHitInfo& info, int32_t x, int32_t y, WindowHitMode mode);
+
+    const int32_t cellSize_;
+    mutable std::mutex mutex_;
+    std::unordered_map<int32_t, Entry> entries_;
+    std::unordered_map<DisplayId, DisplayGrid> grids_;
+};
+} // namespace OHOS::Rosen
+#endif // OHOS_ROSEN_WINDOW_SCENE_WINDOW_HIT_INDEX_H
@@ -47,6 +47,7 @@ private:
     int HandleRegisterWindowPropertyChangeAgent(MessageParcel& data, MessageParcel& reply);
     int HandleUnregisterWindowPropertyChangeAgent(MessageParcel& data, MessageParcel& reply);
     int HandleRecoverWindowPropertyChangeFlag(MessageParcel& data, MessageParcel& reply);
+    int HandleSetWindowManagerAgentFilter(MessageParcel& data, MessageParcel& reply);
     int HandleGetFocusSessionInfo(MessageParcel& data, MessageParcel& reply);
     int HandleGetFocusWindowInfoByAbilityToken(MessageParcel& data, MessageParcel& reply);
     int HandleSetSessionLabel(MessageParcel& data, MessageParcel& reply);
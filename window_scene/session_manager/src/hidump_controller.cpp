@@ -14,12 +14,14 @@
  */
 
 #include "session_manager/include/hidump_controller.h"
+#include "common/include/latency_histogram.h"
 #include "session_helper.h"
 #include "wm_single_instance.h"
 
 namespace OHOS {
 namespace Rosen {
 constexpr int STRING_MAX_WIDTH = 21;
+const std::string ARG_LATENCY_RESET = "reset";
 
 WM_IMPLEMENT_SINGLE_INSTANCE(HidumpController)
 
@@ -43,6 +45,20 @@ void HidumpController::GetAllSessionDumpDetailedInfo(std::ostringstream& oss,
     }
 }
 
+void HidumpController::DumpLatencyHistogram(const std::vector<std::string>& params, std::string& dumpInfo)
+{
+    if (!params.empty() && params[0] == ARG_LATENCY_RESET) {
+        LatencyHistogramManager::GetInstance().Reset();
+        dumpInfo.append("Latency histograms reset\n");
+        return;
+    }
+    std::ostringstream oss;
+    oss << "----------------------------------LatencyHistogram"
+        << "-----------------------------------" << std::endl;
+    LatencyHistogramManager::GetInstance().Dump(oss, params.empty() ? "" : params[0]);
+    dumpInfo.append(oss.str());
+}
+
 void HidumpController::DumpSceneSessionParamList(std::ostringstream& oss)
 {
     DumpSessionParamList(oss);
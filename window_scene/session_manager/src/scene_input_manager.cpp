@@ -15,7 +15,9 @@
 
 #include "scene_input_manager.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <iterator>
 #include <sys/resource.h>
 #include <sys/syscall.h>
 
@@ -235,6 +237,25 @@ void SceneInputManager::Init()
         });
 }
 
+int32_t SceneInputManager::MMIClient::UpdateDisplayInfo(const MMI::UserScreenInfo& userScreenInfo)
+{
+    return MMI::InputManager::GetInstance()->UpdateDisplayInfo(userScreenInfo);
+}
+
+int32_t SceneInputManager::MMIClient::UpdateWindowInfo(const MMI::WindowGroupInfo& windowGroupInfo)
+{
+    return MMI::InputManager::GetInstance()->UpdateWindowInfo(windowGroupInfo);
+}
+
+void SceneInputManager::SetMMIClient(const std::shared_ptr<MMIClient>& mmiClient)
+{
+    if (mmiClient == nullptr) {
+        TLOGE(WmsLogTag::WMS_EVENT, "mmiClient is nullptr");
+        return;
+    }
+    mmiClient_ = mmiClient;
+}
+
 void SceneInputManager::RegisterFlushWindowInfoCallback(FlushWindowInfoCallback&& callback)
 {
     sceneSessionDirty_->RegisterFlushWindowInfoCallback(std::move(callback));
@@ -418,42 +439,80 @@ std::unordered_map<DisplayId, int32_t> SceneInputManager::GetFocusedSessionMap()
 
 void SceneInputManager::FlushFullInfoToMMI(const std::vector<MMI::ScreenInfo>& screenInfos,
     std::map<DisplayGroupId, MMI::DisplayGroupInfo>& displayGroupMap,
-    const std::vector<MMI::WindowInfo>& windowInfoList,
+    std::vector<MMI::WindowInfo>& windowInfoList, size_t windowCount,
     const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList, bool isOverBatchSize)
 {
     auto focusInfoMap = GetFocusedSessionMap();
-    std::unordered_map<DisplayGroupId, std::vector<MMI::WindowInfo>> windowInfoMap;
-    for (const auto& windowInfo : windowInfoList) {
-        windowInfoMap[windowInfo.groupId].emplace_back(windowInfo);
-    }
-    std::vector<MMI::DisplayGroupInfo> displayGroupInfos;
-    for (auto& [displayGroupId, displayGroup] : displayGroupMap) {
-        if (!isOverBatchSize && !windowInfoMap[displayGroupId].empty()) {
-            windowInfoMap[displayGroupId].back().action = MMI::WINDOW_UPDATE_ACTION::ADD_END;
-        }
-        displayGroup.windowsInfo = windowInfoMap[displayGroupId];
-        displayGroup.focusWindowId = focusInfoMap[displayGroupId];
-        displayGroupInfos.emplace_back(displayGroup);
-    }
+    windowCount = std::min(windowCount, windowInfoList.size());
     MMI::UserScreenInfo userScreenInfo = {
         .userId = currentUserId_,
         .userState = MMI::USER_ACTIVE,
         .screens = screenInfos,
-        .displayGroups = displayGroupInfos,
         .uiExtensionInfos = uiExtensionInfoList
     };
-    MMI::InputManager::GetInstance()->UpdateDisplayInfo(userScreenInfo);
+    // the window info slots are moved to MMI and back in their order, so none of them is copied on the way
+    auto& displayGroupInfos = userScreenInfo.displayGroups;
+    displayGroupInfos.reserve(displayGroupMap.size());
+    for (auto& [displayGroupId, displayGroup] : displayGroupMap) {
+        displayGroup.windowsInfo.clear();
+        displayGroup.focusWindowId = focusInfoMap[displayGroupId];
+        displayGroupInfos.emplace_back(std::move(displayGroup));
+    }
+    std::vector<size_t> windowGroupIndexes(windowCount, displayGroupInfos.size());
+    std::vector<size_t> groupWindowCounts(displayGroupInfos.size(), 0);
+    for (size_t i = 0; i < windowCount; i++) {
+        for (size_t groupIndex = 0; groupIndex < displayGroupInfos.size(); groupIndex++) {
+            if (displayGroupInfos[groupIndex].id == windowInfoList[i].groupId) {
+                windowGroupIndexes[i] = groupIndex;
+                groupWindowCounts[groupIndex]++;
+                break;
+            }
+        }
+    }
+    for (size_t groupIndex = 0; groupIndex < displayGroupInfos.size(); groupIndex++) {
+        displayGroupInfos[groupIndex].windowsInfo.reserve(groupWindowCounts[groupIndex]);
+    }
+    for (size_t i = 0; i < windowCount; i++) {
+        if (windowGroupIndexes[i] < displayGroupInfos.size()) {
+            displayGroupInfos[windowGroupIndexes[i]].windowsInfo.emplace_back(std::move(windowInfoList[i]));
+        }
+    }
+    if (!isOverBatchSize) {
+        for (auto& displayGroup : displayGroupInfos) {
+            if (!displayGroup.windowsInfo.empty()) {
+                displayGroup.windowsInfo.back().action = MMI::WINDOW_UPDATE_ACTION::ADD_END;
+            }
+        }
+    }
+    mmiClient_->UpdateDisplayInfo(userScreenInfo);
 
-    for (auto groupInfo : displayGroupInfos) {
-        TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - displayGroupId: %{public}d", groupInfo.id);
-        for (const auto& displayInfo : groupInfo.displaysInfo) {
-            TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - %{public}s", DumpDisplayInfo(displayInfo).c_str());
+    if (HiLogIsLoggable(HILOG_DOMAIN_WINDOW, g_domainContents[static_cast<uint32_t>(WmsLogTag::WMS_EVENT)],
+        LOG_DEBUG)) {
+        for (const auto& groupInfo : displayGroupInfos) {
+            TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - displayGroupId: %{public}d", groupInfo.id);
+            for (const auto& displayInfo : groupInfo.displaysInfo) {
+                TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - %{public}s", DumpDisplayInfo(displayInfo).c_str());
+            }
+            std::string windowInfoListDump = "windowinfo  ";
+            for (const auto& windowInfo : groupInfo.windowsInfo) {
+                windowInfoListDump.append(DumpWindowInfo(windowInfo).append("  ||  "));
+            }
+            TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - %{public}s", windowInfoListDump.c_str());
         }
-        std::string windowInfoListDump = "windowinfo  ";
-        for (const auto& windowInfo : groupInfo.windowsInfo) {
-            windowInfoListDump.append(DumpWindowInfo(windowInfo).append("  ||  "));
+    }
+
+    // give the slots back to the list, the dirty manager refills them on the next flush
+    std::fill(groupWindowCounts.begin(), groupWindowCounts.end(), 0);
+    for (size_t i = 0; i < windowCount; i++) {
+        size_t groupIndex = windowGroupIndexes[i];
+        if (groupIndex < displayGroupInfos.size()) {
+            windowInfoList[i] = std::move(displayGroupInfos[groupIndex].windowsInfo[groupWindowCounts[groupIndex]++]);
         }
-        TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] - %{public}s", windowInfoListDump.c_str());
+    }
+    size_t groupIndex = 0;
+    for (auto& [_, displayGroup] : displayGroupMap) {
+        displayGroup = std::move(displayGroupInfos[groupIndex++]);
+        displayGroup.windowsInfo.clear();
     }
 }
 
@@ -479,7 +538,7 @@ void SceneInputManager::FlushEmptyInfoToMMI()
             .displayGroups = displayGroupInfos
         };
         TLOGNI(WmsLogTag::WMS_EVENT, "userId:%{public}d", currentUserId_);
-        MMI::InputManager::GetInstance()->UpdateDisplayInfo(userScreenInfo);
+        mmiClient_->UpdateDisplayInfo(userScreenInfo);
     };
     if (eventHandler_) {
         eventHandler_->PostTask(task);
@@ -514,18 +573,23 @@ void SceneInputManager::NotifyWindowInfoChangeFromSession(const sptr<SceneSessio
     }
 }
 
-void SceneInputManager::FlushChangeInfoToMMI(const std::map<uint64_t, std::vector<MMI::WindowInfo>>& screenId2Windows)
+void SceneInputManager::FlushChangeInfoToMMI(std::map<uint64_t, std::vector<MMI::WindowInfo>>& screenId2Windows)
 {
     for (auto& iter : screenId2Windows) {
         auto displayId = iter.first;
         auto& windowInfos = iter.second;
-        std::string windowInfoListDump = "windowinfo  ";
-        for (auto& windowInfo : windowInfos) {
-            windowInfoListDump.append(DumpWindowInfo(windowInfo).append("  ||  "));
+        if (HiLogIsLoggable(HILOG_DOMAIN_WINDOW, g_domainContents[static_cast<uint32_t>(WmsLogTag::WMS_EVENT)],
+            LOG_DEBUG)) {
+            std::string windowInfoListDump = "windowinfo  ";
+            for (auto& windowInfo : windowInfos) {
+                windowInfoListDump.append(DumpWindowInfo(windowInfo).append("  ||  "));
+            }
+            TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] --- %{public}s", windowInfoListDump.c_str());
         }
-        TLOGD(WmsLogTag::WMS_EVENT, "[EventDispatch] --- %{public}s", windowInfoListDump.c_str());
-        MMI::WindowGroupInfo windowGroup = {focusedSessionId_, displayId, windowInfos};
-        MMI::InputManager::GetInstance()->UpdateWindowInfo(windowGroup);
+        // lent to MMI and taken back, so the window info is not copied
+        MMI::WindowGroupInfo windowGroup = {focusedSessionId_, displayId, std::move(windowInfos)};
+        mmiClient_->UpdateWindowInfo(windowGroup);
+        windowInfos = std::move(windowGroup.windowsInfo);
     }
 }
 
@@ -753,11 +817,11 @@ void SceneInputManager::SetCurrentUserId(int32_t userId)
 
 void SceneInputManager::UpdateDisplayAndWindowInfo(const std::vector<MMI::ScreenInfo>& screenInfos,
     std::map<DisplayGroupId, MMI::DisplayGroupInfo>& displayGroupMap,
-    std::vector<MMI::WindowInfo> windowInfoList,
+    std::vector<MMI::WindowInfo>& windowInfoList,
     const std::vector<MMI::UIExtensionInfo>& uiExtensionInfoList)
 {
     if (windowInfoList.size() == 0) {
-        FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(), uiExtensionInfoList);
         return;
     }
     int32_t windowBatchSize = MAX_WINDOWINFO_NUM;
@@ -768,36 +832,32 @@ void SceneInputManager::UpdateDisplayAndWindowInfo(const std::vector<MMI::Screen
     }
     int32_t windowListSize = static_cast<int32_t>(windowInfoList.size());
     if (windowListSize <= windowBatchSize) {
-        FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(), uiExtensionInfoList);
         return;
     }
-    std::unordered_map<int32_t, std::vector<int32_t>> windowIndexMap;
-    int32_t index = 0;
-    for (const auto& windowInfo : windowInfoList) {
-        windowIndexMap[windowInfo.groupId].emplace_back(index);
-        index++;
-    }
-    for (auto& [displayGroupId, indexInfos] : windowIndexMap) {
-        windowInfoList[indexInfos.back()].action = MMI::WINDOW_UPDATE_ACTION::ADD_END;
-    }
-    auto iterBegin = windowInfoList.begin();
-    auto iterEnd = windowInfoList.end();
-    auto iterNext = std::next(iterBegin, windowBatchSize);
-    FlushFullInfoToMMI(screenInfos, displayGroupMap, std::vector<MMI::WindowInfo>(iterBegin, iterNext),
-        uiExtensionInfoList, true);
-    while (iterNext != iterEnd) {
-        auto iterNewBegin = iterNext;
-        if (iterNewBegin->defaultHotAreas.size() <= MMI::WindowInfo::DEFAULT_HOTAREA_COUNT) {
+    std::unordered_map<int32_t, size_t> lastWindowIndexMap;
+    for (size_t index = 0; index < windowInfoList.size(); index++) {
+        lastWindowIndexMap[windowInfoList[index].groupId] = index;
+    }
+    for (const auto& [displayGroupId, lastIndex] : lastWindowIndexMap) {
+        windowInfoList[lastIndex].action = MMI::WINDOW_UPDATE_ACTION::ADD_END;
+    }
+    size_t batchEnd = static_cast<size_t>(windowBatchSize);
+    FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, batchEnd, uiExtensionInfoList, true);
+    std::map<uint64_t, std::vector<MMI::WindowInfo>> screenToWindowInfoList;
+    auto& batchWindowInfos = screenToWindowInfoList[DEFALUT_DISPLAYID];
+    while (batchEnd < windowInfoList.size()) {
+        size_t batchBegin = batchEnd;
+        if (windowInfoList[batchBegin].defaultHotAreas.size() <= MMI::WindowInfo::DEFAULT_HOTAREA_COUNT) {
             windowBatchSize = MAX_WINDOWINFO_NUM;
         }
-        if (std::distance(iterNewBegin, iterEnd) <= windowBatchSize) {
-            iterNext = iterEnd;
-        } else {
-            iterNext = std::next(iterNewBegin, windowBatchSize);
-        }
-        std::map<uint64_t, std::vector<MMI::WindowInfo>> screenToWindowInfoList;
-        screenToWindowInfoList.emplace(DEFALUT_DISPLAYID, std::vector<MMI::WindowInfo>(iterNewBegin, iterNext));
+        batchEnd = std::min(windowInfoList.size(), batchBegin + static_cast<size_t>(windowBatchSize));
+        // the slots of the batch are moved out and back, the batch list keeps its buffer for the next batch
+        auto batchIter = std::next(windowInfoList.begin(), batchBegin);
+        batchWindowInfos.assign(std::make_move_iterator(batchIter),
+            std::make_move_iterator(std::next(windowInfoList.begin(), batchEnd)));
         FlushChangeInfoToMMI(screenToWindowInfoList);
+        std::move(batchWindowInfos.begin(), batchWindowInfos.end(), batchIter);
     }
 }
 
@@ -846,12 +906,17 @@ void SceneInputManager::FlushDisplayInfoToMMI(std::vector<MMI::WindowInfo>&& win
             }
         }
         if (!forceFlush && !CheckNeedUpdate(screenInfos, displayInfos, windowInfoList)) {
+            sceneSessionDirty_->RecycleFullWindowInfoList(
+                { std::move(windowInfoList), std::move(pixelMapList), std::move(uiExtensionInfoList) });
             return;
         }
         PrintScreenInfo(screenInfos);
         PrintDisplayInfo(displayInfos);
         PrintWindowInfo(windowInfoList);
-        UpdateDisplayAndWindowInfo(screenInfos, displayGroupMap, std::move(windowInfoList), uiExtensionInfoList);
+        UpdateDisplayAndWindowInfo(screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        // sent to MMI, the slots are refilled by the next flush
+        sceneSessionDirty_->RecycleFullWindowInfoList(
+            { std::move(windowInfoList), std::move(pixelMapList), std::move(uiExtensionInfoList) });
     });
 }
 
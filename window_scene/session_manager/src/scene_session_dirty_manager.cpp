@@ -15,7 +15,9 @@
 
 #include "scene_session_dirty_manager.h"
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <parameters.h>
 #include "screen_session_manager_client/include/screen_session_manager_client.h"
 #include "session_manager/include/scene_session_manager.h"
@@ -49,6 +51,12 @@ const std::string SCREEN_LOCK_WINDOW = "SCBScreenLock";
 const std::string COOPERATION_DISPLAY_NAME = "Cooperation";
 constexpr int32_t CURSOR_DRAG_COUNT_MAX = 1;
 const std::string VIRTUAL_TOUCHPAD_MODULE_NAME = "virtualtouchpad";
+constexpr uint64_t HASH_SEED = 0x9e3779b97f4a7c15ULL;
+
+void HashCombine(uint64_t& hash, uint64_t value)
+{
+    hash ^= value + HASH_SEED + (hash << 6) + (hash >> 2); // 6, 2: shifts of the usual hash combine
+}
 } // namespace
 
 static bool operator==(const MMI::Rect left, const MMI::Rect right)
@@ -110,6 +118,35 @@ bool CmpMMIWindowInfo(const MMI::WindowInfo& a, const MMI::WindowInfo& b)
     return a.defaultHotAreas.size() > b.defaultHotAreas.size();
 }
 
+// back to the defaults, but the vectors keep their buffers for the refill
+static void ResetWindowInfo(MMI::WindowInfo& windowInfo)
+{
+    auto defaultHotAreas = std::move(windowInfo.defaultHotAreas);
+    auto pointerHotAreas = std::move(windowInfo.pointerHotAreas);
+    auto pointerChangeAreas = std::move(windowInfo.pointerChangeAreas);
+    auto transform = std::move(windowInfo.transform);
+    auto dragDisabledAreas = std::move(windowInfo.dragDisabledAreas);
+    windowInfo = MMI::WindowInfo();
+    defaultHotAreas.clear();
+    pointerHotAreas.clear();
+    pointerChangeAreas.clear();
+    transform.clear();
+    dragDisabledAreas.clear();
+    windowInfo.defaultHotAreas = std::move(defaultHotAreas);
+    windowInfo.pointerHotAreas = std::move(pointerHotAreas);
+    windowInfo.pointerChangeAreas = std::move(pointerChangeAreas);
+    windowInfo.transform = std::move(transform);
+    windowInfo.dragDisabledAreas = std::move(dragDisabledAreas);
+}
+
+static MMI::WindowInfo& AcquireWindowInfoSlot(std::vector<MMI::WindowInfo>& windowInfoList, size_t& slotCount)
+{
+    if (slotCount == windowInfoList.size()) {
+        windowInfoList.emplace_back();
+    }
+    return windowInfoList[slotCount++];
+}
+
 Vector2f CalRotationToTranslate(const MMI::Direction& displayRotation, float width, float height,
     const Vector2f& offset, float& rotate)
 {
@@ -166,12 +203,11 @@ void SceneSessionDirtyManager::CalNotRotateTransform(const sptr<SceneSession>& s
         return;
     }
     auto displayId = sessionProperty->GetDisplayId();
-    std::map<ScreenId, ScreenProperty> screensProperties =
-        Rosen::ScreenSessionManagerClient::GetInstance().GetAllScreensProperties();
-    if (screensProperties.find(displayId) == screensProperties.end()) {
+    auto screenSession = ScreenSessionManagerClient::GetInstance().GetScreenSession(displayId);
+    if (screenSession == nullptr) {
         return;
     }
-    auto screenProperty = screensProperties[displayId];
+    auto screenProperty = screenSession->GetScreenProperty();
     MMI::Direction displayRotation = ConvertDegreeToMMIRotation(screenProperty.GetPhysicalRotation());
     float width = screenProperty.GetBounds().rect_.GetWidth();
     float height = screenProperty.GetBounds().rect_.GetHeight();
@@ -215,13 +251,90 @@ void SceneSessionDirtyManager::CalSpecialNotRotateTransform(const sptr<SceneSess
                          .Scale(scale, sceneSession->GetPivotX(), sceneSession->GetPivotY()).Inverse();
 }
 
+uint64_t SceneSessionDirtyManager::GetWindowTransformHash(const sptr<SceneSession>& sceneSession,
+    const ScreenProperty& screenProperty, const SingleHandData& singleHandData, bool useUIExtension) const
+{
+    // scale, pivot and current rotation are covered by the transform version bumped in their setters
+    uint64_t hash = HASH_SEED;
+    const auto& sessionInfo = sceneSession->GetSessionInfo();
+    HashCombine(hash, sceneSession->GetTransformVersion());
+    HashCombine(hash, static_cast<uint64_t>(sessionInfo.isRotable_));
+    HashCombine(hash, static_cast<uint64_t>(sessionInfo.isSystem_));
+    HashCombine(hash, static_cast<uint64_t>(ScreenSessionManagerClient::GetInstance().GetFoldDisplayMode()));
+    HashCombine(hash, std::hash<float>{}(screenProperty.GetPhysicalRotation()));
+    HashCombine(hash, std::hash<float>{}(screenProperty.GetScreenComponentRotation()));
+    HashCombine(hash, std::hash<float>{}(screenProperty.GetBounds().rect_.GetWidth()));
+    HashCombine(hash, std::hash<float>{}(screenProperty.GetBounds().rect_.GetHeight()));
+    Vector2f position = sceneSession->GetSessionGlobalPosition(useUIExtension);
+    HashCombine(hash, std::hash<float>{}(position[0]));
+    HashCombine(hash, std::hash<float>{}(position[1]));
+    HashCombine(hash, static_cast<uint64_t>(singleHandData.mode));
+    HashCombine(hash, std::hash<float>{}(singleHandData.scaleX));
+    HashCombine(hash, std::hash<float>{}(singleHandData.scaleY));
+    HashCombine(hash, std::hash<float>{}(singleHandData.pivotX));
+    HashCombine(hash, std::hash<float>{}(singleHandData.pivotY));
+    return hash;
+}
+
 void SceneSessionDirtyManager::CalTransform(const sptr<SceneSession>& sceneSession, Matrix3f& transform,
-    const SingleHandData& singleHandData, bool useUIExtension) const
+    const SingleHandData& singleHandData, bool useUIExtension, Matrix3f* inverseTransform) const
 {
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
         return;
     }
+    auto sessionProperty = sceneSession->GetSessionProperty();
+    sptr<ScreenSession> screenSession = nullptr;
+    if (sessionProperty != nullptr) {
+        screenSession = ScreenSessionManagerClient::GetInstance().GetScreenSession(sessionProperty->GetDisplayId());
+    }
+    if (screenSession == nullptr) {
+        // not cached, the transform only carries the single hand scale
+        CalTransformInner(sceneSession, nullptr, transform, singleHandData, useUIExtension);
+        if (inverseTransform != nullptr) {
+            *inverseTransform = transform.Inverse();
+        }
+        return;
+    }
+    auto screenProperty = screenSession->GetScreenProperty();
+    uint64_t hash = GetWindowTransformHash(sceneSession, screenProperty, singleHandData, useUIExtension);
+    auto key = std::make_pair(sceneSession->GetPersistentId(), useUIExtension);
+    {
+        std::lock_guard<std::mutex> lock(transformCacheMutex_);
+        auto iter = transformCache_.find(key);
+        if (iter != transformCache_.end() && iter->second.hash_ == hash) {
+            transform = iter->second.transform_;
+            if (inverseTransform != nullptr) {
+                *inverseTransform = iter->second.inverseTransform_;
+            }
+            return;
+        }
+    }
+    CalTransformInner(sceneSession, &screenProperty, transform, singleHandData, useUIExtension);
+    Matrix3f inverse = transform.Inverse();
+    if (inverseTransform != nullptr) {
+        *inverseTransform = inverse;
+    }
+    std::lock_guard<std::mutex> lock(transformCacheMutex_);
+    transformCache_[key] = { hash, transform, inverse };
+}
+
+void SceneSessionDirtyManager::PruneTransformCache(const std::map<int32_t, sptr<SceneSession>>& sessionMap) const
+{
+    std::lock_guard<std::mutex> lock(transformCacheMutex_);
+    for (auto iter = transformCache_.begin(); iter != transformCache_.end();) {
+        if (sessionMap.find(iter->first.first) == sessionMap.end()) {
+            iter = transformCache_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void SceneSessionDirtyManager::CalTransformInner(const sptr<SceneSession>& sceneSession,
+    ScreenProperty* screenPropertyPtr, Matrix3f& transform, const SingleHandData& singleHandData,
+    bool useUIExtension) const
+{
     transform = Matrix3f::IDENTITY;
     bool isRotate = sceneSession->GetSessionInfo().isRotable_;
     auto displayMode = ScreenSessionManagerClient::GetInstance().GetFoldDisplayMode();
@@ -229,20 +342,11 @@ void SceneSessionDirtyManager::CalTransform(const sptr<SceneSession>& sceneSessi
         transform = transform.Scale({singleHandData.scaleX, singleHandData.scaleY},
                                     singleHandData.pivotX, singleHandData.pivotY);
     }
-
-    auto sessionProperty = sceneSession->GetSessionProperty();
-    if (sessionProperty == nullptr) {
-        TLOGE(WmsLogTag::WMS_EVENT, "sessionProperty is nullptr");
-        return;
-    }
-    auto displayId = sessionProperty->GetDisplayId();
-    std::map<ScreenId, ScreenProperty> screensProperties =
-        Rosen::ScreenSessionManagerClient::GetInstance().GetAllScreensProperties();
-    if (screensProperties.find(displayId) == screensProperties.end()) {
-        TLOGE(WmsLogTag::WMS_EVENT, "screensProperties find displayId failed");
+    if (screenPropertyPtr == nullptr) {
+        TLOGE(WmsLogTag::WMS_EVENT, "sessionProperty is nullptr or find displayId failed");
         return;
     }
-    auto screenProperty = screensProperties[displayId];
+    auto& screenProperty = *screenPropertyPtr;
     auto isScreenLockWindow = sceneSession->GetSessionInfo().bundleName_.find(SCREEN_LOCK_WINDOW) != std::string::npos;
     bool isRotateWindow = !NearEqual(PositiveFmod(screenProperty.GetPhysicalRotation() -
         screenProperty.GetScreenComponentRotation(), DIRECTION360), DIRECTION0);
@@ -334,22 +438,19 @@ void SceneSessionDirtyManager::UpdateDefaultHotAreas(sptr<SceneSession> sceneSes
     pointerHotAreas.emplace_back(pointerRect);
 }
 
-static void UpdateKeyboardHotAreasInner(const sptr<SceneSession>& sceneSession, std::vector<Rect>& hotAreas)
+static HotAreaBufferPtr GetKeyboardHotAreaBuffer(const sptr<SceneSession>& sceneSession)
 {
     sptr<SceneSession> session = (sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL) ?
         sceneSession->GetKeyboardSession() : sceneSession;
     auto sessionProperty = session->GetSessionProperty();
-    KeyboardTouchHotAreas keyboardTouchHotAreas = sessionProperty->GetKeyboardTouchHotAreas();
-    auto displayId = (keyboardTouchHotAreas.displayId_ == DISPLAY_ID_INVALID) ?
-                     sessionProperty->GetDisplayId() :
-                     keyboardTouchHotAreas.displayId_;
-    std::map<ScreenId, ScreenProperty> screensProperties =
-        ScreenSessionManagerClient::GetInstance().GetAllScreensProperties();
-    if (screensProperties.find(displayId) == screensProperties.end()) {
+    auto keyboardDisplayId = sessionProperty->GetKeyboardTouchHotAreasDisplayId();
+    auto displayId = (keyboardDisplayId == DISPLAY_ID_INVALID) ? sessionProperty->GetDisplayId() : keyboardDisplayId;
+    auto screenSession = ScreenSessionManagerClient::GetInstance().GetScreenSession(displayId);
+    if (screenSession == nullptr) {
         TLOGW(WmsLogTag::WMS_KEYBOARD, "Set k-hotAreas failed: %{public}" PRIu64, displayId);
-        return;
+        return nullptr;
     }
-    const auto& screenProperty = screensProperties[displayId];
+    const auto screenProperty = screenSession->GetScreenProperty();
     auto displayRect = screenProperty.GetBounds().rect_;
     int32_t displayWidth = displayRect.GetWidth();
     int32_t displayHeight = displayRect.GetHeight();
@@ -365,19 +466,13 @@ static void UpdateKeyboardHotAreasInner(const sptr<SceneSession>& sceneSession,
     auto display = DisplayManager::GetInstance().GetDisplayById(displayId);
     std::string dispName = (display != nullptr) ? display->GetName() : "UNKNOWN";
     isLandscape = isLandscape || (dispName == COOPERATION_DISPLAY_NAME);
-    if (sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT) {
-        if (keyboardTouchHotAreas.isKeyboardEmpty()) {
-            return;
-        }
-        hotAreas = isLandscape ? keyboardTouchHotAreas.landscapeKeyboardHotAreas_ :
-            keyboardTouchHotAreas.portraitKeyboardHotAreas_;
-    } else if (sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL) {
-        if (keyboardTouchHotAreas.isPanelEmpty()) {
-            return;
-        }
-        hotAreas = isLandscape ? keyboardTouchHotAreas.landscapePanelHotAreas_ :
-            keyboardTouchHotAreas.portraitPanelHotAreas_;
+    // the keyboard hot areas take effect only when both orientations are set
+    bool isPanel = sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL;
+    if (sessionProperty->GetKeyboardHotAreaBuffer(isPanel, true)->Empty() ||
+        sessionProperty->GetKeyboardHotAreaBuffer(isPanel, false)->Empty()) {
+        return nullptr;
     }
+    return sessionProperty->GetKeyboardHotAreaBuffer(isPanel, isLandscape);
 }
 
 void SceneSessionDirtyManager::UpdateHotAreas(const sptr<SceneSession>& sceneSession,
@@ -387,34 +482,48 @@ void SceneSessionDirtyManager::UpdateHotAreas(const sptr<SceneSession>& sceneSes
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
         return;
     }
-    std::unordered_set<MMI::Rect, InputRectHash, InputRectEqual> hotAreaHashSet;
-    std::vector<Rect> hotAreas = sceneSession->GetTouchHotAreas();
+    HotAreaBufferPtr hotAreaBuffer = nullptr;
     if (sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT ||
         sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_KEYBOARD_PANEL) {
-        UpdateKeyboardHotAreasInner(sceneSession, hotAreas);
-    }
-    for (const auto& area : hotAreas) {
-        MMI::Rect rect;
-        rect.x = area.posX_;
-        rect.y = area.posY_;
-        rect.width = static_cast<int32_t>(area.width_);
-        rect.height = static_cast<int32_t>(area.height_);
-        if (hotAreaHashSet.count(rect)) {
-            continue;
-        }
-        hotAreaHashSet.insert(rect);
-        touchHotAreas.emplace_back(rect);
-        pointerHotAreas.emplace_back(rect);
-        if (touchHotAreas.size() == static_cast<uint32_t>(MMI::WindowInfo::MAX_HOTAREA_COUNT)) {
-            auto sessionId = sceneSession->GetWindowId();
-            TLOGE(WmsLogTag::WMS_EVENT, "id=%{public}d hotAreas size > %{public}d",
-                sessionId, static_cast<int>(hotAreas.size()));
-            break;
+        hotAreaBuffer = GetKeyboardHotAreaBuffer(sceneSession);
+    }
+    if (hotAreaBuffer == nullptr) {
+        hotAreaBuffer = sceneSession->GetTouchHotAreaBuffer();
+    }
+    // the buffer is immutable, the conversion is redone only when the hot areas are replaced
+    auto mmiHotAreas = sceneSession->GetMMIHotAreasCache(hotAreaBuffer->GetVersion());
+    if (mmiHotAreas == nullptr) {
+        auto convertedHotAreas = std::make_shared<std::vector<MMI::Rect>>();
+        std::unordered_set<MMI::Rect, InputRectHash, InputRectEqual> hotAreaHashSet;
+        const auto& posX = hotAreaBuffer->GetPosX();
+        const auto& posY = hotAreaBuffer->GetPosY();
+        const auto& width = hotAreaBuffer->GetWidth();
+        const auto& height = hotAreaBuffer->GetHeight();
+        for (size_t i = 0; i < hotAreaBuffer->Size(); i++) {
+            MMI::Rect rect;
+            rect.x = posX[i];
+            rect.y = posY[i];
+            rect.width = static_cast<int32_t>(width[i]);
+            rect.height = static_cast<int32_t>(height[i]);
+            if (!hotAreaHashSet.insert(rect).second) {
+                continue;
+            }
+            convertedHotAreas->emplace_back(rect);
+            if (convertedHotAreas->size() == static_cast<uint32_t>(MMI::WindowInfo::MAX_HOTAREA_COUNT)) {
+                auto sessionId = sceneSession->GetWindowId();
+                TLOGE(WmsLogTag::WMS_EVENT, "id=%{public}d hotAreas size > %{public}d",
+                    sessionId, static_cast<int>(hotAreaBuffer->Size()));
+                break;
+            }
         }
+        sceneSession->SetMMIHotAreasCache(hotAreaBuffer->GetVersion(), convertedHotAreas);
+        mmiHotAreas = std::move(convertedHotAreas);
     }
-    if (touchHotAreas.empty()) {
+    if (mmiHotAreas->empty()) {
         return UpdateDefaultHotAreas(sceneSession, touchHotAreas, pointerHotAreas);
     }
+    touchHotAreas = *mmiHotAreas;
+    pointerHotAreas = *mmiHotAreas;
 }
 
 void SceneSessionDirtyManager::UpdateDragDisabledAreas(const sptr<SceneSession>& sceneSession,
@@ -704,7 +813,7 @@ void SceneSessionDirtyManager::GetModalUIExtensionInfo(std::vector<MMI::WindowIn
             return;
         }
         MMI::WindowInfo windowInfo = GetSecComponentWindowInfo(constrainedModalUIExtInfo,
-            hostWindowInfo, sceneSession, GetTransformFromWindowInfo(hostWindowInfo));
+            hostWindowInfo, sceneSession, GetTransformFromWindowInfo(hostWindowInfo).Inverse());
         std::vector<int32_t> pointerChangeAreas(POINTER_CHANGE_AREA_COUNT, 0);
         windowInfo.pointerChangeAreas = std::move(pointerChangeAreas);
         windowInfo.zOrder = hostWindowInfo.zOrder + ZORDER_UIEXTENSION_INDEX;
@@ -718,13 +827,23 @@ void SceneSessionDirtyManager::GetModalUIExtensionInfo(std::vector<MMI::WindowIn
 
 auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
 {
-    std::vector<MMI::WindowInfo> windowInfoList;
-    std::vector<std::shared_ptr<Media::PixelMap>> pixelMapList;
+    FullInfoForMMI fullInfo;
+    {
+        std::lock_guard<std::mutex> lock(fullInfoArenaMutex_);
+        std::swap(fullInfo, fullInfoArena_);
+    }
+    // the slots of the last flush are refilled in place, only a grown list allocates
+    auto& windowInfoList = fullInfo.windowInfoList;
+    auto& pixelMapList = fullInfo.pixelMapList;
+    auto& uiExtensionInfoList = fullInfo.uiExtensionInfoList;
+    pixelMapList.clear();
+    uiExtensionInfoList.clear();
+    size_t slotCount = 0;
+    std::vector<MMI::WindowInfo> modalWindowInfoList;
     const auto sceneSessionMap = SceneSessionManager::GetInstance().GetSceneSessionMap();
     // all input event should trans to dialog window if dialog exists
     const auto dialogMap = GetDialogSessionMap(sceneSessionMap);
     uint32_t maxHotAreasNum = 0;
-    std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
     for (const auto& sceneSessionValuePair : sceneSessionMap) {
         const auto& sceneSessionValue = sceneSessionValuePair.second;
         if (sceneSessionValue == nullptr) {
@@ -735,7 +854,11 @@ auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
             " windowId=%{public}d activeStatus=%{public}d", sceneSessionValue->GetWindowName().c_str(),
             sceneSessionValue->GetSessionInfo().bundleName_.c_str(), sceneSessionValue->GetWindowId(),
             sceneSessionValue->GetForegroundInteractiveStatus());
-        auto [windowInfo, pixelMap] = GetWindowInfo(sceneSessionValue, WindowAction::WINDOW_ADD);
+        size_t hostIndex = slotCount;
+        std::shared_ptr<Media::PixelMap> pixelMap;
+        FillWindowInfo(sceneSessionValue, WindowAction::WINDOW_ADD, AcquireWindowInfoSlot(windowInfoList, slotCount),
+            pixelMap);
+        auto& windowInfo = windowInfoList[hostIndex];
         auto iter = (sceneSessionValue->GetMainSessionOrLoosenedSessionId() == INVALID_SESSION_ID) ?
             dialogMap.find(sceneSessionValue->GetPersistentId()) :
             dialogMap.find(sceneSessionValue->GetMainSessionOrLoosenedSessionId());
@@ -746,24 +869,48 @@ auto SceneSessionDirtyManager::GetFullWindowInfoList() -> FullInfoForMMI
             windowInfo.pid = static_cast<int32_t>(iter->second->GetCallingPid());
             windowInfo.agentPid = static_cast<int32_t>(iter->second->GetCallingPid());
         } else {
-            GetModalUIExtensionInfo(windowInfoList, sceneSessionValue, windowInfo);
+            modalWindowInfoList.clear();
+            GetModalUIExtensionInfo(modalWindowInfoList, sceneSessionValue, windowInfo);
+            for (auto& modalWindowInfo : modalWindowInfoList) {
+                AcquireWindowInfoSlot(windowInfoList, slotCount) = std::move(modalWindowInfo);
+            }
+            // the modal extensions stay in front of their host
+            std::rotate(windowInfoList.begin() + hostIndex, windowInfoList.begin() + hostIndex + 1,
+                windowInfoList.begin() + slotCount);
         }
+        const auto& hostWindowInfo = windowInfoList[slotCount - 1];
         TLOGD(WmsLogTag::WMS_EVENT, "windowId=%{public}d, agentWindowId=%{public}d, zOrder=%{public}f",
-            windowInfo.id, windowInfo.agentWindowId, windowInfo.zOrder);
-        windowInfoList.emplace_back(windowInfo);
-        pixelMapList.emplace_back(pixelMap);
+            hostWindowInfo.id, hostWindowInfo.agentWindowId, hostWindowInfo.zOrder);
+        // the list only keeps the masks alive until MMI has them, a shared mask is held once
+        if (pixelMap != nullptr &&
+            std::find(pixelMapList.begin(), pixelMapList.end(), pixelMap) == pixelMapList.end()) {
+            pixelMapList.emplace_back(pixelMap);
+        }
         // set the number of hot areas to the maximum number of hot areas when it exceeds the maximum number
         // to avoid exceeding socket buff limits
-        if (windowInfo.defaultHotAreas.size() > maxHotAreasNum) {
-            maxHotAreasNum = windowInfo.defaultHotAreas.size();
+        if (hostWindowInfo.defaultHotAreas.size() > maxHotAreasNum) {
+            maxHotAreasNum = hostWindowInfo.defaultHotAreas.size();
         }
         sceneSessionValue->GetAllUIExtensionTokenInfo(uiExtensionInfoList);
     }
+    windowInfoList.erase(windowInfoList.begin() + slotCount, windowInfoList.end());
     if (maxHotAreasNum > MMI::WindowInfo::DEFAULT_HOTAREA_COUNT) {
         std::sort(windowInfoList.begin(), windowInfoList.end(), CmpMMIWindowInfo);
     }
+    PruneTransformCache(sceneSessionMap);
     TLOGD(WmsLogTag::WMS_EVENT, "uiExtensionInfo size=%{public}d", static_cast<int>(uiExtensionInfoList.size()));
-    return {windowInfoList, pixelMapList, uiExtensionInfoList};
+    return fullInfo;
+}
+
+void SceneSessionDirtyManager::RecycleFullWindowInfoList(FullInfoForMMI&& fullInfo)
+{
+    // nothing is left alive by the recycled lists, the slots of the window infos are reset on refill
+    fullInfo.pixelMapList.clear();
+    fullInfo.uiExtensionInfoList.clear();
+    std::lock_guard<std::mutex> lock(fullInfoArenaMutex_);
+    if (fullInfo.windowInfoList.capacity() >= fullInfoArena_.windowInfoList.capacity()) {
+        fullInfoArena_ = std::move(fullInfo);
+    }
 }
 
 void SceneSessionDirtyManager::UpdatePointerAreas(sptr<SceneSession> sceneSession,
@@ -933,35 +1080,39 @@ void SceneSessionDirtyManager::UpdateWindowFlagsForVirtualPad(const sptr<SceneSe
 std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> SceneSessionDirtyManager::GetWindowInfo(
     const sptr<SceneSession>& sceneSession, const WindowAction& action) const
 {
+    std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> windowInfo;
+    FillWindowInfo(sceneSession, action, windowInfo.first, windowInfo.second);
+    return windowInfo;
+}
+
+bool SceneSessionDirtyManager::FillWindowInfo(const sptr<SceneSession>& sceneSession, const WindowAction& action,
+    MMI::WindowInfo& windowInfo, std::shared_ptr<Media::PixelMap>& pixelMap) const
+{
+    ResetWindowInfo(windowInfo);
+    pixelMap = nullptr;
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
-        return {};
+        return false;
     }
     sptr<WindowSessionProperty> windowSessionProperty = sceneSession->GetSessionProperty();
     if (windowSessionProperty == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "GetSessionProperty is nullptr");
-        return {};
+        return false;
     }
     Matrix3f transform;
+    Matrix3f inverseTransform;
     WSRect windowRect = sceneSession->GetSessionGlobalRectInMultiScreen();
     auto pid = sceneSession->GetCallingPid();
-    auto uid = sceneSession->GetCallingUid();
-    auto windowId = sceneSession->GetWindowId();
     auto displayId = windowSessionProperty->GetDisplayId();
     const auto& singleHandData = GetSingleHandData(sceneSession);
-    CalTransform(sceneSession, transform, singleHandData);
-    std::vector<float> transformData(transform.GetData(), transform.GetData() + TRANSFORM_DATA_LEN);
+    CalTransform(sceneSession, transform, singleHandData, false, &inverseTransform);
+    windowInfo.transform.assign(transform.GetData(), transform.GetData() + TRANSFORM_DATA_LEN);
 
-    auto agentWindowId = sceneSession->GetWindowId();
-    auto zOrder = sceneSession->GetZOrder();
-    std::vector<int32_t> pointerChangeAreas(POINTER_CHANGE_AREA_COUNT, 0);
+    windowInfo.pointerChangeAreas.assign(POINTER_CHANGE_AREA_COUNT, 0);
     WindowType windowType = windowSessionProperty->GetWindowType();
-    CheckIfUpdatePointAreas(windowType, sceneSession, windowSessionProperty, pointerChangeAreas);
-    std::vector<MMI::Rect> touchHotAreas;
-    std::vector<MMI::Rect> pointerHotAreas;
-    UpdateHotAreas(sceneSession, touchHotAreas, pointerHotAreas);
-    std::vector<MMI::Rect> dragDisabledAreas;
-    UpdateDragDisabledAreas(sceneSession, dragDisabledAreas);
+    CheckIfUpdatePointAreas(windowType, sceneSession, windowSessionProperty, windowInfo.pointerChangeAreas);
+    UpdateHotAreas(sceneSession, windowInfo.defaultHotAreas, windowInfo.pointerHotAreas);
+    UpdateDragDisabledAreas(sceneSession, windowInfo.dragDisabledAreas);
     int windowNameType = WINDOW_NAME_TYPE_UNKNOWN;
     std::string windowName = sceneSession->GetWindowNameAllType();
     auto startsWith = [](const std::string& str, const std::string& prefix) {
@@ -973,31 +1124,24 @@ std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> SceneSessionDirtyMa
     } else if (startsWith(windowName, VOICEINPUT_WINDOW_NAME_PREFIX)) {
         windowNameType = WINDOW_NAME_TYPE_VOICEINPUT;
     }
-    auto pixelMap = windowSessionProperty->GetWindowMask();
-    MMI::WindowInfo windowInfo = {
-        .id = windowId,
-        .pid = pid,
-        .uid = uid,
-        .area = { ceil(singleHandData.scaleX * windowRect.posX_ + singleHandData.singleHandX),
-                  ceil(singleHandData.scaleX * windowRect.posY_ + singleHandData.singleHandY),
-                  windowRect.width_, windowRect.height_ },
-        .defaultHotAreas = std::move(touchHotAreas),
-        .pointerHotAreas = std::move(pointerHotAreas),
-        .agentWindowId = agentWindowId,
-        .action = static_cast<MMI::WINDOW_UPDATE_ACTION>(action),
-        .displayId = displayId,
-        .groupId = SceneSessionManager::GetInstance().GetDisplayGroupId(displayId),
-        .zOrder = zOrder,
-        .pointerChangeAreas = std::move(pointerChangeAreas),
-        .transform = transformData,
-        .pixelMap = pixelMap.get(),
-        .windowInputType = static_cast<MMI::WindowInputType>(sceneSession->GetSessionInfo().windowInputType_),
-        .windowType = static_cast<int32_t>(windowType),
-        .isSkipSelfWhenShowOnVirtualScreen = sceneSession->GetSessionProperty()->GetSkipEventOnCastPlus(),
-        .windowNameType = windowNameType,
-        .agentPid = sceneSession->IsStartMoving() ? static_cast<int32_t>(getpid()) : pid,
-        .dragDisabledAreas = std::move(dragDisabledAreas)
-    };
+    pixelMap = windowSessionProperty->GetWindowMask();
+    windowInfo.id = sceneSession->GetWindowId();
+    windowInfo.pid = pid;
+    windowInfo.uid = sceneSession->GetCallingUid();
+    windowInfo.area = { ceil(singleHandData.scaleX * windowRect.posX_ + singleHandData.singleHandX),
+                        ceil(singleHandData.scaleX * windowRect.posY_ + singleHandData.singleHandY),
+                        windowRect.width_, windowRect.height_ };
+    windowInfo.agentWindowId = sceneSession->GetWindowId();
+    windowInfo.action = static_cast<MMI::WINDOW_UPDATE_ACTION>(action);
+    windowInfo.displayId = displayId;
+    windowInfo.groupId = SceneSessionManager::GetInstance().GetDisplayGroupId(displayId);
+    windowInfo.zOrder = sceneSession->GetZOrder();
+    windowInfo.pixelMap = pixelMap.get();
+    windowInfo.windowInputType = static_cast<MMI::WindowInputType>(sceneSession->GetSessionInfo().windowInputType_);
+    windowInfo.windowType = static_cast<int32_t>(windowType);
+    windowInfo.isSkipSelfWhenShowOnVirtualScreen = windowSessionProperty->GetSkipEventOnCastPlus();
+    windowInfo.windowNameType = windowNameType;
+    windowInfo.agentPid = sceneSession->IsStartMoving() ? static_cast<int32_t>(getpid()) : pid;
     UpdateWindowFlags(displayId, sceneSession, windowInfo);
     if (windowSessionProperty->GetWindowFlags() & static_cast<uint32_t>(WindowFlag::WINDOW_FLAG_HANDWRITING)) {
         windowInfo.flags |= MMI::WindowInputPolicy::FLAG_HANDWRITING;
@@ -1017,8 +1161,8 @@ std::pair<MMI::WindowInfo, std::shared_ptr<Media::PixelMap>> SceneSessionDirtyMa
     UpdateWindowFlagsForLockCursor(sceneSession, windowInfo);
     UpdateWindowFlagsForVirtualPad(sceneSession, windowInfo);
     UpdatePrivacyMode(sceneSession, windowInfo);
-    windowInfo.uiExtentionWindowInfo = GetSecSurfaceWindowinfoList(sceneSession, windowInfo, transform);
-    return {windowInfo, pixelMap};
+    windowInfo.uiExtentionWindowInfo = GetSecSurfaceWindowinfoList(sceneSession, windowInfo, inverseTransform);
+    return true;
 }
 
 SingleHandData SceneSessionDirtyManager::GetSingleHandData(const sptr<SceneSession>& sceneSession) const
@@ -1030,8 +1174,6 @@ SingleHandData SceneSessionDirtyManager::GetSingleHandData(const sptr<SceneSessi
         !sceneSession->SessionIsSingleHandMode()) {
         return singleHandData;
     }
-    const std::map<ScreenId, ScreenProperty>& screensProperties =
-        ScreenSessionManagerClient::GetInstance().GetAllScreensProperties();
     const SingleHandTransform& transform = sceneSession->GetSingleHandTransform();
     const SingleHandScreenInfo& singleHandScreenInfo = SceneSessionManager::GetInstance().GetSingleHandScreenInfo();
     singleHandData.scaleX = transform.scaleX;
@@ -1135,14 +1277,14 @@ MMI::WindowInfo SceneSessionDirtyManager::MakeWindowInfoFormHostWindow(const MMI
     return windowinfo;
 }
 
-Matrix3f CoordinateSystemHostWindowToScreen(const Matrix3f hostTransform, const SecRectInfo& secRectInfo)
+Matrix3f CoordinateSystemHostWindowToScreen(const Matrix3f& hostInverseTransform, const SecRectInfo& secRectInfo)
 {
     Matrix3f transform = Matrix3f::IDENTITY;
     Vector2f translate(secRectInfo.relativeCoords.GetLeft(), secRectInfo.relativeCoords.GetTop());
     transform = transform.Translate(translate);
     Vector2f scale(secRectInfo.scale[0], secRectInfo.scale[1]);
     transform = transform.Scale(scale, secRectInfo.anchor[0], secRectInfo.anchor[1]);
-    transform = hostTransform.Inverse() * transform;
+    transform = hostInverseTransform * transform;
     return transform;
 }
 
@@ -1174,7 +1316,8 @@ MMI::Rect CalRectInScreen(const Matrix3f& transform, const SecRectInfo& secRectI
 
 
 MMI::WindowInfo SceneSessionDirtyManager::GetHostComponentWindowInfo(const SecSurfaceInfo& secSurfaceInfo,
-    const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession, const Matrix3f hostTransform) const
+    const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession,
+    const Matrix3f hostInverseTransform) const
 {
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
@@ -1197,7 +1340,8 @@ MMI::WindowInfo SceneSessionDirtyManager::GetHostComponentWindowInfo(const SecSu
 }
 
 MMI::WindowInfo SceneSessionDirtyManager::GetSecComponentWindowInfo(const SecSurfaceInfo& secSurfaceInfo,
-    const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession, const Matrix3f hostTransform) const
+    const MMI::WindowInfo& hostWindowinfo, const sptr<SceneSession>& sceneSession,
+    const Matrix3f hostInverseTransform) const
 {
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
@@ -1214,7 +1358,7 @@ MMI::WindowInfo SceneSessionDirtyManager::GetSecComponentWindowInfo(const SecSur
     windowinfo.pid = secSurfaceInfo.uiExtensionPid;
     windowinfo.agentPid = secSurfaceInfo.uiExtensionPid;
     windowinfo.privacyUIFlag = true;
-    auto transform = CoordinateSystemHostWindowToScreen(hostTransform, secRectInfo);
+    auto transform = CoordinateSystemHostWindowToScreen(hostInverseTransform, secRectInfo);
     windowinfo.area = CalRectInScreen(transform, secRectInfo);
     MMI::Rect hotArea = { 0, 0, secRectInfo.relativeCoords.GetWidth(), secRectInfo.relativeCoords.GetHeight() };
     windowinfo.defaultHotAreas.emplace_back(hotArea);
@@ -1337,7 +1481,8 @@ void SceneSessionDirtyManager::UpdateConstrainedModalUIExtInfo(const std::map<ui
 }
 
 std::vector<MMI::WindowInfo> SceneSessionDirtyManager::GetSecSurfaceWindowinfoList(
-    const sptr<SceneSession>& sceneSession, const MMI::WindowInfo& hostWindowinfo, const Matrix3f& hostTransform) const
+    const sptr<SceneSession>& sceneSession, const MMI::WindowInfo& hostWindowinfo,
+    const Matrix3f& hostInverseTransform) const
 {
     if (sceneSession == nullptr) {
         TLOGE(WmsLogTag::WMS_EVENT, "sceneSession is nullptr");
@@ -1361,10 +1506,10 @@ std::vector<MMI::WindowInfo> SceneSessionDirtyManager::GetSecSurfaceWindowinfoLi
     int seczOrder = 0;
     MMI::WindowInfo windowinfo;
     for (const auto& secSurfaceInfo : secSurfaceInfoList) {
-        windowinfo = GetSecComponentWindowInfo(secSurfaceInfo, hostWindowinfo, sceneSession, hostTransform);
+        windowinfo = GetSecComponentWindowInfo(secSurfaceInfo, hostWindowinfo, sceneSession, hostInverseTransform);
         windowinfo.zOrder = seczOrder++;
         windowinfoList.emplace_back(windowinfo);
-        windowinfo = GetHostComponentWindowInfo(secSurfaceInfo, hostWindowinfo, sceneSession, hostTransform);
+        windowinfo = GetHostComponentWindowInfo(secSurfaceInfo, hostWindowinfo, sceneSession, hostInverseTransform);
         windowinfo.zOrder = seczOrder++;
         windowinfoList.emplace_back(windowinfo);
     }
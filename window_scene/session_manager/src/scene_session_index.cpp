@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session_manager/include/scene_session_index.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <iomanip>
+
+#include "window_manager_hilog.h"
+
+namespace OHOS::Rosen {
+namespace {
+const char* const LOOP_NAMES[] = {
+    "FlushUIParams",
+    "SessionsByType",
+    "SessionsByTypeAndDisplay",
+    "KeyboardSession",
+};
+static_assert(sizeof(LOOP_NAMES) / sizeof(LOOP_NAMES[0]) == static_cast<size_t>(SessionIndexLoop::LOOP_END),
+    "a name is needed for every loop");
+constexpr int LOOP_NAME_WIDTH = 26;
+constexpr int COUNT_WIDTH = 12;
+} // namespace
+
+void SceneSessionIndex::Add(int32_t persistentId, const sptr<SceneSession>& sceneSession)
+{
+    Entry entry = MakeEntry(sceneSession);
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddLocked(persistentId, std::move(entry));
+}
+
+void SceneSessionIndex::Remove(int32_t persistentId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemoveLocked(persistentId);
+}
+
+void SceneSessionIndex::UpdateScreenId(int32_t persistentId, ScreenId screenId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(persistentId);
+    if (iter == entries_.end() || iter->second.screenId_ == screenId) {
+        return;
+    }
+    TLOGD(WmsLogTag::WMS_ATTRIBUTE, "id: %{public}d, screen: %{public}" PRIu64 " -> %{public}" PRIu64,
+        persistentId, iter->second.screenId_, screenId);
+    Entry entry = iter->second;
+    entry.screenId_ = screenId;
+    AddLocked(persistentId, std::move(entry));
+}
+
+void SceneSessionIndex::Rebuild(const std::map<int32_t, sptr<SceneSession>>& sceneSessionMap)
+{
+    std::vector<std::pair<int32_t, Entry>> entries;
+    entries.reserve(sceneSessionMap.size());
+    for (const auto& [persistentId, sceneSession] : sceneSessionMap) {
+        entries.emplace_back(persistentId, MakeEntry(sceneSession));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    screenSessions_.clear();
+    typeSessions_.clear();
+    for (auto& [persistentId, entry] : entries) {
+        AddLocked(persistentId, std::move(entry));
+    }
+}
+
+size_t SceneSessionIndex::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void SceneSessionIndex::GetSessionsByScreen(ScreenId screenId, std::vector<sptr<SceneSession>>& sessions) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = screenSessions_.find(screenId);
+    if (iter == screenSessions_.end()) {
+        return;
+    }
+    for (const auto& [_, sceneSession] : iter->second) {
+        sessions.push_back(sceneSession);
+    }
+}
+
+void SceneSessionIndex::GetSessionsByScreens(const std::vector<ScreenId>& screenIds,
+    std::vector<sptr<SceneSession>>& sessions) const
+{
+    std::vector<std::pair<int32_t, sptr<SceneSession>>> screenSessions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto screenId : screenIds) {
+            auto iter = screenSessions_.find(screenId);
+            if (iter != screenSessions_.end()) {
+                screenSessions.insert(screenSessions.end(), iter->second.begin(), iter->second.end());
+            }
+        }
+    }
+    std::sort(screenSessions.begin(), screenSessions.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (auto& [_, sceneSession] : screenSessions) {
+        sessions.push_back(std::move(sceneSession));
+    }
+}
+
+void SceneSessionIndex::GetSessionsByType(WindowType type, std::vector<sptr<SceneSession>>& sessions) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = typeSessions_.find(type);
+    if (iter == typeSessions_.end()) {
+        return;
+    }
+    for (const auto& [_, sceneSession] : iter->second) {
+        sessions.push_back(sceneSession);
+    }
+}
+
+SceneSessionIndex::Entry SceneSessionIndex::MakeEntry(const sptr<SceneSession>& sceneSession)
+{
+    if (sceneSession == nullptr) {
+        return Entry {};
+    }
+    return Entry { sceneSession, sceneSession->GetSessionInfo().screenId_, sceneSession->GetWindowType() };
+}
+
+void SceneSessionIndex::AddLocked(int32_t persistentId, Entry&& entry)
+{
+    RemoveLocked(persistentId);
+    // a null session is only counted, so the size still follows the map
+    if (entry.session_ != nullptr) {
+        screenSessions_[entry.screenId_][persistentId] = entry.session_;
+        typeSessions_[entry.type_][persistentId] = entry.session_;
+    }
+    entries_[persistentId] = std::move(entry);
+}
+
+void SceneSessionIndex::RemoveLocked(int32_t persistentId)
+{
+    auto iter = entries_.find(persistentId);
+    if (iter == entries_.end()) {
+        return;
+    }
+    const auto& entry = iter->second;
+    if (entry.session_ != nullptr) {
+        if (auto screenIter = screenSessions_.find(entry.screenId_); screenIter != screenSessions_.end()) {
+            screenIter->second.erase(persistentId);
+            if (screenIter->second.empty()) {
+                screenSessions_.erase(screenIter);
+            }
+        }
+        if (auto typeIter = typeSessions_.find(entry.type_); typeIter != typeSessions_.end()) {
+            typeIter->second.erase(persistentId);
+            if (typeIter->second.empty()) {
+                typeSessions_.erase(typeIter);
+            }
+        }
+    }
+    entries_.erase(iter);
+}
+
+void SceneSessionIndex::RecordLoop(SessionIndexLoop loop, size_t total, size_t visited, size_t matched)
+{
+    if (loop >= SessionIndexLoop::LOOP_END) {
+        return;
+    }
+    auto& stats = loopStats_[static_cast<size_t>(loop)];
+    stats.count_.fetch_add(1, std::memory_order_relaxed);
+    stats.total_.fetch_add(total, std::memory_order_relaxed);
+    stats.visited_.fetch_add(visited, std::memory_order_relaxed);
+    stats.matched_.fetch_add(matched, std::memory_order_relaxed);
+}
+
+void SceneSessionIndex::DumpLoopStats(std::ostringstream& oss) const
+{
+    oss << std::left << std::setw(LOOP_NAME_WIDTH) << "Loop" << std::right << std::setw(COUNT_WIDTH) << "Runs"
+        << std::setw(COUNT_WIDTH) << "Total" << std::setw(COUNT_WIDTH) << "Visited" << std::setw(COUNT_WIDTH)
+        << "Matched" << std::endl;
+    for (size_t i = 0; i < loopStats_.size(); i++) {
+        const auto& stats = loopStats_[i];
+        oss << std::left << std::setw(LOOP_NAME_WIDTH) << LOOP_NAMES[i] << std::right
+            << std::setw(COUNT_WIDTH) << stats.count_.load(std::memory_order_relaxed)
+            << std::setw(COUNT_WIDTH) << stats.total_.load(std::memory_order_relaxed)
+            << std::setw(COUNT_WIDTH) << stats.visited_.load(std::memory_order_relaxed)
+            << std::setw(COUNT_WIDTH) << stats.matched_.load(std::memory_order_relaxed) << std::endl;
+    }
+}
+
+void SceneSessionIndex::ResetLoopStats()
+{
+    for (auto& stats : loopStats_) {
+        stats.count_.store(0, std::memory_order_relaxed);
+        stats.total_.store(0, std::memory_order_relaxed);
+        stats.visited_.store(0, std::memory_order_relaxed);
+        stats.matched_.store(0, std::memory_order_relaxed);
+    }
+}
+
+SceneSessionMap::SceneSessionMap(const SceneSessionMap& other) : map_(other.map_)
+{
+    index_.Rebuild(map_);
+}
+
+SceneSessionMap& SceneSessionMap::operator=(const SceneSessionMap& other)
+{
+    if (this != &other) {
+        map_ = other.map_;
+        index_.Rebuild(map_);
+    }
+    return *this;
+}
+
+SceneSessionMap& SceneSessionMap::operator=(const MapType& sceneSessionMap)
+{
+    map_ = sceneSessionMap;
+    index_.Rebuild(map_);
+    return *this;
+}
+
+std::pair<SceneSessionMap::const_iterator, bool> SceneSessionMap::insert_or_assign(int32_t persistentId,
+    const sptr<SceneSession>& sceneSession)
+{
+    auto result = map_.insert_or_assign(persistentId, sceneSession);
+    index_.Add(persistentId, sceneSession);
+    return result;
+}
+
+SceneSessionMap::size_type SceneSessionMap::erase(int32_t persistentId)
+{
+    size_type count = map_.erase(persistentId);
+    if (count != 0) {
+        index_.Remove(persistentId);
+    }
+    return count;
+}
+
+SceneSessionMap::const_iterator SceneSessionMap::erase(const_iterator iter)
+{
+    int32_t persistentId = iter->first;
+    auto next = map_.erase(iter);
+    index_.Remove(persistentId);
+    return next;
+}
+
+void SceneSessionMap::clear()
+{
+    map_.clear();
+    index_.Rebuild(map_);
+}
+} // namespace OHOS::Rosen
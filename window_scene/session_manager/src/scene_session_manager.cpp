@@ -46,6 +46,8 @@
 
 #ifdef POWER_MANAGER_ENABLE
 #include <power_mgr_client.h>
+#include <shutdown/shutdown_client.h>
+#include <shutdown/sync_shutdown_callback_stub.h>
 #endif
 
 #ifdef RES_SCHED_ENABLE
@@ -57,6 +59,8 @@
 #include "collaborator_dll_manager.h"
 #include "color_parser.h"
 #include "common/include/fold_screen_state_internel.h"
+#include "common/include/ipc_payload_profiler.h"
+#include "common/include/plugin_loader.h"
 #include "common/include/session_permission.h"
 #include "common/include/window_display_isolation_policy.h"
 #include "display_manager.h"
@@ -67,6 +71,7 @@
 #include "hidump_controller.h"
 #include "image_source.h"
 #include "perform_reporter.h"
+#include "persistent_storage_write_behind.h"
 #include "rdb/scope_guard.h"
 #include "rdb/starting_window_rdb_manager.h"
 #include "res_sched_client.h"
@@ -163,6 +168,12 @@ const std::string ARG_DUMP_PIPLINE = "-p";
 const std::string ARG_DUMP_SCB = "-b";
 const std::string ARG_DUMP_DETAIL = "-c";
 const std::string ARG_DUMP_RECORD = "-v";
+const std::string ARG_DUMP_LATENCY = "-l";
+const std::string ARG_DUMP_SESSION_INDEX = "-i";
+const std::string ARG_SESSION_INDEX_RESET = "reset";
+const std::string ARG_DUMP_STARTUP = "-startup";
+const std::string ARG_DUMP_IPC_PAYLOAD = "-ipc";
+const std::string ARG_DUMP_PERSISTENT_STORAGE = "-storage";
 constexpr uint64_t NANO_SECOND_PER_SEC = 1000000000; // ns
 const int32_t LOGICAL_DISPLACEMENT_32 = 32;
 constexpr int32_t GET_TOP_WINDOW_DELAY = 100;
@@ -375,6 +386,17 @@ public:
     }
 };
 
+#ifdef POWER_MANAGER_ENABLE
+class PersistentStorageShutdownCallback : public PowerMgr::SyncShutdownCallbackStub {
+public:
+    void OnSyncShutdown() override
+    {
+        TLOGI(WmsLogTag::DEFAULT, "write pending persistent storage");
+        PersistentStorageWriteBehind::GetInstance().FlushAll(true);
+    }
+};
+#endif
+
 #ifdef POWERMGR_DISPLAY_MANAGER_ENABLE
     class OverrideChangeListener : public DisplayPowerMgr::DisplayBrightnessListenerStub {
     public:
@@ -490,6 +512,7 @@ SceneSessionManager& SceneSessionManager::GetInstance()
 SceneSessionManager::SceneSessionManager() : rsInterface_(RSInterfaces::GetInstance())
 {
     taskScheduler_ = std::make_shared<TaskScheduler>(SCENE_SESSION_MANAGER_THREAD);
+    taskScheduler_->SetLaneModeEnabled(true);
     if (!mainHandler_) {
         auto runner = AppExecFwk::EventRunner::GetMainEventRunner();
         mainHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
@@ -517,6 +540,7 @@ SceneSessionManager::~SceneSessionManager()
         TLOGI(WmsLogTag::WMS_ATTRIBUTE, "unregister app observer result=%{public}d", ret);
     }
     UnregisterBrightnessDataChangeListener();
+    PersistentStorageWriteBehind::GetInstance().FlushAll(true);
 }
 
 void SceneSessionManager::Init()
@@ -530,6 +554,7 @@ void SceneSessionManager::Init()
         TLOGW(WmsLogTag::DEFAULT, "Add thread %{public}s to watchdog failed.", SCENE_SESSION_MANAGER_THREAD.c_str());
     }
 
+    StartupPhaseScope phaseScope("wms:Init");
     bundleMgr_ = GetBundleManager();
 
     // Parse configuration.
@@ -561,6 +586,7 @@ void SceneSessionManager::Init()
     isKeyboardPanelEnabled_ = system::GetParameter("persist.sceneboard.keyboardPanel.enabled", "1")  == "1";
     isTrayAppForeground_ = system::GetParameter("persist.window.tray_foreground", "") == "true";
     isSupportPcAppInPhone_ = system::GetParameter("const.window.device_feature_support_type", "0") == "1";
+    isFlushUIParamsBatchEnabled_ = system::GetParameter("persist.window.flush_ui_params_batch.enable", "1") == "1";
     // window recover
     RegisterSessionRecoverStateChangeListener();
     RegisterRecoverStateChangeListener();
@@ -606,6 +632,12 @@ void SceneSessionManager::Init()
     // Initialize locale indexing configuration
     OHOS::Rosen::TextConfig::SetLocaleTextBreakEnabled(true);
 
+#ifdef POWER_MANAGER_ENABLE
+    // scene board may be killed right after shutdown, write the batched keys before it
+    PowerMgr::ShutdownClient::GetInstance().RegisterShutdownCallback(
+        sptr<PersistentStorageShutdownCallback>::MakeSptr(), PowerMgr::ShutdownPriority::HIGH);
+#endif
+
     MotionManager::GetInstance().Init();
 }
 
@@ -2489,12 +2521,15 @@ std::vector<sptr<SceneSession>> SceneSessionManager::GetSceneSessionVectorByType
     }
     std::vector<sptr<SceneSession>> sceneSessionVector;
     std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, sceneSession] : sceneSessionMap_) {
-        if (sceneSession->GetWindowType() == type &&
-            sceneSession->GetSessionProperty()->GetDisplayId() == displayId) {
-            sceneSessionVector.emplace_back(sceneSession);
-        }
-    }
+    sceneSessionMap_.GetIndex().GetSessionsByType(type, sceneSessionVector);
+    size_t visited = sceneSessionVector.size();
+    sceneSessionVector.erase(std::remove_if(sceneSessionVector.begin(), sceneSessionVector.end(),
+        [type, displayId](const sptr<SceneSession>& sceneSession) {
+            return sceneSession->GetWindowType() != type ||
+                sceneSession->GetSessionProperty()->GetDisplayId() != displayId;
+        }), sceneSessionVector.end());
+    sceneSessionMap_.GetIndex().RecordLoop(SessionIndexLoop::SESSIONS_BY_TYPE_AND_DISPLAY, sceneSessionMap_.size(),
+        visited, sceneSessionVector.size());
     return sceneSessionVector;
 }
 
@@ -2502,11 +2537,14 @@ std::vector<sptr<SceneSession>> SceneSessionManager::GetSceneSessionVectorByType
 {
     std::vector<sptr<SceneSession>> sceneSessionVector;
     std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, sceneSession] : sceneSessionMap_) {
-        if (sceneSession->GetWindowType() == type) {
-            sceneSessionVector.emplace_back(sceneSession);
-        }
-    }
+    sceneSessionMap_.GetIndex().GetSessionsByType(type, sceneSessionVector);
+    size_t visited = sceneSessionVector.size();
+    sceneSessionVector.erase(std::remove_if(sceneSessionVector.begin(), sceneSessionVector.end(),
+        [type](const sptr<SceneSession>& sceneSession) {
+            return sceneSession->GetWindowType() != type;
+        }), sceneSessionVector.end());
+    sceneSessionMap_.GetIndex().RecordLoop(SessionIndexLoop::SESSIONS_BY_TYPE, sceneSessionMap_.size(), visited,
+        sceneSessionVector.size());
     return sceneSessionVector;
 }
 
@@ -3138,15 +3176,21 @@ sptr<SceneSession> SceneSessionManager::GetKeyboardSession(DisplayId displayId,
         return nullptr;
     }
     sptr<SceneSession> keyboardSession = nullptr;
+    std::vector<sptr<SceneSession>> screenSessions;
     std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-    for (const auto& [_, sceneSession] : sceneSessionMap_) {
-        if (sceneSession && sceneSession->GetScreenId() == displayId &&
+    sceneSessionMap_.GetIndex().GetSessionsByScreen(displayId, screenSessions);
+    size_t visited = 0;
+    for (const auto& sceneSession : screenSessions) {
+        visited++;
+        if (sceneSession->GetScreenId() == displayId &&
             sceneSession->GetWindowType() == WindowType::WINDOW_TYPE_INPUT_METHOD_FLOAT &&
             sceneSession->IsSystemKeyboard() == isSystemKeyboard) {
             keyboardSession = sceneSession;
             break;
         }
     }
+    sceneSessionMap_.GetIndex().RecordLoop(SessionIndexLoop::KEYBOARD_SESSION, sceneSessionMap_.size(), visited,
+        keyboardSession != nullptr ? 1 : 0);
     return keyboardSession;
 }
 
@@ -3736,6 +3780,9 @@ sptr<SceneSession> SceneSessionManager::RequestSceneSession(const SessionInfo& s
                 sceneSession->SetSessionInfoAncoSceneState(AncoSceneState::NOTIFY_START_FAILED);
             }
         }
+        sceneSession->SetScreenIdChangeFunc([this](int32_t persistentId, uint64_t screenId) {
+            sceneSessionMap_.GetIndex().UpdateScreenId(persistentId, screenId);
+        });
         {
             std::unique_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
             sceneSessionMap_.insert({ sceneSession->GetPersistentId(), sceneSession });
@@ -3874,6 +3921,7 @@ void SceneSessionManager::PerformRegisterInRequestSceneSession(sptr<SceneSession
     RegisterAcquireRotateAnimationConfigFunc(sceneSession);
     RegisterSceneSessionDestructNotifyManagerFunc(sceneSession);
     RegisterSessionPropertyChangeNotifyManagerFunc(sceneSession);
+    RegisterPropertyDirtyNotifyManagerFunc(sceneSession);
     RegisterClientDisplayIdChangeNotifyManagerFunc(sceneSession);
     RegisterGetRsCmdBlockingCountFunc(sceneSession);
     RegisterUpdateAppHookDisplayInfoFunc(sceneSession);
@@ -4875,6 +4923,7 @@ void SceneSessionManager::EraseSceneSessionMapById(int32_t persistentId)
     } else {
         TLOGW(WmsLogTag::WMS_PATTERN, "session is nullptr id: %{public}d", persistentId);
     }
+    windowHitIndex_.Remove(persistentId);
     std::unique_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
     EraseSceneSessionAndMarkDirtyLocked(persistentId);
     systemTopSceneSessionMap_.erase(persistentId);
@@ -4886,6 +4935,29 @@ void SceneSessionManager::EraseSceneSessionMapById(int32_t persistentId)
     }
 }
 
+void SceneSessionManager::UpdateWindowHitIndex(const sptr<SceneSession>& sceneSession)
+{
+    constexpr uint32_t hitDirtyFlags = static_cast<uint32_t>(SessionUIDirtyFlag::VISIBLE) |
+        static_cast<uint32_t>(SessionUIDirtyFlag::RECT) | static_cast<uint32_t>(SessionUIDirtyFlag::TOUCH_HOT_AREA) |
+        static_cast<uint32_t>(SessionUIDirtyFlag::Z_ORDER);
+    int32_t persistentId = sceneSession->GetPersistentId();
+    if ((sceneSession->GetDirtyFlags() & hitDirtyFlags) == 0 && windowHitIndex_.Contains(persistentId)) {
+        return;
+    }
+    WindowHitInfo info;
+    info.displayId_ = sceneSession->GetSessionProperty()->GetDisplayId();
+    info.zOrder_ = sceneSession->GetZOrder();
+    info.rect_ = sceneSession->GetSessionRect();
+    auto hotAreaBuffer = sceneSession->GetTouchHotAreaBuffer();
+    info.hotAreas_.reserve(hotAreaBuffer->Size());
+    for (size_t i = 0; i < hotAreaBuffer->Size(); i++) {
+        info.hotAreas_.push_back({ info.rect_.posX_ + hotAreaBuffer->GetPosX()[i],
+            info.rect_.posY_ + hotAreaBuffer->GetPosY()[i], static_cast<int32_t>(hotAreaBuffer->GetWidth()[i]),
+            static_cast<int32_t>(hotAreaBuffer->GetHeight()[i]) });
+    }
+    windowHitIndex_.Update(persistentId, info);
+}
+
 /**
  * if visible session is erased, mark dirty
  * lock-free
@@ -6401,7 +6473,8 @@ void SceneSessionManager::NotifySessionTouchOutside(int32_t persistentId, Displa
         }
     };
 
-    taskScheduler_->PostAsyncTask(task, "NotifySessionTouchOutside:PID" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("NotifySessionTouchOutside"),
+        TaskLane::INPUT_CRITICAL);
     return;
 }
 
@@ -9045,6 +9118,38 @@ WSError SceneSessionManager::GetSessionDumpInfo(const std::vector<std::string>&
         SessionChangeRecorder::GetInstance().GetSceneSessionNeedDumpInfo(resetParams, dumpInfo);
         return WSError::WS_OK;
     }
+    if (params.size() >= 1 && params[0] == ARG_DUMP_LATENCY) { // 1: params num
+        std::vector<std::string> latencyParams(params.begin() + 1, params.end());
+        HidumpController::GetInstance().DumpLatencyHistogram(latencyParams, dumpInfo);
+        std::ostringstream oss;
+        taskScheduler_->DumpLaneInfo(oss);
+        dumpInfo.append(oss.str());
+        return WSError::WS_OK;
+    }
+    if (params.size() >= 1 && params[0] == ARG_DUMP_SESSION_INDEX) { // 1: params num
+        if (params.size() >= 2 && params[1] == ARG_SESSION_INDEX_RESET) { // 2: params num
+            sceneSessionMap_.GetIndex().ResetLoopStats();
+            dumpInfo.append("Session index loop stats reset\n");
+            return WSError::WS_OK;
+        }
+        std::ostringstream oss;
+        sceneSessionMap_.GetIndex().DumpLoopStats(oss);
+        dumpInfo.append(oss.str());
+        return WSError::WS_OK;
+    }
+    if (params.size() == 1 && params[0] == ARG_DUMP_STARTUP) { // 1: params num
+        PluginLoader::GetInstance().DumpStartupTimeline(dumpInfo);
+        return WSError::WS_OK;
+    }
+    if (params.size() >= 1 && params[0] == ARG_DUMP_IPC_PAYLOAD) { // 1: params num
+        std::vector<std::string> ipcParams(params.begin() + 1, params.end());
+        IpcPayloadProfiler::GetInstance().DumpInfo(ipcParams, dumpInfo);
+        return WSError::WS_OK;
+    }
+    if (params.size() == 1 && params[0] == ARG_DUMP_PERSISTENT_STORAGE) { // 1: params num
+        PersistentStorageWriteBehind::GetInstance().DumpInfo(dumpInfo);
+        return WSError::WS_OK;
+    }
     return WSError::WS_ERROR_INVALID_OPERATION;
 }
 
@@ -9231,7 +9336,7 @@ WMError SceneSessionManager::RequestFocusStatus(int32_t persistentId, bool isFoc
             RequestSessionUnfocus(persistentId, reason);
         }
     };
-    taskScheduler_->PostAsyncTask(task, "RequestFocusStatus" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("RequestFocusStatus"), TaskLane::LAYOUT);
     focusChangeReason_ = reason;
     return WMError::WM_OK;
 }
@@ -9273,7 +9378,7 @@ WMError SceneSessionManager::RequestFocusStatusBySCB(int32_t persistentId, bool
             RequestSessionUnfocus(persistentId, reason, displayId);
         }
     };
-    taskScheduler_->PostAsyncTask(task, "RequestFocusStatusBySCB" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("RequestFocusStatusBySCB"), TaskLane::LAYOUT);
     return WMError::WM_OK;
 }
 
@@ -9297,7 +9402,8 @@ WMError SceneSessionManager::RequestFocusStatusBySA(int32_t persistentId, bool i
             RequestSessionUnfocus(persistentId, reason);
         }
     };
-    taskScheduler_->PostAsyncTask(task, "RequestFocusOnPreviousWindow" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("RequestFocusOnPreviousWindow"),
+        TaskLane::LAYOUT);
     return WMError::WM_OK;
 }
 
@@ -11066,12 +11172,8 @@ __attribute__((no_sanitize("cfi"))) void SceneSessionManager::OnSessionStateChan
 {
     HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:OnSessionStateChange%d", persistentId);
     TLOGD(WmsLogTag::DEFAULT, "id: %{public}d, state:%{public}u", persistentId, state);
-    SceneSessionChangeInfo changeInfo {
-        .persistentId_ = persistentId,
-        .changeInfo_ = "Session state change to " + std::to_string(static_cast<uint32_t>(state)),
-        .logTag_ = WmsLogTag::WMS_LIFE,
-    };
-    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::SESSION_STATE_RECORD, changeInfo);
+    SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::SESSION_STATE_RECORD, persistentId,
+        WmsLogTag::WMS_LIFE, RecordFormatId::SESSION_STATE_CHANGE, static_cast<uint32_t>(state));
     auto sceneSession = GetSceneSession(persistentId);
     if (sceneSession == nullptr) {
         TLOGD(WmsLogTag::DEFAULT, "session is nullptr");
@@ -12117,7 +12219,7 @@ WSError SceneSessionManager::DumpSessionAll(std::vector<std::string>& infos)
             }
         }
         return WSError::WS_OK;
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
 }
 
 WSError SceneSessionManager::DumpSessionWithId(int32_t persistentId, std::vector<std::string>& infos)
@@ -12137,7 +12239,7 @@ WSError SceneSessionManager::DumpSessionWithId(int32_t persistentId, std::vector
             infos.push_back("error: invalid mission number, please see 'aa dump --mission-list'.");
         }
         return WSError::WS_OK;
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
 }
 
 __attribute__((no_sanitize("cfi"))) WSError SceneSessionManager::GetAllAbilityInfos(
@@ -12503,7 +12605,7 @@ WSError SceneSessionManager::GetSessionSnapshot(const std::string& deviceId, int
             }
         }
         return WSError::WS_OK;
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
 }
 
 WMError SceneSessionManager::GetSessionSnapshotById(int32_t persistentId, SessionSnapshot& snapshot)
@@ -12539,7 +12641,7 @@ WMError SceneSessionManager::GetSessionSnapshotById(int32_t persistentId, Sessio
             return WMError::WM_OK;
         }
         return WMError::WM_ERROR_NULLPTR;
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
 }
 
 WMError SceneSessionManager::Snapshot(std::shared_ptr<Media::PixelMap>& pixelMap,
@@ -12598,7 +12700,7 @@ WMError SceneSessionManager::Snapshot(std::shared_ptr<Media::PixelMap>& pixelMap
             return WMError::WM_ERROR_TIMEOUT;
         }
         return WMError::WM_OK;
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
 }
 
 void SceneSessionManager::ReportPrivacyWindowSnapshotFail(const sptr<SceneSession>& sceneSession, int32_t errorCode,
@@ -12852,7 +12954,7 @@ void SceneSessionManager::NotifyWindowStateErrorFromMMI(int32_t pid, int32_t per
         }
     };
     // delay 2000ms, wait for hidumper
-    taskScheduler_->PostAsyncTask(task, __func__, 2000);
+    taskScheduler_->PostLaneTask(task, __func__, TaskLane::BACKGROUND, 2000);
 }
 
 sptr<SceneSession> SceneSessionManager::FindMainWindowWithToken(sptr<IRemoteObject> targetToken)
@@ -12947,7 +13049,7 @@ WMError SceneSessionManager::GetSurfaceNodeIdsFromMissionIds(std::vector<uint64_
         return WMError::WM_ERROR_INVALID_PERMISSION;
     }
     auto task = [this, &missionIds, &surfaceNodeIds, &needWindowTypeList, isNeedForceCheck]() {
-        std::map<int32_t, sptr<SceneSession>>::iterator iter;
+        std::map<int32_t, sptr<SceneSession>>::const_iterator iter;
         std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
         for (auto missionId : missionIds) {
             iter = sceneSessionMap_.find(static_cast<int32_t>(missionId));
@@ -13388,6 +13490,7 @@ WMError SceneSessionManager::RecoverWindowPropertyChangeFlag(uint32_t observedFl
 {
     observedFlags_ |= observedFlags;
     interestedFlags_ |= interestedFlags;
+    needScanAllPropertyDirty_ = true;
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "observedFlags: %{public}u, interestedFlags: %{public}u",
         observedFlags_, interestedFlags_);
     return WMError::WM_OK;
@@ -13398,6 +13501,7 @@ WMError SceneSessionManager::RegisterWindowPropertyChangeAgent(WindowInfoKey win
 {
     observedFlags_ |= static_cast<uint32_t>(windowInfoKey);
     interestedFlags_ |= interestInfo;
+    needScanAllPropertyDirty_ = true;
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "observedFlags: %{public}u, interestedFlags: %{public}u",
         observedFlags_, interestedFlags_);
     return RegisterWindowManagerAgent(
@@ -13495,6 +13599,29 @@ WMError SceneSessionManager::UnregisterWindowManagerAgent(WindowManagerAgentType
     return taskScheduler_->PostSyncTask(task, "UnregisterWindowManagerAgent");
 }
 
+WMError SceneSessionManager::SetWindowManagerAgentFilter(WindowManagerAgentType type,
+    const WindowManagerAgentFilter& filter, const sptr<IWindowManagerAgent>& windowManagerAgent)
+{
+    if (type != WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY &&
+        type != WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "type not supported: %{public}u", static_cast<uint32_t>(type));
+        return WMError::WM_ERROR_INVALID_PARAM;
+    }
+    if (!SessionPermission::IsSACalling()) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "permission denied!");
+        return WMError::WM_ERROR_INVALID_PERMISSION;
+    }
+    if ((windowManagerAgent == nullptr) || (windowManagerAgent->AsObject() == nullptr)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "windowManagerAgent is null");
+        return WMError::WM_ERROR_NULLPTR;
+    }
+    auto task = [windowManagerAgent, type, filter]() {
+        return SessionManagerAgentController::GetInstance().SetWindowManagerAgentFilter(
+            windowManagerAgent, type, filter);
+    };
+    return taskScheduler_->PostSyncTask(task, "SetWindowManagerAgentFilter");
+}
+
 void SceneSessionManager::UpdateCameraFloatWindowStatus(uint32_t accessTokenId, bool isShowing)
 {
     SessionManagerAgentController::GetInstance().UpdateCameraFloatWindowStatus(accessTokenId, isShowing);
@@ -13549,7 +13676,7 @@ WMError SceneSessionManager::GetAccessibilityWindowInfo(std::vector<sptr<Accessi
     }
     auto task = [this, &infos]() {
         HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "ssm:GetAccessibilityWindowInfo");
-        std::map<int32_t, sptr<SceneSession>>::iterator iter;
+        std::map<int32_t, sptr<SceneSession>>::const_iterator iter;
         std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
         for (iter = sceneSessionMap_.begin(); iter != sceneSessionMap_.end(); iter++) {
             sptr<SceneSession> sceneSession = iter->second;
@@ -13716,7 +13843,7 @@ void SceneSessionManager::NotifyWindowInfoChange(int32_t persistentId, WindowUpd
                 WindowChangedFunc_(sceneSession->GetPersistentId(), type);
             }
         };
-        taskScheduler_->PostAsyncTask(task, "WindowChangeFunc:id:" + std::to_string(persistentId));
+        taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("WindowChangeFunc"));
         return;
     }
     auto task = [this, weakSceneSession, type]() {
@@ -13727,7 +13854,7 @@ void SceneSessionManager::NotifyWindowInfoChange(int32_t persistentId, WindowUpd
             WindowChangedFunc_(sceneSession->GetPersistentId(), type);
         }
     };
-    taskScheduler_->PostAsyncTask(task, "NotifyWindowInfoChange:PID:" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("NotifyWindowInfoChange"));
     auto notifySceneInputTask = [weakSceneSession, type]() {
         auto sceneSession = weakSceneSession.promote();
         if (sceneSession == nullptr) {
@@ -13735,7 +13862,8 @@ void SceneSessionManager::NotifyWindowInfoChange(int32_t persistentId, WindowUpd
         }
         SceneInputManager::GetInstance().NotifyWindowInfoChange(sceneSession, type);
     };
-    taskScheduler_->PostAsyncTask(notifySceneInputTask, "notifySceneInputTask");
+    taskScheduler_->PostAsyncTask(std::move(notifySceneInputTask), WMS_TASK_NAME("notifySceneInputTask"),
+        TaskLane::INPUT_CRITICAL);
 }
 
 bool SceneSessionManager::FillWindowInfo(std::vector<sptr<AccessibilityWindowInfo>>& infos,
@@ -13954,6 +14082,11 @@ void SceneSessionManager::SetSessionVisibilityInfo(const sptr<SceneSession>& ses
     windowVisibilityInfo->SetIsSystem(session->GetSessionInfo().isSystem_);
     windowVisibilityInfo->SetZOrder(session->GetZOrder());
     windowVisibilityInfo->SetCollaboratorType(session->GetCollaboratorType());
+    DisplayId displayId = session->GetSessionProperty()->GetDisplayId();
+    if (session->IsPcFoldDevice() && PcFoldScreenManager::GetInstance().IsHalfFolded(displayId)) {
+        displayId = session->GetClientDisplayId();
+    }
+    windowVisibilityInfo->SetDisplayId(displayId);
     if (auto sceneSession = GetSceneSession(session->GetMainWindowPersistentId())) {
         windowVisibilityInfo->SetMainWindowPersistentId(session->GetMainWindowPersistentId());
         windowVisibilityInfo->SetControlAppType(sceneSession->GetControlAppType());
@@ -14441,6 +14574,11 @@ void SceneSessionManager::WindowDestroyNotifyVisibility(const sptr<SceneSession>
         windowVisibilityInfo->SetAbilityName(sceneSession->GetSessionInfo().abilityName_);
         windowVisibilityInfo->SetIsSystem(sceneSession->GetSessionInfo().isSystem_);
         windowVisibilityInfo->SetZOrder(sceneSession->GetZOrder());
+        DisplayId displayId = sceneSession->GetSessionProperty()->GetDisplayId();
+        if (sceneSession->IsPcFoldDevice() && PcFoldScreenManager::GetInstance().IsHalfFolded(displayId)) {
+            displayId = sceneSession->GetClientDisplayId();
+        }
+        windowVisibilityInfo->SetDisplayId(displayId);
         windowVisibilityInfos.emplace_back(windowVisibilityInfo);
 #ifdef MEMMGR_WINDOW_ENABLE
         memMgrWindowInfos.emplace_back(new Memory::MemMgrWindowInfo(sceneSession->GetWindowId(),
@@ -14746,8 +14884,9 @@ void SceneSessionManager::UpdateAvoidSessionAvoidArea(WindowType type)
             TLOGE(WmsLogTag::WMS_IMMS, "id: %{public}d invalid scale", sceneSession->GetPersistentId());
             continue;
         }
-        AvoidArea avoidArea = sceneSession->GetAvoidAreaByType(avoidType);
-        sceneSession->UpdateAvoidArea(new AvoidArea(avoidArea), avoidType);
+        WSRect sessionRect = sceneSession->GetSessionRect();
+        AvoidArea avoidArea = sceneSession->GetAvoidAreaByType(avoidType, sessionRect);
+        sceneSession->UpdateAvoidArea(new AvoidArea(avoidArea), avoidType, sessionRect);
     }
 }
 
@@ -14822,8 +14961,12 @@ void SceneSessionManager::UpdateAvoidArea(int32_t persistentId)
         bool needUpdate = false;
         auto sceneSession = GetSceneSession(persistentId);
         if (sceneSession != nullptr && sceneSession->IsImmersiveType()) {
+            dirtyAvoidProviderIds_.insert(persistentId);
             UpdateAvoidSessionAvoidArea(sceneSession->GetWindowType());
         } else {
+            if (sceneSession != nullptr) {
+                sceneSession->MarkQueryStateOutdated();
+            }
             UpdateNormalSessionAvoidArea(persistentId, sceneSession, needUpdate);
         }
         if (needUpdate) {
@@ -16094,7 +16237,7 @@ WSError SceneSessionManager::UpdateMaximizeMode(int32_t persistentId, bool isMax
         sceneSession->UpdateMaximizeMode(isMaximize);
         return WSError::WS_OK;
     };
-    taskScheduler_->PostAsyncTask(task, "UpdateMaximizeMode:PID:" + std::to_string(persistentId));
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("UpdateMaximizeMode"));
     return WSError::WS_OK;
 }
 
@@ -16441,91 +16584,229 @@ void SceneSessionManager::FlushUIParams(ScreenId screenId, std::unordered_map<in
     if (onFlushUIParamsFunc_ != nullptr) {
         onFlushUIParamsFunc_();
     }
-    taskScheduler_->PostAsyncTask([this, screenId, uiParams = std::move(uiParams)]() THREAD_SAFETY_GUARD(SCENE_GUARD) {
-        HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "SceneSessionManager::FlushUIParams");
-        TLOGND(WmsLogTag::WMS_PIPELINE, "FlushUIParams");
-        {
-            std::unique_lock<std::mutex> lock(nextFlushCompletedMutex_);
-            nextFlushCompletedCV_.notify_all();
+    if (!isFlushUIParamsBatchEnabled_) {
+        ScreenUIParamMap screenUIParams;
+        screenUIParams.emplace(screenId, std::move(uiParams));
+        taskScheduler_->PostAsyncTask([this, screenUIParams = std::move(screenUIParams)]()
+            THREAD_SAFETY_GUARD(SCENE_GUARD) {
+            ProcessFlushUIParams(screenUIParams);
+        }, WMS_TASK_NAME(__func__), TaskLane::LAYOUT);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pendingUIParamsMutex_);
+        AddPendingUIParams(screenId, std::move(uiParams));
+        if (isFlushUIParamsTaskPending_) {
+            return;
         }
-        std::vector<std::pair<uint32_t, uint32_t>> appZOrderList;
-        processingFlushUIParams_.store(true);
-        auto keyboardSession = GetKeyboardSession(screenId, false);
-        {
-            std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-            for (const auto& [_, sceneSession] : sceneSessionMap_) {
-                if (sceneSession == nullptr) {
-                    continue;
-                }
-                if (sceneSession->GetSessionInfo().screenId_ != SCREEN_ID_INVALID &&
-                    sceneSession->GetSessionInfo().screenId_ != screenId) {
-                    continue;
+        isFlushUIParamsTaskPending_ = true;
+    }
+    taskScheduler_->PostAsyncTask([this]() THREAD_SAFETY_GUARD(SCENE_GUARD) {
+        FlushPendingUIParams();
+    }, WMS_TASK_NAME(__func__), TaskLane::LAYOUT);
+}
+
+void SceneSessionManager::AddPendingUIParams(ScreenId screenId,
+    std::unordered_map<int32_t, SessionUIParam>&& uiParams)
+{
+    auto iter = pendingUIParams_.find(screenId);
+    if (iter == pendingUIParams_.end()) {
+        pendingUIParams_.emplace(screenId, std::move(uiParams));
+        return;
+    }
+    // the latest frame of a screen wins, but a rect sync asked by the replaced frame must not be lost
+    for (auto& [persistentId, uiParam] : uiParams) {
+        auto pendingIter = iter->second.find(persistentId);
+        if (uiParam.needSync_ || pendingIter == iter->second.end() || !pendingIter->second.needSync_) {
+            continue;
+        }
+        uiParam.rect_ = pendingIter->second.rect_;
+        uiParam.transX_ = pendingIter->second.transX_;
+        uiParam.transY_ = pendingIter->second.transY_;
+        uiParam.needSync_ = true;
+    }
+    TLOGND(WmsLogTag::WMS_PIPELINE, "merge frame of screen: %{public}" PRIu64, screenId);
+    iter->second = std::move(uiParams);
+}
+
+void SceneSessionManager::FlushPendingUIParams()
+{
+    ScreenUIParamMap pendingUIParams;
+    {
+        std::lock_guard<std::mutex> lock(pendingUIParamsMutex_);
+        pendingUIParams.swap(pendingUIParams_);
+        isFlushUIParamsTaskPending_ = false;
+    }
+    ProcessFlushUIParams(pendingUIParams);
+}
+
+void SceneSessionManager::ProcessFlushUIParams(const ScreenUIParamMap& screenUIParams)
+{
+    HITRACE_METER_FMT(HITRACE_TAG_WINDOW_MANAGER, "SceneSessionManager::FlushUIParams screens:%zu",
+        screenUIParams.size());
+    TLOGND(WmsLogTag::WMS_PIPELINE, "FlushUIParams, screens: %{public}zu", screenUIParams.size());
+    {
+        std::unique_lock<std::mutex> lock(nextFlushCompletedMutex_);
+        nextFlushCompletedCV_.notify_all();
+    }
+    std::vector<std::pair<uint32_t, uint32_t>> appZOrderList;
+    std::vector<ScreenId> screenIds;
+    std::vector<sptr<SceneSession>> keyboardSessions;
+    for (const auto& [screenId, _] : screenUIParams) {
+        screenIds.push_back(screenId);
+        if (auto keyboardSession = GetKeyboardSession(screenId, false)) {
+            keyboardSessions.push_back(keyboardSession);
+        }
+    }
+    processingFlushUIParams_.store(true);
+    {
+        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+        // sessions not placed on a screen yet take the params of any screen
+        std::vector<ScreenId> flushScreenIds = screenIds;
+        if (screenUIParams.count(SCREEN_ID_INVALID) == 0) {
+            flushScreenIds.push_back(SCREEN_ID_INVALID);
+        }
+        std::vector<sptr<SceneSession>> flushSessions;
+        sceneSessionMap_.GetIndex().GetSessionsByScreens(flushScreenIds, flushSessions);
+        size_t matched = 0;
+        for (const auto& sceneSession : flushSessions) {
+            int32_t persistentId = sceneSession->GetPersistentId();
+            ScreenId sessionScreenId = sceneSession->GetSessionInfo().screenId_;
+            auto screenIter = screenUIParams.find(sessionScreenId);
+            if (sessionScreenId != SCREEN_ID_INVALID && screenIter == screenUIParams.end()) {
+                continue;
+            }
+            matched++;
+            const SessionUIParam* uiParam = nullptr;
+            if (sessionScreenId != SCREEN_ID_INVALID) {
+                if (auto iter = screenIter->second.find(persistentId); iter != screenIter->second.end()) {
+                    uiParam = &iter->second;
                 }
-                if (auto iter = uiParams.find(sceneSession->GetPersistentId()); iter != uiParams.end()) {
-                    if (sceneSession->GetSessionInfo().screenId_ == SCREEN_ID_INVALID) {
+            } else {
+                for (const auto& [screenId, uiParams] : screenUIParams) {
+                    if (auto iter = uiParams.find(persistentId); iter != uiParams.end()) {
                         sceneSession->SetScreenIdOnServer(screenId);
+                        uiParam = &iter->second;
+                        break;
                     }
-                    if ((systemConfig_.IsPhoneWindow() || systemConfig_.IsPadWindow()) &&
-                        sceneSession->IsAppSession()) {
-                        if (!sceneSession->IsVisible()) {
-                            appZOrderList.push_back(std::make_pair(0, iter->second.zOrder_));
-                        }
-                        appZOrderList.push_back(std::make_pair(sceneSession->GetZOrder(), iter->second.zOrder_));
-                    }
-                    sessionMapDirty_ |= sceneSession->UpdateUIParam(iter->second);
-                } else {
-                    sessionMapDirty_ |= sceneSession->UpdateUIParam();
                 }
             }
-            if (keyboardSession != nullptr) {
-                keyboardSession->CalculateOccupiedAreaAfterUIRefresh();
+            if (uiParam == nullptr) {
+                sessionMapDirty_ |= sceneSession->UpdateUIParam();
+                continue;
             }
+            if ((systemConfig_.IsPhoneWindow() || systemConfig_.IsPadWindow()) && sceneSession->IsAppSession()) {
+                if (!sceneSession->IsVisible()) {
+                    appZOrderList.push_back(std::make_pair(0, uiParam->zOrder_));
+                }
+                appZOrderList.push_back(std::make_pair(sceneSession->GetZOrder(), uiParam->zOrder_));
+            }
+            sessionMapDirty_ |= sceneSession->UpdateUIParam(*uiParam);
+        }
+        sceneSessionMap_.GetIndex().RecordLoop(SessionIndexLoop::FLUSH_UI_PARAMS, sceneSessionMap_.size(),
+            flushSessions.size(), matched);
+        for (const auto& keyboardSession : keyboardSessions) {
+            keyboardSession->CalculateOccupiedAreaAfterUIRefresh();
         }
-        processingFlushUIParams_.store(false);
+    }
+    processingFlushUIParams_.store(false);
 
-        // post process if dirty
-        if ((sessionMapDirty_ & (~static_cast<uint32_t>(SessionUIDirtyFlag::AVOID_AREA))) !=
-            static_cast<uint32_t>(SessionUIDirtyFlag::NONE)) {
-            TLOGND(WmsLogTag::WMS_PIPELINE, "FlushUIParams found dirty: %{public}d", sessionMapDirty_);
+    // post process if dirty
+    if ((sessionMapDirty_ & (~static_cast<uint32_t>(SessionUIDirtyFlag::AVOID_AREA))) !=
+        static_cast<uint32_t>(SessionUIDirtyFlag::NONE)) {
+        TLOGND(WmsLogTag::WMS_PIPELINE, "FlushUIParams found dirty: %{public}d", sessionMapDirty_);
+        for (const auto& [screenId, uiParams] : screenUIParams) {
             for (const auto& item : uiParams) {
-                TLOGND(WmsLogTag::WMS_PIPELINE, "id: %{public}d, zOrder: %{public}d, rect: %{public}s, transX:%{public}f,"
-                    " transY:%{public}f, needSync:%{public}d, interactive:%{public}d", item.first, item.second.zOrder_,
+                TLOGND(WmsLogTag::WMS_PIPELINE, "screen: %{public}" PRIu64 ", id: %{public}d, zOrder: %{public}d, "
+                    "rect: %{public}s, transX:%{public}f, transY:%{public}f, needSync:%{public}d, "
+                    "interactive:%{public}d", screenId, item.first, item.second.zOrder_,
                     item.second.rect_.ToString().c_str(), item.second.transX_, item.second.transY_,
                     item.second.needSync_, item.second.interactive_);
             }
-            ProcessUpdateLastFocusedAppId(appZOrderList);
-            ProcessFocusZOrderChange(sessionMapDirty_);
-            PostProcessFocus();
-            PostProcessProperty(sessionMapDirty_);
-            NotifyAllAccessibilityInfo();
-            AnomalyDetection::SceneZOrderCheckProcess();
-        } else if (sessionMapDirty_ == static_cast<uint32_t>(SessionUIDirtyFlag::AVOID_AREA)) {
-            PostProcessProperty(sessionMapDirty_);
         }
-        SceneInputManager::GetInstance().SetIsRotationBegin(false);
-        FlushWindowInfoToMMI();
-        NotifyWindowPropertyChange(screenId);
-        sessionMapDirty_ = 0;
-        {
-            std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-            for (const auto& [_, sceneSession] : sceneSessionMap_) {
-                if (sceneSession == nullptr) {
-                    continue;
-                }
-                sceneSession->ResetSizeChangeReasonIfDirty();
-                sceneSession->ResetDirtyFlags();
-                if (WindowHelper::IsMainWindow(sceneSession->GetWindowType())) {
-                    sceneSession->SetUIStateDirty(false);
-                }
+        ProcessUpdateLastFocusedAppId(appZOrderList);
+        ProcessFocusZOrderChange(sessionMapDirty_);
+        PostProcessFocus();
+        PostProcessProperty(sessionMapDirty_);
+        NotifyAllAccessibilityInfo();
+        AnomalyDetection::SceneZOrderCheckProcess();
+    } else if (sessionMapDirty_ == static_cast<uint32_t>(SessionUIDirtyFlag::AVOID_AREA)) {
+        PostProcessProperty(sessionMapDirty_);
+    }
+    SceneInputManager::GetInstance().SetIsRotationBegin(false);
+    FlushWindowInfoToMMI();
+    NotifyWindowPropertyChange(screenIds);
+    sessionMapDirty_ = 0;
+    std::vector<sptr<SceneSession>> publishSessions;
+    {
+        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+        bool isAllAvoidAreasDirty = false;
+        auto dirtyAvoidAreas = CollectDirtyAvoidAreasLocked(isAllAvoidAreasDirty);
+        auto isInDirtyAvoidArea = [&dirtyAvoidAreas, isAllAvoidAreasDirty](const sptr<SceneSession>& sceneSession) {
+            if (isAllAvoidAreasDirty) {
+                return true;
             }
-        }
-        if (needCloseSync_) {
-            if (closeSyncFunc_) {
-                closeSyncFunc_();
+            DisplayId displayId = sceneSession->GetSessionProperty()->GetDisplayId();
+            WSRect rect = sceneSession->GetSessionRect();
+            return std::any_of(dirtyAvoidAreas.begin(), dirtyAvoidAreas.end(), [displayId, &rect](const auto& area) {
+                return area.first == displayId && area.second.IsOverlap(rect);
+            });
+        };
+        for (const auto& [_, sceneSession] : sceneSessionMap_) {
+            if (sceneSession == nullptr) {
+                continue;
+            }
+            sceneSession->ResetSizeChangeReasonIfDirty();
+            UpdateWindowHitIndex(sceneSession);
+            if (sceneSession->IsQueryStateOutdated() || isInDirtyAvoidArea(sceneSession)) {
+                publishSessions.push_back(sceneSession);
+            }
+            sceneSession->ResetDirtyFlags();
+            if (WindowHelper::IsMainWindow(sceneSession->GetWindowType())) {
+                sceneSession->SetUIStateDirty(false);
             }
-            needCloseSync_ = false;
         }
-    }, __func__);
+    }
+    // getting the avoid areas takes sceneSessionMapMutex_ again, so publish after releasing it
+    for (const auto& sceneSession : publishSessions) {
+        sceneSession->PublishQueryState();
+    }
+    if (needCloseSync_) {
+        if (closeSyncFunc_) {
+            closeSyncFunc_();
+        }
+        needCloseSync_ = false;
+    }
+}
+
+std::vector<std::pair<DisplayId, WSRect>> SceneSessionManager::CollectDirtyAvoidAreasLocked(
+    bool& isAllAvoidAreasDirty)
+{
+    // the old and new rects of the changed bar and keyboard windows, the sessions they overlap get new avoid areas
+    std::vector<std::pair<DisplayId, WSRect>> dirtyAvoidAreas;
+    auto addAvoidArea = [&dirtyAvoidAreas](const sptr<SceneSession>& sceneSession) {
+        dirtyAvoidAreas.emplace_back(sceneSession->GetSessionProperty()->GetDisplayId(),
+            sceneSession->GetSessionRect());
+        if (auto queryState = sceneSession->GetQueryState()) {
+            dirtyAvoidAreas.emplace_back(queryState->displayId_, queryState->rect_);
+        }
+    };
+    for (int32_t persistentId : dirtyAvoidProviderIds_) {
+        auto iter = sceneSessionMap_.find(persistentId);
+        if (iter != sceneSessionMap_.end() && iter->second != nullptr) {
+            addAvoidArea(iter->second);
+        } else {
+            // the rect of a removed window is unknown
+            isAllAvoidAreasDirty = true;
+        }
+    }
+    dirtyAvoidProviderIds_.clear();
+    for (const auto& [persistentId, sceneSession] : sceneSessionMap_) {
+        if (sceneSession != nullptr && sceneSession->IsImmersiveType() && sceneSession->GetDirtyFlags() != 0) {
+            addAvoidArea(sceneSession);
+        }
+    }
+    return dirtyAvoidAreas;
 }
 
 void SceneSessionManager::ProcessUpdateLastFocusedAppId(const std::vector<std::pair<uint32_t, uint32_t>>& zOrderList)
@@ -17519,13 +17800,13 @@ void SceneSessionManager::FlushWindowInfoToMMI(const bool forceFlush)
             std::move(fullInfoForMMI.uiExtensionInfoList), std::move(fullInfoForMMI.pixelMapList), forceFlush);
     };
     TLOGD(WmsLogTag::WMS_EVENT, "in");
-    taskScheduler_->PostAsyncTask(task, __func__);
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME(__func__), TaskLane::INPUT_CRITICAL);
 }
 
 void SceneSessionManager::PostFlushWindowInfoTask(FlushWindowInfoTask&& task,
     const std::string& taskName, const int delayTime)
 {
-    taskScheduler_->PostAsyncTask(std::move(task), taskName, delayTime);
+    taskScheduler_->PostLaneTask(std::move(task), taskName, TaskLane::INPUT_CRITICAL, delayTime);
 }
 
 bool SceneSessionManager::GetExtensionWindowIds(const sptr<IRemoteObject>& token, int32_t& persistentId,
@@ -17621,7 +17902,7 @@ void SceneSessionManager::UpdateModalExtensionRect(const sptr<IRemoteObject>& to
             parentSession->UpdateNormalModalUIExtension(extensionInfo);
         }
     };
-    taskScheduler_->PostAsyncTask(task, "UpdateModalExtensionRect");
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("UpdateModalExtensionRect"));
 }
 
 void SceneSessionManager::ProcessModalExtensionPointDown(const sptr<IRemoteObject>& token, int32_t posX, int32_t posY)
@@ -17646,7 +17927,8 @@ void SceneSessionManager::ProcessModalExtensionPointDown(const sptr<IRemoteObjec
             }
         }
     };
-    taskScheduler_->PostAsyncTask(task, "ProcessModalExtensionPointDown");
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("ProcessModalExtensionPointDown"),
+        TaskLane::INPUT_CRITICAL);
 }
 
 void SceneSessionManager::AddExtensionWindowStageToSCB(const sptr<ISessionStage>& sessionStage,
@@ -18416,22 +18698,24 @@ bool SceneSessionManager::SubtractIntersectArea(std::shared_ptr<SkRegion>& unacc
         TLOGW(WmsLogTag::WMS_ATTRIBUTE, "space or session is null");
         return false;
     }
-    auto hotAreas = sceneSession->GetTouchHotAreas();
+    // borrow the hot areas instead of copying them for every window of every display
+    auto hotAreaBuffer = sceneSession->GetTouchHotAreaBuffer();
     WSRect wsRect = sceneSession->GetSessionRect();
-    for (auto& rect : hotAreas) {
-        TLOGD(WmsLogTag::WMS_ATTRIBUTE, "id=%{public}d, rect=%{public}s, hotArea=%{public}s",
-            static_cast<int32_t>(sceneSession->GetPersistentId()), wsRect.ToString().c_str(), rect.ToString().c_str());
-        if (rect != Rect::EMPTY_RECT) {
-            rect.posX_ += wsRect.posX_;
-            rect.posY_ += wsRect.posY_;
-        }
-    }
-    if (hotAreas.empty()) {
-        hotAreas.push_back({.posX_ = wsRect.posX_, .posY_ = wsRect.posY_,
-                            .width_ = wsRect.width_, .height_ = wsRect.height_});
-    }
+    size_t hotAreaCount = hotAreaBuffer->Empty() ? 1 : hotAreaBuffer->Size();
     bool hasIntersectArea = false;
-    for (const auto& rect : hotAreas) {
+    for (size_t i = 0; i < hotAreaCount; i++) {
+        Rect rect = { wsRect.posX_, wsRect.posY_, static_cast<uint32_t>(wsRect.width_),
+            static_cast<uint32_t>(wsRect.height_) };
+        if (!hotAreaBuffer->Empty()) {
+            rect = hotAreaBuffer->GetRect(i);
+            TLOGD(WmsLogTag::WMS_ATTRIBUTE, "id=%{public}d, rect=%{public}s, hotArea=%{public}s",
+                static_cast<int32_t>(sceneSession->GetPersistentId()), wsRect.ToString().c_str(),
+                rect.ToString().c_str());
+            if (rect != Rect::EMPTY_RECT) {
+                rect.posX_ += wsRect.posX_;
+                rect.posY_ += wsRect.posY_;
+            }
+        }
         SkIRect windowBounds {.fLeft = rect.posX_, .fTop = rect.posY_,
                               .fRight = rect.posX_ + rect.width_, .fBottom = rect.posY_ + rect.height_};
         SkRegion windowRegion(windowBounds);
@@ -18619,7 +18903,7 @@ void SceneSessionManager::CheckSceneZOrder()
     auto task = [this]() {
         AnomalyDetection::SceneZOrderCheckProcess();
     };
-    taskScheduler_->PostAsyncTask(task, "CheckSceneZOrder");
+    taskScheduler_->PostAsyncTask(std::move(task), WMS_TASK_NAME("CheckSceneZOrder"), TaskLane::BACKGROUND);
 }
 
 WSError SceneSessionManager::NotifyEnterRecentTask(bool enterRecent)
@@ -18749,7 +19033,8 @@ WMError SceneSessionManager::GetWindowIdsByCoordinate(DisplayId displayId, int32
     std::string callerBundleName = SessionPermission::GetCallingBundleName();
     ChangeWindowRectYInVirtualDisplay(displayId, y);
     bool checkPoint = (x >= 0 && y >= 0);
-    auto func = [displayId, callerBundleName = std::move(callerBundleName), checkPoint, x, y,
+    bool useQueryState = checkPoint && Session::IsScbCoreEnabled();
+    auto func = [displayId, callerBundleName = std::move(callerBundleName), checkPoint, useQueryState, x, y,
         findAllWindow, &windowNumber, &windowIds](const sptr<SceneSession>& session) {
         if (session == nullptr) {
             return false;
@@ -18757,10 +19042,12 @@ WMError SceneSessionManager::GetWindowIdsByCoordinate(DisplayId displayId, int32
         if (!findAllWindow && windowNumber == 0) {
             return true;
         }
+        auto queryState = useQueryState ? session->GetQueryState() : nullptr;
         bool isSameBundleName = session->GetSessionInfo().bundleName_ == callerBundleName;
-        bool isSameDisplayId = session->GetSessionProperty()->GetDisplayId() == displayId;
+        bool isSameDisplayId =
+            (queryState ? queryState->displayId_ : session->GetSessionProperty()->GetDisplayId()) == displayId;
         bool isRsVisible = session->GetRSVisible();
-        WSRect windowRect = session->GetSessionRect();
+        WSRect windowRect = queryState ? queryState->rect_ : session->GetSessionRect();
         bool isPointInWindowRect = SessionHelper::IsPointInRect(x, y, SessionHelper::TransferToRect(windowRect));
         TLOGND(WmsLogTag::DEFAULT, "persistentId %{public}d bundleName %{public}s displayId %{public}" PRIu64
                " isRsVisible %{public}d checkPoint %{public}d isPointInWindowRect %{public}d",
@@ -18773,6 +19060,16 @@ WMError SceneSessionManager::GetWindowIdsByCoordinate(DisplayId displayId, int32
         windowNumber--;
         return false;
     };
+    if (useQueryState) {
+        // the hit index and query states are published at the end of FlushUIParams, no need for the main thread
+        // only the windows containing the point are visited, from top to bottom as the session tree
+        for (auto persistentId : windowHitIndex_.QueryAll(displayId, x, y)) {
+            if (func(GetSceneSession(persistentId))) {
+                break;
+            }
+        }
+        return WMError::WM_OK;
+    }
     return taskScheduler_->PostSyncTask([this, func = std::move(func)] {
         TraverseSessionTree(func, true);
         return WMError::WM_OK;
@@ -18915,7 +19212,7 @@ WMError SceneSessionManager::GetMainWindowSnapshot(const std::vector<int32_t>& w
         return ret;
     }
     const char* const where = __func__;
-    taskScheduler_->PostAsyncTask([this, callback, config, windowIds, where] {
+    taskScheduler_->PostLaneTask([this, callback, config, windowIds, where] {
         std::vector<std::shared_ptr<Media::PixelMap>> pixelMaps;
         WMError errCode = WMError::WM_OK;
         for (const auto windowId : windowIds) {
@@ -18944,7 +19241,7 @@ WMError SceneSessionManager::GetMainWindowSnapshot(const std::vector<int32_t>& w
         } else {
             TLOGNE(WmsLogTag::WMS_LIFE, "getSnapshotCallback is null");
         }
-    }, __func__);
+    }, __func__, TaskLane::BACKGROUND);
     return ret;
 }
  
@@ -19570,7 +19867,7 @@ WMError SceneSessionManager::SkipSnapshotForAppProcess(int32_t pid, bool skip)
             }
         }
     };
-    taskScheduler_->PostTask(task, "SkipSnapshotForAppProcess");
+    taskScheduler_->PostLaneTask(task, "SkipSnapshotForAppProcess", TaskLane::BACKGROUND);
     return WMError::WM_OK;
 }
 
@@ -21357,98 +21654,141 @@ WSError SceneSessionManager::NotifySessionPropertyChangeFromSession(int32_t pers
     return WSError::WS_OK;
 }
 
+void SceneSessionManager::RegisterPropertyDirtyNotifyManagerFunc(const sptr<SceneSession>& sceneSession)
+{
+    if (sceneSession == nullptr) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "session is nullptr");
+        return;
+    }
+    sceneSession->SetPropertyDirtyListener([this](int32_t persistentId) {
+        AddPropertyDirtySession(persistentId);
+    });
+}
+
+void SceneSessionManager::AddPropertyDirtySession(int32_t persistentId)
+{
+    std::lock_guard<std::mutex> lock(propertyDirtySessionIdsMutex_);
+    propertyDirtySessionIds_.insert(persistentId);
+}
+
+std::vector<int32_t> SceneSessionManager::TakePropertyDirtySessions()
+{
+    std::vector<int32_t> persistentIds;
+    if (needScanAllPropertyDirty_.exchange(false)) {
+        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
+        for (const auto& [persistentId, sceneSession] : sceneSessionMap_) {
+            if (sceneSession != nullptr && sceneSession->GetPropertyDirtyFlags() != 0) {
+                persistentIds.push_back(persistentId);
+            }
+        }
+    }
+    std::lock_guard<std::mutex> lock(propertyDirtySessionIdsMutex_);
+    persistentIds.insert(persistentIds.end(), propertyDirtySessionIds_.begin(), propertyDirtySessionIds_.end());
+    propertyDirtySessionIds_.clear();
+    std::sort(persistentIds.begin(), persistentIds.end());
+    persistentIds.erase(std::unique(persistentIds.begin(), persistentIds.end()), persistentIds.end());
+    return persistentIds;
+}
+
 void SceneSessionManager::NotifyWindowPropertyChangeByWindowInfoKey(
     const sptr<SceneSession>& sceneSession, WindowInfoKey windowInfoKey)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "windowInfoKey: %{public}u", static_cast<uint32_t>(windowInfoKey));
-    WindowInfoList windowInfoList;
-    std::unordered_map<WindowInfoKey, WindowChangeInfoType> windowPropertyChangeInfo;
-    PackWindowPropertyChangeInfo(sceneSession, windowPropertyChangeInfo);
-    windowInfoList.push_back(windowPropertyChangeInfo);
-    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(
-        static_cast<uint32_t>(windowInfoKey), windowInfoList);
+    WindowPropertyChangeBatch batch;
+    batch.AddPropertyDirtyFlags(static_cast<uint32_t>(windowInfoKey));
+    PackWindowPropertyChangeRecord(sceneSession, batch);
+    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(batch);
 }
 
 void SceneSessionManager::NotifyWindowPropertyChange(ScreenId screenId)
+{
+    NotifyWindowPropertyChange(std::vector<ScreenId> { screenId });
+}
+
+void SceneSessionManager::NotifyWindowPropertyChange(const std::vector<ScreenId>& screenIds)
 {
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "ObservedFlags: %{public}u, interestedFlags: %{public}u",
         observedFlags_, interestedFlags_);
-    WindowInfoList windowInfoList;
-    uint32_t propertyDirtyFlags = 0;
-    {
-        std::shared_lock<std::shared_mutex> lock(sceneSessionMapMutex_);
-        for (const auto& [_, sceneSession] : sceneSessionMap_) {
-            if (sceneSession == nullptr) {
-                TLOGW(WmsLogTag::WMS_ATTRIBUTE, "sceneSession nullptr");
-                continue;
-            }
-            if (sceneSession->GetSessionInfo().screenId_ != SCREEN_ID_INVALID &&
-                sceneSession->GetSessionInfo().screenId_ != screenId) {
-                continue;
-            }
-            if (!(sceneSession->GetPropertyDirtyFlags() & observedFlags_)) {
-                continue;
-            }
-            propertyDirtyFlags |= sceneSession->GetPropertyDirtyFlags();
-            std::unordered_map<WindowInfoKey, WindowChangeInfoType> windowPropertyChangeInfo;
-            PackWindowPropertyChangeInfo(sceneSession, windowPropertyChangeInfo);
-            windowInfoList.emplace_back(windowPropertyChangeInfo);
-            sceneSession->SetPropertyDirtyFlags(0);
+    auto& batch = propertyChangeBatch_;
+    batch.Clear();
+    for (auto persistentId : TakePropertyDirtySessions()) {
+        auto sceneSession = GetSceneSession(persistentId);
+        if (sceneSession == nullptr) {
+            continue;
+        }
+        ScreenId sessionScreenId = sceneSession->GetSessionInfo().screenId_;
+        if (sessionScreenId != SCREEN_ID_INVALID &&
+            std::find(screenIds.begin(), screenIds.end(), sessionScreenId) == screenIds.end()) {
+            // left for the flush of its own screen
+            AddPropertyDirtySession(persistentId);
+            continue;
+        }
+        // unobserved flags are kept, and reported after being observed
+        if (!(sceneSession->GetPropertyDirtyFlags() & observedFlags_)) {
+            continue;
         }
+        batch.AddPropertyDirtyFlags(sceneSession->GetPropertyDirtyFlags());
+        PackWindowPropertyChangeRecord(sceneSession, batch);
+        sceneSession->SetPropertyDirtyFlags(0);
     }
-    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(propertyDirtyFlags, windowInfoList);
+    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(batch);
 }
 
-void SceneSessionManager::PackWindowPropertyChangeInfo(const sptr<SceneSession>& sceneSession,
-    std::unordered_map<WindowInfoKey, WindowChangeInfoType>& windowPropertyChangeInfo)
+void SceneSessionManager::PackWindowPropertyChangeRecord(const sptr<SceneSession>& sceneSession,
+    WindowPropertyChangeBatch& batch)
 {
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::WINDOW_ID)) {
-        windowPropertyChangeInfo[WindowInfoKey::WINDOW_ID] = sceneSession->GetWindowId();
+    auto& record = batch.AddRecord();
+    auto addKey = [this, &record](SessionPropertyFlag flag) {
+        if (interestedFlags_ & static_cast<uint32_t>(flag)) {
+            record.presentKeys_ |= static_cast<uint32_t>(flag);
+            return true;
+        }
+        return false;
+    };
+    const auto& sessionInfo = sceneSession->GetSessionInfo();
+    if (addKey(SessionPropertyFlag::WINDOW_ID)) {
+        record.windowId_ = sceneSession->GetWindowId();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::BUNDLE_NAME)) {
-        windowPropertyChangeInfo[WindowInfoKey::BUNDLE_NAME] = sceneSession->GetSessionInfo().bundleName_;
+    if (addKey(SessionPropertyFlag::BUNDLE_NAME)) {
+        record.bundleNameIndex_ = batch.InternString(sessionInfo.bundleName_);
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::ABILITY_NAME)) {
-        windowPropertyChangeInfo[WindowInfoKey::ABILITY_NAME] = sceneSession->GetSessionInfo().abilityName_;
+    if (addKey(SessionPropertyFlag::ABILITY_NAME)) {
+        record.abilityNameIndex_ = batch.InternString(sessionInfo.abilityName_);
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::APP_INDEX)) {
-        windowPropertyChangeInfo[WindowInfoKey::APP_INDEX] = sceneSession->GetSessionInfo().appIndex_;
+    if (addKey(SessionPropertyFlag::APP_INDEX)) {
+        record.appIndex_ = sessionInfo.appIndex_;
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::VISIBILITY_STATE)) {
-        windowPropertyChangeInfo[WindowInfoKey::VISIBILITY_STATE] = sceneSession->GetVisibilityState();
+    if (addKey(SessionPropertyFlag::VISIBILITY_STATE)) {
+        record.visibilityState_ = sceneSession->GetVisibilityState();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::DISPLAY_ID)) {
+    if (addKey(SessionPropertyFlag::DISPLAY_ID)) {
         if (PcFoldScreenManager::GetInstance().IsHalfFoldedOnMainDisplay(
             sceneSession->GetSessionProperty()->GetDisplayId())) {
             WSRect sessionGlobalRect = sceneSession->GetSessionGlobalRect();
-            windowPropertyChangeInfo[WindowInfoKey::DISPLAY_ID] =
-                sceneSession->TransformGlobalRectToRelativeRect(sessionGlobalRect);
+            record.displayId_ = sceneSession->TransformGlobalRectToRelativeRect(sessionGlobalRect);
         } else {
-            windowPropertyChangeInfo[WindowInfoKey::DISPLAY_ID] = sceneSession->GetSessionProperty()->GetDisplayId();
+            record.displayId_ = sceneSession->GetSessionProperty()->GetDisplayId();
         }
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::WINDOW_RECT)) {
+    if (addKey(SessionPropertyFlag::WINDOW_RECT)) {
         WSRect wsrect = sceneSession->GetSessionRect();
-        Rect rect = { wsrect.posX_, wsrect.posY_, wsrect.width_, wsrect.height_ };
-        windowPropertyChangeInfo[WindowInfoKey::WINDOW_RECT] = rect;
+        record.rect_ = { wsrect.posX_, wsrect.posY_, wsrect.width_, wsrect.height_ };
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::WINDOW_MODE)) {
-        windowPropertyChangeInfo[WindowInfoKey::WINDOW_MODE] = sceneSession->GetWindowModeCompat();
+    if (addKey(SessionPropertyFlag::WINDOW_MODE)) {
+        record.mode_ = sceneSession->GetWindowModeCompat();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::WINDOW_MODE_INFO)) {
-        windowPropertyChangeInfo[WindowInfoKey::WINDOW_MODE_INFO] =
-            sceneSession->GetSessionProperty()->GetWindowModeInfo();
+    if (addKey(SessionPropertyFlag::WINDOW_MODE_INFO)) {
+        record.modeInfo_ = sceneSession->GetSessionProperty()->GetWindowModeInfo();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::FLOATING_SCALE)) {
-        windowPropertyChangeInfo[WindowInfoKey::FLOATING_SCALE] = sceneSession->GetFloatingScale();
+    if (addKey(SessionPropertyFlag::FLOATING_SCALE)) {
+        record.floatingScale_ = sceneSession->GetFloatingScale();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::MID_SCENE)) {
-        windowPropertyChangeInfo[WindowInfoKey::MID_SCENE] = sceneSession->GetIsMidScene();
+    if (addKey(SessionPropertyFlag::MID_SCENE)) {
+        record.isMidScene_ = sceneSession->GetIsMidScene();
     }
-    if (interestedFlags_ & static_cast<uint32_t>(SessionPropertyFlag::WINDOW_GLOBAL_RECT)) {
+    if (addKey(SessionPropertyFlag::WINDOW_GLOBAL_RECT)) {
         WSRect wsrect = sceneSession->GetSessionGlobalRect();
-        Rect globalRect = { wsrect.posX_, wsrect.posY_, wsrect.width_, wsrect.height_ };
-        windowPropertyChangeInfo[WindowInfoKey::WINDOW_GLOBAL_RECT] = globalRect;
+        record.globalRect_ = { wsrect.posX_, wsrect.posY_, wsrect.width_, wsrect.height_ };
     }
 }
 
@@ -15,6 +15,8 @@
 
 #include "session_manager_agent_controller.h"
 
+#include <algorithm>
+
 namespace OHOS {
 namespace Rosen {
 namespace {
@@ -60,6 +62,7 @@ WMError SessionManagerAgentController::UnregisterWindowManagerAgent(const sptr<I
     if (!smAgentContainer_.UnregisterAgent(windowManagerAgent, type)) {
         return WMError::WM_ERROR_NULLPTR;
     }
+    RemoveAgentFilter(windowManagerAgent->AsObject(), type);
     std::lock_guard<std::mutex> lock(windowManagerPidUserIdAgentMapMutex_);
     auto pidIter = windowManagerPidUserIdAgentMap_.find(pid);
     if (pidIter == windowManagerPidUserIdAgentMap_.end()) {
@@ -159,9 +162,43 @@ void SessionManagerAgentController::NotifyWaterMarkFlagChangedResult(bool hasWat
 void SessionManagerAgentController::UpdateWindowVisibilityInfo(
     const std::vector<sptr<WindowVisibilityInfo>>& windowVisibilityInfos)
 {
-    for (auto& agent : smAgentContainer_.GetAgentsByType(
-        WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY)) {
-        agent->UpdateWindowVisibilityInfo(windowVisibilityInfos);
+    constexpr auto type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY;
+    std::map<sptr<IRemoteObject>, std::vector<sptr<WindowVisibilityInfo>>> filteredInfos;
+    {
+        std::lock_guard<std::mutex> lock(agentFilterMutex_);
+        auto indexIter = agentFilterIndexes_.find(type);
+        if (indexIter != agentFilterIndexes_.end()) {
+            const auto& index = indexIter->second;
+            std::vector<sptr<IRemoteObject>> candidates;
+            // a filtered agent left with no entry gets no IPC
+            for (const auto& [remoteObject, filter] : index.filters_) {
+                filteredInfos[remoteObject];
+            }
+            for (const auto& info : windowVisibilityInfos) {
+                if (info == nullptr) {
+                    continue;
+                }
+                candidates.clear();
+                index.Lookup(info->pid_, info->windowId_, &info->bundleName_, &info->displayId_, candidates);
+                for (const auto& remoteObject : candidates) {
+                    if (index.filters_.at(remoteObject).IsMatched(info->pid_, info->windowId_, info->bundleName_,
+                        info->displayId_)) {
+                        filteredInfos[remoteObject].push_back(info);
+                    }
+                }
+            }
+        }
+    }
+    for (auto& agent : smAgentContainer_.GetAgentsByType(type)) {
+        if (agent == nullptr) {
+            continue;
+        }
+        auto infoIter = filteredInfos.find(agent->AsObject());
+        if (infoIter == filteredInfos.end()) {
+            agent->UpdateWindowVisibilityInfo(windowVisibilityInfos);
+        } else if (!infoIter->second.empty()) {
+            agent->UpdateWindowVisibilityInfo(infoIter->second);
+        }
     }
 }
 
@@ -184,12 +221,144 @@ void SessionManagerAgentController::UpdateWindowDrawingContentInfo(
     const std::vector<sptr<WindowDrawingContentInfo>>& windowDrawingContentInfos)
 {
     WLOGFD("Size:%{public}zu", windowDrawingContentInfos.size());
-    for (auto& agent : smAgentContainer_.GetAgentsByType(
-        WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE)) {
-        agent->UpdateWindowDrawingContentInfo(windowDrawingContentInfos);
+    constexpr auto type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE;
+    std::map<sptr<IRemoteObject>, std::vector<sptr<WindowDrawingContentInfo>>> filteredInfos;
+    {
+        std::lock_guard<std::mutex> lock(agentFilterMutex_);
+        auto indexIter = agentFilterIndexes_.find(type);
+        if (indexIter != agentFilterIndexes_.end()) {
+            const auto& index = indexIter->second;
+            std::vector<sptr<IRemoteObject>> candidates;
+            for (const auto& [remoteObject, filter] : index.filters_) {
+                filteredInfos[remoteObject];
+            }
+            for (const auto& info : windowDrawingContentInfos) {
+                if (info == nullptr) {
+                    continue;
+                }
+                candidates.clear();
+                index.Lookup(info->pid_, info->windowId_, nullptr, nullptr, candidates);
+                for (const auto& remoteObject : candidates) {
+                    if (index.filters_.at(remoteObject).IsWindowMatched(info->pid_, info->windowId_)) {
+                        filteredInfos[remoteObject].push_back(info);
+                    }
+                }
+            }
+        }
+    }
+    for (auto& agent : smAgentContainer_.GetAgentsByType(type)) {
+        if (agent == nullptr) {
+            continue;
+        }
+        auto infoIter = filteredInfos.find(agent->AsObject());
+        if (infoIter == filteredInfos.end()) {
+            agent->UpdateWindowDrawingContentInfo(windowDrawingContentInfos);
+        } else if (!infoIter->second.empty()) {
+            agent->UpdateWindowDrawingContentInfo(infoIter->second);
+        }
     }
 }
 
+WMError SessionManagerAgentController::SetWindowManagerAgentFilter(
+    const sptr<IWindowManagerAgent>& windowManagerAgent, WindowManagerAgentType type,
+    const WindowManagerAgentFilter& filter)
+{
+    if (type != WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY &&
+        type != WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE) {
+        return WMError::WM_ERROR_INVALID_PARAM;
+    }
+    if (windowManagerAgent == nullptr || windowManagerAgent->AsObject() == nullptr) {
+        return WMError::WM_ERROR_NULLPTR;
+    }
+    auto agents = smAgentContainer_.GetAgentsByType(type);
+    auto remoteObject = windowManagerAgent->AsObject();
+    if (std::none_of(agents.begin(), agents.end(), [&remoteObject](const sptr<IWindowManagerAgent>& agent) {
+        return agent != nullptr && agent->AsObject() == remoteObject;
+    })) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "agent not registered, type=%{public}u", static_cast<uint32_t>(type));
+        return WMError::WM_ERROR_INVALID_OPERATION;
+    }
+    TLOGI(WmsLogTag::WMS_ATTRIBUTE, "type=%{public}u, pids=%{public}zu, bundleNames=%{public}zu, "
+        "windowIds=%{public}zu, displayIds=%{public}zu", static_cast<uint32_t>(type), filter.pids.size(),
+        filter.bundleNames.size(), filter.windowIds.size(), filter.displayIds.size());
+    if (filter.IsEmpty()) {
+        RemoveAgentFilter(windowManagerAgent->AsObject(), type);
+        return WMError::WM_OK;
+    }
+    std::lock_guard<std::mutex> lock(agentFilterMutex_);
+    auto& index = agentFilterIndexes_[type];
+    index.filters_[windowManagerAgent->AsObject()] = filter;
+    index.Rebuild(type == WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY);
+    return WMError::WM_OK;
+}
+
+void SessionManagerAgentController::RemoveAgentFilter(const sptr<IRemoteObject>& remoteObject,
+    WindowManagerAgentType type)
+{
+    std::lock_guard<std::mutex> lock(agentFilterMutex_);
+    auto indexIter = agentFilterIndexes_.find(type);
+    if (indexIter == agentFilterIndexes_.end() || indexIter->second.filters_.erase(remoteObject) == 0) {
+        return;
+    }
+    if (indexIter->second.filters_.empty()) {
+        agentFilterIndexes_.erase(indexIter);
+        return;
+    }
+    indexIter->second.Rebuild(type == WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY);
+}
+
+void SessionManagerAgentController::AgentFilterIndex::Rebuild(bool hasAppInfo)
+{
+    windowIdIndex_.clear();
+    pidIndex_.clear();
+    bundleNameIndex_.clear();
+    displayIdIndex_.clear();
+    scanAgents_.clear();
+    for (const auto& [remoteObject, filter] : filters_) {
+        // the most selective field first, entries without app info can only be looked up by window id and pid
+        if (!filter.windowIds.empty()) {
+            for (auto windowId : filter.windowIds) {
+                windowIdIndex_[windowId].push_back(remoteObject);
+            }
+        } else if (!filter.pids.empty()) {
+            for (auto pid : filter.pids) {
+                pidIndex_[pid].push_back(remoteObject);
+            }
+        } else if (hasAppInfo && !filter.bundleNames.empty()) {
+            for (const auto& bundleName : filter.bundleNames) {
+                bundleNameIndex_[bundleName].push_back(remoteObject);
+            }
+        } else if (hasAppInfo && !filter.displayIds.empty()) {
+            for (auto displayId : filter.displayIds) {
+                displayIdIndex_[displayId].push_back(remoteObject);
+            }
+        } else {
+            scanAgents_.push_back(remoteObject);
+        }
+    }
+}
+
+void SessionManagerAgentController::AgentFilterIndex::Lookup(int32_t pid, uint32_t windowId,
+    const std::string* bundleName, const DisplayId* displayId, std::vector<sptr<IRemoteObject>>& candidates) const
+{
+    // every agent is in one index only, so no candidate is found twice
+    auto append = [&candidates](const auto& index, const auto& key) {
+        auto iter = index.find(key);
+        if (iter != index.end()) {
+            candidates.insert(candidates.end(), iter->second.begin(), iter->second.end());
+        }
+    };
+    append(windowIdIndex_, windowId);
+    append(pidIndex_, pid);
+    if (bundleName != nullptr) {
+        append(bundleNameIndex_, *bundleName);
+    }
+    if (displayId != nullptr) {
+        append(displayIdIndex_, *displayId);
+    }
+    candidates.insert(candidates.end(), scanAgents_.begin(), scanAgents_.end());
+}
+
 void SessionManagerAgentController::UpdateCameraWindowStatus(uint32_t accessTokenId, bool isShowing)
 {
     TLOGI(WmsLogTag::WMS_SYSTEM, "accessTokenId:%{private}u, isShowing:%{public}d", accessTokenId,
@@ -204,6 +373,8 @@ void SessionManagerAgentController::UpdateCameraWindowStatus(uint32_t accessToke
 
 void SessionManagerAgentController::DoAfterAgentDeath(const sptr<IRemoteObject>& remoteObject)
 {
+    RemoveAgentFilter(remoteObject, WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY);
+    RemoveAgentFilter(remoteObject, WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE);
     std::lock_guard<std::mutex> lock(windowManagerPidUserIdAgentMapMutex_);
     auto it = windowManagerAgentPairMap_.find(remoteObject);
     if (it == windowManagerAgentPairMap_.end()) {
@@ -320,6 +491,19 @@ void SessionManagerAgentController::NotifyWindowPropertyChange(
     }
 }
 
+void SessionManagerAgentController::NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch)
+{
+    if (batch.IsEmpty()) {
+        return;
+    }
+    for (const auto& agent : smAgentContainer_.GetAgentsByType(
+        WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_PROPERTY)) {
+        if (agent != nullptr) {
+            agent->NotifyWindowPropertyChange(batch);
+        }
+    }
+}
+
 void SessionManagerAgentController::NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo)
 {
     for (const auto& agent : smAgentContainer_.GetAgentsByType(
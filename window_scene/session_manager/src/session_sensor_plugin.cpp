@@ -15,11 +15,11 @@
 
 #include "session_sensor_plugin.h"
 
+#include "common/include/plugin_loader.h"
+
 namespace OHOS {
 namespace Rosen {
 namespace {
-    constexpr uint32_t SLEEP_TIME_US = 10000;
-    constexpr uint32_t RETRY_TIMES = 3;
 #if (defined(__aarch64__) || defined(__x86_64__))
     const std::string PLUGIN_SO_PATH = "/system/lib64/platformsdk/libmotion_agent.z.so";
 #else
@@ -37,18 +37,7 @@ bool SessionLoadMotionSensor(void)
         TLOGW(WmsLogTag::WMS_ROTATION, "motion plugin already loaded");
         return true;
     }
-    int32_t cnt = 0;
-    const char* dlopenError = nullptr;
-    do {
-        cnt++;
-        g_handle = dlopen(PLUGIN_SO_PATH.c_str(), RTLD_LAZY);
-        dlopenError = dlerror();
-        if (dlopenError) {
-            TLOGE(WmsLogTag::WMS_ROTATION, "dlopen error: %{public}s", dlopenError);
-        }
-        TLOGI(WmsLogTag::WMS_ROTATION, "dlopen %{public}s, retry cnt: %{public}d", PLUGIN_SO_PATH.c_str(), cnt);
-        usleep(SLEEP_TIME_US);
-    } while (!g_handle && cnt < RETRY_TIMES);
+    g_handle = PluginLoader::OpenLibrary(PLUGIN_SO_PATH, RTLD_LAZY);
     return g_handle != nullptr;
 }
 
@@ -75,19 +64,8 @@ __attribute__((no_sanitize("cfi"))) bool SessionSubscribeCallback(int32_t motion
         return false;
     }
     if (g_subscribePtr == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_subscribePtr = reinterpret_cast<MotionSubscribeCallbackPtr>(dlsym(
-                g_handle, "MotionSubscribeCallback"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::WMS_ROTATION, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::WMS_ROTATION, "dlsym %{public}s, retry cnt: %{public}d", "MotionSubscribeCallback", cnt);
-        } while (!g_subscribePtr && cnt < RETRY_TIMES);
+        g_subscribePtr = reinterpret_cast<MotionSubscribeCallbackPtr>(
+            PluginLoader::LoadSymbol(g_handle, "MotionSubscribeCallback"));
     }
     if (g_subscribePtr == nullptr) {
         return false;
@@ -107,19 +85,8 @@ __attribute__((no_sanitize("cfi"))) bool SessionUnsubscribeCallback(int32_t moti
         return false;
     }
     if (g_unsubscribePtr == nullptr) {
-        int32_t cnt = 0;
-        const char* dlsymError = nullptr;
-        do {
-            cnt++;
-            g_unsubscribePtr = reinterpret_cast<MotionUnsubscribeCallbackPtr>(dlsym(
-                g_handle, "MotionUnsubscribeCallback"));
-            dlsymError = dlerror();
-            if (dlsymError) {
-                TLOGE(WmsLogTag::WMS_ROTATION, "dlsym error: %{public}s", dlsymError);
-                usleep(SLEEP_TIME_US);
-            }
-            TLOGI(WmsLogTag::WMS_ROTATION, "dlsym %{public}s, retry cnt: %{public}d", "MotionUnsubscribeCallback", cnt);
-        } while (!g_unsubscribePtr && cnt < RETRY_TIMES);
+        g_unsubscribePtr = reinterpret_cast<MotionUnsubscribeCallbackPtr>(
+            PluginLoader::LoadSymbol(g_handle, "MotionUnsubscribeCallback"));
     }
     if (g_unsubscribePtr == nullptr) {
         return false;
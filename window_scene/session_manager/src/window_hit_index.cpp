@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "window_hit_index.h"
+
+#include <algorithm>
+
+#include "common/include/session_helper.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr uint32_t CELL_KEY_SHIFT = 32;
+
+bool IsHigher(const std::pair<uint32_t, int32_t>& left, const std::pair<uint32_t, int32_t>& right)
+{
+    return left.first != right.first ? left.first > right.first : left.second > right.second;
+}
+} // namespace
+
+WindowHitIndex::WindowHitIndex(int32_t cellSize) : cellSize_(cellSize > 0 ? cellSize : DEFAULT_CELL_SIZE) {}
+
+bool WindowHitIndex::Update(int32_t persistentId, const WindowHitInfo& info)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(persistentId);
+    if (iter != entries_.end()) {
+        if (iter->second.info_ == info) {
+            return false;
+        }
+        EraseLocked(persistentId, iter->second);
+    }
+    auto& entry = entries_[persistentId];
+    entry.info_ = info;
+    InsertLocked(persistentId, entry);
+    return true;
+}
+
+void WindowHitIndex::Remove(int32_t persistentId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(persistentId);
+    if (iter == entries_.end()) {
+        return;
+    }
+    EraseLocked(persistentId, iter->second);
+    entries_.erase(iter);
+}
+
+void WindowHitIndex::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    grids_.clear();
+}
+
+bool WindowHitIndex::Contains(int32_t persistentId) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.find(persistentId) != entries_.end();
+}
+
+size_t WindowHitIndex::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void WindowHitIndex::InsertLocked(int32_t persistentId, Entry& entry)
+{
+    const auto& info = entry.info_;
+    int64_t left = info.rect_.posX_;
+    int64_t top = info.rect_.posY_;
+    int64_t right = static_cast<int64_t>(info.rect_.posX_) + info.rect_.width_;
+    int64_t bottom = static_cast<int64_t>(info.rect_.posY_) + info.rect_.height_;
+    for (const auto& hotArea : info.hotAreas_) {
+        left = std::min<int64_t>(left, hotArea.posX_);
+        top = std::min<int64_t>(top, hotArea.posY_);
+        right = std::max<int64_t>(right, static_cast<int64_t>(hotArea.posX_) + hotArea.width_);
+        bottom = std::max<int64_t>(bottom, static_cast<int64_t>(hotArea.posY_) + hotArea.height_);
+    }
+    entry.cells_.clear();
+    entry.isOversized_ = false;
+    if (right <= left || bottom <= top) {
+        return;
+    }
+    auto& grid = grids_[info.displayId_];
+    int32_t cellLeft = GetCellIndex(static_cast<int32_t>(left));
+    int32_t cellTop = GetCellIndex(static_cast<int32_t>(top));
+    int32_t cellRight = GetCellIndex(static_cast<int32_t>(right - 1));
+    int32_t cellBottom = GetCellIndex(static_cast<int32_t>(bottom - 1));
+    uint64_t cellCount = static_cast<uint64_t>(cellRight - cellLeft + 1) *
+        static_cast<uint64_t>(cellBottom - cellTop + 1);
+    if (cellCount > MAX_CELL_COUNT_PER_WINDOW) {
+        entry.isOversized_ = true;
+        grid.oversizedIds_.insert(persistentId);
+        return;
+    }
+    entry.cells_.reserve(cellCount);
+    for (int32_t cellY = cellTop; cellY <= cellBottom; cellY++) {
+        for (int32_t cellX = cellLeft; cellX <= cellRight; cellX++) {
+            uint64_t cellKey = GetCellKey(cellX, cellY);
+            grid.cells_[cellKey].push_back(persistentId);
+            entry.cells_.push_back(cellKey);
+        }
+    }
+}
+
+void WindowHitIndex::EraseLocked(int32_t persistentId, const Entry& entry)
+{
+    auto gridIter = grids_.find(entry.info_.displayId_);
+    if (gridIter == grids_.end()) {
+        return;
+    }
+    auto& grid = gridIter->second;
+    if (entry.isOversized_) {
+        grid.oversizedIds_.erase(persistentId);
+    }
+    for (auto cellKey : entry.cells_) {
+        auto cellIter = grid.cells_.find(cellKey);
+        if (cellIter == grid.cells_.end()) {
+            continue;
+        }
+        auto& ids = cellIter->second;
+        ids.erase(std::remove(ids.begin(), ids.end(), persistentId), ids.end());
+        if (ids.empty()) {
+            grid.cells_.erase(cellIter);
+        }
+    }
+    if (grid.cells_.empty() && grid.oversizedIds_.empty()) {
+        grids_.erase(gridIter);
+    }
+}
+
+std::vector<std::pair<uint32_t, int32_t>> WindowHitIndex::CollectHitsLocked(DisplayId displayId, int32_t x,
+    int32_t y, WindowHitMode mode) const
+{
+    std::vector<std::pair<uint32_t, int32_t>> hits;
+    auto gridIter = grids_.find(displayId);
+    if (gridIter == grids_.end()) {
+        return hits;
+    }
+    const auto& grid = gridIter->second;
+    auto checkHit = [this, x, y, mode, &hits](int32_t persistentId) {
+        auto entryIter = entries_.find(persistentId);
+        if (entryIter != entries_.end() && IsHit(entryIter->second.info_, x, y, mode)) {
+            hits.emplace_back(entryIter->second.info_.zOrder_, persistentId);
+        }
+    };
+    if (auto cellIter = grid.cells_.find(GetCellKey(GetCellIndex(x), GetCellIndex(y)));
+        cellIter != grid.cells_.end()) {
+        for (auto persistentId : cellIter->second) {
+            checkHit(persistentId);
+        }
+    }
+    for (auto persistentId : grid.oversizedIds_) {
+        checkHit(persistentId);
+    }
+    return hits;
+}
+
+std::vector<int32_t> WindowHitIndex::QueryAll(DisplayId displayId, int32_t x, int32_t y, WindowHitMode mode) const
+{
+    std::vector<std::pair<uint32_t, int32_t>> hits;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hits = CollectHitsLocked(displayId, x, y, mode);
+    }
+    std::sort(hits.begin(), hits.end(), IsHigher);
+    std::vector<int32_t> persistentIds;
+    persistentIds.reserve(hits.size());
+    for (const auto& [_, persistentId] : hits) {
+        persistentIds.push_back(persistentId);
+    }
+    return persistentIds;
+}
+
+int32_t WindowHitIndex::QueryTopmost(DisplayId displayId, int32_t x, int32_t y, WindowHitMode mode) const
+{
+    std::vector<std::pair<uint32_t, int32_t>> hits;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hits = CollectHitsLocked(displayId, x, y, mode);
+    }
+    if (hits.empty()) {
+        return INVALID_SESSION_ID;
+    }
+    return std::min_element(hits.begin(), hits.end(), IsHigher)->second;
+}
+
+int32_t WindowHitIndex::GetCellIndex(int32_t value) const
+{
+    // round towards negative infinity, so that cells of negative coordinates do not overlap cell 0
+    return value >= 0 ? value / cellSize_ :
+        static_cast<int32_t>(-((-static_cast<int64_t>(value) + cellSize_ - 1) / cellSize_));
+}
+
+uint64_t WindowHitIndex::GetCellKey(int32_t cellX, int32_t cellY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << CELL_KEY_SHIFT) | static_cast<uint32_t>(cellY);
+}
+
+bool WindowHitIndex::IsHit(const WindowHitInfo& info, int32_t x, int32_t y, WindowHitMode mode)
+{
+    if (mode == WindowHitMode::RECT || info.hotAreas_.empty()) {
+        return SessionHelper::IsPointInRect(x, y, SessionHelper::TransferToRect(info.rect_));
+    }
+    return std::any_of(info.hotAreas_.begin(), info.hotAreas_.end(), [x, y](const WSRect& hotArea) {
+        return SessionHelper::IsPointInRect(x, y, SessionHelper::TransferToRect(hotArea));
+    });
+}
+} // namespace OHOS::Rosen
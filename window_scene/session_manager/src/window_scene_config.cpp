@@ -20,11 +20,16 @@
 #include "libxml/tree.h"
 #include "window_helper.h"
 #include "window_manager_hilog.h"
+#include "xml_config_snapshot.h"
 
 namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "WindowSceneConfig"};
+const std::string CONFIG_FILE_NAME = "etc/window/resources/window_manager_config.xml";
+const std::string SNAPSHOT_NAME = "window_scene_config";
+// bump when ParseConfigXml builds a different ConfigItem tree
+constexpr uint32_t SNAPSHOT_PARSER_VERSION = 1;
 }
 
 WindowSceneConfig::ConfigItem WindowSceneConfig::config_;
@@ -224,13 +229,25 @@ void WindowSceneConfig::ReadConfig(const xmlNodePtr& rootPtr, std::map<std::stri
 
 bool WindowSceneConfig::LoadConfigXml()
 {
-    auto configFilePath = GetConfigPath("etc/window/resources/window_manager_config.xml");
+    auto configFilePath = GetConfigPath(CONFIG_FILE_NAME);
+    WLOGI("filePath: %{public}s", configFilePath.c_str());
+    return XmlConfigSnapshot::LoadOrParse(configFilePath, SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml, config_);
+}
+
+bool WindowSceneConfig::CheckConfigSnapshot()
+{
+    return XmlConfigSnapshot::Check(GetConfigPath(CONFIG_FILE_NAME), SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml);
+}
+
+bool WindowSceneConfig::ParseConfigXml(const std::string& configFilePath, ConfigItem& config)
+{
     xmlDocPtr docPtr = nullptr;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         docPtr = xmlReadFile(configFilePath.c_str(), nullptr, XML_PARSE_NOBLANKS);
     }
-    WLOGI("filePath: %{public}s", configFilePath.c_str());
     if (docPtr == nullptr) {
         WLOGFE("load xml error!");
         return false;
@@ -245,8 +262,8 @@ bool WindowSceneConfig::LoadConfigXml()
     }
 
     std::map<std::string, ConfigItem> configMap;
-    config_.SetValue(configMap);
-    ReadConfig(rootPtr, *config_.mapValue_);
+    config.SetValue(configMap);
+    ReadConfig(rootPtr, *config.mapValue_);
 
     xmlFreeDoc(docPtr);
     return true;
@@ -29,12 +29,24 @@
 #include "window_manager_hilog.h"
 #include "ui_effect_controller_interface.h"
 #include "ui_effect_controller_client_interface.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
 
 namespace OHOS::Rosen {
 namespace {
 constexpr int32_t CYCLE_LIMIT = 1000;
 constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "SceneSessionManagerProxy"};
 constexpr DisplayId VIRTUAL_DISPLAY_ID = 999;
+
+int SendIpcRequest(const sptr<IRemoteObject>& remote, uint32_t code, MessageParcel& data, MessageParcel& reply,
+    MessageOption& option)
+{
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadScope payloadScope(IpcSide::PROXY, "SceneSessionManager", code, data, reply);
+#endif
+    return remote->SendRequest(code, data, reply, option);
+}
 }
 WSErrorResult SceneSessionManagerProxy::CreateAndConnectSpecificSession(const sptr<ISessionStage>& sessionStage,
     const sptr<IWindowEventChannel>& eventChannel, uint64_t nodeId,
@@ -78,7 +90,7 @@ WSErrorResult SceneSessionManagerProxy::CreateAndConnectSpecificSession(const sp
     }
     int32_t errCode = ERR_NONE;
     std::string errMsg = "";
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_CREATE_AND_CONNECT_SPECIFIC_SESSION), data, reply, option) != ERR_NONE ||
         !reply.ReadInt32(errCode) || !reply.ReadString(errMsg)) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -179,7 +191,7 @@ WSError SceneSessionManagerProxy::RecoverAndConnectSpecificSession(const sptr<IS
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_RECOVER_AND_CONNECT_SPECIFIC_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -236,7 +248,7 @@ WSError SceneSessionManagerProxy::RecoverAndReconnectSceneSession(const sptr<ISe
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_RECOVER_AND_RECONNECT_SCENE_SESSION), data, reply,
         option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -274,7 +286,7 @@ WMError SceneSessionManagerProxy::SetParentWindow(int32_t subWindowId, int32_t n
         TLOGE(WmsLogTag::WMS_SUB, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PARENT_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PARENT_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -306,7 +318,7 @@ WMError SceneSessionManagerProxy::GetSessionSnapshotById(int32_t persistentId, S
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_SNAPSHOT_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_SNAPSHOT_BY_ID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -349,7 +361,7 @@ WSErrorResult SceneSessionManagerProxy::DestroyAndDisconnectSpecificSession(cons
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSErrorResult{WSError::WS_ERROR_IPC_FAILED, "remote is null"};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_DESTROY_AND_DISCONNECT_SPECIFIC_SESSION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -382,7 +394,7 @@ WSErrorResult SceneSessionManagerProxy::DestroyAndDisconnectSpecificSessionWithD
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSErrorResult{WSError::WS_ERROR_IPC_FAILED, "remote is null"};
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_DESTROY_AND_DISCONNECT_SPECIFIC_SESSION_WITH_DETACH_CALLBACK),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -417,7 +429,7 @@ WMError SceneSessionManagerProxy::RequestFocusStatus(int32_t persistentId, bool
         WLOGFE("remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_REQUEST_FOCUS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -462,7 +474,7 @@ WMError SceneSessionManagerProxy::RequestFocusStatusBySA(int32_t persistentId, b
         TLOGE(WmsLogTag::WMS_FOCUS, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_REQUEST_FOCUS_STATUS_BY_SA),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -491,7 +503,7 @@ WSError SceneSessionManagerProxy::RaiseWindowToTop(int32_t persistentId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_RAISE_WINDOW_TO_TOP),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -526,7 +538,7 @@ WSError SceneSessionManagerProxy::BindDialogSessionTarget(uint64_t persistentId,
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_BIND_DIALOG_TARGET),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -559,7 +571,7 @@ WSError SceneSessionManagerProxy::UpdateSessionAvoidAreaListener(int32_t persist
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_UPDATE_AVOIDAREA_LISTENER),
         data, reply, option) != ERR_NONE) {
         return WSError::WS_ERROR_IPC_FAILED;
@@ -585,7 +597,7 @@ WMError SceneSessionManagerProxy::NotifyScreenshotEvent(ScreenshotEventType type
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_NOTIFY_SCREEN_SHOT_EVENT), data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -621,7 +633,7 @@ WSError SceneSessionManagerProxy::UpdateSessionTouchOutsideListener(int32_t& per
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_UPDATE_TOUCHOUTSIDE_LISTENER),
         data, reply, option) != ERR_NONE) {
         return WSError::WS_ERROR_IPC_FAILED;
@@ -652,7 +664,7 @@ WSError SceneSessionManagerProxy::UpdateSessionWindowVisibilityListener(int32_t
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_UPDATE_WINDOW_VISIBILITY_LISTENER),
         data, reply, option) != ERR_NONE) {
         return WSError::WS_ERROR_IPC_FAILED;
@@ -682,7 +694,7 @@ WMError SceneSessionManagerProxy::UpdateSessionScreenshotListener(int32_t persis
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_SESSION_SCREENSHOT_LISTENER),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -720,7 +732,7 @@ WMError SceneSessionManagerProxy::UpdateSessionOcclusionStateListener(int32_t pe
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_SESSION_OCCLUSION_STATE_LISTENER),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -757,7 +769,7 @@ WMError SceneSessionManagerProxy::GetWindowStateSnapshot(int32_t persistentId, s
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_STATE_SNAPSHOT),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -798,7 +810,7 @@ WSError SceneSessionManagerProxy::NotifySurfaceNodeAlphaUpdate(int32_t persisten
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_NOTIFY_SURFACE_NODE_ALPHA_UPDATE),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -838,7 +850,7 @@ WMError SceneSessionManagerProxy::RecoverWindowPropertyChangeFlag(uint32_t obser
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_RECOVER_WINDOW_PROPERTY_CHANGE_FLAG),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -884,7 +896,7 @@ WMError SceneSessionManagerProxy::RegisterWindowManagerAgent(WindowManagerAgentT
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_REGISTER_WINDOW_MANAGER_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
@@ -925,7 +937,7 @@ WMError SceneSessionManagerProxy::UnregisterWindowManagerAgent(WindowManagerAgen
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_UNREGISTER_WINDOW_MANAGER_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
@@ -976,7 +988,7 @@ WMError SceneSessionManagerProxy::RegisterWindowPropertyChangeAgent(WindowInfoKe
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_REGISTER_WINDOW_PROPERTY_CHANGE_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -1027,7 +1039,7 @@ WMError SceneSessionManagerProxy::UnregisterWindowPropertyChangeAgent(WindowInfo
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_UNREGISTER_WINDOW_PROPERTY_CHANGE_AGENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -1037,6 +1049,51 @@ WMError SceneSessionManagerProxy::UnregisterWindowPropertyChangeAgent(WindowInfo
     return static_cast<WMError>(reply.ReadInt32());
 }
 
+WMError SceneSessionManagerProxy::SetWindowManagerAgentFilter(WindowManagerAgentType type,
+    const WindowManagerAgentFilter& filter, const sptr<IWindowManagerAgent>& windowManagerAgent)
+{
+    MessageOption option;
+    MessageParcel reply;
+    MessageParcel data;
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write InterfaceToken failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    if (!data.WriteUint32(static_cast<uint32_t>(type))) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write type failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    if (!data.WriteParcelable(&filter)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write filter failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    if (!windowManagerAgent) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "windowManagerAgent is nullptr");
+        return WMError::WM_ERROR_NULLPTR;
+    }
+    if (!data.WriteRemoteObject(windowManagerAgent->AsObject())) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write IWindowManagerAgent failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
+        SceneSessionManagerMessage::TRANS_ID_SET_WINDOW_MANAGER_AGENT_FILTER),
+        data, reply, option) != ERR_NONE) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    int32_t ret = 0;
+    if (!reply.ReadInt32(ret)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Read ret failed");
+        return WMError::WM_ERROR_IPC_FAILED;
+    }
+    return static_cast<WMError>(ret);
+}
+
 WMError SceneSessionManagerProxy::SetGestureNavigationEnabled(bool enable)
 {
     MessageParcel data;
@@ -1057,7 +1114,7 @@ WMError SceneSessionManagerProxy::SetGestureNavigationEnabled(bool enable)
         WLOGFE("remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_SET_GESTURE_NAVIGATION_ENABLED), data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -1084,7 +1141,7 @@ void SceneSessionManagerProxy::GetFocusWindowInfo(FocusChangeInfo& focusInfo, Di
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_INFO),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -1120,7 +1177,7 @@ void SceneSessionManagerProxy::GetFocusWindowInfoByAbilityToken(FocusChangeInfo&
         TLOGE(WmsLogTag::WMS_FOCUS, "Remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_INFO_BY_ABILITY_TOKEN), data, reply, option) !=
         ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -1158,7 +1215,7 @@ WSError SceneSessionManagerProxy::SetSessionLabel(const sptr<IRemoteObject>& tok
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_LABEL),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_LABEL),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1191,7 +1248,7 @@ WSError SceneSessionManagerProxy::SetSessionIcon(const sptr<IRemoteObject>& toke
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_ICON),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_ICON),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1220,7 +1277,7 @@ WSError SceneSessionManagerProxy::IsValidSessionIds(
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_IS_VALID_SESSION_IDS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_IS_VALID_SESSION_IDS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1245,7 +1302,7 @@ WMError SceneSessionManagerProxy::GetAccessibilityWindowInfo(std::vector<sptr<Ac
         WLOGFE("remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_INFO),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -1281,7 +1338,7 @@ WMError SceneSessionManagerProxy::GetUnreliableWindowInfo(int32_t windowId,
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_UNRELIABLE_WINDOW_INFO),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
@@ -1321,7 +1378,8 @@ WSError SceneSessionManagerProxy::PendingSessionToForeground(const sptr<IRemoteO
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_PENDING_SESSION_TO_FOREGROUND),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_PENDING_SESSION_TO_FOREGROUND),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1361,7 +1419,7 @@ WSError SceneSessionManagerProxy::PendingSessionToBackgroundForDelegator(const s
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_PENDING_SESSION_TO_BACKGROUND_FOR_DELEGATOR),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -1393,7 +1451,7 @@ WSError SceneSessionManagerProxy::RegisterSessionListener(const sptr<ISessionLis
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REGISTER_SESSION_LISTENER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REGISTER_SESSION_LISTENER),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1424,7 +1482,7 @@ WSError SceneSessionManagerProxy::UnRegisterSessionListener(const sptr<ISessionL
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UNREGISTER_SESSION_LISTENER),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -1457,7 +1515,7 @@ WSError SceneSessionManagerProxy::GetSessionInfos(const std::string& deviceId, i
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_MISSION_INFOS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_MISSION_INFOS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1494,7 +1552,7 @@ WSError SceneSessionManagerProxy::GetSessionInfo(const std::string& deviceId, in
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_MISSION_INFO_BY_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_MISSION_INFO_BY_ID),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1532,7 +1590,7 @@ WSError SceneSessionManagerProxy::GetSessionInfo(const std::string& deviceId, in
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>
+    if (SendIpcRequest(remote, static_cast<uint32_t>
         (SceneSessionManagerMessage::TRANS_ID_GET_SESSION_INFO_WITH_DISPLAY),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -1573,7 +1631,7 @@ WSError SceneSessionManagerProxy::GetSessionInfoByContinueSessionId(
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_SESSION_INFO_BY_CONTINUE_SESSION_ID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -1603,7 +1661,7 @@ WSError SceneSessionManagerProxy::DumpSessionAll(std::vector<std::string>& infos
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_DUMP_SESSION_ALL),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_DUMP_SESSION_ALL),
         data, reply, option) != ERR_NONE) {
         WLOGFE("DumpSessionAll sendRequest failed.");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1634,7 +1692,7 @@ WSError SceneSessionManagerProxy::DumpSessionWithId(int32_t persistentId, std::v
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_DUMP_SESSION_WITH_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_DUMP_SESSION_WITH_ID),
         data, reply, option) != ERR_NONE) {
         WLOGFE("DumpSessionWithId sendRequest failed.");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1696,7 +1754,7 @@ WSError SceneSessionManagerProxy::TerminateSessionNew(const sptr<AAFwk::SessionI
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_TERMINATE_SESSION_NEW),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -1724,7 +1782,7 @@ WSError SceneSessionManagerProxy::GetFocusSessionToken(sptr<IRemoteObject>& toke
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_TOKEN),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_TOKEN),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1755,7 +1813,7 @@ WSError SceneSessionManagerProxy::GetFocusSessionElement(AppExecFwk::ElementName
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_ELEMENT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FOCUS_SESSION_ELEMENT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1787,7 +1845,7 @@ WMError SceneSessionManagerProxy::CheckWindowId(int32_t windowId, int32_t& pid)
         WLOGFE("remote is nullptr");
         return WMError::WM_ERROR_NULLPTR;
     }
-    int32_t ret = remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CHECK_WINDOW_ID),
+    int32_t ret = SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CHECK_WINDOW_ID),
         data, reply, option);
     if (ret != ERR_NONE) {
         WLOGFE("Send request failed, ret:%{public}d", ret);
@@ -1818,7 +1876,7 @@ WSError SceneSessionManagerProxy::GetSessionDumpInfo(const std::vector<std::stri
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_DUMP_INFO),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_DUMP_INFO),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1863,7 +1921,7 @@ WSError SceneSessionManagerProxy::GetSessionSnapshot(const std::string& deviceId
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_SNAPSHOT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_SESSION_SNAPSHOT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1896,7 +1954,7 @@ WSError SceneSessionManagerProxy::GetUIContentRemoteObj(int32_t persistentId, sp
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_UI_CONTENT_REMOTE_OBJ),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_UI_CONTENT_REMOTE_OBJ),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -1929,7 +1987,7 @@ WMError SceneSessionManagerProxy::GetRootUIContentRemoteObj(DisplayId displayId,
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(static_cast<uint32_t>(
+    auto reqErrCode = SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_ROOT_UI_CONTENT_REMOTE_OBJ), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -1972,7 +2030,7 @@ WSError SceneSessionManagerProxy::SetSessionContinueState(const sptr<IRemoteObje
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_CONTINUE_STATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SESSION_CONTINUE_STATE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2013,7 +2071,7 @@ void SceneSessionManagerProxy::NotifyDumpInfoResult(const std::vector<std::strin
         WLOGFE("remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_NOTIFY_DUMP_INFO_RESULT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_NOTIFY_DUMP_INFO_RESULT),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return;
@@ -2040,7 +2098,7 @@ WSError SceneSessionManagerProxy::LockSession(int32_t sessionId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_LOCK_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_LOCK_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2068,7 +2126,7 @@ WSError SceneSessionManagerProxy::UnlockSession(int32_t sessionId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UNLOCK_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UNLOCK_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2100,7 +2158,7 @@ WSError SceneSessionManagerProxy::MoveSessionsToForeground(const std::vector<std
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MOVE_MISSIONS_TO_FOREGROUND),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MOVE_MISSIONS_TO_FOREGROUND),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2132,7 +2190,7 @@ WSError SceneSessionManagerProxy::MoveSessionsToBackground(const std::vector<std
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MOVE_MISSIONS_TO_BACKGROUND),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MOVE_MISSIONS_TO_BACKGROUND),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2162,7 +2220,7 @@ WSError SceneSessionManagerProxy::ClearSession(int32_t persistentId)
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CLEAR_SESSION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CLEAR_SESSION),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2186,7 +2244,7 @@ WSError SceneSessionManagerProxy::ClearAllSessions()
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CLEAR_ALL_SESSIONS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CLEAR_ALL_SESSIONS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2224,7 +2282,7 @@ WSError SceneSessionManagerProxy::RegisterIAbilityManagerCollaborator(int32_t ty
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REGISTER_COLLABORATOR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REGISTER_COLLABORATOR),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2257,7 +2315,7 @@ WSError SceneSessionManagerProxy::UnregisterIAbilityManagerCollaborator(int32_t
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UNREGISTER_COLLABORATOR),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UNREGISTER_COLLABORATOR),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -2296,7 +2354,7 @@ WSError SceneSessionManagerProxy::NotifyWindowExtensionVisibilityChange(int32_t
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_NOTIFY_WINDOW_EXTENSION_VISIBILITY_CHANGE),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -2326,7 +2384,7 @@ WMError SceneSessionManagerProxy::GetTopWindowId(uint32_t mainWinId, uint32_t& t
         WLOGFE("remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_TOP_WINDOW_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_TOP_WINDOW_ID),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -2361,7 +2419,7 @@ WMError SceneSessionManagerProxy::NotifyWatchGestureConsumeResult(int32_t keyCod
         TLOGE(WmsLogTag::WMS_EVENT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_WATCH_GESTURE_CONSUME_RESULT),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_WATCH_GESTURE_CONSUME_RESULT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -2393,7 +2451,7 @@ WMError SceneSessionManagerProxy::NotifyWatchFocusActiveChange(bool isActive)
         TLOGE(WmsLogTag::WMS_EVENT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_WATCH_FOCUS_ACTIVE_CHANGE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_WATCH_FOCUS_ACTIVE_CHANGE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_EVENT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -2423,7 +2481,7 @@ WMError SceneSessionManagerProxy::GetParentMainWindowId(int32_t windowId, int32_
         TLOGE(WmsLogTag::WMS_SUB, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PARENT_MAIN_WINDOW_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PARENT_MAIN_WINDOW_ID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -2471,7 +2529,7 @@ WMError SceneSessionManagerProxy::ListWindowInfo(const WindowInfoOption& windowI
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_LIST_WINDOW_INFO), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2522,7 +2580,7 @@ WMError SceneSessionManagerProxy::GetAllWindowLayoutInfo(DisplayId displayId,
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_LAYOUT_INFO), data, reply, msgOption) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2552,7 +2610,7 @@ WMError SceneSessionManagerProxy::GetAllMainWindowInfo(std::vector<sptr<MainWind
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_ALL_MAIN_WINDOW_INFO), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2595,7 +2653,7 @@ WMError SceneSessionManagerProxy::GetMainWindowSnapshot(const std::vector<int32_
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_MAIN_WINDOW_SNAPSHOT), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2631,7 +2689,7 @@ WMError SceneSessionManagerProxy::Snapshot(std::shared_ptr<Media::PixelMap>& pix
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
             SceneSessionManagerMessage::TRANS_ID_SNAPSHOT_BY_WINDOW_ID), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -2666,7 +2724,7 @@ WMError SceneSessionManagerProxy::SetWindowSnapshotSkip(int32_t windowId, bool i
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(static_cast<uint32_t>(
+    auto reqErrCode = SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_SET_WINDOW_SNAPSHOT_SKIP), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2698,7 +2756,7 @@ WMError SceneSessionManagerProxy::GetGlobalWindowMode(DisplayId displayId, Globa
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_GLOBAL_WINDOW_MODE), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2736,7 +2794,7 @@ WMError SceneSessionManagerProxy::GetFloatViewLimits(uint32_t templateType, Floa
         TLOGE(WmsLogTag::WMS_SYSTEM, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FLOAT_VIEW_LIMITS), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SYSTEM, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2774,7 +2832,7 @@ WMError SceneSessionManagerProxy::GetTopNavDestinationName(int32_t windowId, std
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_TOP_NAV_DEST_NAME), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2815,7 +2873,7 @@ WMError SceneSessionManagerProxy::SetScreenWatermarkImage(const std::shared_ptr<
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SCREEN_WATERMARK_IMAGE), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2851,7 +2909,7 @@ WMError SceneSessionManagerProxy::CleanScreenWatermarkImage(const std::shared_pt
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CLEAN_SCREEN_WATERMARK_IMAGE), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2887,7 +2945,7 @@ WMError SceneSessionManagerProxy::RecoverScreenWatermarkImage(const std::string&
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_RECOVER_SCREEN_WATERMARK_IMAGE),
         data, reply, option);
     if (reqErrCode != ERR_NONE) {
@@ -2921,7 +2979,7 @@ WMError SceneSessionManagerProxy::SetWatermarkImageForApp(const std::shared_ptr<
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_APP_WATERMARK_IMAGE), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2964,7 +3022,7 @@ WMError SceneSessionManagerProxy::RecoverWatermarkImageForApp(const std::string&
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto reqErrCode = remote->SendRequest(
+    auto reqErrCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_RECOVER_APP_WATERMARK_IMAGE), data, reply, option);
     if (reqErrCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "send request failed, errCode: %{public}d", reqErrCode);
@@ -2997,7 +3055,7 @@ WMError SceneSessionManagerProxy::GetVisibilityWindowInfo(
         WLOGFE("remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_VISIBILITY_WINDOW_INFO_ID), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -3034,7 +3092,7 @@ WSError SceneSessionManagerProxy::ShiftAppWindowFocus(int32_t sourcePersistentId
         WLOGFE("remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_SHIFT_APP_WINDOW_FOCUS),
         data, reply, option) != ERR_NONE) {
         WLOGFE("SendRequest failed");
@@ -3066,7 +3124,7 @@ WSError SceneSessionManagerProxy::SetSpecificWindowZIndex(WindowType windowType,
         TLOGE(WmsLogTag::WMS_FOCUS, "Remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_SET_SPECIFIC_WINDOW_ZINDEX),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -3098,7 +3156,7 @@ WSError SceneSessionManagerProxy::ResetSpecificWindowZIndex(int32_t pid)
         TLOGE(WmsLogTag::WMS_FOCUS, "Remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_RESET_SPECIFIC_WINDOW_ZINDEX),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_FOCUS, "SendRequest failed");
@@ -3135,7 +3193,7 @@ WSError SceneSessionManagerProxy::MoveMainWindowToTargetDisplay(DisplayId displa
         TLOGE(WmsLogTag::WMS_LIFE, "Remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_MOVE_MAIN_WINDOW_TO_TARGET_DISPLAY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
@@ -3183,7 +3241,7 @@ void SceneSessionManagerProxy::UpdateModalExtensionRect(const sptr<IRemoteObject
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             SceneSessionManagerMessage::TRANS_ID_UPDATE_MODALEXTENSION_RECT_TO_SCB),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -3217,7 +3275,7 @@ void SceneSessionManagerProxy::ProcessModalExtensionPointDown(const sptr<IRemote
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             SceneSessionManagerMessage::TRANS_ID_PROCESS_MODALEXTENSION_POINTDOWN_TO_SCB),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -3264,7 +3322,7 @@ void SceneSessionManagerProxy::AddExtensionWindowStageToSCB(const sptr<ISessionS
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             SceneSessionManagerMessage::TRANS_ID_ADD_EXTENSION_WINDOW_STAGE_TO_SCB),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -3302,7 +3360,7 @@ void SceneSessionManagerProxy::RemoveExtensionWindowStageFromSCB(const sptr<ISes
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             SceneSessionManagerMessage::TRANS_ID_REMOVE_EXTENSION_WINDOW_STAGE_FROM_SCB),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -3331,7 +3389,7 @@ WSError SceneSessionManagerProxy::AddOrRemoveSecureSession(int32_t persistentId,
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
                             SceneSessionManagerMessage::TRANS_ID_ADD_OR_REMOVE_SECURE_SESSION),
                             data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -3368,7 +3426,7 @@ WSError SceneSessionManagerProxy::UpdateExtWindowFlags(const sptr<IRemoteObject>
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_EXTENSION_WINDOW_FLAGS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest AddExtensionSessionInfo failed");
@@ -3400,7 +3458,7 @@ WSError SceneSessionManagerProxy::GetHostWindowRect(int32_t hostWindowId, Rect&
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_HOST_WINDOW_RECT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest GetHostWindowRect failed");
@@ -3438,7 +3496,7 @@ WSError SceneSessionManagerProxy::GetHostGlobalScaledRect(int32_t hostWindowId,
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    auto errorCode = remote->SendRequest(
+    auto errorCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_HOST_GLOBAL_SCALE_RECT), data, reply, option);
     if (errorCode != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed code: %{public}d", errorCode);
@@ -3473,7 +3531,7 @@ WMError SceneSessionManagerProxy::ConvertToRelativeCoordinateExtended(
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "remote is nullptr");
         return WMError::WM_ERROR_NULLPTR;
     }
-    auto sendRet = remote->SendRequest(
+    auto sendRet = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GLOBAL_COORDINATE_TO_RELATIVE_COORDINATE),
         data, reply, option);
     if (sendRet != ERR_NONE) {
@@ -3519,7 +3577,7 @@ WSError SceneSessionManagerProxy::GetFreeMultiWindowEnableState(bool& enable)
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "remote is nullptr");
         return WSError::WS_ERROR_NULLPTR;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_FREE_MULTI_WINDOW_ENABLE_STATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MULTI_WINDOW, "SendRequest GetFreeMultiWindowEnableState failed");
@@ -3549,7 +3607,7 @@ WMError SceneSessionManagerProxy::GetCallingWindowWindowStatus(uint32_t callingW
         TLOGE(WmsLogTag::WMS_KEYBOARD, "remote is null, callingWindowId: %{public}u", callingWindowId);
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_STATUS),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3582,7 +3640,7 @@ WMError SceneSessionManagerProxy::GetCallingWindowRect(uint32_t callingWindowId,
         TLOGE(WmsLogTag::WMS_KEYBOARD, "remote is null, callingWindowId: %{public}u", callingWindowId);
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_RECT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -3614,7 +3672,7 @@ WMError SceneSessionManagerProxy::GetWindowModeType(WindowModeType& windowModeTy
         TLOGE(WmsLogTag::DEFAULT, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_MODE_TYPE), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -3644,7 +3702,7 @@ WMError SceneSessionManagerProxy::MinimizeAllAppWindows(DisplayId displayId, int
         TLOGE(WmsLogTag::WMS_LIFE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_MINIMIZE_ALL_WINDOW), data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -3681,7 +3739,7 @@ WMError SceneSessionManagerProxy::GetWindowStyleType(WindowStyleType& windowStyl
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_STYLE_TYPE), data, reply, option) != ERR_NONE) {
         return WMError::WM_ERROR_IPC_FAILED;
     }
@@ -3712,7 +3770,7 @@ WMError SceneSessionManagerProxy::GetProcessSurfaceNodeIdByPersistentId(const in
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_GET_PROCESS_SURFACENODEID_BY_PERSISTENTID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
@@ -3744,7 +3802,7 @@ WMError SceneSessionManagerProxy::SkipSnapshotForAppProcess(int32_t pid, bool sk
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PROCESS_SNAPSHOT_SKIP),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PROCESS_SNAPSHOT_SKIP),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -3776,7 +3834,7 @@ WMError SceneSessionManagerProxy::SkipSnapshotByUserIdAndBundleNames(int32_t use
         TLOGE(WmsLogTag::WMS_LIFE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_SET_SNAPSHOT_SKIP_BY_USERID_AND_BUNDLENAMES),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -3806,7 +3864,7 @@ WMError SceneSessionManagerProxy::SetProcessWatermark(int32_t pid, const std::st
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write isEnabled failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (Remote()->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PROCESS_WATERMARK),
+    if (SendIpcRequest(Remote(), static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_PROCESS_WATERMARK),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -3837,7 +3895,7 @@ WMError SceneSessionManagerProxy::RecoverProcessWatermark(int32_t pid, const std
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_RECOVER_PROCESS_WATERMARK),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -3882,7 +3940,7 @@ WMError SceneSessionManagerProxy::GetWindowIdsByCoordinate(DisplayId displayId,
         TLOGE(WmsLogTag::DEFAULT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_IDS_BY_COORDINATE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_WINDOW_IDS_BY_COORDINATE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::DEFAULT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -3911,7 +3969,7 @@ WMError SceneSessionManagerProxy::UpdateScreenLockStatusForApp(const std::string
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write isRelease failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (Remote()->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_SESSION_SCREEN_LOCK),
+    if (SendIpcRequest(Remote(), static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_SESSION_SCREEN_LOCK),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -3938,7 +3996,7 @@ WMError SceneSessionManagerProxy::AddSkipSelfWhenShowOnVirtualScreenList(const s
             return WMError::WM_ERROR_IPC_FAILED;
         }
     }
-    if (Remote()->SendRequest(
+    if (SendIpcRequest(Remote(),
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_ADD_SKIP_SELF_ON_VIRTUAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -3966,7 +4024,7 @@ WMError SceneSessionManagerProxy::RemoveSkipSelfWhenShowOnVirtualScreenList(cons
             return WMError::WM_ERROR_IPC_FAILED;
         }
     }
-    if (Remote()->SendRequest(
+    if (SendIpcRequest(Remote(),
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REMOVE_SKIP_SELF_ON_VIRTUAL_SCREEN),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -4009,7 +4067,7 @@ WMError SceneSessionManagerProxy::SetScreenPrivacyWindowTagSwitch(
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_SCREEN_PRIVACY_WINDOW_TAG_SWITCH),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -4038,7 +4096,7 @@ WMError SceneSessionManagerProxy::IsPcOrPadFreeMultiWindowMode(bool& isPcOrPadFr
         TLOGE(WmsLogTag::WMS_SUB, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_IS_PC_OR_PAD_FREE_MULTI_WINDOW_MODE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_SUB, "SendRequest failed");
@@ -4072,7 +4130,7 @@ WMError SceneSessionManagerProxy::IsPcWindow(bool& isPcWindow)
         TLOGE(WmsLogTag::WMS_UIEXT, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_IS_PC_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest failed");
@@ -4106,7 +4164,7 @@ WMError SceneSessionManagerProxy::IsFreeMultiWindow(bool& isFreeMultiWindow)
         TLOGE(WmsLogTag::WMS_PC, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(
+    if (SendIpcRequest(remote, static_cast<uint32_t>(
         SceneSessionManagerMessage::TRANS_ID_IS_FREE_MULTI_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
@@ -4142,7 +4200,7 @@ WMError SceneSessionManagerProxy::GetDisplayIdByWindowId(const std::vector<uint6
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write windowIds failed");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (Remote()->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_DISPLAYID_BY_WINDOWID),
+    if (SendIpcRequest(Remote(), static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_DISPLAYID_BY_WINDOWID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4190,7 +4248,7 @@ WMError SceneSessionManagerProxy::IsWindowRectAutoSave(const std::string& key, b
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_IS_WINDOW_RECT_AUTO_SAVE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_IS_WINDOW_RECT_AUTO_SAVE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MAIN, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4233,7 +4291,7 @@ WMError SceneSessionManagerProxy::SetImageForRecent(uint32_t imgResourceId, Imag
         TLOGE(WmsLogTag::WMS_PATTERN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_IMAGE_FOR_RECENT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4275,7 +4333,7 @@ WMError SceneSessionManagerProxy::SetImageForRecentPixelMap(const std::shared_pt
         TLOGE(WmsLogTag::WMS_PATTERN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_IMAGE_FOR_RECENT_PIXELMAP),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4308,7 +4366,7 @@ WMError SceneSessionManagerProxy::RemoveImageForRecent(int32_t persistentId)
         TLOGE(WmsLogTag::WMS_PATTERN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REMOVE_IMAGE_FOR_RECENT),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4341,7 +4399,7 @@ WMError SceneSessionManagerProxy::SetGlobalDragResizeType(DragResizeType dragRes
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_GLOBAL_DRAG_RESIZE_TYPE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_GLOBAL_DRAG_RESIZE_TYPE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4368,7 +4426,7 @@ WMError SceneSessionManagerProxy::GetGlobalDragResizeType(DragResizeType& dragRe
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_GLOBAL_DRAG_RESIZE_TYPE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_GLOBAL_DRAG_RESIZE_TYPE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4413,7 +4471,7 @@ WMError SceneSessionManagerProxy::SetAppDragResizeType(const std::string& bundle
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_APP_DRAG_RESIZE_TYPE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_APP_DRAG_RESIZE_TYPE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4444,7 +4502,7 @@ WMError SceneSessionManagerProxy::GetAppDragResizeType(const std::string& bundle
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_APP_DRAG_RESIZE_TYPE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_APP_DRAG_RESIZE_TYPE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4490,7 +4548,7 @@ WMError SceneSessionManagerProxy::SetAppKeyFramePolicy(
         TLOGE(WmsLogTag::WMS_LAYOUT, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_APP_KEY_FRAME_POLICY),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_APP_KEY_FRAME_POLICY),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LAYOUT, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4530,7 +4588,8 @@ WMError SceneSessionManagerProxy::ShiftAppWindowPointerEvent(int32_t sourcePersi
         TLOGE(WmsLogTag::WMS_PC, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SHIFT_APP_WINDOW_POINTER_EVENT),
+    if (SendIpcRequest(remote,
+        static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SHIFT_APP_WINDOW_POINTER_EVENT),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4569,7 +4628,7 @@ WMError SceneSessionManagerProxy::SetStartWindowBackgroundColor(
         TLOGE(WmsLogTag::WMS_PATTERN, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    int sendCode = remote->SendRequest(
+    int sendCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_START_WINDOW_BACKGROUND_COLOR),
         data, reply, option);
     if (sendCode != ERR_NONE) {
@@ -4601,7 +4660,7 @@ WMError SceneSessionManagerProxy::MinimizeByWindowId(const std::vector<int32_t>&
         TLOGE(WmsLogTag::WMS_LIFE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MINIMIZE_BY_WINDOW_ID),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_MINIMIZE_BY_WINDOW_ID),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_LIFE, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4631,7 +4690,7 @@ WMError SceneSessionManagerProxy::SetForegroundWindowNum(uint32_t windowNum)
         TLOGE(WmsLogTag::WMS_PC, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_FOREGROUND_WINDOW_NUM),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_FOREGROUND_WINDOW_NUM),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PC, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4662,7 +4721,7 @@ WSError SceneSessionManagerProxy::UseImplicitAnimation(int32_t hostWindowId, boo
         TLOGE(WmsLogTag::WMS_UIEXT, "remote is null");
         return WSError::WS_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_USE_IMPLICIT_ANIMATION),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_USE_IMPLICIT_ANIMATION),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendRequest UseImplicitAnimation failed");
         return WSError::WS_ERROR_IPC_FAILED;
@@ -4701,7 +4760,7 @@ WMError SceneSessionManagerProxy::AnimateTo(int32_t windowId, const WindowAnimat
         TLOGE(WmsLogTag::WMS_ANIMATION, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_ANIMATE_TO_WINDOW),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_ANIMATE_TO_WINDOW),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4728,7 +4787,7 @@ WMError SceneSessionManagerProxy::CreateUIEffectController(const sptr<IUIEffectC
         TLOGE(WmsLogTag::WMS_ANIMATION, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CREATE_UI_EFFECT_CONTROLLER),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_CREATE_UI_EFFECT_CONTROLLER),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4765,7 +4824,7 @@ WMError SceneSessionManagerProxy::GetPiPSettingSwitchStatus(bool& switchStatus)
         TLOGE(WmsLogTag::WMS_PIP, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PIP_SWITCH_STATUS),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PIP_SWITCH_STATUS),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4798,7 +4857,7 @@ WMError SceneSessionManagerProxy::GetIsPipEnabled(bool& isPipEnabled)
         TLOGE(WmsLogTag::WMS_PIP, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PIP_IS_PIP_ENABLED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_PIP_IS_PIP_ENABLED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_PIP, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4852,7 +4911,7 @@ WMError SceneSessionManagerProxy::AddSessionBlackList(
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_ADD_SESSION_BLACK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -4901,7 +4960,7 @@ WMError SceneSessionManagerProxy::RemoveSessionBlackList(
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_REMOVE_SESSION_BLACK_LIST),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
@@ -4942,7 +5001,7 @@ WMError SceneSessionManagerProxy::UpdateOutline(const sptr<IRemoteObject>& remot
         TLOGE(WmsLogTag::WMS_ANIMATION, "Remote is null.");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_OUTLINE),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_UPDATE_OUTLINE),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ANIMATION, "Send request failed.");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4970,7 +5029,7 @@ WMError SceneSessionManagerProxy::NotifySupportRotationRegistered()
         TLOGE(WmsLogTag::WMS_ROTATION, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SUPPORT_ROTATION_REGISTERED),
+    if (SendIpcRequest(remote, static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SUPPORT_ROTATION_REGISTERED),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_ROTATION, "SendRequest failed");
         return WMError::WM_ERROR_IPC_FAILED;
@@ -4996,7 +5055,7 @@ WMError SceneSessionManagerProxy::GetCrossProcessWindowInfo(CrossProcessWindowIn
         TLOGE(WmsLogTag::WMS_LIFE, "Remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    auto retErrorCode = remote->SendRequest(
+    auto retErrorCode = SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_CROSS_PROCESS_WINDOW_INFO),
         data, reply, option);
     if (retErrorCode != ERR_NONE) {
@@ -5059,7 +5118,7 @@ WMError SceneSessionManagerProxy::GetAppWindowShowingInfosByBundleName(const App
         TLOGE(WmsLogTag::WMS_MAIN, "remote is null");
         return WMError::WM_ERROR_IPC_FAILED;
     }
-    if (remote->SendRequest(
+    if (SendIpcRequest(remote,
         static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_APP_WINDOW_SHOWING_INFOS_BY_BUNDLE_NAME),
         data, reply, option) != ERR_NONE) {
         TLOGE(WmsLogTag::WMS_MAIN, "SendRequest failed");
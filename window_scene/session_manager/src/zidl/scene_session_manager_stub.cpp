@@ -16,6 +16,7 @@
 #include "session_manager/include/zidl/scene_session_manager_stub.h"
 
 #include <ui/rs_surface_node.h>
+#include "common/include/latency_histogram.h"
 #include "marshalling_helper.h"
 #include "rs_adapter.h"
 #include "ui_effect_controller_client_interface.h"
@@ -35,6 +36,8 @@ int SceneSessionManagerStub::OnRemoteRequest(uint32_t code,
         WLOGFE("Failed to check interface token!");
         return ERR_TRANSACTION_FAILED;
     }
+    static IpcLatencyTable latencyTable("SceneSessionManager");
+    IpcLatencyScope latencyScope(latencyTable, code, data, reply);
     return ProcessRemoteRequest(code, data, reply, option);
 }
 
@@ -318,6 +321,8 @@ int SceneSessionManagerStub::ProcessRemoteRequest(uint32_t code, MessageParcel&
             return HandleGetFloatViewLimits(data, reply);
         case static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_GET_APP_WINDOW_SHOWING_INFOS_BY_BUNDLE_NAME):
             return HandleGetAppWindowShowingInfosByBundleName(data, reply);
+        case static_cast<uint32_t>(SceneSessionManagerMessage::TRANS_ID_SET_WINDOW_MANAGER_AGENT_FILTER):
+            return HandleSetWindowManagerAgentFilter(data, reply);
         default:
             WLOGFE("Failed to find function handler!");
             return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
@@ -628,6 +633,34 @@ int SceneSessionManagerStub::HandleRecoverWindowPropertyChangeFlag(MessageParcel
     return ERR_NONE;
 }
 
+int SceneSessionManagerStub::HandleSetWindowManagerAgentFilter(MessageParcel& data, MessageParcel& reply)
+{
+    uint32_t type = 0;
+    if (!data.ReadUint32(type) ||
+        type >= static_cast<uint32_t>(WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_END)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Read type failed");
+        return ERR_INVALID_DATA;
+    }
+    sptr<WindowManagerAgentFilter> filter = data.ReadParcelable<WindowManagerAgentFilter>();
+    if (filter == nullptr) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Read filter failed");
+        return ERR_INVALID_DATA;
+    }
+    sptr<IRemoteObject> windowManagerAgentObject = data.ReadRemoteObject();
+    if (windowManagerAgentObject == nullptr) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Read agent failed");
+        return ERR_INVALID_DATA;
+    }
+    sptr<IWindowManagerAgent> windowManagerAgentProxy = iface_cast<IWindowManagerAgent>(windowManagerAgentObject);
+    WMError errCode = SetWindowManagerAgentFilter(static_cast<WindowManagerAgentType>(type), *filter,
+        windowManagerAgentProxy);
+    if (!reply.WriteInt32(static_cast<int32_t>(errCode))) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write errCode failed");
+        return ERR_TRANSACTION_FAILED;
+    }
+    return ERR_NONE;
+}
+
 int SceneSessionManagerStub::HandleRegisterWindowPropertyChangeAgent(MessageParcel& data, MessageParcel& reply)
 {
     int32_t windowInfoKeyValue = 0;
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "display_change_broadcaster.h"
+#include "display_manager_agent_default.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t FAST_AGENT_PID = 100;
+constexpr int32_t SLOW_AGENT_PID = 101;
+constexpr uint32_t SLOW_AGENT_COST_MS = 200;
+constexpr int64_t SLOW_SEND_THRESHOLD_US = 100000;
+
+struct RecordedEvent {
+    std::string type_;
+    DisplayId displayId_ = DISPLAY_ID_INVALID;
+    DisplayChangeEvent event_ = DisplayChangeEvent::UNKNOWN;
+    int32_t width_ = 0;
+};
+
+class RecordDisplayAgent : public DisplayManagerAgentDefault {
+public:
+    explicit RecordDisplayAgent(uint32_t costMs = 0) : costMs_(costMs) {}
+
+    void OnDisplayCreate(sptr<DisplayInfo> displayInfo) override
+    {
+        Record({ "create", displayInfo->GetDisplayId(), DisplayChangeEvent::UNKNOWN, displayInfo->GetWidth() });
+    }
+
+    void OnDisplayDestroy(DisplayId displayId) override
+    {
+        Record({ "destroy", displayId, DisplayChangeEvent::UNKNOWN, 0 });
+    }
+
+    void OnDisplayChange(sptr<DisplayInfo> displayInfo, DisplayChangeEvent event) override
+    {
+        Record({ "change", displayInfo->GetDisplayId(), event, displayInfo->GetWidth() });
+    }
+
+    std::vector<RecordedEvent> GetEvents()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return events_;
+    }
+
+private:
+    void Record(RecordedEvent&& recordedEvent)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(costMs_));
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(std::move(recordedEvent));
+    }
+
+    uint32_t costMs_;
+    std::mutex mutex_;
+    std::vector<RecordedEvent> events_;
+};
+
+/**
+ * @brief Worker pool running each task on its own thread.
+ */
+class ThreadPool {
+public:
+    ~ThreadPool()
+    {
+        Join();
+    }
+
+    DisplayChangeBroadcaster::SubmitFunc GetSubmitFunc()
+    {
+        return [this](std::function<void()>&& task) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            threads_.emplace_back(std::move(task));
+        };
+    }
+
+    void Join()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+        threads_.clear();
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::thread> threads_;
+};
+
+/**
+ * @brief Worker pool holding the tasks until they are run manually.
+ */
+class ManualPool {
+public:
+    DisplayChangeBroadcaster::SubmitFunc GetSubmitFunc()
+    {
+        return [this](std::function<void()>&& task) { tasks_.push_back(std::move(task)); };
+    }
+
+    void RunAll()
+    {
+        auto tasks = std::move(tasks_);
+        tasks_.clear();
+        for (auto& task : tasks) {
+            task();
+        }
+    }
+
+    std::vector<std::function<void()>> tasks_;
+};
+
+sptr<DisplayInfo> CreateDisplayInfo(DisplayId displayId, int32_t width)
+{
+    sptr<DisplayInfo> displayInfo = sptr<DisplayInfo>::MakeSptr();
+    displayInfo->SetDisplayId(displayId);
+    displayInfo->SetWidth(width);
+    return displayInfo;
+}
+} // namespace
+
+class DisplayChangeBroadcasterTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: SlowAgentNotBlocking
+ * @tc.desc: a slow agent only delays its own events and is counted as slow send
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayChangeBroadcasterTest, SlowAgentNotBlocking, TestSize.Level1)
+{
+    ThreadPool pool;
+    DisplayChangeBroadcaster broadcaster(pool.GetSubmitFunc(), SLOW_SEND_THRESHOLD_US);
+    sptr<RecordDisplayAgent> slowAgent = sptr<RecordDisplayAgent>::MakeSptr(SLOW_AGENT_COST_MS);
+    sptr<RecordDisplayAgent> fastAgent = sptr<RecordDisplayAgent>::MakeSptr();
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids = {
+        { slowAgent, SLOW_AGENT_PID }, { fastAgent, FAST_AGENT_PID },
+    };
+    broadcaster.Broadcast(CreateDisplayInfo(0, 1080), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_AGENT_COST_MS / 2));
+    EXPECT_EQ(fastAgent->GetEvents().size(), 1);
+    EXPECT_TRUE(slowAgent->GetEvents().empty());
+
+    pool.Join();
+    ASSERT_EQ(slowAgent->GetEvents().size(), 1);
+    for (const auto& stats : broadcaster.GetAgentStats()) {
+        EXPECT_EQ(stats.sentCount_, 1);
+        EXPECT_EQ(stats.slowSendCount_, stats.pid_ == SLOW_AGENT_PID ? 1 : 0);
+    }
+    std::string dumpInfo;
+    broadcaster.Dump(dumpInfo);
+    GTEST_LOG_(INFO) << dumpInfo;
+    EXPECT_NE(dumpInfo.find(std::to_string(SLOW_AGENT_PID)), std::string::npos);
+}
+
+/**
+ * @tc.name: SupersededEventDropped
+ * @tc.desc: a queued change is replaced in place by a newer change of the same display and type
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayChangeBroadcasterTest, SupersededEventDropped, TestSize.Level1)
+{
+    ManualPool pool;
+    DisplayChangeBroadcaster broadcaster(pool.GetSubmitFunc(), SLOW_SEND_THRESHOLD_US);
+    sptr<RecordDisplayAgent> agent = sptr<RecordDisplayAgent>::MakeSptr();
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids = { { agent, FAST_AGENT_PID } };
+    broadcaster.Broadcast(CreateDisplayInfo(0, 1080), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    broadcaster.Broadcast(CreateDisplayInfo(0, 1080), DisplayChangeEvent::DISPLAY_SIZE_CHANGED, agentPids);
+    broadcaster.Broadcast(CreateDisplayInfo(0, 2160), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    broadcaster.Broadcast(CreateDisplayInfo(0, 2224), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    EXPECT_EQ(pool.tasks_.size(), 1);
+    pool.RunAll();
+
+    auto events = agent->GetEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].event_, DisplayChangeEvent::UPDATE_ROTATION);
+    EXPECT_EQ(events[0].width_, 2224);
+    EXPECT_EQ(events[1].event_, DisplayChangeEvent::DISPLAY_SIZE_CHANGED);
+    auto agentStats = broadcaster.GetAgentStats();
+    ASSERT_EQ(agentStats.size(), 1);
+    EXPECT_EQ(agentStats[0].sentCount_, 2);
+    EXPECT_EQ(agentStats[0].droppedCount_, 2);
+}
+
+/**
+ * @tc.name: CreateDestroyOrdered
+ * @tc.desc: create, change and destroy of a display share the agent queue and a change never passes them
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayChangeBroadcasterTest, CreateDestroyOrdered, TestSize.Level1)
+{
+    ManualPool pool;
+    DisplayChangeBroadcaster broadcaster(pool.GetSubmitFunc(), SLOW_SEND_THRESHOLD_US);
+    sptr<RecordDisplayAgent> agent = sptr<RecordDisplayAgent>::MakeSptr();
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids = { { agent, FAST_AGENT_PID } };
+    broadcaster.Broadcast(CreateDisplayInfo(1, 1080), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    broadcaster.BroadcastDestroy(1, agentPids);
+    broadcaster.BroadcastCreate(CreateDisplayInfo(1, 2160), agentPids);
+    broadcaster.Broadcast(CreateDisplayInfo(1, 2224), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    broadcaster.Broadcast(CreateDisplayInfo(1, 2240), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    EXPECT_EQ(pool.tasks_.size(), 1);
+    pool.RunAll();
+
+    auto events = agent->GetEvents();
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[0].type_, "change");
+    EXPECT_EQ(events[0].width_, 1080);
+    EXPECT_EQ(events[1].type_, "destroy");
+    EXPECT_EQ(events[1].displayId_, 1);
+    EXPECT_EQ(events[2].type_, "create");
+    EXPECT_EQ(events[2].width_, 2160);
+    EXPECT_EQ(events[3].type_, "change");
+    EXPECT_EQ(events[3].width_, 2240);
+    auto agentStats = broadcaster.GetAgentStats();
+    ASSERT_EQ(agentStats.size(), 1);
+    EXPECT_EQ(agentStats[0].sentCount_, 4);
+    EXPECT_EQ(agentStats[0].droppedCount_, 1);
+}
+
+/**
+ * @tc.name: RemoveAgent
+ * @tc.desc: the queued events of a removed agent are discarded
+ * @tc.type: FUNC
+ */
+HWTEST_F(DisplayChangeBroadcasterTest, RemoveAgent, TestSize.Level1)
+{
+    ManualPool pool;
+    DisplayChangeBroadcaster broadcaster(pool.GetSubmitFunc(), SLOW_SEND_THRESHOLD_US);
+    sptr<RecordDisplayAgent> agent = sptr<RecordDisplayAgent>::MakeSptr();
+    std::map<sptr<IDisplayManagerAgent>, int32_t> agentPids = { { agent, FAST_AGENT_PID } };
+    broadcaster.Broadcast(CreateDisplayInfo(0, 1080), DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    broadcaster.RemoveAgent(agent->AsObject());
+    pool.RunAll();
+    EXPECT_TRUE(agent->GetEvents().empty());
+    EXPECT_TRUE(broadcaster.GetAgentStats().empty());
+
+    broadcaster.Broadcast(nullptr, DisplayChangeEvent::UPDATE_ROTATION, agentPids);
+    EXPECT_TRUE(pool.tasks_.empty());
+}
+}
+} // namespace Rosen
+} // namespace OHOS
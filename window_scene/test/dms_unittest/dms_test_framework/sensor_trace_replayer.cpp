@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef SENSOR_ENABLE
+#include "sensor_trace_replayer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include "fold_screen_common.h"
+#include "fold_screen_controller/fold_screen_sensor_manager.h"
+#include "screen_sensor_connector.h"
+#include "screen_session_manager.h"
+#include "time_util.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float EXT_HALL_SUPPORTED_FLAG = 2.0F; // bit 1 marks the extended hall data as valid
+constexpr int64_t NS_PER_US = 1000;
+constexpr double PERCENT_P50 = 0.5;
+constexpr double PERCENT_P90 = 0.9;
+const std::map<std::string, SensorTraceType> TRACE_TYPE_MAP = {
+    { "angle", SensorTraceType::ANGLE },
+    { "hall", SensorTraceType::HALL },
+    { "gravity", SensorTraceType::GRAVITY },
+    { "expect_fold", SensorTraceType::EXPECT_FOLD_STATUS },
+    { "expect_rotation", SensorTraceType::EXPECT_ROTATION },
+};
+
+/**
+ * @brief Track the switches of one probed status against the expectations in the trace.
+ */
+class SwitchTracker {
+public:
+    explicit SwitchTracker(SensorReplayReport& report) : report_(report) {}
+
+    void OnExpect(int32_t value, int64_t timestampUs)
+    {
+        if (hasExpect_ && !isReached_) {
+            report_.missedSwitchCount_++;
+        }
+        hasExpect_ = true;
+        expectValue_ = value;
+        expectTimeUs_ = timestampUs;
+        isReached_ = hasValue_ && value_ == value;
+        if (isReached_) {
+            report_.decisionLatencyUs_.push_back(0);
+        }
+    }
+
+    void OnProbe(int32_t value, int64_t timestampUs)
+    {
+        if (value < 0) {
+            return;
+        }
+        if (!hasValue_ || value_ == value) {
+            hasValue_ = true;
+            value_ = value;
+            return;
+        }
+        value_ = value;
+        report_.switchCount_++;
+        if (!hasExpect_) {
+            return;
+        }
+        if (value != expectValue_) {
+            report_.spuriousSwitchCount_++;
+        } else if (!isReached_) {
+            isReached_ = true;
+            report_.decisionLatencyUs_.push_back(timestampUs - expectTimeUs_);
+        }
+    }
+
+    void OnFinish()
+    {
+        if (hasExpect_ && !isReached_) {
+            report_.missedSwitchCount_++;
+        }
+    }
+
+private:
+    SensorReplayReport& report_;
+    bool hasValue_ = false;
+    int32_t value_ = 0;
+    bool hasExpect_ = false;
+    int32_t expectValue_ = 0;
+    int64_t expectTimeUs_ = 0;
+    bool isReached_ = false;
+};
+
+void DispatchEvent(const SensorTraceEvent& traceEvent, const SensorTraceReplayer::Sink& sink)
+{
+    SensorEvent event = {};
+    event.timestamp = traceEvent.timestampUs_ * NS_PER_US;
+    switch (traceEvent.type_) {
+        case SensorTraceType::ANGLE: {
+            PostureData postureData = {};
+            postureData.angle = traceEvent.values_[0];
+            event.sensorTypeId = SENSOR_TYPE_ID_POSTURE;
+            event.data = reinterpret_cast<uint8_t*>(&postureData);
+            event.dataLen = sizeof(postureData);
+            if (sink.angleHandler_) {
+                sink.angleHandler_(&event);
+            }
+            break;
+        }
+        case SensorTraceType::HALL: {
+            DMS::ExtHallData hallData;
+            hallData.flag = EXT_HALL_SUPPORTED_FLAG;
+            hallData.hall = traceEvent.values_[0];
+            event.sensorTypeId = SENSOR_TYPE_ID_HALL_EXT;
+            event.data = reinterpret_cast<uint8_t*>(&hallData);
+            event.dataLen = sizeof(hallData);
+            if (sink.hallHandler_) {
+                sink.hallHandler_(&event);
+            }
+            break;
+        }
+        case SensorTraceType::GRAVITY: {
+            GravityData gravityData = {};
+            gravityData.x = traceEvent.values_[0];
+            gravityData.y = traceEvent.values_[1];
+            gravityData.z = traceEvent.values_[2]; // 2: z axis
+            event.sensorTypeId = SENSOR_TYPE_ID_ACCELEROMETER;
+            event.data = reinterpret_cast<uint8_t*>(&gravityData);
+            event.dataLen = sizeof(gravityData);
+            if (sink.gravityHandler_) {
+                sink.gravityHandler_(&event);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+} // namespace
+
+bool FileSensorEventSource::Load(const std::string& tracePath)
+{
+    std::ifstream file(tracePath);
+    if (!file.is_open()) {
+        TLOGE(WmsLogTag::DMS, "open trace failed: %{public}s", tracePath.c_str());
+        return false;
+    }
+    return Parse(file);
+}
+
+bool FileSensorEventSource::Parse(std::istream& stream)
+{
+    events_.clear();
+    index_ = 0;
+    std::string line;
+    uint32_t lineNum = 0;
+    while (std::getline(stream, line)) {
+        lineNum++;
+        std::istringstream lineStream(line);
+        std::string typeName;
+        SensorTraceEvent event;
+        if (!(lineStream >> event.timestampUs_)) {
+            continue; // empty line or comment
+        }
+        if (!(lineStream >> typeName) || TRACE_TYPE_MAP.count(typeName) == 0 || !(lineStream >> event.values_[0])) {
+            TLOGE(WmsLogTag::DMS, "invalid trace line: %{public}u", lineNum);
+            return false;
+        }
+        event.type_ = TRACE_TYPE_MAP.at(typeName);
+        if (event.type_ == SensorTraceType::GRAVITY &&
+            !(lineStream >> event.values_[1] >> event.values_[2])) { // 2: z axis
+            TLOGE(WmsLogTag::DMS, "invalid gravity trace line: %{public}u", lineNum);
+            return false;
+        }
+        events_.push_back(event);
+    }
+    std::stable_sort(events_.begin(), events_.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.timestampUs_ < rhs.timestampUs_;
+    });
+    return true;
+}
+
+bool FileSensorEventSource::Next(SensorTraceEvent& event)
+{
+    if (index_ >= events_.size()) {
+        return false;
+    }
+    event = events_[index_++];
+    return true;
+}
+
+void SensorReplayReport::Dump(std::string& dumpInfo) const
+{
+    std::vector<int64_t> latencies = decisionLatencyUs_;
+    std::sort(latencies.begin(), latencies.end());
+    auto getPercentile = [&latencies](double percent) -> int64_t {
+        if (latencies.empty()) {
+            return 0;
+        }
+        return latencies[static_cast<size_t>(percent * (latencies.size() - 1))];
+    };
+    std::ostringstream oss;
+    oss << "events: " << eventCount_
+        << ", switches: " << switchCount_
+        << ", spurious switches: " << spuriousSwitchCount_
+        << ", missed switches: " << missedSwitchCount_ << std::endl
+        << "decision latency(us) p50: " << getPercentile(PERCENT_P50)
+        << ", p90: " << getPercentile(PERCENT_P90)
+        << ", max: " << (latencies.empty() ? 0 : latencies.back()) << std::endl
+        << "handle cost(us) total: " << totalHandleCostUs_
+        << ", max: " << maxHandleCostUs_ << std::endl;
+    dumpInfo.append(oss.str());
+}
+
+SensorTraceReplayer::Sink SensorTraceReplayer::CreateDefaultSink()
+{
+    Sink sink;
+    sink.angleHandler_ = [](const SensorEvent* event) {
+        FoldScreenSensorManager::GetInstance().HandlePostureData(event);
+    };
+    sink.hallHandler_ = [](const SensorEvent* event) {
+        FoldScreenSensorManager::GetInstance().HandleHallData(event);
+    };
+    // the replayer is only built into tests, whose testcase flags expose the private sensor callbacks
+    sink.gravityHandler_ = [](SensorEvent* event) {
+        GravitySensorSubscriber::HandleGravitySensorEventCallback(event);
+    };
+    sink.foldStatusProbe_ = [] {
+        return static_cast<int32_t>(ScreenSessionManager::GetInstance().GetFoldStatus());
+    };
+    sink.rotationProbe_ = [] {
+        auto screenSession = ScreenSessionManager::GetInstance().GetDefaultScreenSession();
+        return screenSession == nullptr ? -1 : static_cast<int32_t>(screenSession->GetSensorRotation());
+    };
+    return sink;
+}
+
+SensorReplayReport SensorTraceReplayer::Replay(SensorEventSource& source, const Sink& sink, float speed)
+{
+    SensorReplayReport report;
+    SwitchTracker foldTracker(report);
+    SwitchTracker rotationTracker(report);
+    auto probe = [&sink, &foldTracker, &rotationTracker](int64_t timestampUs) {
+        if (sink.foldStatusProbe_) {
+            foldTracker.OnProbe(sink.foldStatusProbe_(), timestampUs);
+        }
+        if (sink.rotationProbe_) {
+            rotationTracker.OnProbe(sink.rotationProbe_(), timestampUs);
+        }
+    };
+    probe(0);
+    SensorTraceEvent event;
+    bool isFirstEvent = true;
+    int64_t firstTraceTimeUs = 0;
+    int64_t startTimeUs = TimeUtil::GetCurrentTimeUs();
+    while (source.Next(event)) {
+        if (isFirstEvent) {
+            isFirstEvent = false;
+            firstTraceTimeUs = event.timestampUs_;
+        }
+        if (speed > 0.0f) {
+            auto wakeTimeUs = startTimeUs + static_cast<int64_t>((event.timestampUs_ - firstTraceTimeUs) / speed);
+            int64_t waitTimeUs = wakeTimeUs - TimeUtil::GetCurrentTimeUs();
+            if (waitTimeUs > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(waitTimeUs));
+            }
+        }
+        report.eventCount_++;
+        if (event.type_ == SensorTraceType::EXPECT_FOLD_STATUS) {
+            foldTracker.OnExpect(static_cast<int32_t>(event.values_[0]), event.timestampUs_);
+            continue;
+        }
+        if (event.type_ == SensorTraceType::EXPECT_ROTATION) {
+            rotationTracker.OnExpect(static_cast<int32_t>(event.values_[0]), event.timestampUs_);
+            continue;
+        }
+        int64_t handleStartUs = TimeUtil::GetCurrentTimeUs();
+        DispatchEvent(event, sink);
+        int64_t handleCostUs = TimeUtil::GetCurrentTimeUs() - handleStartUs;
+        report.totalHandleCostUs_ += handleCostUs;
+        report.maxHandleCostUs_ = std::max(report.maxHandleCostUs_, handleCostUs);
+        probe(event.timestampUs_);
+    }
+    foldTracker.OnFinish();
+    rotationTracker.OnFinish();
+    return report;
+}
+} // namespace Rosen
+} // namespace OHOS
+#endif // SENSOR_ENABLE
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_SENSOR_TRACE_REPLAYER_H
+#define OHOS_ROSEN_SENSOR_TRACE_REPLAYER_H
+
+#ifdef SENSOR_ENABLE
+#include <array>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace Rosen {
+enum class SensorTraceType : uint32_t {
+    ANGLE = 0,
+    HALL,
+    GRAVITY,
+    EXPECT_FOLD_STATUS,
+    EXPECT_ROTATION,
+};
+
+struct SensorTraceEvent {
+    int64_t timestampUs_ = 0;
+    SensorTraceType type_ = SensorTraceType::ANGLE;
+    std::array<float, 3> values_ = {}; // 3: x, y and z of gravity
+};
+
+/**
+ * @brief Source of sensor events fed into the fold and rotation state managers.
+ */
+class SensorEventSource {
+public:
+    virtual ~SensorEventSource() = default;
+    virtual bool Next(SensorTraceEvent& event) = 0;
+};
+
+/**
+ * @brief Sensor events recorded in a text trace, one event per line:
+ * "<timestampUs> angle <degree>", "<timestampUs> hall <value>", "<timestampUs> gravity <x> <y> <z>".
+ * "<timestampUs> expect_fold <FoldStatus>" and "<timestampUs> expect_rotation <degree>" mark the
+ * status the device really reached, lines starting with '#' are comments.
+ */
+class FileSensorEventSource : public SensorEventSource {
+public:
+    bool Load(const std::string& tracePath);
+    bool Parse(std::istream& stream);
+    bool Next(SensorTraceEvent& event) override;
+    size_t GetEventCount() const { return events_.size(); }
+
+private:
+    std::vector<SensorTraceEvent> events_;
+    size_t index_ = 0;
+};
+
+struct SensorReplayReport {
+    uint32_t eventCount_ = 0;
+    uint32_t switchCount_ = 0;
+    // switches to a status other than the expected one
+    uint32_t spuriousSwitchCount_ = 0;
+    // expected statuses never reached before the next expectation
+    uint32_t missedSwitchCount_ = 0;
+    // trace time from an expectation to the switch reaching it
+    std::vector<int64_t> decisionLatencyUs_;
+    // wall time spent in the sensor handlers
+    int64_t totalHandleCostUs_ = 0;
+    int64_t maxHandleCostUs_ = 0;
+
+    void Dump(std::string& dumpInfo) const;
+};
+
+class SensorTraceReplayer {
+public:
+    struct Sink {
+        std::function<void(const SensorEvent*)> angleHandler_;
+        std::function<void(const SensorEvent*)> hallHandler_;
+        std::function<void(SensorEvent*)> gravityHandler_;
+        std::function<int32_t()> foldStatusProbe_;
+        std::function<int32_t()> rotationProbe_;
+    };
+
+    /**
+     * @brief Sink feeding FoldScreenSensorManager and GravitySensorSubscriber, the same path as real sensors.
+     */
+    static Sink CreateDefaultSink();
+
+    /**
+     * @brief Replay all events of source into sink.
+     *
+     * @param speed Replay speed relative to the trace timestamps, 0 replays as fast as possible.
+     * Gravity events are rate limited by wall time, replay them at speed 1 to keep them.
+     */
+    static SensorReplayReport Replay(SensorEventSource& source, const Sink& sink, float speed = 0.0f);
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // SENSOR_ENABLE
+#endif // OHOS_ROSEN_SENSOR_TRACE_REPLAYER_H
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "screen_power_mgr.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr ScreenId SCREEN_ID_FULL = 0;
+constexpr ScreenId SCREEN_ID_MAIN = 5;
+constexpr uint32_t RS_DELAY_MS = 5;
+constexpr uint32_t FIXED_SLEEP_MS = 50;
+
+/**
+ * @brief Fake RS applying power status asynchronously after a delay, power on commits a first frame.
+ */
+class FakeRSScreenPowerMgr : public DMS::ScreenPowerMgr {
+public:
+    ~FakeRSScreenPowerMgr()
+    {
+        for (auto& thread : rsThreads_) {
+            thread.join();
+        }
+    }
+
+    void DoSetScreenPowerStatus(ScreenId rsScreenId, ScreenPowerStatus status) override
+    {
+        AddScreenPowerRequest(rsScreenId);
+        if (!isRSWorking_) {
+            return;
+        }
+        rsThreads_.emplace_back([this, rsScreenId, status] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(RS_DELAY_MS));
+            {
+                std::lock_guard<std::mutex> lock(rsMutex_);
+                rsStatusMap_[rsScreenId] = status;
+            }
+            if (status == ScreenPowerStatus::POWER_STATUS_ON) {
+                NotifyFirstFrameCommit(rsScreenId);
+            }
+        });
+    }
+
+    bool isRSWorking_ = true;
+
+protected:
+    ScreenPowerStatus GetRSScreenPowerStatus(ScreenId rsScreenId) override
+    {
+        std::lock_guard<std::mutex> lock(rsMutex_);
+        auto iter = rsStatusMap_.find(rsScreenId);
+        return iter == rsStatusMap_.end() ? ScreenPowerStatus::INVALID_POWER_STATUS : iter->second;
+    }
+
+private:
+    std::mutex rsMutex_;
+    std::map<ScreenId, ScreenPowerStatus> rsStatusMap_;
+    std::vector<std::thread> rsThreads_;
+};
+
+int64_t GetCostMs(std::chrono::steady_clock::time_point startTime)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+} // namespace
+
+class ScreenPowerMgrTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: WaitPowerOn
+ * @tc.desc: power on completes on the first frame committed after the set
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, WaitPowerOn, TestSize.Level1)
+{
+    FakeRSScreenPowerMgr powerMgr;
+    auto startTime = std::chrono::steady_clock::now();
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, 1000));
+    EXPECT_LT(GetCostMs(startTime), 1000);
+
+    requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
+    std::this_thread::sleep_for(std::chrono::milliseconds(RS_DELAY_MS * 2));
+    startTime = std::chrono::steady_clock::now();
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, 1000));
+    EXPECT_LT(GetCostMs(startTime), RS_DELAY_MS);
+}
+
+/**
+ * @tc.name: WaitPowerOff
+ * @tc.desc: power off completes when RS reports the new status
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, WaitPowerOff, TestSize.Level1)
+{
+    FakeRSScreenPowerMgr powerMgr;
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_FULL);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF);
+    std::this_thread::sleep_for(std::chrono::milliseconds(RS_DELAY_MS * 2));
+    auto startTime = std::chrono::steady_clock::now();
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF,
+        requestSeq, 1000));
+    EXPECT_LT(GetCostMs(startTime), RS_DELAY_MS);
+}
+
+/**
+ * @tc.name: WaitTimeout
+ * @tc.desc: the timeout is the fallback when RS never completes
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, WaitTimeout, TestSize.Level1)
+{
+    FakeRSScreenPowerMgr powerMgr;
+    powerMgr.isRSWorking_ = false;
+    auto startTime = std::chrono::steady_clock::now();
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
+    EXPECT_FALSE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, FIXED_SLEEP_MS));
+    EXPECT_GE(GetCostMs(startTime), FIXED_SLEEP_MS);
+}
+
+/**
+ * @tc.name: WaitCancelledRequest
+ * @tc.desc: the ack of an older request does not complete the wait for a set that was cancelled
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, WaitCancelledRequest, TestSize.Level1)
+{
+    FakeRSScreenPowerMgr powerMgr;
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_FULL);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF);
+    std::this_thread::sleep_for(std::chrono::milliseconds(RS_DELAY_MS * 2));
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF,
+        requestSeq, 1000));
+
+    // the caller cancels the set, so no request is added after requestSeq
+    requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_FULL);
+    auto startTime = std::chrono::steady_clock::now();
+    EXPECT_FALSE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF,
+        requestSeq, FIXED_SLEEP_MS));
+    EXPECT_GE(GetCostMs(startTime), FIXED_SLEEP_MS);
+
+    requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, 1000));
+    requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    EXPECT_FALSE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, FIXED_SLEEP_MS));
+}
+
+/**
+ * @tc.name: FirstFrameCommitAck
+ * @tc.desc: the first frame committed by RS acks the requests of the singleton used by the screen session manager
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, FirstFrameCommitAck, TestSize.Level1)
+{
+    auto& powerMgr = DMS::ScreenPowerMgr::GetInstance();
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    EXPECT_EQ(powerMgr.AddScreenPowerRequest(SCREEN_ID_MAIN), requestSeq + 1);
+    EXPECT_EQ(powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN), requestSeq + 1);
+
+    std::thread commitThread([&powerMgr] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(RS_DELAY_MS));
+        powerMgr.NotifyFirstFrameCommit(SCREEN_ID_MAIN);
+    });
+    auto startTime = std::chrono::steady_clock::now();
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, 1000));
+    EXPECT_LT(GetCostMs(startTime), 1000);
+    commitThread.join();
+
+    // a frame committed without a new request acks nothing
+    requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.NotifyFirstFrameCommit(SCREEN_ID_MAIN);
+    EXPECT_FALSE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, RS_DELAY_MS));
+}
+
+/**
+ * @tc.name: BootPowerSwitchTime
+ * @tc.desc: measure the boot power switch sequence against the fixed sleep it replaces
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenPowerMgrTest, BootPowerSwitchTime, TestSize.Level1)
+{
+    FakeRSScreenPowerMgr powerMgr;
+    auto startTime = std::chrono::steady_clock::now();
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_OFF_FAKE);
+    uint64_t requestSeq = powerMgr.GetScreenPowerRequestSeq(SCREEN_ID_MAIN);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON);
+    EXPECT_TRUE(powerMgr.WaitScreenPowerStatusApplied(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_ON,
+        requestSeq, FIXED_SLEEP_MS * 10));
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_MAIN, ScreenPowerStatus::POWER_STATUS_OFF);
+    powerMgr.DoSetScreenPowerStatus(SCREEN_ID_FULL, ScreenPowerStatus::POWER_STATUS_ON);
+    auto costMs = GetCostMs(startTime);
+    GTEST_LOG_(INFO) << "boot power switch cost: " << costMs << " ms, fixed sleep: " << FIXED_SLEEP_MS << " ms";
+    EXPECT_LT(costMs, FIXED_SLEEP_MS * 10);
+}
+}
+} // namespace Rosen
+} // namespace OHOS
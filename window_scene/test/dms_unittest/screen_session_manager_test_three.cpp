@@ -17,6 +17,7 @@
 
 #include "screen_session_manager/include/screen_session_manager.h"
 #include "screen_session_manager/include/screen_power_fsm/screen_state_machine.h"
+#include "screen_power_mgr.h"
 #include "display_manager_agent_default.h"
 #include "iconsumer_surface.h"
 #include "connection/screen_cast_connection.h"
@@ -325,6 +326,28 @@ HWTEST_F(ScreenSessionManagerTest, SetRSScreenPowerStatus, TestSize.Level1)
     EXPECT_EQ(state, ScreenPowerState::POWER_OFF);
 }
 
+/**
+ * @tc.name: WaitRSScreenPowerStatus
+ * @tc.desc: the wait completes on the ack of a request set after the sequence read, never on an older ack
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScreenSessionManagerTest, WaitRSScreenPowerStatus, TestSize.Level1)
+{
+    ASSERT_NE(ssm_, nullptr);
+    uint64_t requestSeq = ssm_->GetRSScreenPowerRequestSeq(0);
+    if (!ssm_->SetRSScreenPowerStatusExt(0, ScreenPowerStatus::POWER_STATUS_ON)) {
+        EXPECT_EQ(ssm_->GetRSScreenPowerRequestSeq(0), requestSeq);
+        EXPECT_FALSE(ssm_->WaitRSScreenPowerStatus(0, ScreenPowerStatus::POWER_STATUS_ON, requestSeq, 10));
+        return;
+    }
+    EXPECT_EQ(ssm_->GetRSScreenPowerRequestSeq(0), requestSeq + 1);
+    DMS::ScreenPowerMgr::GetInstance().NotifyFirstFrameCommit(0);
+    EXPECT_TRUE(ssm_->WaitRSScreenPowerStatus(0, ScreenPowerStatus::POWER_STATUS_ON, requestSeq, 1000));
+
+    requestSeq = ssm_->GetRSScreenPowerRequestSeq(0);
+    EXPECT_FALSE(ssm_->WaitRSScreenPowerStatus(0, ScreenPowerStatus::POWER_STATUS_ON, requestSeq, 10));
+}
+
 /**
  * @tc.name: GetScreenCombination01
  * @tc.desc: GetScreenCombination01
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <thread>
 
 #include <parameter.h>
 #include <parameters.h>
@@ -757,6 +758,69 @@ HWTEST_F(SecondaryDisplayFoldPolicyTest, UpdatePositionZForDualDisplayNodeFeatur
     policy.UpdatePositionZForDualDisplayNode();
     EXPECT_FALSE(policy.dualDisplayNodePositionZ_.empty());
 }
+
+/**
+ * @tc.name: WaitCoordinationExit
+ * @tc.desc: waiting for coordination exit returns once the display mode changes, timeout only as fallback
+ * @tc.type: FUNC
+ */
+HWTEST_F(SecondaryDisplayFoldPolicyTest, WaitCoordinationExit, TestSize.Level1)
+{
+    std::recursive_mutex displayInfoMutex;
+    std::shared_ptr<TaskScheduler> screenPowerTaskScheduler = nullptr;
+    SecondaryDisplayFoldPolicy policy(displayInfoMutex, screenPowerTaskScheduler);
+
+    policy.currentDisplayMode_ = FoldDisplayMode::FULL;
+    EXPECT_TRUE(policy.WaitCoordinationExit());
+
+    policy.currentDisplayMode_ = FoldDisplayMode::COORDINATION;
+    bool isCoordination = ScreenSessionManager::GetInstance().GetCoordinationFlag();
+    auto startTime = std::chrono::steady_clock::now();
+    std::thread exitThread([&policy] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        policy.ExitCoordination();
+    });
+    // ExitCoordination is skipped without the coordination flag, so the wait falls back to the timeout
+    bool isExited = policy.WaitCoordinationExit();
+    exitThread.join();
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    GTEST_LOG_(INFO) << "coordination exit wait cost: " << costMs << " ms";
+    EXPECT_EQ(isExited, isCoordination);
+
+    policy.currentDisplayMode_ = FoldDisplayMode::COORDINATION;
+    EXPECT_FALSE(policy.WaitCoordinationExit());
+}
+
+/**
+ * @tc.name: WaitCoordinationExitByDisplayModeChange
+ * @tc.desc: a display mode change written under displayModeMutex_ wakes the coordination exit wait
+ * @tc.type: FUNC
+ */
+HWTEST_F(SecondaryDisplayFoldPolicyTest, WaitCoordinationExitByDisplayModeChange, TestSize.Level1)
+{
+    std::recursive_mutex displayInfoMutex;
+    std::shared_ptr<TaskScheduler> screenPowerTaskScheduler = nullptr;
+    SecondaryDisplayFoldPolicy policy(displayInfoMutex, screenPowerTaskScheduler);
+
+    policy.currentDisplayMode_ = FoldDisplayMode::COORDINATION;
+    auto startTime = std::chrono::steady_clock::now();
+    std::thread changeThread([&policy] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // ChangeScreenDisplayMode writes the mode and notifies while ExitCoordination may hold coordinationMutex_
+        std::lock_guard<std::mutex> lock(policy.coordinationMutex_);
+        {
+            std::lock_guard<std::recursive_mutex> lockMode(policy.displayModeMutex_);
+            policy.currentDisplayMode_ = FoldDisplayMode::FULL;
+        }
+        policy.NotifyCoordinationExit();
+    });
+    EXPECT_TRUE(policy.WaitCoordinationExit());
+    changeThread.join();
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    EXPECT_LT(costMs, 600);
+}
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "fold_screen_controller/fold_screen_sensor_manager.h"
+#include "fold_screen_controller/sensor_fold_state_manager/single_display_sensor_fold_state_manager.h"
+#include "screen_sensor_connector.h"
+#include "screen_session_manager.h"
+#include "sensor_trace_replayer.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+#ifdef SENSOR_ENABLE
+namespace {
+// open, fold to half folded at 150ms and to folded at 350ms
+const std::string FOLD_TRACE =
+    "# timestampUs type value\n"
+    "0 angle 180\n"
+    "0 hall 1\n"
+    "0 expect_fold 1\n"
+    "100000 angle 150\n"
+    "150000 expect_fold 3\n"
+    "200000 angle 130\n"
+    "300000 angle 135\n"
+    "350000 expect_fold 2\n"
+    "400000 angle 60\n"
+    "500000 angle 20\n";
+// angle shakes inside the buffer below the expand threshold while the device stays half folded
+const std::string JITTER_TRACE =
+    "0 angle 120\n"
+    "0 hall 1\n"
+    "0 expect_fold 3\n"
+    "100000 angle 138\n"
+    "200000 angle 131\n"
+    "300000 angle 139\n"
+    "400000 angle 132\n";
+// portrait, landscape, lying flat keeps landscape, back to portrait
+const std::string ROTATION_TRACE =
+    "0 gravity 9.8 0 0\n"
+    "0 expect_rotation 0\n"
+    "100000 expect_rotation 90\n"
+    "100000 gravity 0 -9.8 0\n"
+    "200000 gravity 0 0 9.8\n"
+    "300000 expect_rotation 0\n"
+    "300000 gravity 9.8 0 0\n";
+constexpr ScreenId REPLAY_SCREEN_ID = 1100;
+
+struct FoldReplayContext {
+    FoldScreenSensorManager manager_;
+    sptr<FoldScreenPolicy> policy_ = sptr<FoldScreenPolicy>::MakeSptr();
+
+    FoldReplayContext()
+    {
+        manager_.registerPosture_ = true;
+        manager_.SetFoldScreenPolicy(policy_);
+        manager_.SetSensorFoldStateManager(sptr<SingleDisplaySensorFoldStateManager>::MakeSptr());
+    }
+
+    SensorTraceReplayer::Sink CreateSink()
+    {
+        SensorTraceReplayer::Sink sink;
+        sink.angleHandler_ = [this](const SensorEvent* event) { manager_.HandlePostureData(event); };
+        sink.hallHandler_ = [this](const SensorEvent* event) { manager_.HandleHallData(event); };
+        sink.foldStatusProbe_ = [this] { return static_cast<int32_t>(policy_->GetFoldStatus()); };
+        return sink;
+    }
+};
+
+SensorReplayReport ReplayTrace(const std::string& trace, const SensorTraceReplayer::Sink& sink)
+{
+    std::istringstream stream(trace);
+    FileSensorEventSource source;
+    EXPECT_TRUE(source.Parse(stream));
+    auto report = SensorTraceReplayer::Replay(source, sink);
+    std::string dumpInfo;
+    report.Dump(dumpInfo);
+    GTEST_LOG_(INFO) << dumpInfo;
+    return report;
+}
+
+SensorTraceReplayer::Sink CreateRotationSink()
+{
+    auto sink = SensorTraceReplayer::CreateDefaultSink();
+    sink.angleHandler_ = nullptr;
+    sink.hallHandler_ = nullptr;
+    sink.foldStatusProbe_ = nullptr;
+    return sink;
+}
+} // namespace
+
+class SensorTraceReplayerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        auto& ssm = ScreenSessionManager::GetInstance();
+        lastDefaultScreenId_ = ssm.defaultScreenId_;
+        ssm.screenSessionMap_[REPLAY_SCREEN_ID] = sptr<ScreenSession>::MakeSptr();
+        ssm.defaultScreenId_ = REPLAY_SCREEN_ID;
+        GravitySensorSubscriber::lastCallbackTime_ = 0;
+    }
+    void TearDown() override
+    {
+        auto& ssm = ScreenSessionManager::GetInstance();
+        ssm.screenSessionMap_.erase(REPLAY_SCREEN_ID);
+        ssm.defaultScreenId_ = lastDefaultScreenId_;
+    }
+
+private:
+    ScreenId lastDefaultScreenId_ = SCREEN_ID_INVALID;
+};
+
+namespace {
+/**
+ * @tc.name: ParseTrace
+ * @tc.desc: parse the trace lines, invalid line is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(SensorTraceReplayerTest, ParseTrace, TestSize.Level1)
+{
+    std::istringstream stream("# comment\n\n20 gravity 1 2 3\n10 angle 90\n");
+    FileSensorEventSource source;
+    ASSERT_TRUE(source.Parse(stream));
+    EXPECT_EQ(source.GetEventCount(), 2);
+    SensorTraceEvent event;
+    ASSERT_TRUE(source.Next(event));
+    EXPECT_EQ(event.type_, SensorTraceType::ANGLE);
+    EXPECT_EQ(event.timestampUs_, 10);
+    ASSERT_TRUE(source.Next(event));
+    EXPECT_EQ(event.type_, SensorTraceType::GRAVITY);
+    EXPECT_EQ(event.values_[2], 3.0f);
+    EXPECT_FALSE(source.Next(event));
+
+    std::istringstream invalidStream("10 unknown 90\n");
+    EXPECT_FALSE(source.Parse(invalidStream));
+    std::istringstream invalidGravityStream("10 gravity 1 2\n");
+    EXPECT_FALSE(source.Parse(invalidGravityStream));
+    EXPECT_FALSE(source.Load("/data/local/tmp/not_exist_sensor_trace.txt"));
+}
+
+/**
+ * @tc.name: ReplayFoldTrace
+ * @tc.desc: replay a fold trace through the real sensor fold state manager and measure decision latency
+ * @tc.type: FUNC
+ */
+HWTEST_F(SensorTraceReplayerTest, ReplayFoldTrace, TestSize.Level1)
+{
+    FoldReplayContext context;
+    auto report = ReplayTrace(FOLD_TRACE, context.CreateSink());
+    EXPECT_EQ(report.eventCount_, 10);
+    EXPECT_EQ(report.spuriousSwitchCount_, 0);
+    EXPECT_EQ(report.missedSwitchCount_, 0);
+    ASSERT_EQ(report.decisionLatencyUs_.size(), 3);
+    EXPECT_EQ(report.decisionLatencyUs_[1], 50000);
+    EXPECT_EQ(report.decisionLatencyUs_[2], 50000);
+}
+
+/**
+ * @tc.name: ReplayJitterTrace
+ * @tc.desc: angle jitter inside the half folded buffer is debounced and never leaves half folded
+ * @tc.type: FUNC
+ */
+HWTEST_F(SensorTraceReplayerTest, ReplayJitterTrace, TestSize.Level1)
+{
+    FoldReplayContext context;
+    auto report = ReplayTrace(JITTER_TRACE, context.CreateSink());
+    EXPECT_EQ(report.eventCount_, 7);
+    EXPECT_EQ(report.spuriousSwitchCount_, 0);
+    EXPECT_EQ(report.missedSwitchCount_, 0);
+    EXPECT_EQ(context.policy_->GetFoldStatus(), FoldStatus::HALF_FOLD);
+}
+
+/**
+ * @tc.name: ReplayRotationTrace
+ * @tc.desc: replay gravity events through the gravity sensor callback and track the sensor rotation
+ * @tc.type: FUNC
+ */
+HWTEST_F(SensorTraceReplayerTest, ReplayRotationTrace, TestSize.Level1)
+{
+    auto sink = CreateRotationSink();
+    auto gravityHandler = sink.gravityHandler_;
+    // lift the wall time rate limit of the callback so that the trace replays at full speed
+    sink.gravityHandler_ = [gravityHandler](SensorEvent* event) {
+        GravitySensorSubscriber::lastCallbackTime_ = 0;
+        gravityHandler(event);
+    };
+    auto report = ReplayTrace(ROTATION_TRACE, sink);
+    EXPECT_EQ(report.eventCount_, 7);
+    EXPECT_EQ(report.spuriousSwitchCount_, 0);
+    EXPECT_EQ(report.missedSwitchCount_, 0);
+    ASSERT_EQ(report.decisionLatencyUs_.size(), 3);
+    EXPECT_EQ(report.decisionLatencyUs_[1], 0);
+    EXPECT_EQ(report.decisionLatencyUs_[2], 0);
+    auto screenSession = ScreenSessionManager::GetInstance().GetScreenSession(REPLAY_SCREEN_ID);
+    ASSERT_NE(screenSession, nullptr);
+    EXPECT_EQ(screenSession->GetValidSensorRotation(), 0.0f);
+}
+
+/**
+ * @tc.name: ReplayGravityRateLimit
+ * @tc.desc: gravity events closer than the callback interval are dropped, the rotation is missed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SensorTraceReplayerTest, ReplayGravityRateLimit, TestSize.Level1)
+{
+    auto report = ReplayTrace(ROTATION_TRACE, CreateRotationSink());
+    EXPECT_EQ(report.spuriousSwitchCount_, 0);
+    EXPECT_EQ(report.missedSwitchCount_, 1);
+    auto screenSession = ScreenSessionManager::GetInstance().GetScreenSession(REPLAY_SCREEN_ID);
+    ASSERT_NE(screenSession, nullptr);
+    EXPECT_EQ(screenSession->GetValidSensorRotation(), 0.0f);
+}
+}
+#endif // SENSOR_ENABLE
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mock_alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+std::atomic<uint64_t> g_allocCount { 0 };
+std::atomic<uint64_t> g_allocBytes { 0 };
+thread_local bool g_isThreadCounting = false;
+thread_local uint64_t g_threadAllocCount = 0;
+
+void* CountedAlloc(std::size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (g_isThreadCounting) {
+        g_threadAllocCount++;
+    }
+    return std::malloc(size == 0 ? 1 : size);
+}
+} // namespace
+
+uint64_t MockAllocCounter::GetAllocCount()
+{
+    return g_allocCount.load(std::memory_order_relaxed);
+}
+
+uint64_t MockAllocCounter::GetAllocBytes()
+{
+    return g_allocBytes.load(std::memory_order_relaxed);
+}
+
+void MockAllocCounter::StartThreadCounting()
+{
+    g_threadAllocCount = 0;
+    g_isThreadCounting = true;
+}
+
+uint64_t MockAllocCounter::StopThreadCounting()
+{
+    g_isThreadCounting = false;
+    return g_threadAllocCount;
+}
+} // namespace Rosen
+} // namespace OHOS
+
+void* operator new(std::size_t size)
+{
+    void* ptr = OHOS::Rosen::CountedAlloc(size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return OHOS::Rosen::CountedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return OHOS::Rosen::CountedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MOCK_ALLOC_COUNTER_H
+#define MOCK_ALLOC_COUNTER_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @brief Allocations done through the global operator new, which mock_alloc_counter.cpp replaces.
+ *
+ * Add mock_alloc_counter.cpp to the sources of the test, only one replacement may exist in a binary.
+ */
+class MockAllocCounter {
+public:
+    // allocations of all threads since the process started
+    static uint64_t GetAllocCount();
+    static uint64_t GetAllocBytes();
+
+    // allocations of the calling thread only, between start and stop
+    static void StartThreadCounting();
+    static uint64_t StopThreadCounting();
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // MOCK_ALLOC_COUNTER_H
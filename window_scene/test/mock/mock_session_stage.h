@@ -43,7 +43,8 @@ public:
     MOCK_METHOD4(NotifyOccupiedAreaChangeInfo, void(sptr<OccupiedAreaChangeInfo> info,
         const std::shared_ptr<RSTransaction>& rsTransaction, const Rect& callingWindowRect,
         const std::map<AvoidAreaType, AvoidArea>& avoidAreas));
-    MOCK_METHOD2(UpdateAvoidArea, WSError(const sptr<AvoidArea>& avoidArea, AvoidAreaType type));
+    MOCK_METHOD3(UpdateAvoidArea, WSError(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect));
     MOCK_METHOD1(DumpSessionElementInfo, void(const std::vector<std::string>& params));
     MOCK_METHOD0(NotifyScreenshot, void(void));
     MOCK_METHOD1(NotifyScreenshotAppEvent, WSError(ScreenshotEventType type));
@@ -16,8 +16,10 @@
 #include "scene_input_manager.h"
 #include <gtest/gtest.h>
 #include "session_manager/include/scene_session_manager.h"
+#include "mock/mock_alloc_counter.h"
 #include "screen_session_manager_client/include/screen_session_manager_client.h"
 #include "session_manager/include/scene_session_dirty_manager.h"
+#include "window_mask_cache.h"
 #include "window_manager_hilog.h"
 
 using namespace testing;
@@ -563,17 +565,17 @@ HWTEST_F(SceneInputManagerTest, FlushFullInfoToMMI, TestSize.Level1)
     std::vector<MMI::WindowInfo> windowInfoList;
     std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
     SceneInputManager::GetInstance().FlushFullInfoToMMI(
-        screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(), uiExtensionInfoList);
     ASSERT_EQ(displayInfos.size(), 0);
     MMI::DisplayInfo displayInfo;
     displayInfos.emplace_back(displayInfo);
     SceneInputManager::GetInstance().FlushFullInfoToMMI(
-        screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(), uiExtensionInfoList);
     ASSERT_EQ(displayInfos.size(), 1);
     auto oldDirty = SceneInputManager::GetInstance().sceneSessionDirty_;
     SceneInputManager::GetInstance().sceneSessionDirty_ = nullptr;
     SceneInputManager::GetInstance().FlushFullInfoToMMI(
-        screenInfos, displayGroupMap, windowInfoList, uiExtensionInfoList);
+        screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(), uiExtensionInfoList);
     ASSERT_EQ(windowInfoList.size(), 0);
     SceneInputManager::GetInstance().sceneSessionDirty_ = oldDirty;
 }
@@ -1169,6 +1171,230 @@ HWTEST_F(SceneInputManagerTest, HandleEmptyDisplayGroup007, TestSize.Level1)
     EXPECT_EQ(SceneInputManager::GetInstance().rootSessionState_.load(), RootSessionState::NOT_CREATED);
     EXPECT_TRUE(SceneInputManager::GetInstance().hasDelayedTaskScheduled_.load());
 }
+
+/**
+ * @tc.name: CheckNeedUpdateWithWindowMask
+ * @tc.desc: a mask set again with the same pixels does not need a flush, a changed one does
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, CheckNeedUpdateWithWindowMask, TestSize.Level1)
+{
+    auto createMask = [](uint32_t color) {
+        const uint32_t colors[1] = { color };
+        Media::InitializationOptions opts;
+        opts.size.width = 1;
+        opts.size.height = 1;
+        opts.pixelFormat = Media::PixelFormat::RGBA_8888;
+        opts.alphaType = Media::AlphaType::IMAGE_ALPHA_TYPE_OPAQUE;
+        return std::shared_ptr<Media::PixelMap>(Media::PixelMap::Create(colors, 1, 0, 1, opts));
+    };
+    auto mask = WindowMaskCache::GetInstance().Intern(createMask(0x6f0000ff));
+    ASSERT_NE(mask, nullptr);
+    std::vector<MMI::ScreenInfo> screenInfos;
+    std::vector<MMI::DisplayInfo> displayInfos;
+    displayInfos.emplace_back();
+    std::vector<MMI::WindowInfo> windowInfoList;
+    windowInfoList.emplace_back();
+    windowInfoList[0].pixelMap = mask.get();
+    int32_t focusId = 0;
+    Rosen::SceneSessionManager::GetInstance().SetFocusedSessionId(focusId, DEFAULT_DISPLAY_ID);
+    SceneInputManager::GetInstance().lastFocusId_ = focusId;
+    SceneInputManager::GetInstance().lastScreenInfos_ = screenInfos;
+    SceneInputManager::GetInstance().lastDisplayInfos_ = displayInfos;
+    SceneInputManager::GetInstance().lastWindowInfoList_ = windowInfoList;
+
+    auto sameMask = WindowMaskCache::GetInstance().Intern(createMask(0x6f0000ff));
+    windowInfoList[0].pixelMap = sameMask.get();
+    EXPECT_FALSE(SceneInputManager::GetInstance().CheckNeedUpdate(screenInfos, displayInfos, windowInfoList));
+
+    auto changedMask = WindowMaskCache::GetInstance().Intern(createMask(0x6f00ff00));
+    windowInfoList[0].pixelMap = changedMask.get();
+    EXPECT_TRUE(SceneInputManager::GetInstance().CheckNeedUpdate(screenInfos, displayInfos, windowInfoList));
+    SceneInputManager::GetInstance().lastWindowInfoList_.clear();
+}
+
+class RecordMMIClient : public SceneInputManager::MMIClient {
+public:
+    int32_t UpdateDisplayInfo(const MMI::UserScreenInfo& userScreenInfo) override
+    {
+        displayInfoCount_++;
+        return 0;
+    }
+
+    int32_t UpdateWindowInfo(const MMI::WindowGroupInfo& windowGroupInfo) override
+    {
+        windowInfoCount_ += windowGroupInfo.windowsInfo.size();
+        return 0;
+    }
+
+    uint32_t displayInfoCount_ = 0;
+    size_t windowInfoCount_ = 0;
+};
+
+/**
+ * @tc.name: SetMMIClient
+ * @tc.desc: window info is flushed to the injected MMI client, a null client is ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, SetMMIClient, TestSize.Level1)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    auto mmiClient = sceneInputManager.mmiClient_;
+    auto recordClient = std::make_shared<RecordMMIClient>();
+    sceneInputManager.SetMMIClient(recordClient);
+    sceneInputManager.SetMMIClient(nullptr);
+    EXPECT_EQ(sceneInputManager.mmiClient_, recordClient);
+
+    std::map<uint64_t, std::vector<MMI::WindowInfo>> screenId2Windows;
+    screenId2Windows[0].resize(2);
+    sceneInputManager.FlushChangeInfoToMMI(screenId2Windows);
+    EXPECT_EQ(recordClient->windowInfoCount_, 2);
+    sceneInputManager.FlushEmptyInfoToMMI();
+    if (sceneInputManager.eventHandler_ != nullptr) {
+        sceneInputManager.eventHandler_->PostSyncTask([] {}, "SetMMIClient");
+        EXPECT_EQ(recordClient->displayInfoCount_, 1);
+    }
+    sceneInputManager.SetMMIClient(mmiClient);
+}
+
+class CaptureMMIClient : public SceneInputManager::MMIClient {
+public:
+    int32_t UpdateDisplayInfo(const MMI::UserScreenInfo& userScreenInfo) override
+    {
+        for (const auto& displayGroup : userScreenInfo.displayGroups) {
+            for (const auto& windowInfo : displayGroup.windowsInfo) {
+                if (displayWindowCount_ == 0) {
+                    firstHotAreas_ = windowInfo.defaultHotAreas.data();
+                }
+                isLastAddEnd_ = windowInfo.action == MMI::WINDOW_UPDATE_ACTION::ADD_END;
+                displayWindowCount_++;
+            }
+        }
+        return 0;
+    }
+
+    int32_t UpdateWindowInfo(const MMI::WindowGroupInfo& windowGroupInfo) override
+    {
+        if (!windowGroupInfo.windowsInfo.empty()) {
+            lastBatchHotAreas_ = windowGroupInfo.windowsInfo.back().defaultHotAreas.data();
+        }
+        batchWindowCount_ += windowGroupInfo.windowsInfo.size();
+        return 0;
+    }
+
+    void Clear()
+    {
+        displayWindowCount_ = 0;
+        batchWindowCount_ = 0;
+        firstHotAreas_ = nullptr;
+        lastBatchHotAreas_ = nullptr;
+        isLastAddEnd_ = false;
+    }
+
+    size_t displayWindowCount_ = 0;
+    size_t batchWindowCount_ = 0;
+    const MMI::Rect* firstHotAreas_ = nullptr;
+    const MMI::Rect* lastBatchHotAreas_ = nullptr;
+    bool isLastAddEnd_ = false;
+};
+
+uint64_t CountFlushAllocs(size_t windowNum, bool isBatch, const std::shared_ptr<CaptureMMIClient>& captureClient)
+{
+    std::vector<MMI::ScreenInfo> screenInfos;
+    std::map<DisplayGroupId, MMI::DisplayGroupInfo> displayGroupMap;
+    displayGroupMap[0].id = 0;
+    std::vector<MMI::UIExtensionInfo> uiExtensionInfoList;
+    std::vector<MMI::WindowInfo> windowInfoList(windowNum);
+    std::vector<const MMI::Rect*> hotAreas;
+    for (size_t i = 0; i < windowNum; i++) {
+        windowInfoList[i].id = static_cast<int32_t>(i) + 1;
+        windowInfoList[i].groupId = 0;
+        windowInfoList[i].defaultHotAreas.resize(MMI::WindowInfo::DEFAULT_HOTAREA_COUNT);
+        hotAreas.push_back(windowInfoList[i].defaultHotAreas.data());
+    }
+
+    captureClient->Clear();
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    MockAllocCounter::StartThreadCounting();
+    if (isBatch) {
+        sceneInputManager.UpdateDisplayAndWindowInfo(screenInfos, displayGroupMap, windowInfoList,
+            uiExtensionInfoList);
+    } else {
+        sceneInputManager.FlushFullInfoToMMI(screenInfos, displayGroupMap, windowInfoList, windowInfoList.size(),
+            uiExtensionInfoList);
+    }
+    uint64_t allocCount = MockAllocCounter::StopThreadCounting();
+
+    EXPECT_EQ(windowInfoList.size(), windowNum);
+    for (size_t i = 0; i < windowInfoList.size(); i++) {
+        EXPECT_EQ(windowInfoList[i].id, static_cast<int32_t>(i) + 1);
+        EXPECT_EQ(windowInfoList[i].defaultHotAreas.data(), hotAreas[i]);
+    }
+    EXPECT_EQ(captureClient->firstHotAreas_, hotAreas.front());
+    if (isBatch) {
+        EXPECT_EQ(captureClient->lastBatchHotAreas_, hotAreas.back());
+    }
+    EXPECT_EQ(displayGroupMap[0].id, 0);
+    EXPECT_TRUE(displayGroupMap[0].windowsInfo.empty());
+    return allocCount;
+}
+
+bool IsEventDebugLoggable()
+{
+    return HiLogIsLoggable(HILOG_DOMAIN_WINDOW, g_domainContents[static_cast<uint32_t>(WmsLogTag::WMS_EVENT)],
+        LOG_DEBUG);
+}
+
+/**
+ * @tc.name: FlushFullInfoToMMIAllocCount
+ * @tc.desc: window info is moved to the MMI client and back, the allocations do not grow with the windows
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, FlushFullInfoToMMIAllocCount, TestSize.Level1)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    auto mmiClient = sceneInputManager.mmiClient_;
+    auto captureClient = std::make_shared<CaptureMMIClient>();
+    sceneInputManager.SetMMIClient(captureClient);
+
+    constexpr size_t smallWindowNum = 8;
+    constexpr size_t largeWindowNum = 64;
+    uint64_t smallAllocCount = CountFlushAllocs(smallWindowNum, false, captureClient);
+    EXPECT_EQ(captureClient->displayWindowCount_, smallWindowNum);
+    EXPECT_TRUE(captureClient->isLastAddEnd_);
+    uint64_t largeAllocCount = CountFlushAllocs(largeWindowNum, false, captureClient);
+    EXPECT_EQ(captureClient->displayWindowCount_, largeWindowNum);
+    if (!IsEventDebugLoggable()) {
+        EXPECT_EQ(largeAllocCount, smallAllocCount);
+    }
+    sceneInputManager.SetMMIClient(mmiClient);
+}
+
+/**
+ * @tc.name: UpdateDisplayAndWindowInfoAllocCount
+ * @tc.desc: windows over the batch size are sent in batches without copying them
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneInputManagerTest, UpdateDisplayAndWindowInfoAllocCount, TestSize.Level1)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    auto mmiClient = sceneInputManager.mmiClient_;
+    auto captureClient = std::make_shared<CaptureMMIClient>();
+    sceneInputManager.SetMMIClient(captureClient);
+
+    constexpr size_t smallWindowNum = 40;
+    constexpr size_t largeWindowNum = 80;
+    uint64_t smallAllocCount = CountFlushAllocs(smallWindowNum, true, captureClient);
+    EXPECT_EQ(captureClient->displayWindowCount_, MAX_WINDOWINFO_NUM);
+    EXPECT_EQ(captureClient->batchWindowCount_, smallWindowNum - MAX_WINDOWINFO_NUM);
+    uint64_t largeAllocCount = CountFlushAllocs(largeWindowNum, true, captureClient);
+    EXPECT_EQ(captureClient->displayWindowCount_, MAX_WINDOWINFO_NUM);
+    EXPECT_EQ(captureClient->batchWindowCount_, largeWindowNum - MAX_WINDOWINFO_NUM);
+    if (!IsEventDebugLoggable()) {
+        EXPECT_EQ(largeAllocCount, smallAllocCount);
+    }
+    sceneInputManager.SetMMIClient(mmiClient);
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
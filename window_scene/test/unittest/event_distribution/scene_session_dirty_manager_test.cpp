@@ -17,6 +17,7 @@
 #include "input_manager.h"
 #include "session_manager/include/scene_session_dirty_manager.h"
 #include <gtest/gtest.h>
+#include <chrono>
 #include <parameter.h>
 #include <parameters.h>
 #include "screen_session_manager_client/include/screen_session_manager_client.h"
@@ -1057,6 +1058,82 @@ HWTEST_F(SceneSessionDirtyManagerTest, CalTransform_CompatMode, TestSize.Level1)
     EXPECT_EQ(transform, testTransform.Translate(translate).Scale(scale, 0.5f, 0.5f).Inverse());
 }
 
+/**
+ * @tc.name: CalTransformCache
+ * @tc.desc: the transform and its inverse are reused until the transform hash changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest, CalTransformCache, TestSize.Level1)
+{
+    constexpr int32_t sessionCount = 100;
+    constexpr int32_t flushCount = 10;
+    ScreenId screenId = 0;
+    ScreenSessionConfig config;
+    sptr<ScreenSession> screenSession =
+        sptr<ScreenSession>::MakeSptr(config, ScreenSessionReason::CREATE_SESSION_FOR_CLIENT);
+    ScreenSessionManagerClient::GetInstance().screenSessionMap_.emplace(screenId, screenSession);
+    std::map<int32_t, sptr<SceneSession>> sessionMap;
+    for (int32_t i = 0; i < sessionCount; i++) {
+        SessionInfo sessionInfo;
+        sessionInfo.bundleName_ = "CalTransformCache";
+        sessionInfo.moduleName_ = "CalTransformCache";
+        sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+        sceneSession->GetSessionProperty()->SetDisplayId(screenId);
+        sceneSession->SetSessionGlobalRect({ i, i, 100, 100 });
+        sessionMap[sceneSession->GetPersistentId()] = sceneSession;
+    }
+    SingleHandData singleHandData;
+    auto flush = [&sessionMap, &singleHandData]() {
+        auto start = std::chrono::steady_clock::now();
+        Matrix3f transform;
+        for (int32_t i = 0; i < flushCount; i++) {
+            for (const auto& [persistentId, sceneSession] : sessionMap) {
+                manager_->CalTransform(sceneSession, transform, singleHandData);
+            }
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count() / flushCount;
+    };
+    auto firstFlushNs = flush();
+    auto cachedFlushNs = flush();
+    GTEST_LOG_(INFO) << "CalTransform of " << sessionCount << " sessions per flush, first: " << firstFlushNs
+        << "ns, cached: " << cachedFlushNs << "ns";
+    EXPECT_EQ(manager_->transformCache_.size(), sessionCount);
+
+    auto sceneSession = sessionMap.begin()->second;
+    Matrix3f transform;
+    Matrix3f expectedTransform;
+    auto screenProperty = screenSession->GetScreenProperty();
+    Matrix3f inverseTransform;
+    manager_->CalTransform(sceneSession, transform, singleHandData, false, &inverseTransform);
+    manager_->CalTransformInner(sceneSession, &screenProperty, expectedTransform, singleHandData, false);
+    EXPECT_EQ(transform, expectedTransform);
+    EXPECT_EQ(inverseTransform, expectedTransform.Inverse());
+    auto key = std::make_pair(sceneSession->GetPersistentId(), false);
+    EXPECT_EQ(manager_->transformCache_[key].hash_,
+        manager_->GetWindowTransformHash(sceneSession, screenProperty, singleHandData, false));
+
+    auto transformVersion = sceneSession->GetTransformVersion();
+    sceneSession->SetScale(0.5f, 0.5f, 0.5f, 0.5f);
+    EXPECT_NE(sceneSession->GetTransformVersion(), transformVersion);
+    manager_->CalTransformInner(sceneSession, &screenProperty, expectedTransform, singleHandData, false);
+    EXPECT_NE(transform, expectedTransform);
+    manager_->CalTransform(sceneSession, transform, singleHandData, false, &inverseTransform);
+    EXPECT_EQ(transform, expectedTransform);
+    EXPECT_EQ(inverseTransform, expectedTransform.Inverse());
+
+    singleHandData.mode = SingleHandMode::LEFT;
+    singleHandData.scaleX = 0.5f;
+    singleHandData.scaleY = 0.5f;
+    manager_->CalTransformInner(sceneSession, &screenProperty, expectedTransform, singleHandData, false);
+    manager_->CalTransform(sceneSession, transform, singleHandData);
+    EXPECT_EQ(transform, expectedTransform);
+
+    sessionMap.erase(sessionMap.begin());
+    manager_->PruneTransformCache(sessionMap);
+    EXPECT_EQ(manager_->transformCache_.size(), sessionCount - 1);
+}
+
 /**
  * @tc.name: CalTransformSessionPropertyNullptr
  * @tc.desc: CalTransform
@@ -1340,6 +1417,47 @@ HWTEST_F(SceneSessionDirtyManagerTest, UpdateHotAreas2, TestSize.Level1)
     ASSERT_EQ(touchHotAreas.size(), 1);
 }
 
+/**
+ * @tc.name: UpdateHotAreas3
+ * @tc.desc: the converted hot areas are reused until the hot areas change
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest, UpdateHotAreas3, TestSize.Level1)
+{
+    SessionInfo sessionInfo;
+    sessionInfo.bundleName_ = "UpdateHotAreas3";
+    sessionInfo.moduleName_ = "UpdateHotAreas3";
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+    std::vector<OHOS::Rosen::Rect> touchHotAreasInSceneSession = { { 0, 0, 10, 10 }, { 0, 0, 10, 10 } };
+    sceneSession->GetSessionProperty()->SetTouchHotAreas(touchHotAreasInSceneSession);
+    std::vector<MMI::Rect> touchHotAreas;
+    std::vector<MMI::Rect> pointerHotAreas;
+    manager_->UpdateHotAreas(sceneSession, touchHotAreas, pointerHotAreas);
+    ASSERT_EQ(touchHotAreas.size(), 1);
+    ASSERT_EQ(pointerHotAreas.size(), 1);
+    auto version = sceneSession->GetTouchHotAreaBuffer()->GetVersion();
+    auto cachedHotAreas = sceneSession->GetMMIHotAreasCache(version);
+    ASSERT_NE(cachedHotAreas, nullptr);
+    EXPECT_EQ(cachedHotAreas->size(), 1);
+
+    touchHotAreas.clear();
+    pointerHotAreas.clear();
+    manager_->UpdateHotAreas(sceneSession, touchHotAreas, pointerHotAreas);
+    EXPECT_EQ(touchHotAreas.size(), 1);
+    EXPECT_EQ(pointerHotAreas.size(), 1);
+    EXPECT_EQ(sceneSession->GetMMIHotAreasCache(version), cachedHotAreas);
+
+    touchHotAreasInSceneSession.push_back({ 10, 10, 10, 10 });
+    sceneSession->GetSessionProperty()->SetTouchHotAreas(touchHotAreasInSceneSession);
+    EXPECT_EQ(sceneSession->GetMMIHotAreasCache(sceneSession->GetTouchHotAreaBuffer()->GetVersion()), nullptr);
+    touchHotAreas.clear();
+    pointerHotAreas.clear();
+    manager_->UpdateHotAreas(sceneSession, touchHotAreas, pointerHotAreas);
+    ASSERT_EQ(touchHotAreas.size(), 2);
+    EXPECT_EQ(touchHotAreas[1].x, 10);
+    EXPECT_EQ(pointerHotAreas.size(), 2);
+}
+
 /**
  * @tc.name: UpdateDefaultHotAreas
  * @tc.desc: UpdateDefaultHotAreas
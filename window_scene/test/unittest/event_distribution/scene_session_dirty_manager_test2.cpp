@@ -931,6 +931,80 @@ HWTEST_F(SceneSessionDirtyManagerTest2, UpdateWindowFlagsForWindowSeparation, Te
     manager_->UpdateWindowFlagsForWindowSeparation(session, windowInfo);
     EXPECT_NE(windowInfo.flags, 0);
 }
+
+/**
+ * @tc.name: FillWindowInfo
+ * @tc.desc: a reused slot gets no stale field and keeps the buffers of its vectors
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest2, FillWindowInfo, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "FillWindowInfo";
+    info.bundleName_ = "FillWindowInfo";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    session->persistentId_ = 41;
+    MMI::WindowInfo windowInfo;
+    std::shared_ptr<Media::PixelMap> pixelMap;
+    ASSERT_TRUE(manager_->FillWindowInfo(session, SceneSessionDirtyManager::WindowAction::WINDOW_ADD,
+        windowInfo, pixelMap));
+    ASSERT_FALSE(windowInfo.transform.empty());
+    ASSERT_FALSE(windowInfo.pointerChangeAreas.empty());
+    const float* transformData = windowInfo.transform.data();
+    const int32_t* pointerChangeAreasData = windowInfo.pointerChangeAreas.data();
+    windowInfo.agentWindowId = 42;
+    windowInfo.privacyUIFlag = true;
+
+    ASSERT_TRUE(manager_->FillWindowInfo(session, SceneSessionDirtyManager::WindowAction::WINDOW_ADD,
+        windowInfo, pixelMap));
+    EXPECT_EQ(windowInfo.id, session->GetWindowId());
+    EXPECT_EQ(windowInfo.agentWindowId, session->GetWindowId());
+    EXPECT_FALSE(windowInfo.privacyUIFlag);
+    EXPECT_EQ(windowInfo.transform.data(), transformData);
+    EXPECT_EQ(windowInfo.pointerChangeAreas.data(), pointerChangeAreasData);
+
+    EXPECT_FALSE(manager_->FillWindowInfo(nullptr, SceneSessionDirtyManager::WindowAction::WINDOW_ADD,
+        windowInfo, pixelMap));
+    EXPECT_TRUE(windowInfo.transform.empty());
+    EXPECT_EQ(pixelMap, nullptr);
+}
+
+/**
+ * @tc.name: RecycleFullWindowInfoList
+ * @tc.desc: a flush after the lists were given back refills them without allocating
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionDirtyManagerTest2, RecycleFullWindowInfoList, TestSize.Level1)
+{
+    std::map<int32_t, sptr<SceneSession>> sceneSessionMap;
+    for (int32_t persistentId = 51; persistentId <= 53; persistentId++) {
+        SessionInfo info;
+        info.abilityName_ = "RecycleFullWindowInfoList";
+        info.bundleName_ = "RecycleFullWindowInfoList";
+        sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+        session->persistentId_ = persistentId;
+        sceneSessionMap.emplace(persistentId, session);
+    }
+    ssm_->sceneSessionMap_ = sceneSessionMap;
+    auto fullInfo = manager_->GetFullWindowInfoList();
+    ASSERT_EQ(fullInfo.windowInfoList.size(), sceneSessionMap.size());
+    const MMI::WindowInfo* slotData = fullInfo.windowInfoList.data();
+    const float* transformData = fullInfo.windowInfoList[0].transform.data();
+    const MMI::Rect* hotAreasData = fullInfo.windowInfoList[0].defaultHotAreas.data();
+    manager_->RecycleFullWindowInfoList(std::move(fullInfo));
+
+    auto fullInfo1 = manager_->GetFullWindowInfoList();
+    ASSERT_EQ(fullInfo1.windowInfoList.size(), sceneSessionMap.size());
+    EXPECT_EQ(fullInfo1.windowInfoList.data(), slotData);
+    EXPECT_EQ(fullInfo1.windowInfoList[0].transform.data(), transformData);
+    EXPECT_EQ(fullInfo1.windowInfoList[0].defaultHotAreas.data(), hotAreasData);
+    EXPECT_EQ(fullInfo1.windowInfoList[0].id, 51);
+
+    // the lists are handed out once, a flush without them starts empty
+    auto fullInfo2 = manager_->GetFullWindowInfoList();
+    EXPECT_NE(fullInfo2.windowInfoList.data(), slotData);
+    ssm_->sceneSessionMap_.clear();
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
@@ -500,6 +500,22 @@ HWTEST_F(HidumpControllerTest, DumpVisibleParam, TestSize.Level1)
     std::string result = oss.str();
     ASSERT_NE(result.size(), 0);
 }
+
+/**
+ * @tc.name: DumpLatencyHistogram
+ * @tc.desc: DumpLatencyHistogram Test
+ * @tc.type: FUNC
+ */
+HWTEST_F(HidumpControllerTest, DumpLatencyHistogram, TestSize.Level1)
+{
+    std::string dumpInfo;
+    HidumpController::GetInstance().DumpLatencyHistogram({}, dumpInfo);
+    EXPECT_NE(dumpInfo.find("LatencyHistogram"), std::string::npos);
+
+    dumpInfo.clear();
+    HidumpController::GetInstance().DumpLatencyHistogram({ "reset" }, dumpInfo);
+    EXPECT_NE(dumpInfo.find("reset"), std::string::npos);
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
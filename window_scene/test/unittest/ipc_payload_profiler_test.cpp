@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/include/ipc_payload_profiler.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+class IpcPayloadProfilerTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        IpcPayloadProfiler::GetInstance().Reset();
+    }
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: RecordAndGetSnapshot
+ * @tc.desc: record payloads of one code and get the sums and maximums
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcPayloadProfilerTest, RecordAndGetSnapshot, TestSize.Level1)
+{
+    auto& profiler = IpcPayloadProfiler::GetInstance();
+    profiler.Record(IpcSide::PROXY, "SnapshotInterface", 1, 100, 20, 10);
+    profiler.Record(IpcSide::PROXY, "SnapshotInterface", 1, 300, 40, 30);
+
+    IpcPayloadProfiler::Snapshot snapshot;
+    ASSERT_TRUE(profiler.GetSnapshot(IpcSide::PROXY, "SnapshotInterface", 1, snapshot));
+    EXPECT_EQ(snapshot.count_, 2);
+    EXPECT_EQ(snapshot.requestBytes_, 400);
+    EXPECT_EQ(snapshot.replyBytes_, 60);
+    EXPECT_EQ(snapshot.maxRequestBytes_, 300);
+    EXPECT_EQ(snapshot.maxReplyBytes_, 40);
+    EXPECT_EQ(snapshot.latency_.count_, 2);
+    EXPECT_EQ(snapshot.latency_.maxUs_, 30);
+
+    EXPECT_FALSE(profiler.GetSnapshot(IpcSide::STUB, "SnapshotInterface", 1, snapshot));
+    EXPECT_FALSE(profiler.GetSnapshot(IpcSide::PROXY, "SnapshotInterface", 2, snapshot));
+    profiler.Record(IpcSide::SIDE_END, "SnapshotInterface", 1, 100, 20, 10);
+    EXPECT_FALSE(profiler.GetSnapshot(IpcSide::SIDE_END, "SnapshotInterface", 1, snapshot));
+}
+
+/**
+ * @tc.name: DumpSortedByBytes
+ * @tc.desc: dump the codes with the most bytes first and filter them by interface name
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcPayloadProfilerTest, DumpSortedByBytes, TestSize.Level1)
+{
+    auto& profiler = IpcPayloadProfiler::GetInstance();
+    profiler.Record(IpcSide::PROXY, "DumpSmallInterface", 2, 10, 0, 1);
+    profiler.Record(IpcSide::PROXY, "DumpLargeInterface", 3, 1000, 8, 1);
+
+    std::ostringstream oss;
+    profiler.Dump(oss, "Dump");
+    std::string result = oss.str();
+    auto largePos = result.find("DumpLargeInterface");
+    auto smallPos = result.find("DumpSmallInterface");
+    ASSERT_NE(largePos, std::string::npos);
+    ASSERT_NE(smallPos, std::string::npos);
+    EXPECT_LT(largePos, smallPos);
+
+    std::ostringstream filterOss;
+    profiler.Dump(filterOss, "DumpSmall");
+    result = filterOss.str();
+    EXPECT_NE(result.find("DumpSmallInterface"), std::string::npos);
+    EXPECT_EQ(result.find("DumpLargeInterface"), std::string::npos);
+}
+
+/**
+ * @tc.name: DumpCsv
+ * @tc.desc: export the stats of both sides as csv
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcPayloadProfilerTest, DumpCsv, TestSize.Level1)
+{
+    auto& profiler = IpcPayloadProfiler::GetInstance();
+    profiler.Record(IpcSide::PROXY, "CsvInterface", 5, 64, 8, 4);
+    profiler.Record(IpcSide::STUB, "CsvInterface", 5, 64, 8, 2);
+
+    std::ostringstream oss;
+    profiler.DumpCsv(oss);
+    std::string result = oss.str();
+    EXPECT_EQ(result.find("side,interface,code,count,"), 0);
+    EXPECT_NE(result.find("Proxy,CsvInterface,5,1,64,64,8,8,4,"), std::string::npos);
+    EXPECT_NE(result.find("Stub,CsvInterface,5,1,64,64,8,8,2,"), std::string::npos);
+}
+
+/**
+ * @tc.name: DumpInfo
+ * @tc.desc: hidumper params reset, csv and interface filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcPayloadProfilerTest, DumpInfo, TestSize.Level1)
+{
+    auto& profiler = IpcPayloadProfiler::GetInstance();
+    profiler.Record(IpcSide::PROXY, "DumpInfoInterface", 6, 32, 4, 1);
+
+    std::string dumpInfo;
+    profiler.DumpInfo({}, dumpInfo);
+    EXPECT_NE(dumpInfo.find("IpcPayload"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("DumpInfoInterface"), std::string::npos);
+
+    dumpInfo.clear();
+    profiler.DumpInfo({ "csv" }, dumpInfo);
+    EXPECT_EQ(dumpInfo.find("side,interface,code,count,"), 0);
+
+    dumpInfo.clear();
+    profiler.DumpInfo({ "reset" }, dumpInfo);
+    EXPECT_NE(dumpInfo.find("reset"), std::string::npos);
+    IpcPayloadProfiler::Snapshot snapshot;
+    ASSERT_TRUE(profiler.GetSnapshot(IpcSide::PROXY, "DumpInfoInterface", 6, snapshot));
+    EXPECT_EQ(snapshot.count_, 0);
+    EXPECT_EQ(snapshot.latency_.count_, 0);
+}
+
+/**
+ * @tc.name: RecordOverflow
+ * @tc.desc: codes beyond the limit are counted under the overflow code
+ * @tc.type: FUNC
+ */
+HWTEST_F(IpcPayloadProfilerTest, RecordOverflow, TestSize.Level1)
+{
+    auto& profiler = IpcPayloadProfiler::GetInstance();
+    for (uint32_t code = 0; code < IpcPayloadProfiler::MAX_STATS_NUM_PER_SIDE; code++) {
+        profiler.Record(IpcSide::STUB, "OverflowInterface", code, 4, 4, 1);
+    }
+    IpcPayloadProfiler::Snapshot snapshot;
+    bool hasOverflow = profiler.GetSnapshot(IpcSide::STUB, "others", IpcPayloadProfiler::OVERFLOW_CODE, snapshot);
+    uint64_t overflowCount = hasOverflow ? snapshot.count_ : 0;
+    uint64_t overflowBytes = hasOverflow ? snapshot.requestBytes_ : 0;
+    uint32_t overflowCode = static_cast<uint32_t>(IpcPayloadProfiler::MAX_STATS_NUM_PER_SIDE) + 1;
+    profiler.Record(IpcSide::STUB, "OverflowInterface", overflowCode, 16, 4, 1);
+
+    EXPECT_FALSE(profiler.GetSnapshot(IpcSide::STUB, "OverflowInterface", overflowCode, snapshot));
+    ASSERT_TRUE(profiler.GetSnapshot(IpcSide::STUB, "others", IpcPayloadProfiler::OVERFLOW_CODE, snapshot));
+    EXPECT_EQ(snapshot.count_, overflowCount + 1);
+    EXPECT_EQ(snapshot.requestBytes_, overflowBytes + 16);
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "common/include/latency_histogram.h"
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+#include "common/include/ipc_payload_profiler.h"
+#endif
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class LatencyHistogramTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        LatencyHistogramManager::GetInstance().Reset();
+    }
+};
+
+namespace {
+/**
+ * @tc.name: GetBucketIndex
+ * @tc.desc: bucket index and lower bound are consistent
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, GetBucketIndex, TestSize.Level1)
+{
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(0), 0);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(1), 1);
+    EXPECT_EQ(LatencyHistogram::GetBucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_NUM - 1);
+    for (uint32_t index = 1; index < LatencyHistogram::BUCKET_NUM; index++) {
+        uint64_t lowerBound = LatencyHistogram::GetBucketLowerBound(index);
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(lowerBound), index);
+        EXPECT_EQ(LatencyHistogram::GetBucketIndex(lowerBound - 1), index - 1);
+    }
+}
+
+/**
+ * @tc.name: RecordAndPercentile
+ * @tc.desc: record values and get percentile
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, RecordAndPercentile, TestSize.Level1)
+{
+    LatencyHistogram histogram;
+    for (int64_t value = 1; value <= 100; value++) { // 100: record 1us to 100us
+        histogram.Record(value);
+    }
+    histogram.Record(-1);
+    auto snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count_, 101);
+    EXPECT_EQ(snapshot.maxUs_, 100);
+    EXPECT_EQ(snapshot.sumUs_, 5050);
+    uint64_t p50 = snapshot.GetPercentile(50.0);
+    EXPECT_GE(p50, 50);
+    EXPECT_LE(p50, 63);
+    EXPECT_EQ(snapshot.GetPercentile(100.0), 100);
+
+    histogram.Reset();
+    snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count_, 0);
+    EXPECT_EQ(snapshot.GetPercentile(99.0), 0);
+}
+
+/**
+ * @tc.name: RecordMultiThread
+ * @tc.desc: records from different threads are merged
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, RecordMultiThread, TestSize.Level1)
+{
+    LatencyHistogram histogram;
+    constexpr uint32_t threadNum = 8;
+    constexpr uint32_t recordNum = 1000;
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadNum; i++) {
+        threads.emplace_back([&histogram] {
+            for (uint32_t j = 0; j < recordNum; j++) {
+                histogram.Record(j);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(histogram.GetSnapshot().count_, threadNum * recordNum);
+}
+
+/**
+ * @tc.name: DumpAndReset
+ * @tc.desc: manager dumps named histograms and resets them
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, DumpAndReset, TestSize.Level1)
+{
+    auto& manager = LatencyHistogramManager::GetInstance();
+    manager.Record(LatencyCategory::TASK_WAIT, "LatencyTestTask", 10);
+    manager.Record(LatencyCategory::CATEGORY_END, "LatencyTestInvalid", 10);
+    manager.RecordIpc("LatencyTestIpc", 5, 20);
+    std::ostringstream oss;
+    manager.Dump(oss, "LatencyTest");
+    std::string dumpInfo = oss.str();
+    EXPECT_NE(dumpInfo.find("LatencyTestTask"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("LatencyTestIpc:5"), std::string::npos);
+    EXPECT_EQ(dumpInfo.find("LatencyTestInvalid"), std::string::npos);
+
+    manager.Reset();
+    std::ostringstream ossAfterReset;
+    manager.Dump(ossAfterReset, "LatencyTest");
+    EXPECT_EQ(ossAfterReset.str().find("LatencyTestTask"), std::string::npos);
+}
+
+/**
+ * @tc.name: IpcLatencyScope
+ * @tc.desc: the scope records the latency and the parcel sizes of a transaction once
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, IpcLatencyScope, TestSize.Level1)
+{
+    auto& manager = LatencyHistogramManager::GetInstance();
+    MessageParcel data;
+    MessageParcel reply;
+    data.WriteInt32(1);
+    IpcLatencyTable table("LatencyScopeIpc");
+    {
+        IpcLatencyScope latencyScope(table, 7, data, reply);
+        reply.WriteInt32(1);
+        reply.WriteInt32(2);
+    }
+    std::ostringstream oss;
+    manager.Dump(oss, "LatencyScopeIpc");
+    EXPECT_NE(oss.str().find("LatencyScopeIpc:7"), std::string::npos);
+#ifdef WINDOW_MANAGER_FEATURE_IPC_PAYLOAD_PROFILER
+    IpcPayloadProfiler::Snapshot snapshot;
+    ASSERT_TRUE(IpcPayloadProfiler::GetInstance().GetSnapshot(IpcSide::STUB, "LatencyScopeIpc", 7, snapshot));
+    EXPECT_EQ(snapshot.count_, 1);
+    EXPECT_EQ(snapshot.requestBytes_, data.GetDataSize());
+    EXPECT_EQ(snapshot.replyBytes_, reply.GetDataSize());
+#endif
+    manager.Reset();
+}
+
+/**
+ * @tc.name: IpcLatencyTable
+ * @tc.desc: the table records into the histogram of the code, large codes fall back to the manager
+ * @tc.type: FUNC
+ */
+HWTEST_F(LatencyHistogramTest, IpcLatencyTable, TestSize.Level1)
+{
+    auto& manager = LatencyHistogramManager::GetInstance();
+    IpcLatencyTable table("LatencyTableIpc");
+    table.Record(3, 10, 0, 0);
+    table.Record(3, 30, 0, 0);
+    table.Record(IpcLatencyTable::MAX_CODE_NUM, 20, 0, 0);
+    EXPECT_EQ(manager.GetIpcHistogram("LatencyTableIpc", 3)->GetSnapshot().count_, 2);
+    EXPECT_EQ(manager.GetIpcHistogram("LatencyTableIpc", IpcLatencyTable::MAX_CODE_NUM)->GetSnapshot().count_, 1);
+
+    IpcLatencyTable otherTable("LatencyTableIpc");
+    otherTable.Record(3, 20, 0, 0);
+    EXPECT_EQ(manager.GetIpcHistogram("LatencyTableIpc", 3)->GetSnapshot().count_, 3);
+    manager.Reset();
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
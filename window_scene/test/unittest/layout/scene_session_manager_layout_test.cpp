@@ -266,7 +266,8 @@ HWTEST_F(SceneSessionManagerLayoutTest, NotifySingleHandInfoChange_TestNullSessi
     singleHandScreenInfo.mode = SingleHandMode::LEFT;
     ssm_->NotifySingleHandInfoChange(singleHandScreenInfo, originRect, singleHandRect);
     usleep(WAIT_SYNC_IN_NS);
-    EXPECT_EQ(ssm_->sceneSessionMap_[0], nullptr);
+    auto iter = ssm_->sceneSessionMap_.find(0);
+    EXPECT_TRUE(iter == ssm_->sceneSessionMap_.end() || iter->second == nullptr);
 }
 
 /**
@@ -946,7 +947,7 @@ HWTEST_F(SceneSessionManagerLayoutTest, UpdateAppHookDisplayInfo003, TestSize.Le
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
     ASSERT_NE(nullptr, sceneSession);
     sceneSession->persistentId_ = persistentId;
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
 
     auto result = ssm_->UpdateAppHookDisplayInfo(uid, hookInfo, enable, persistentId);
     ASSERT_EQ(result, WMError::WM_OK);
@@ -996,7 +997,7 @@ HWTEST_F(SceneSessionManagerLayoutTest, UpdateAppHookDisplayInfo005, TestSize.Le
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
     ASSERT_NE(nullptr, sceneSession);
     sceneSession->persistentId_ = persistentId;
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
 
     auto result = ssm_->UpdateAppHookDisplayInfo(uid, hookInfo, enable, persistentId);
     ASSERT_EQ(result, WMError::WM_ERROR_INVALID_PARAM);
@@ -1024,7 +1025,7 @@ HWTEST_F(SceneSessionManagerLayoutTest, UpdateAppHookDisplayInfo006, TestSize.Le
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
     ASSERT_NE(nullptr, sceneSession);
     sceneSession->persistentId_ = persistentId;
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
 
     auto result = ssm_->UpdateAppHookDisplayInfo(uid, hookInfo, enable, persistentId);
     ASSERT_EQ(result, WMError::WM_OK);
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dlfcn.h>
+#include <future>
+#include <gtest/gtest.h>
+
+#include "common/include/plugin_loader.h"
+#include "common/include/task_scheduler.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+class PluginLoaderTest : public testing::Test {
+public:
+    PluginLoaderTest() {}
+    ~PluginLoaderTest() {}
+};
+
+namespace {
+/**
+ * @tc.name: OpenLibrary
+ * @tc.desc: OpenLibrary and LoadSymbol
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginLoaderTest, OpenLibrary, TestSize.Level1)
+{
+    EXPECT_EQ(PluginLoader::OpenLibrary("/system/lib/not_exist_plugin.z.so", RTLD_LAZY, 1), nullptr);
+    EXPECT_EQ(PluginLoader::LoadSymbol(nullptr, "dlopen", 1), nullptr);
+
+    void* handle = PluginLoader::OpenLibrary("libc.so", RTLD_LAZY, 1);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_NE(PluginLoader::LoadSymbol(handle, "strlen", 1), nullptr);
+    EXPECT_EQ(PluginLoader::LoadSymbol(handle, "not_exist_symbol", 1), nullptr);
+    dlclose(handle);
+}
+
+/**
+ * @tc.name: LoadAsync
+ * @tc.desc: LoadAsync and WaitLoaded
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginLoaderTest, LoadAsync, TestSize.Level1)
+{
+    auto& pluginLoader = PluginLoader::GetInstance();
+    EXPECT_TRUE(pluginLoader.WaitLoaded("notPostedPlugin"));
+
+    auto taskScheduler = std::make_shared<TaskScheduler>("pluginLoaderTest");
+    pluginLoader.LoadAsync("successPlugin", [] { return true; }, taskScheduler);
+    pluginLoader.LoadAsync("failedPlugin", [] { return false; }, taskScheduler);
+    EXPECT_TRUE(pluginLoader.WaitLoaded("successPlugin"));
+    EXPECT_FALSE(pluginLoader.WaitLoaded("failedPlugin"));
+
+    std::string dumpInfo;
+    pluginLoader.DumpStartupTimeline(dumpInfo);
+    EXPECT_NE(dumpInfo.find("load:successPlugin"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("load:failedPlugin"), std::string::npos);
+}
+
+/**
+ * @tc.name: WaitLoadedRunsPendingLoad
+ * @tc.desc: WaitLoaded runs a load which is still queued or has no task scheduler
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginLoaderTest, WaitLoadedRunsPendingLoad, TestSize.Level1)
+{
+    auto& pluginLoader = PluginLoader::GetInstance();
+    auto taskScheduler = std::make_shared<TaskScheduler>("pluginLoaderBlockedTest");
+    std::promise<void> blockPromise;
+    std::shared_future<void> blockFuture = blockPromise.get_future().share();
+    taskScheduler->PostAsyncTask([blockFuture] { blockFuture.wait(); }, "BlockPluginLoaderTest");
+
+    uint32_t loadCount = 0;
+    pluginLoader.LoadAsync("queuedPlugin", [&loadCount] {
+        loadCount++;
+        return true;
+    }, taskScheduler);
+    EXPECT_TRUE(pluginLoader.WaitLoaded("queuedPlugin", 1));
+    EXPECT_EQ(loadCount, 1);
+    blockPromise.set_value();
+    taskScheduler->PostSyncTask([] { return 0; }, "WaitPluginLoaderTest");
+    EXPECT_EQ(loadCount, 1);
+
+    pluginLoader.LoadAsync("noSchedulerPlugin", [] { return true; }, nullptr);
+    EXPECT_TRUE(pluginLoader.WaitLoaded("noSchedulerPlugin"));
+}
+
+/**
+ * @tc.name: StartupPhaseScope
+ * @tc.desc: StartupPhaseScope records a phase
+ * @tc.type: FUNC
+ */
+HWTEST_F(PluginLoaderTest, StartupPhaseScope, TestSize.Level1)
+{
+    {
+        StartupPhaseScope phaseScope("test:phase");
+    }
+    std::string dumpInfo;
+    PluginLoader::GetInstance().DumpStartupTimeline(dumpInfo);
+    EXPECT_NE(dumpInfo.find("test:phase"), std::string::npos);
+}
+}
+} // namespace Rosen
+} // namespace OHOS
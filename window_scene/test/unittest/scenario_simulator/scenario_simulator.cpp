@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "scenario_simulator.h"
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+#include "iremote_object_mocker.h"
+#include "mock/mock_alloc_counter.h"
+#include "session_manager/include/scene_session_manager.h"
+#include "session/container/include/zidl/session_stage_proxy.h"
+#include "session/container/include/zidl/window_event_channel_proxy.h"
+#include "window_manager_hilog.h"
+
+namespace OHOS {
+namespace Rosen {
+std::atomic<uint64_t> SimulatorMessageCounter::appMessageCount_ { 0 };
+std::atomic<uint64_t> SimulatorMessageCounter::appMessageBytes_ { 0 };
+std::atomic<uint64_t> SimulatorMessageCounter::mmiMessageCount_ { 0 };
+std::atomic<uint64_t> SimulatorMessageCounter::mmiWindowCount_ { 0 };
+std::atomic<uint64_t> SimulatorMessageCounter::rsMessageCount_ { 0 };
+
+namespace {
+constexpr uint32_t MAX_COMMAND_COUNT = 1000;
+constexpr uint32_t IDLE_ROUND = 2;
+constexpr auto IDLE_TIMEOUT = std::chrono::seconds(3);
+constexpr int32_t DISPLAY_WIDTH = 1260;
+constexpr int32_t DISPLAY_HEIGHT = 2720;
+constexpr int32_t FLOATING_WIDTH = 800;
+constexpr int32_t FLOATING_HEIGHT = 1200;
+constexpr int32_t CASCADE_OFFSET = 40;
+constexpr uint32_t BASE_Z_ORDER = 100;
+constexpr int32_t STAGE_NAME_WIDTH = 20;
+constexpr int32_t STAGE_VALUE_WIDTH = 12;
+constexpr int64_t NS_PER_US = 1000;
+constexpr int64_t US_PER_S = 1000000;
+const std::set<std::string> COMMAND_NAMES = {
+    "launch", "cascade", "flush", "flush_mmi", "visibility", "focus", "background",
+};
+const std::string DEFAULT_SCENARIO =
+    "# launch 50 apps and cascade 20 floating windows\n"
+    "launch 50\n"
+    "flush 3\n"
+    "visibility\n"
+    "cascade 20\n"
+    "flush 3\n"
+    "flush_mmi\n"
+    "visibility\n"
+    "focus 20\n"
+    "background 10\n"
+    "flush 3\n"
+    "visibility\n";
+
+/**
+ * @brief Stand-in of the app process, every request sent to it is counted as one message.
+ */
+class SimulatorAppRemoteObject : public IRemoteObjectMocker {
+public:
+    int SendRequest(uint32_t code, MessageParcel& data, MessageParcel& reply, MessageOption& option) override
+    {
+        SimulatorMessageCounter::appMessageCount_.fetch_add(1, std::memory_order_relaxed);
+        SimulatorMessageCounter::appMessageBytes_.fetch_add(data.GetDataSize(), std::memory_order_relaxed);
+        return 0;
+    }
+};
+
+/**
+ * @brief Stand-in of MMI, every update flushed to it is counted as one message.
+ */
+class SimulatorMMIClient : public SceneInputManager::MMIClient {
+public:
+    int32_t UpdateDisplayInfo(const MMI::UserScreenInfo& userScreenInfo) override
+    {
+        uint64_t windowCount = 0;
+        for (const auto& displayGroup : userScreenInfo.displayGroups) {
+            windowCount += displayGroup.windowsInfo.size();
+        }
+        SimulatorMessageCounter::mmiMessageCount_.fetch_add(1, std::memory_order_relaxed);
+        SimulatorMessageCounter::mmiWindowCount_.fetch_add(windowCount, std::memory_order_relaxed);
+        return 0;
+    }
+
+    int32_t UpdateWindowInfo(const MMI::WindowGroupInfo& windowGroupInfo) override
+    {
+        SimulatorMessageCounter::mmiMessageCount_.fetch_add(1, std::memory_order_relaxed);
+        SimulatorMessageCounter::mmiWindowCount_.fetch_add(windowGroupInfo.windowsInfo.size(),
+            std::memory_order_relaxed);
+        return 0;
+    }
+};
+
+int64_t GetProcessCpuTimeUs()
+{
+    struct timespec ts = {};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * US_PER_S + ts.tv_nsec / NS_PER_US;
+}
+
+int64_t GetWallTimeUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool IsRectContained(const WSRect& outer, const WSRect& inner)
+{
+    return inner.posX_ >= outer.posX_ && inner.posY_ >= outer.posY_ &&
+        inner.posX_ + inner.width_ <= outer.posX_ + outer.width_ &&
+        inner.posY_ + inner.height_ <= outer.posY_ + outer.height_;
+}
+
+bool IsRectIntersected(const WSRect& lhs, const WSRect& rhs)
+{
+    return lhs.posX_ < rhs.posX_ + rhs.width_ && rhs.posX_ < lhs.posX_ + lhs.width_ &&
+        lhs.posY_ < rhs.posY_ + rhs.height_ && rhs.posY_ < lhs.posY_ + lhs.height_;
+}
+} // namespace
+
+void SimulatorReport::Dump(std::string& dumpInfo) const
+{
+    std::ostringstream oss;
+    oss << "----------------------------------ScenarioSimulator"
+        << "----------------------------------" << std::endl;
+    oss << std::left << std::setw(STAGE_NAME_WIDTH) << "Stage"
+        << std::setw(STAGE_VALUE_WIDTH) << "Count"
+        << std::setw(STAGE_VALUE_WIDTH) << "Cpu(us)"
+        << std::setw(STAGE_VALUE_WIDTH) << "Wall(us)"
+        << std::setw(STAGE_VALUE_WIDTH) << "Allocs"
+        << std::setw(STAGE_VALUE_WIDTH) << "AllocBytes"
+        << std::setw(STAGE_VALUE_WIDTH) << "AppMsgs"
+        << std::setw(STAGE_VALUE_WIDTH) << "AppBytes"
+        << std::setw(STAGE_VALUE_WIDTH) << "MmiMsgs"
+        << std::setw(STAGE_VALUE_WIDTH) << "MmiWindows"
+        << std::setw(STAGE_VALUE_WIDTH) << "RsMsgs" << std::endl;
+    for (const auto& stageName : stageOrder_) {
+        const auto& stats = stages_.at(stageName);
+        oss << std::left << std::setw(STAGE_NAME_WIDTH) << stageName
+            << std::setw(STAGE_VALUE_WIDTH) << stats.count_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.cpuTimeUs_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.wallTimeUs_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.allocCount_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.allocBytes_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.appMessageCount_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.appMessageBytes_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.mmiMessageCount_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.mmiWindowCount_
+            << std::setw(STAGE_VALUE_WIDTH) << stats.rsMessageCount_ << std::endl;
+    }
+    oss << "sessions: " << sessionCount_ << ", focused: " << focusedSessionId_ << std::endl;
+    dumpInfo.append(oss.str());
+}
+
+ScenarioSimulator::ScenarioSimulator() = default;
+
+ScenarioSimulator::~ScenarioSimulator()
+{
+    Reset();
+}
+
+const std::string& ScenarioSimulator::GetDefaultScenario()
+{
+    return DEFAULT_SCENARIO;
+}
+
+bool ScenarioSimulator::Load(const std::string& scenarioPath)
+{
+    std::ifstream file(scenarioPath);
+    if (!file.is_open()) {
+        TLOGE(WmsLogTag::DEFAULT, "open scenario failed: %{public}s", scenarioPath.c_str());
+        return false;
+    }
+    return Parse(file);
+}
+
+bool ScenarioSimulator::Parse(std::istream& stream)
+{
+    commands_.clear();
+    std::string line;
+    uint32_t lineNum = 0;
+    while (std::getline(stream, line)) {
+        lineNum++;
+        std::istringstream lineStream(line);
+        Command command;
+        if (!(lineStream >> command.name_) || command.name_[0] == '#') {
+            continue; // empty line or comment
+        }
+        int64_t count = 1;
+        std::string countStr;
+        if (lineStream >> countStr) {
+            std::istringstream countStream(countStr);
+            if (!(countStream >> count) || !countStream.eof()) {
+                count = 0;
+            }
+        }
+        if (COMMAND_NAMES.count(command.name_) == 0 || count <= 0 || count > MAX_COMMAND_COUNT) {
+            TLOGE(WmsLogTag::DEFAULT, "invalid scenario line: %{public}u", lineNum);
+            return false;
+        }
+        command.count_ = static_cast<uint32_t>(count);
+        commands_.push_back(command);
+    }
+    return true;
+}
+
+SimulatorReport ScenarioSimulator::Run()
+{
+    report_ = SimulatorReport();
+    isScbCoreEnabled_ = Session::IsScbCoreEnabled();
+    Session::SetScbCoreEnabled(true);
+    SetMMIClient(true);
+    for (const auto& command : commands_) {
+        if (command.name_ == "launch") {
+            Launch(command.count_, WindowMode::WINDOW_MODE_FULLSCREEN);
+        } else if (command.name_ == "cascade") {
+            Launch(command.count_, WindowMode::WINDOW_MODE_FLOATING);
+        } else if (command.name_ == "flush") {
+            FlushUIParams(command.count_);
+        } else if (command.name_ == "flush_mmi") {
+            FlushWindowInfoToMMI();
+        } else if (command.name_ == "visibility") {
+            UpdateVisibility();
+        } else if (command.name_ == "focus") {
+            Focus(command.count_);
+        } else if (command.name_ == "background") {
+            Background(command.count_);
+        }
+    }
+    report_.sessionCount_ = static_cast<uint32_t>(sessions_.size());
+    report_.focusedSessionId_ = SceneSessionManager::GetInstance().GetFocusedSessionId();
+    Reset();
+    SetMMIClient(false);
+    Session::SetScbCoreEnabled(isScbCoreEnabled_);
+    return report_;
+}
+
+void ScenarioSimulator::Launch(uint32_t count, WindowMode mode)
+{
+    uint32_t floatingIndex = 0;
+    for (const auto& session : sessions_) {
+        if (session->GetWindowMode() == WindowMode::WINDOW_MODE_FLOATING) {
+            floatingIndex++;
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        std::string name = "ScenarioSimulator" + std::to_string(sessions_.size());
+        SessionInfo info;
+        info.bundleName_ = name;
+        info.moduleName_ = name;
+        info.abilityName_ = name;
+        info.windowType_ = static_cast<uint32_t>(WindowType::APP_MAIN_WINDOW_BASE);
+        auto property = sptr<WindowSessionProperty>::MakeSptr();
+        property->SetWindowType(WindowType::APP_MAIN_WINDOW_BASE);
+        property->SetWindowName(name);
+        property->SetWindowMode(mode);
+
+        // the simulator stands in for AMS and the app: create, attach the app side, then foreground
+        sptr<SceneSession> session;
+        MeasureStage("create", [&session, &info, &property] {
+            session = SceneSessionManager::GetInstance().RequestSceneSession(info, nullptr);
+            if (session == nullptr) {
+                return;
+            }
+            SystemSessionConfig systemConfig;
+            sptr<IRemoteObject> renderSession;
+            std::shared_ptr<RSSurfaceNode> surfaceNode;
+            session->ConnectInner(sptr<SessionStageProxy>::MakeSptr(sptr<SimulatorAppRemoteObject>::MakeSptr()),
+                sptr<WindowEventChannelProxy>::MakeSptr(sptr<SimulatorAppRemoteObject>::MakeSptr()), 0,
+                systemConfig, renderSession, surfaceNode, property);
+        });
+        if (session == nullptr) {
+            TLOGE(WmsLogTag::DEFAULT, "create session failed: %{public}s", name.c_str());
+            continue;
+        }
+        session->GetSessionProperty()->SetWindowMode(mode);
+        if (mode == WindowMode::WINDOW_MODE_FLOATING) {
+            int32_t offset = static_cast<int32_t>(floatingIndex++) * CASCADE_OFFSET;
+            session->SetSessionRect({ CASCADE_OFFSET + offset, CASCADE_OFFSET + offset,
+                FLOATING_WIDTH, FLOATING_HEIGHT });
+        } else {
+            session->SetSessionRect({ 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT });
+        }
+        sessions_.push_back(session);
+        MeasureStage("foreground", [this, &session, &property] {
+            session->Foreground(property);
+            WaitIdle();
+        });
+    }
+}
+
+void ScenarioSimulator::FlushUIParams(uint32_t frames)
+{
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        std::unordered_map<int32_t, SessionUIParam> uiParams;
+        uint32_t zOrder = BASE_Z_ORDER;
+        for (const auto& session : GetForegroundSessions()) {
+            SessionUIParam uiParam;
+            uiParam.rect_ = session->GetSessionRect();
+            uiParam.zOrder_ = zOrder++;
+            uiParam.sessionName_ = session->GetWindowName();
+            uiParams.emplace(session->GetPersistentId(), uiParam);
+        }
+        MeasureStage("flush_ui_params", [this, &uiParams] {
+            SceneSessionManager::GetInstance().FlushUIParams(DEFAULT_SCREEN_ID, std::move(uiParams));
+            WaitIdle();
+        });
+    }
+}
+
+void ScenarioSimulator::FlushWindowInfoToMMI()
+{
+    MeasureStage("flush_mmi", [this] {
+        SceneSessionManager::GetInstance().FlushWindowInfoToMMI(true);
+        WaitIdle();
+    });
+}
+
+void ScenarioSimulator::UpdateVisibility()
+{
+    // stand-in of the RS occlusion callback, windows are opaque and the later one is on top
+    auto sessions = GetForegroundSessions();
+    std::vector<std::pair<uint64_t, WindowVisibilityState>> visibilityChangeInfos;
+    for (size_t i = 0; i < sessions.size(); i++) {
+        auto surfaceNode = sessions[i]->GetSurfaceNode();
+        if (surfaceNode == nullptr) {
+            continue;
+        }
+        WSRect rect = sessions[i]->GetSessionRect();
+        WindowVisibilityState state = WINDOW_VISIBILITY_STATE_NO_OCCLUSION;
+        for (size_t j = i + 1; j < sessions.size(); j++) {
+            WSRect upperRect = sessions[j]->GetSessionRect();
+            if (IsRectContained(upperRect, rect)) {
+                state = WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION;
+                break;
+            }
+            if (IsRectIntersected(upperRect, rect)) {
+                state = WINDOW_VISIBILITY_STATE_PARTICALLY_OCCLUSION;
+            }
+        }
+        visibilityChangeInfos.emplace_back(surfaceNode->GetId(), state);
+    }
+    MeasureStage("visibility", [this, &visibilityChangeInfos] {
+        SimulatorMessageCounter::rsMessageCount_.fetch_add(1, std::memory_order_relaxed);
+        auto& ssm = SceneSessionManager::GetInstance();
+        ssm.GetTaskScheduler()->PostSyncTask([&ssm, &visibilityChangeInfos] {
+            ssm.DealwithVisibilityChange(visibilityChangeInfos, visibilityChangeInfos);
+            return 0;
+        }, "ScenarioSimulatorVisibility");
+        WaitIdle();
+    });
+}
+
+void ScenarioSimulator::Focus(uint32_t count)
+{
+    auto sessions = GetForegroundSessions();
+    for (auto iter = sessions.rbegin(); iter != sessions.rend() && count > 0; ++iter, count--) {
+        int32_t persistentId = (*iter)->GetPersistentId();
+        MeasureStage("focus", [this, persistentId] {
+            SceneSessionManager::GetInstance().RequestFocusStatusBySCB(persistentId, true);
+            WaitIdle();
+        });
+    }
+}
+
+void ScenarioSimulator::Background(uint32_t count)
+{
+    auto sessions = GetForegroundSessions();
+    for (auto iter = sessions.rbegin(); iter != sessions.rend() && count > 0; ++iter, count--) {
+        MeasureStage("background", [this, session = *iter] {
+            session->Background();
+            WaitIdle();
+        });
+    }
+}
+
+void ScenarioSimulator::MeasureStage(const std::string& stageName, const std::function<void()>& func)
+{
+    uint64_t allocCount = MockAllocCounter::GetAllocCount();
+    uint64_t allocBytes = MockAllocCounter::GetAllocBytes();
+    uint64_t appMessageCount = SimulatorMessageCounter::appMessageCount_.load(std::memory_order_relaxed);
+    uint64_t appMessageBytes = SimulatorMessageCounter::appMessageBytes_.load(std::memory_order_relaxed);
+    uint64_t mmiMessageCount = SimulatorMessageCounter::mmiMessageCount_.load(std::memory_order_relaxed);
+    uint64_t mmiWindowCount = SimulatorMessageCounter::mmiWindowCount_.load(std::memory_order_relaxed);
+    uint64_t rsMessageCount = SimulatorMessageCounter::rsMessageCount_.load(std::memory_order_relaxed);
+    int64_t cpuTimeUs = GetProcessCpuTimeUs();
+    int64_t wallTimeUs = GetWallTimeUs();
+    func();
+    if (report_.stages_.count(stageName) == 0) {
+        report_.stageOrder_.push_back(stageName);
+    }
+    auto& stats = report_.stages_[stageName];
+    stats.count_++;
+    stats.wallTimeUs_ += GetWallTimeUs() - wallTimeUs;
+    stats.cpuTimeUs_ += GetProcessCpuTimeUs() - cpuTimeUs;
+    stats.allocCount_ += MockAllocCounter::GetAllocCount() - allocCount;
+    stats.allocBytes_ += MockAllocCounter::GetAllocBytes() - allocBytes;
+    stats.appMessageCount_ +=
+        SimulatorMessageCounter::appMessageCount_.load(std::memory_order_relaxed) - appMessageCount;
+    stats.appMessageBytes_ +=
+        SimulatorMessageCounter::appMessageBytes_.load(std::memory_order_relaxed) - appMessageBytes;
+    stats.mmiMessageCount_ +=
+        SimulatorMessageCounter::mmiMessageCount_.load(std::memory_order_relaxed) - mmiMessageCount;
+    stats.mmiWindowCount_ += SimulatorMessageCounter::mmiWindowCount_.load(std::memory_order_relaxed) - mmiWindowCount;
+    stats.rsMessageCount_ += SimulatorMessageCounter::rsMessageCount_.load(std::memory_order_relaxed) - rsMessageCount;
+}
+
+void ScenarioSimulator::WaitIdle()
+{
+    // tasks of a round may post new tasks, the second round waits for them
+    for (uint32_t round = 0; round < IDLE_ROUND; round++) {
+        auto promise = std::make_shared<std::promise<void>>();
+        auto future = promise->get_future();
+        SceneSessionManager::GetInstance().GetTaskScheduler()->PostAsyncTask([promise] { promise->set_value(); },
+            TaskName::Intern("ScenarioSimulatorIdle"), TaskLane::BACKGROUND);
+        if (future.wait_for(IDLE_TIMEOUT) != std::future_status::ready) {
+            TLOGW(WmsLogTag::DEFAULT, "wait scene session manager idle timeout");
+        }
+        auto inputHandler = SceneInputManager::GetInstance().eventHandler_;
+        if (inputHandler != nullptr) {
+            inputHandler->PostSyncTask([] {}, "ScenarioSimulatorIdle");
+        }
+    }
+}
+
+void ScenarioSimulator::Reset()
+{
+    if (sessions_.empty()) {
+        return;
+    }
+    auto& ssm = SceneSessionManager::GetInstance();
+    ssm.GetTaskScheduler()->PostSyncTask([this, &ssm] {
+        std::unique_lock<std::shared_mutex> lock(ssm.sceneSessionMapMutex_);
+        for (const auto& session : sessions_) {
+            ssm.sceneSessionMap_.erase(session->GetPersistentId());
+        }
+        return 0;
+    }, "ScenarioSimulatorReset");
+    sessions_.clear();
+}
+
+void ScenarioSimulator::SetMMIClient(bool isSimulated)
+{
+    auto& sceneInputManager = SceneInputManager::GetInstance();
+    auto task = [this, &sceneInputManager, isSimulated] {
+        if (isSimulated) {
+            mmiClient_ = sceneInputManager.mmiClient_;
+            sceneInputManager.SetMMIClient(std::make_shared<SimulatorMMIClient>());
+        } else if (mmiClient_ != nullptr) {
+            sceneInputManager.SetMMIClient(mmiClient_);
+            mmiClient_ = nullptr;
+        }
+    };
+    // the client is used on the input thread only
+    if (sceneInputManager.eventHandler_ != nullptr) {
+        sceneInputManager.eventHandler_->PostSyncTask(task, "ScenarioSimulatorSetMMIClient");
+    } else {
+        task();
+    }
+}
+
+std::vector<sptr<SceneSession>> ScenarioSimulator::GetForegroundSessions() const
+{
+    std::vector<sptr<SceneSession>> sessions;
+    for (const auto& session : sessions_) {
+        auto state = session->GetSessionState();
+        if (state == SessionState::STATE_FOREGROUND || state == SessionState::STATE_ACTIVE) {
+            sessions.push_back(session);
+        }
+    }
+    return sessions;
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_WINDOW_SCENE_SCENARIO_SIMULATOR_H
+#define OHOS_ROSEN_WINDOW_SCENE_SCENARIO_SIMULATOR_H
+
+#include <atomic>
+#include <functional>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "scene_input_manager.h"
+#include "session/host/include/scene_session.h"
+
+namespace OHOS {
+namespace Rosen {
+/**
+ * @brief Messages the stand-ins of the app, MMI and RS received, each one would be an IPC on a device.
+ */
+struct SimulatorMessageCounter {
+    static std::atomic<uint64_t> appMessageCount_;
+    static std::atomic<uint64_t> appMessageBytes_;
+    static std::atomic<uint64_t> mmiMessageCount_;
+    static std::atomic<uint64_t> mmiWindowCount_;
+    static std::atomic<uint64_t> rsMessageCount_;
+};
+
+struct SimulatorStageStats {
+    uint32_t count_ = 0;
+    // process cpu time, including the scene session manager and input threads
+    int64_t cpuTimeUs_ = 0;
+    int64_t wallTimeUs_ = 0;
+    uint64_t allocCount_ = 0;
+    uint64_t allocBytes_ = 0;
+    uint64_t appMessageCount_ = 0;
+    uint64_t appMessageBytes_ = 0;
+    uint64_t mmiMessageCount_ = 0;
+    uint64_t mmiWindowCount_ = 0;
+    uint64_t rsMessageCount_ = 0;
+};
+
+struct SimulatorReport {
+    std::vector<std::string> stageOrder_;
+    std::map<std::string, SimulatorStageStats> stages_;
+    uint32_t sessionCount_ = 0;
+    int32_t focusedSessionId_ = INVALID_SESSION_ID;
+
+    void Dump(std::string& dumpInfo) const;
+};
+
+/**
+ * @brief Drive the SceneSessionManager pipeline with scripted scenarios, without SCB, apps, MMI or RS.
+ *
+ * One command per line, lines starting with '#' are comments:
+ * "launch <count>" creates, connects and foregrounds full screen app windows.
+ * "cascade <count>" does the same for floating app windows cascaded from the top left.
+ * "flush <frames>" runs FlushUIParams for all foreground windows once per frame.
+ * "flush_mmi" forces FlushWindowInfoToMMI.
+ * "visibility" computes occlusion from the window rects and delivers it as RS would.
+ * "focus <count>" requests focus for the topmost count windows from top to bottom.
+ * "background <count>" backgrounds the topmost count windows.
+ */
+class ScenarioSimulator {
+public:
+    ScenarioSimulator();
+    ~ScenarioSimulator();
+
+    static const std::string& GetDefaultScenario();
+    bool Parse(std::istream& stream);
+    bool Load(const std::string& scenarioPath);
+    SimulatorReport Run();
+
+private:
+    struct Command {
+        std::string name_;
+        uint32_t count_ = 1;
+    };
+
+    void Launch(uint32_t count, WindowMode mode);
+    void FlushUIParams(uint32_t frames);
+    void FlushWindowInfoToMMI();
+    void UpdateVisibility();
+    void Focus(uint32_t count);
+    void Background(uint32_t count);
+    void MeasureStage(const std::string& stageName, const std::function<void()>& func);
+    void WaitIdle();
+    void Reset();
+    void SetMMIClient(bool isSimulated);
+    std::vector<sptr<SceneSession>> GetForegroundSessions() const;
+
+    std::vector<Command> commands_;
+    std::vector<sptr<SceneSession>> sessions_;
+    SimulatorReport report_;
+    bool isScbCoreEnabled_ = false;
+    std::shared_ptr<SceneInputManager::MMIClient> mmiClient_;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // OHOS_ROSEN_WINDOW_SCENE_SCENARIO_SIMULATOR_H
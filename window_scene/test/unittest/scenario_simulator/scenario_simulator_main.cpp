@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <sstream>
+
+#include "scenario_simulator.h"
+
+using namespace OHOS::Rosen;
+
+// usage: wms_scenario_simulator [scenario file], the default scenario is run without a file
+int main(int argc, char* argv[])
+{
+    ScenarioSimulator simulator;
+    if (argc > 1) {
+        if (!simulator.Load(argv[1])) {
+            std::cerr << "invalid scenario: " << argv[1] << std::endl;
+            return 1;
+        }
+    } else {
+        std::istringstream stream(ScenarioSimulator::GetDefaultScenario());
+        simulator.Parse(stream);
+    }
+    std::string dumpInfo;
+    simulator.Run().Dump(dumpInfo);
+    std::cout << dumpInfo;
+    return 0;
+}
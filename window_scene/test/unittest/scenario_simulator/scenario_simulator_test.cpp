@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "scenario_simulator.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+class ScenarioSimulatorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: Parse
+ * @tc.desc: invalid commands and counts are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenarioSimulatorTest, Parse, TestSize.Level1)
+{
+    ScenarioSimulator simulator;
+    std::istringstream stream(ScenarioSimulator::GetDefaultScenario());
+    EXPECT_TRUE(simulator.Parse(stream));
+
+    for (const auto& scenario : { "resize 1", "launch 0", "launch -1", "launch 1x", "focus 100000" }) {
+        ScenarioSimulator invalidSimulator;
+        std::istringstream invalidStream(scenario);
+        EXPECT_FALSE(invalidSimulator.Parse(invalidStream)) << scenario;
+    }
+    ScenarioSimulator commentSimulator;
+    std::istringstream commentStream("# comment\n\nflush_mmi\n");
+    EXPECT_TRUE(commentSimulator.Parse(commentStream));
+    EXPECT_FALSE(commentSimulator.Load("/data/not_exist_scenario"));
+}
+
+/**
+ * @tc.name: Run
+ * @tc.desc: every stage is measured and the messages are counted
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScenarioSimulatorTest, Run, TestSize.Level1)
+{
+    auto mmiClient = SceneInputManager::GetInstance().mmiClient_;
+    ScenarioSimulator simulator;
+    std::istringstream stream("launch 3\ncascade 2\nflush 2\nflush_mmi\nvisibility\nfocus 2\nbackground 1\n");
+    ASSERT_TRUE(simulator.Parse(stream));
+    auto report = simulator.Run();
+    std::string dumpInfo;
+    report.Dump(dumpInfo);
+    GTEST_LOG_(INFO) << dumpInfo;
+
+    EXPECT_EQ(report.sessionCount_, 5);
+    EXPECT_EQ(report.stages_["create"].count_, 5);
+    EXPECT_EQ(report.stages_["foreground"].count_, 5);
+    EXPECT_EQ(report.stages_["flush_ui_params"].count_, 2);
+    EXPECT_EQ(report.stages_["flush_mmi"].count_, 1);
+    EXPECT_EQ(report.stages_["visibility"].count_, 1);
+    EXPECT_EQ(report.stages_["focus"].count_, 2);
+    EXPECT_EQ(report.stages_["background"].count_, 1);
+    EXPECT_GT(report.stages_["foreground"].appMessageCount_, 0);
+    EXPECT_EQ(report.stages_["visibility"].rsMessageCount_, 1);
+    EXPECT_EQ(report.stageOrder_.front(), "create");
+
+    // the simulated MMI client is only injected during the run
+    EXPECT_EQ(SceneInputManager::GetInstance().mmiClient_, mmiClient);
+}
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -58,7 +58,7 @@ HWTEST_F(SceneScreenChangeListenerTest, OnPropertyChangeWithRelativePositionUnch
 
     {
         std::unique_lock<std::shared_mutex> lock(ssm_.sceneSessionMapMutex_);
-        ssm_.sceneSessionMap_[1] = mockSession;
+        ssm_.sceneSessionMap_.insert_or_assign(1, mockSession);
     }
 
     EXPECT_CALL(*mockSession, UpdateGlobalDisplayRect(_, _)).Times(0);
@@ -87,7 +87,7 @@ HWTEST_F(SceneScreenChangeListenerTest, OnPropertyChangeWithRelativePositionChan
 
     {
         std::unique_lock<std::shared_mutex> lock(ssm_.sceneSessionMapMutex_);
-        ssm_.sceneSessionMap_[1] = mockSession;
+        ssm_.sceneSessionMap_.insert_or_assign(1, mockSession);
     }
 
     EXPECT_CALL(*mockSession, UpdateGlobalDisplayRect(_, _))
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "scene_session_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr ScreenId FIRST_SCREEN_ID = 0;
+constexpr ScreenId SECOND_SCREEN_ID = 1;
+
+sptr<SceneSession> CreateSession(int32_t persistentId, ScreenId screenId, WindowType type)
+{
+    SessionInfo info;
+    info.abilityName_ = "SceneSessionIndexTest";
+    info.bundleName_ = "SceneSessionIndexTest";
+    info.screenId_ = screenId;
+    info.windowType_ = static_cast<uint32_t>(type);
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
+    sceneSession->persistentId_ = persistentId;
+    return sceneSession;
+}
+
+std::vector<int32_t> GetIds(const std::vector<sptr<SceneSession>>& sessions)
+{
+    std::vector<int32_t> ids;
+    for (const auto& sceneSession : sessions) {
+        ids.push_back(sceneSession->GetPersistentId());
+    }
+    return ids;
+}
+} // namespace
+
+class SceneSessionIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: GetSessionsByScreenAndType
+ * @tc.desc: sessions are found by screen and by type in persistentId order
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionIndexTest, GetSessionsByScreenAndType, TestSize.Level1)
+{
+    SceneSessionMap sceneSessionMap;
+    sceneSessionMap.insert({ 3, CreateSession(3, FIRST_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.insert({ 1, CreateSession(1, FIRST_SCREEN_ID, WindowType::WINDOW_TYPE_STATUS_BAR) });
+    sceneSessionMap.insert({ 2, CreateSession(2, SECOND_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    const auto& index = sceneSessionMap.GetIndex();
+    EXPECT_EQ(index.Size(), 3);
+
+    std::vector<sptr<SceneSession>> sessions;
+    index.GetSessionsByScreen(FIRST_SCREEN_ID, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1, 3 }));
+    sessions.clear();
+    index.GetSessionsByType(WindowType::APP_MAIN_WINDOW_BASE, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 2, 3 }));
+
+    sceneSessionMap.erase(3);
+    sessions.clear();
+    index.GetSessionsByType(WindowType::APP_MAIN_WINDOW_BASE, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 2 }));
+    EXPECT_EQ(index.Size(), 2);
+}
+
+/**
+ * @tc.name: GetSessionsByScreens
+ * @tc.desc: sessions of several screens are found in persistentId order across the screens
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionIndexTest, GetSessionsByScreens, TestSize.Level1)
+{
+    SceneSessionMap sceneSessionMap;
+    sceneSessionMap.insert({ 4, CreateSession(4, SCREEN_ID_INVALID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.insert({ 1, CreateSession(1, SECOND_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.insert({ 3, CreateSession(3, FIRST_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.insert({ 2, CreateSession(2, SCREEN_ID_INVALID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.insert({ 5, CreateSession(5, SECOND_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    const auto& index = sceneSessionMap.GetIndex();
+
+    std::vector<sptr<SceneSession>> sessions;
+    index.GetSessionsByScreens({ SCREEN_ID_INVALID, FIRST_SCREEN_ID, SECOND_SCREEN_ID }, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1, 2, 3, 4, 5 }));
+    sessions.clear();
+    index.GetSessionsByScreens({ SECOND_SCREEN_ID, SCREEN_ID_INVALID }, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1, 2, 4, 5 }));
+}
+
+/**
+ * @tc.name: UpdateScreenId
+ * @tc.desc: a session moved to another screen is found on the new screen only
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionIndexTest, UpdateScreenId, TestSize.Level1)
+{
+    SceneSessionMap sceneSessionMap;
+    auto sceneSession = CreateSession(1, FIRST_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE);
+    sceneSessionMap.insert({ 1, sceneSession });
+    auto& index = sceneSessionMap.GetIndex();
+    sceneSession->SetScreenIdChangeFunc([&index](int32_t persistentId, uint64_t screenId) {
+        index.UpdateScreenId(persistentId, screenId);
+    });
+    sceneSession->SetScreenIdOnServer(SECOND_SCREEN_ID);
+
+    std::vector<sptr<SceneSession>> sessions;
+    index.GetSessionsByScreen(FIRST_SCREEN_ID, sessions);
+    EXPECT_TRUE(sessions.empty());
+    index.GetSessionsByScreen(SECOND_SCREEN_ID, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1 }));
+    sessions.clear();
+    index.GetSessionsByType(WindowType::APP_MAIN_WINDOW_BASE, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1 }));
+}
+
+/**
+ * @tc.name: MapUpdatesIndex
+ * @tc.desc: every insert and erase on the map updates its index
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionIndexTest, MapUpdatesIndex, TestSize.Level1)
+{
+    SceneSessionMap sceneSessionMap;
+    const auto& index = sceneSessionMap.GetIndex();
+    sceneSessionMap.insert({ 1, CreateSession(1, FIRST_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap.emplace(2, CreateSession(2, SECOND_SCREEN_ID, WindowType::APP_SUB_WINDOW_BASE));
+    sceneSessionMap.emplace(3, nullptr);
+    // a key already in the map keeps its session
+    auto result = sceneSessionMap.insert({ 1, CreateSession(1, SECOND_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(index.Size(), 3);
+    std::vector<sptr<SceneSession>> sessions;
+    index.GetSessionsByScreen(FIRST_SCREEN_ID, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1 }));
+
+    sceneSessionMap.insert_or_assign(2, CreateSession(2, FIRST_SCREEN_ID, WindowType::APP_SUB_WINDOW_BASE));
+    sessions.clear();
+    index.GetSessionsByScreen(FIRST_SCREEN_ID, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 1, 2 }));
+    sessions.clear();
+    index.GetSessionsByScreen(SECOND_SCREEN_ID, sessions);
+    EXPECT_TRUE(sessions.empty());
+
+    sceneSessionMap.erase(sceneSessionMap.find(1));
+    sceneSessionMap.erase(3);
+    EXPECT_EQ(index.Size(), 1);
+    sessions.clear();
+    index.GetSessionsByType(WindowType::APP_SUB_WINDOW_BASE, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 2 }));
+
+    SceneSessionMap copiedMap = sceneSessionMap;
+    sessions.clear();
+    copiedMap.GetIndex().GetSessionsByType(WindowType::APP_SUB_WINDOW_BASE, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 2 }));
+
+    std::map<int32_t, sptr<SceneSession>> plainMap;
+    plainMap.insert({ 4, CreateSession(4, SECOND_SCREEN_ID, WindowType::APP_MAIN_WINDOW_BASE) });
+    sceneSessionMap = plainMap;
+    EXPECT_EQ(index.Size(), 1);
+    sessions.clear();
+    index.GetSessionsByScreen(SECOND_SCREEN_ID, sessions);
+    EXPECT_EQ(GetIds(sessions), std::vector<int32_t>({ 4 }));
+
+    sceneSessionMap.clear();
+    EXPECT_EQ(index.Size(), 0);
+    sessions.clear();
+    index.GetSessionsByType(WindowType::APP_MAIN_WINDOW_BASE, sessions);
+    EXPECT_TRUE(sessions.empty());
+}
+
+/**
+ * @tc.name: LoopStats
+ * @tc.desc: the visited and matched sessions of the loops are dumped and reset
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionIndexTest, LoopStats, TestSize.Level1)
+{
+    SceneSessionIndex index;
+    index.RecordLoop(SessionIndexLoop::FLUSH_UI_PARAMS, 100, 10, 8);
+    index.RecordLoop(SessionIndexLoop::FLUSH_UI_PARAMS, 100, 12, 9);
+    index.RecordLoop(SessionIndexLoop::LOOP_END, 1, 1, 1);
+    std::ostringstream oss;
+    index.DumpLoopStats(oss);
+    std::string dumpInfo = oss.str();
+    EXPECT_NE(dumpInfo.find("FlushUIParams"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("200"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("22"), std::string::npos);
+    EXPECT_NE(dumpInfo.find("17"), std::string::npos);
+
+    index.ResetLoopStats();
+    std::ostringstream resetOss;
+    index.DumpLoopStats(resetOss);
+    EXPECT_EQ(resetOss.str().find("200"), std::string::npos);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -167,7 +167,7 @@ HWTEST_F(SceneSessionManagerKioskTest,
     ssm_->kioskModeChangeFunc_ = [](bool, uint64_t) {};
     sptr<IRemoteObject> token = new MockIRemoteObject();
     session->SetAbilityToken(token);
-    ssm_->sceneSessionMap_[101] = session;
+    ssm_->sceneSessionMap_.insert_or_assign(101, session);
     EXPECT_EQ(ssm_->EnterKioskMode(token), WMError::WM_OK);
 }
 
@@ -188,7 +188,7 @@ HWTEST_F(SceneSessionManagerKioskTest,
     ssm_->kioskModeChangeFunc_ = nullptr;
     sptr<IRemoteObject> token = new MockIRemoteObject();
     session->SetAbilityToken(token);
-    ssm_->sceneSessionMap_[101] = session;
+    ssm_->sceneSessionMap_.insert_or_assign(101, session);
     EXPECT_EQ(ssm_->EnterKioskMode(token), WMError::WM_OK);
     EXPECT_TRUE(ssm_->isKioskMode_);
     EXPECT_EQ(ssm_->kioskAppPersistentId_, session->GetPersistentId());
@@ -3102,6 +3102,54 @@ HWTEST_F(sceneSessionManagerProxyTest, GetAppWindowShowingInfosByBundleName01, T
     ret = proxy->GetAppWindowShowingInfosByBundleName(appInfo, windowInfos);
     EXPECT_EQ(ret, WMError::WM_OK);
 }
+
+/**
+ * @tc.name: SetWindowManagerAgentFilter
+ * @tc.desc: SetWindowManagerAgentFilter
+ * @tc.type: FUNC
+ */
+HWTEST_F(sceneSessionManagerProxyTest, SetWindowManagerAgentFilter, TestSize.Level1)
+{
+    WindowManagerAgentType type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY;
+    WindowManagerAgentFilter filter;
+    filter.pids = { 1 };
+    sptr<IWindowManagerAgent> windowManagerAgent = sptr<WindowManagerAgent>::MakeSptr();
+
+    // remote == nullptr
+    auto tempProxy = sptr<SceneSessionManagerProxy>::MakeSptr(nullptr);
+    auto ret = tempProxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    EXPECT_EQ(ret, WMError::WM_ERROR_IPC_FAILED);
+
+    // WriteInterfaceToken failed
+    sptr<MockIRemoteObject> remoteMocker = sptr<MockIRemoteObject>::MakeSptr();
+    auto proxy = sptr<SceneSessionManagerProxy>::MakeSptr(remoteMocker);
+    MockMessageParcel::ClearAllErrorFlag();
+    MockMessageParcel::SetWriteInterfaceTokenErrorFlag(true);
+    ret = proxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    EXPECT_EQ(ret, WMError::WM_ERROR_IPC_FAILED);
+    MockMessageParcel::SetWriteInterfaceTokenErrorFlag(false);
+
+    // WriteParcelable failed
+    MockMessageParcel::SetWriteParcelableErrorFlag(true);
+    ret = proxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    EXPECT_EQ(ret, WMError::WM_ERROR_IPC_FAILED);
+    MockMessageParcel::SetWriteParcelableErrorFlag(false);
+
+    // windowManagerAgent == nullptr
+    ret = proxy->SetWindowManagerAgentFilter(type, filter, nullptr);
+    EXPECT_EQ(ret, WMError::WM_ERROR_NULLPTR);
+
+    // SendRequest failed
+    remoteMocker->SetRequestResult(ERR_INVALID_DATA);
+    ret = proxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    EXPECT_EQ(ret, WMError::WM_ERROR_IPC_FAILED);
+    remoteMocker->SetRequestResult(ERR_NONE);
+
+    // interface success
+    ret = proxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    EXPECT_EQ(ret, WMError::WM_OK);
+    MockMessageParcel::ClearAllErrorFlag();
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
@@ -521,7 +521,7 @@ HWTEST_F(SceneSessionManagerStubTest, TransIdCheckWindowId, TestSize.Level1)
     info.bundleName_ = "HandleCheckWindowId1";
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
     ASSERT_NE(nullptr, sceneSession);
-    SceneSessionManager::GetInstance().sceneSessionMap_[windowId] = sceneSession;
+    SceneSessionManager::GetInstance().sceneSessionMap_.insert_or_assign(windowId, sceneSession);
     data.WriteInt32(windowId);
 
     uint32_t code = static_cast<uint32_t>(ISceneSessionManager::SceneSessionManagerMessage::TRANS_ID_CHECK_WINDOW_ID);
@@ -1362,6 +1362,50 @@ HWTEST_F(SceneSessionManagerStubTest, HandleUnregisterWindowManagerAgent, TestSi
     EXPECT_EQ(res, ERR_NONE);
 }
 
+/**
+ * @tc.name: TransIdSetWindowManagerAgentFilter
+ * @tc.desc: test TransIdSetWindowManagerAgentFilter
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerStubTest, TransIdSetWindowManagerAgentFilter, TestSize.Level1)
+{
+    uint32_t code = static_cast<uint32_t>(
+        ISceneSessionManager::SceneSessionManagerMessage::TRANS_ID_SET_WINDOW_MANAGER_AGENT_FILTER);
+    uint32_t type = static_cast<uint32_t>(WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY);
+    WindowManagerAgentFilter filter;
+    filter.pids = { 1 };
+    sptr<IWindowManagerAgent> windowManagerAgent = sptr<WindowManagerAgent>::MakeSptr();
+
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    data.WriteInterfaceToken(SceneSessionManagerStub::GetDescriptor());
+    data.WriteUint32(static_cast<uint32_t>(WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_END));
+    EXPECT_EQ(stub_->OnRemoteRequest(code, data, reply, option), ERR_INVALID_DATA);
+
+    MessageParcel noFilterData;
+    noFilterData.WriteInterfaceToken(SceneSessionManagerStub::GetDescriptor());
+    noFilterData.WriteUint32(type);
+    EXPECT_EQ(stub_->OnRemoteRequest(code, noFilterData, reply, option), ERR_INVALID_DATA);
+
+    MessageParcel noAgentData;
+    noAgentData.WriteInterfaceToken(SceneSessionManagerStub::GetDescriptor());
+    noAgentData.WriteUint32(type);
+    noAgentData.WriteParcelable(&filter);
+    EXPECT_EQ(stub_->OnRemoteRequest(code, noAgentData, reply, option), ERR_INVALID_DATA);
+
+    MessageParcel validData;
+    MessageParcel validReply;
+    validData.WriteInterfaceToken(SceneSessionManagerStub::GetDescriptor());
+    validData.WriteUint32(type);
+    validData.WriteParcelable(&filter);
+    validData.WriteRemoteObject(windowManagerAgent->AsObject());
+    EXPECT_EQ(stub_->OnRemoteRequest(code, validData, validReply, option), ERR_NONE);
+    int32_t errCode = 0;
+    EXPECT_TRUE(validReply.ReadInt32(errCode));
+    EXPECT_NE(errCode, static_cast<int32_t>(WMError::WM_OK));
+}
+
 /**
  * @tc.name: HandleRegisterWindowManagerAgent01
  * @tc.desc: test HandleRegisterWindowManagerAgent
@@ -1682,7 +1726,7 @@ HWTEST_F(SceneSessionManagerStubTest, HandleCheckWindowId, TestSize.Level1)
     info.abilityName_ = "HandleCheckWindowId";
     info.bundleName_ = "HandleCheckWindowId1";
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
-    SceneSessionManager::GetInstance().sceneSessionMap_[windowId] = sceneSession;
+    SceneSessionManager::GetInstance().sceneSessionMap_.insert_or_assign(windowId, sceneSession);
     data.WriteInt32(windowId);
 
     int res = stub_->HandleCheckWindowId(data, reply);
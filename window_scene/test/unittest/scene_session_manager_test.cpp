@@ -1676,7 +1676,7 @@ HWTEST_F(SceneSessionManagerTest, TestGetScreenName, TestSize.Level1)
     info1.abilityName_ = "test1";
     info1.bundleName_ = "test2";
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info1, nullptr);
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
     EXPECT_EQ(ssm_->GetScreenName(persistentId), "");
 
     sceneSession->SetSessionState(SessionState::STATE_FOREGROUND);
@@ -1688,13 +1688,13 @@ HWTEST_F(SceneSessionManagerTest, TestGetScreenName, TestSize.Level1)
 
     property->SetDisplayId(-1ULL);
     sceneSession->SetSessionProperty(property);
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
     EXPECT_EQ(ssm_->GetScreenName(persistentId), "");
 
     uint64_t displayId = 1000;
     property->SetDisplayId(displayId);
     sceneSession->SetSessionProperty(property);
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
     EXPECT_EQ(ssm_->GetScreenName(persistentId), "");
 
     sptr<ScreenSession> screenSession = sptr<ScreenSession>::MakeSptr();
@@ -1767,7 +1767,7 @@ HWTEST_F(SceneSessionManagerTest, TestIsPiPForbidden, TestSize.Level1)
     uint64_t displayId = 1001;
     property->SetDisplayId(displayId);
     sceneSession->SetSessionProperty(property);
-    ssm_->sceneSessionMap_[persistentId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(persistentId, sceneSession);
     sptr<ScreenSession> screenSession = new ScreenSession();
     screenSession->SetName("HiCar");
     ScreenSessionManagerClient::GetInstance().screenSessionMap_.insert({ displayId, screenSession });
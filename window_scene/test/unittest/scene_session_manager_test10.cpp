@@ -1007,7 +1007,7 @@ HWTEST_F(SceneSessionManagerTest10, TestGetMainParentSceneSession_03, TestSize.L
     ssm_->sceneSessionMap_.insert({ 100, sceneSessionParent });
     sceneSession->SetParentSession(sceneSessionParent);
 
-    ssm_->sceneSessionMap_[999] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(999, sceneSession);
     sptr<SceneSession> ret = ssm_->GetMainParentSceneSession(999, ssm_->sceneSessionMap_);
     ASSERT_NE(ret, sceneSessionParent);
 }
@@ -1054,7 +1054,7 @@ HWTEST_F(SceneSessionManagerTest10, TestGetParentMainWindowId_03, TestSize.Level
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
 
     sceneSession->property_->SetPersistentId(windowId);
-    ssm_->sceneSessionMap_[windowId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(windowId, sceneSession);
     WMError ret = ssm_->GetParentMainWindowId(windowId, mainWindowId);
     ASSERT_EQ(ret, WMError::WM_OK);
 }
@@ -1073,7 +1073,7 @@ HWTEST_F(SceneSessionManagerTest10, TestGetParentMainWindowId_04, TestSize.Level
     info.bundleName_ = "test";
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
     sceneSession->property_->SetPersistentId(windowId);
-    ssm_->sceneSessionMap_[windowId] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(windowId, sceneSession);
     sceneSession->property_->SetWindowType(WindowType::WINDOW_TYPE_APP_SUB_WINDOW);
     WMError ret = ssm_->GetParentMainWindowId(windowId, mainWindowId);
     ASSERT_EQ(ret, WMError::WM_ERROR_NULLPTR);
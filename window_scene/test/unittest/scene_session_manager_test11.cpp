@@ -1546,7 +1546,7 @@ HWTEST_F(SceneSessionManagerTest11, RequestSceneSession, Function | SmallTest |
     sceneSession->property_->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
     sceneSession->sessionInfo_.isAbilityHook_ = true;
     sptr<WindowSessionProperty> windowSessionProperty = sptr<WindowSessionProperty>::MakeSptr();
-    ssm_->sceneSessionMap_[101] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(101, sceneSession);
 
     auto result = ssm_->RequestSceneSession(info, windowSessionProperty);
     ASSERT_NE(result, nullptr);
@@ -1589,7 +1589,7 @@ HWTEST_F(SceneSessionManagerTest11, UpdateRecentMainSessionInfos, Function | Sma
     sptr<SceneSession> sceneSession = sptr<MainSession>::MakeSptr(info, nullptr);
     ASSERT_NE(sceneSession, nullptr);
     sceneSession->property_->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
-    ssm_->sceneSessionMap_[101] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(101, sceneSession);
     ssm_->recentMainSessionInfoList_.clear();
     EXPECT_EQ(ssm_->recentMainSessionInfoList_.size(), 0);
     ssm_->UpdateRecentMainSessionInfos(recentMainSessionIdList);
@@ -2137,7 +2137,7 @@ HWTEST_F(SceneSessionManagerTest12, RequestSceneSession, Function | SmallTest |
     sceneSession->property_->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
     sceneSession->sessionInfo_.isAbilityHook_ = true;
     sptr<WindowSessionProperty> windowSessionProperty = sptr<WindowSessionProperty>::MakeSptr();
-    ssm_->sceneSessionMap_[101] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(101, sceneSession);
 
     auto result = ssm_->RequestSceneSession(info, windowSessionProperty);
     ASSERT_NE(result, nullptr);
@@ -2615,7 +2615,7 @@ HWTEST_F(SceneSessionManagerTest12, GetRecentMainSessionInfoList_OK, TestSize.Le
     ASSERT_NE(sceneSession, nullptr);
     sceneSession->property_->SetWindowType(WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
     sceneSession->state_ = SessionState::STATE_CONNECT;
-    ssm_->sceneSessionMap_[101] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(101, sceneSession);
     const std::vector<int32_t> idList = { 101 };
     MockAccesstokenKit::MockIsSystemApp(true);
     MockAccesstokenKit::MockIsSACalling(false);
@@ -3559,6 +3559,7 @@ HWTEST_F(SceneSessionManagerTest12, NotifyWindowPropertyChange03, Function | Sma
     sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
     ASSERT_NE(sceneSession, nullptr);
     sceneSession->SetScreenId(screenId);
+    ssm_->RegisterPropertyDirtyNotifyManagerFunc(sceneSession);
     sceneSession->SetPropertyDirtyFlags(1);
     ssm_->observedFlags_ = 1;
     auto result = ssm_->sceneSessionMap_.insert({1003, sceneSession});
@@ -3566,6 +3567,57 @@ HWTEST_F(SceneSessionManagerTest12, NotifyWindowPropertyChange03, Function | Sma
     EXPECT_EQ(sceneSession->GetPropertyDirtyFlags(), 0);
 }
 
+/**
+ * @tc.name: NotifyWindowPropertyChange04
+ * @tc.desc: only the sessions in the dirty set are visited, unobserved flags are kept until observed
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest12, NotifyWindowPropertyChange04, Function | SmallTest | Level2)
+{
+    ASSERT_NE(nullptr, ssm_);
+    ssm_->sceneSessionMap_.clear();
+    ssm_->propertyDirtySessionIds_.clear();
+    ssm_->needScanAllPropertyDirty_ = false;
+    ScreenId screenId = 0;
+    const uint32_t windowIdFlag = static_cast<uint32_t>(SessionPropertyFlag::WINDOW_ID);
+    const uint32_t windowRectFlag = static_cast<uint32_t>(SessionPropertyFlag::WINDOW_RECT);
+    ssm_->observedFlags_ = windowIdFlag;
+
+    SessionInfo sessionInfo;
+    sessionInfo.bundleName_ = "NotifyWindowPropertyChange04";
+    sessionInfo.abilityName_ = "NotifyWindowPropertyChange04";
+    sessionInfo.persistentId_ = 1004;
+    sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+    sceneSession->SetScreenId(screenId);
+    ssm_->RegisterPropertyDirtyNotifyManagerFunc(sceneSession);
+    ssm_->sceneSessionMap_.insert({ sceneSession->GetPersistentId(), sceneSession });
+    // not in the dirty set, as the listener is not registered
+    sptr<SceneSession> unregisteredSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+    unregisteredSession->SetScreenId(screenId);
+    unregisteredSession->SetPropertyDirtyFlags(windowIdFlag);
+    ssm_->sceneSessionMap_.insert({ 1005, unregisteredSession });
+
+    sceneSession->AddPropertyDirtyFlags(windowRectFlag);
+    EXPECT_EQ(ssm_->propertyDirtySessionIds_.size(), 1);
+    ssm_->NotifyWindowPropertyChange(screenId);
+    EXPECT_TRUE(ssm_->propertyDirtySessionIds_.empty());
+    EXPECT_EQ(sceneSession->GetPropertyDirtyFlags(), windowRectFlag);
+    EXPECT_EQ(unregisteredSession->GetPropertyDirtyFlags(), windowIdFlag);
+
+    sceneSession->AddPropertyDirtyFlags(windowRectFlag);
+    EXPECT_TRUE(ssm_->propertyDirtySessionIds_.empty());
+    sceneSession->AddPropertyDirtyFlags(windowIdFlag);
+    ssm_->NotifyWindowPropertyChange(screenId);
+    EXPECT_EQ(sceneSession->GetPropertyDirtyFlags(), 0);
+
+    // observing more flags scans all sessions once
+    ssm_->RecoverWindowPropertyChangeFlag(windowIdFlag, 0);
+    ssm_->NotifyWindowPropertyChange(screenId);
+    EXPECT_EQ(unregisteredSession->GetPropertyDirtyFlags(), 0);
+    ssm_->sceneSessionMap_.clear();
+    ssm_->observedFlags_ = 0;
+}
+
 /**
  * @tc.name: FillWindowProfileInfoTest
  * @tc.desc: FillWindowProfileInfoTest
@@ -353,7 +353,7 @@ HWTEST_F(SceneSessionManagerTest13, SetAppForceLandscapeConfig04, TestSize.Level
     info.moduleName_ = "TestModule";
     sptr<SceneSession> session = ssm_->CreateSceneSession(info, nullptr);
     ASSERT_NE(session, nullptr);
-    ssm_->sceneSessionMap_[session->GetPersistentId()] = session;
+    ssm_->sceneSessionMap_.insert_or_assign(session->GetPersistentId(), session);
     AppForceLandscapeConfig config;
     config.containsConfig_ = true;
     config.isRouter_ = true;
@@ -393,14 +393,14 @@ HWTEST_F(SceneSessionManagerTest13, SetAppForceLandscapeConfig06, TestSize.Level
     info1.moduleName_ = "TestModule1";
     sptr<SceneSession> session1 = ssm_->CreateSceneSession(info1, nullptr);
     ASSERT_NE(session1, nullptr);
-    ssm_->sceneSessionMap_[session1->GetPersistentId()] = session1;
+    ssm_->sceneSessionMap_.insert_or_assign(session1->GetPersistentId(), session1);
     SessionInfo info2;
     info2.bundleName_ = bundleName;
     info2.abilityName_ = "TestAbility2";
     info2.moduleName_ = "TestModule2";
     sptr<SceneSession> session2 = ssm_->CreateSceneSession(info2, nullptr);
     ASSERT_NE(session2, nullptr);
-    ssm_->sceneSessionMap_[session2->GetPersistentId()] = session2;
+    ssm_->sceneSessionMap_.insert_or_assign(session2->GetPersistentId(), session2);
     AppForceLandscapeConfig config;
     config.containsConfig_ = false;
     config.isRouter_ = false;
@@ -442,7 +442,7 @@ HWTEST_F(SceneSessionManagerTest13, SetAppForceLandscapeConfig08, TestSize.Level
     info.moduleName_ = "TestModule";
     sptr<SceneSession> session = ssm_->CreateSceneSession(info, nullptr);
     ASSERT_NE(session, nullptr);
-    ssm_->sceneSessionMap_[session->GetPersistentId()] = session;
+    ssm_->sceneSessionMap_.insert_or_assign(session->GetPersistentId(), session);
     AppForceLandscapeConfig config;
     config.containsConfig_ = true;
     config.isRouter_ = false;
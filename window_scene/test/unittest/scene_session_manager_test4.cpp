@@ -731,7 +731,7 @@ HWTEST_F(SceneSessionManagerTest4, UpdateScreenSupportMultiWindow02, TestSize.Le
     info.persistentId_ = 100;
     auto sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
     ASSERT_NE(sceneSession, nullptr);
-    ssm_->sceneSessionMap_[100] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(100, sceneSession);
  
     auto result = ssm_->UpdateScreenSupportMultiWindow(0, ScreenSupportMultiWindowReason::ADD);
     EXPECT_EQ(result, WSError::WS_OK);
@@ -756,7 +756,7 @@ HWTEST_F(SceneSessionManagerTest4, UpdateScreenSupportMultiWindow03, TestSize.Le
     info.persistentId_ = 100;
     auto sceneSession = sptr<SceneSession>::MakeSptr(info, nullptr);
     ASSERT_NE(sceneSession, nullptr);
-    ssm_->sceneSessionMap_[100] = sceneSession;
+    ssm_->sceneSessionMap_.insert_or_assign(100, sceneSession);
     sceneSession->systemConfig_.supportMultiWindowScreenSet_ = {0, 1};
  
     auto result = ssm_->UpdateScreenSupportMultiWindow(0, ScreenSupportMultiWindowReason::DELETE);
@@ -778,7 +778,7 @@ HWTEST_F(SceneSessionManagerTest4, UpdateScreenSupportMultiWindow04, TestSize.Le
 {
     ASSERT_NE(nullptr, ssm_);
     ssm_->systemConfig_.supportMultiWindowScreenSet_.clear();
-    ssm_->sceneSessionMap_[100] = nullptr;
+    ssm_->sceneSessionMap_.insert_or_assign(100, nullptr);
  
     auto result = ssm_->UpdateScreenSupportMultiWindow(0, ScreenSupportMultiWindowReason::ADD);
     EXPECT_EQ(result, WSError::WS_OK);
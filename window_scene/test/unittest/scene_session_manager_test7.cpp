@@ -346,6 +346,110 @@ HWTEST_F(SceneSessionManagerTest7, FlushUIParams03, Function | SmallTest | Level
     EXPECT_EQ(true, keyboardSession->stateChanged_);
 }
 
+/**
+ * @tc.name: FlushUIParams04
+ * @tc.desc: FlushUIParams processes all pending screens in one pass and merges repeated frames of a screen
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest7, FlushUIParams04, Function | SmallTest | Level3)
+{
+    ASSERT_NE(nullptr, ssm_);
+    bool isScbCoreEnabled = Session::IsScbCoreEnabled();
+    Session::SetScbCoreEnabled(true);
+    ssm_->sceneSessionMap_.clear();
+    std::vector<sptr<SceneSession>> sceneSessions;
+    const std::vector<ScreenId> sessionScreenIds = { 2, 3, 2 };
+    for (int32_t persistentId = 1; persistentId <= 3; persistentId++) {
+        SessionInfo sessionInfo;
+        sessionInfo.bundleName_ = "SceneSessionManagerTest7";
+        sessionInfo.abilityName_ = "FlushUIParams04";
+        sessionInfo.screenId_ = sessionScreenIds[persistentId - 1];
+        sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+        sceneSession->persistentId_ = persistentId;
+        sceneSession->isVisible_ = false;
+        ssm_->sceneSessionMap_.insert({ persistentId, sceneSession });
+        sceneSessions.push_back(sceneSession);
+    }
+    uint32_t visibilityChangedCount = 0;
+    sceneSessions[2]->SetVisibilityChangedDetectFunc(
+        [&visibilityChangedCount](int32_t pid, bool isVisible, bool newIsVisible) { visibilityChangedCount++; });
+    auto& flushLoopStats =
+        ssm_->sceneSessionMap_.GetIndex().loopStats_[static_cast<size_t>(SessionIndexLoop::FLUSH_UI_PARAMS)];
+    ssm_->isFlushUIParamsBatchEnabled_ = true;
+    // keep the frames pending until FlushPendingUIParams is called below
+    ssm_->isFlushUIParamsTaskPending_ = true;
+
+    ssm_->FlushUIParams(2, { { 1, SessionUIParam() }, { 3, SessionUIParam() } });
+    ssm_->FlushUIParams(3, { { 2, SessionUIParam() } });
+    EXPECT_EQ(ssm_->pendingUIParams_.size(), 2);
+    uint64_t flushCount = flushLoopStats.count_.load();
+    ssm_->FlushPendingUIParams();
+    EXPECT_EQ(flushLoopStats.count_.load(), flushCount + 1);
+    EXPECT_TRUE(sceneSessions[0]->IsVisible());
+    EXPECT_TRUE(sceneSessions[1]->IsVisible());
+    EXPECT_TRUE(sceneSessions[2]->IsVisible());
+    EXPECT_EQ(visibilityChangedCount, 1);
+
+    // the second frame of screen 2 replaces the first one in the same pass, its rect sync is kept
+    ssm_->isFlushUIParamsTaskPending_ = true;
+    SessionUIParam syncParam;
+    syncParam.rect_ = { 0, 0, 100, 100 };
+    SessionUIParam noSyncParam;
+    noSyncParam.rect_ = { 0, 0, 200, 200 };
+    noSyncParam.needSync_ = false;
+    ssm_->FlushUIParams(2, { { 1, syncParam } });
+    ssm_->FlushUIParams(3, { { 2, SessionUIParam() } });
+    ssm_->FlushUIParams(2, { { 1, noSyncParam }, { 3, SessionUIParam() } });
+    ASSERT_EQ(ssm_->pendingUIParams_.size(), 2);
+    ASSERT_EQ(ssm_->pendingUIParams_[2].size(), 2);
+    EXPECT_TRUE(ssm_->pendingUIParams_[2][1].needSync_);
+    EXPECT_EQ(ssm_->pendingUIParams_[2][1].rect_, syncParam.rect_);
+    flushCount = flushLoopStats.count_.load();
+    ssm_->FlushPendingUIParams();
+    EXPECT_EQ(flushLoopStats.count_.load(), flushCount + 1);
+    EXPECT_TRUE(sceneSessions[2]->IsVisible());
+    EXPECT_EQ(visibilityChangedCount, 1);
+    EXPECT_TRUE(ssm_->pendingUIParams_.empty());
+    EXPECT_FALSE(ssm_->isFlushUIParamsTaskPending_);
+
+    ssm_->sceneSessionMap_.clear();
+    Session::SetScbCoreEnabled(isScbCoreEnabled);
+}
+
+/**
+ * @tc.name: FlushUIParams05
+ * @tc.desc: FlushUIParams counts only the sessions on the flushed screens as matched
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest7, FlushUIParams05, Function | SmallTest | Level3)
+{
+    ASSERT_NE(nullptr, ssm_);
+    ssm_->sceneSessionMap_.clear();
+    const std::vector<ScreenId> sessionScreenIds = { 2, 2, SCREEN_ID_INVALID };
+    for (int32_t persistentId = 1; persistentId <= 3; persistentId++) {
+        SessionInfo sessionInfo;
+        sessionInfo.bundleName_ = "SceneSessionManagerTest7";
+        sessionInfo.abilityName_ = "FlushUIParams05";
+        sessionInfo.screenId_ = sessionScreenIds[persistentId - 1];
+        sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+        sceneSession->persistentId_ = persistentId;
+        ssm_->sceneSessionMap_.insert({ persistentId, sceneSession });
+    }
+    // moved without telling the index, still visited in the bucket of screen 2 but not matched
+    ssm_->sceneSessionMap_.find(2)->second->sessionInfo_.screenId_ = 5;
+    auto& flushLoopStats =
+        ssm_->sceneSessionMap_.GetIndex().loopStats_[static_cast<size_t>(SessionIndexLoop::FLUSH_UI_PARAMS)];
+    uint64_t visited = flushLoopStats.visited_.load();
+    uint64_t matched = flushLoopStats.matched_.load();
+
+    ScreenUIParamMap screenUIParams;
+    screenUIParams[2].insert({ 1, SessionUIParam() });
+    ssm_->ProcessFlushUIParams(screenUIParams);
+    EXPECT_EQ(flushLoopStats.visited_.load(), visited + 3);
+    EXPECT_EQ(flushLoopStats.matched_.load(), matched + 2);
+    ssm_->sceneSessionMap_.clear();
+}
+
 /**
  * @tc.name: RegisterIAbilityManagerCollaborator
  * @tc.desc: RegisterIAbilityManagerCollaborator
@@ -2115,6 +2219,44 @@ HWTEST_F(SceneSessionManagerTest7, ConfigSupportFunctionType, Function | SmallTe
     EXPECT_EQ(SupportFunctionType::ALLOW_KEYBOARD_WILL_ANIMATION_NOTIFICATION,
         (ssm_->systemConfig_.supportFunctionType_ & SupportFunctionType::ALLOW_KEYBOARD_WILL_ANIMATION_NOTIFICATION));
 }
+
+/**
+ * @tc.name: CollectDirtyAvoidAreasLocked
+ * @tc.desc: the old and new rects of a changed bar are collected, a removed bar makes all avoid areas dirty
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionManagerTest7, CollectDirtyAvoidAreasLocked, TestSize.Level1)
+{
+    SessionInfo sessionInfo;
+    sessionInfo.bundleName_ = "SceneSessionManagerTest7";
+    sessionInfo.abilityName_ = "CollectDirtyAvoidAreasLocked";
+    sptr<SceneSession> statusBar = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+    statusBar->persistentId_ = 1001;
+    statusBar->property_->SetWindowType(WindowType::WINDOW_TYPE_STATUS_BAR);
+    statusBar->property_->SetDisplayId(0);
+    WSRect oldRect = { 0, 0, 1260, 100 };
+    WSRect newRect = { 0, 0, 1260, 0 };
+    statusBar->GetLayoutController()->SetSessionRect(oldRect);
+    statusBar->PublishQueryState();
+    statusBar->GetLayoutController()->SetSessionRect(newRect);
+    statusBar->ResetDirtyFlags();
+    ssm_->sceneSessionMap_.insert(std::make_pair(statusBar->persistentId_, statusBar));
+    ssm_->dirtyAvoidProviderIds_.insert(statusBar->persistentId_);
+
+    bool isAllAvoidAreasDirty = false;
+    auto dirtyAvoidAreas = ssm_->CollectDirtyAvoidAreasLocked(isAllAvoidAreasDirty);
+    EXPECT_FALSE(isAllAvoidAreasDirty);
+    EXPECT_TRUE(ssm_->dirtyAvoidProviderIds_.empty());
+    ASSERT_EQ(dirtyAvoidAreas.size(), 2);
+    EXPECT_EQ(dirtyAvoidAreas[0].second, newRect);
+    EXPECT_EQ(dirtyAvoidAreas[1].second, oldRect);
+
+    ssm_->sceneSessionMap_.erase(statusBar->persistentId_);
+    ssm_->dirtyAvoidProviderIds_.insert(statusBar->persistentId_);
+    dirtyAvoidAreas = ssm_->CollectDirtyAvoidAreasLocked(isAllAvoidAreasDirty);
+    EXPECT_TRUE(isAllAvoidAreasDirty);
+    EXPECT_TRUE(dirtyAvoidAreas.empty());
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
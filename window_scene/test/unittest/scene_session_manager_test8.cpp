@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <bitset>
 #include <gtest/gtest.h>
 
 #include "iremote_object_mocker.h"
@@ -1029,17 +1030,17 @@ HWTEST_F(SceneSessionManagerTest8, UnregisterWindowPropertyChangeAgent01, TestSi
 }
 
 /**
- * @tc.name: PackWindowPropertyChangeInfo01
- * @tc.desc: test function : PackWindowPropertyChangeInfo
+ * @tc.name: PackWindowPropertyChangeRecord01
+ * @tc.desc: test function : PackWindowPropertyChangeRecord
  * @tc.type: FUNC
  */
-HWTEST_F(SceneSessionManagerTest8, PackWindowPropertyChangeInfo01, TestSize.Level1)
+HWTEST_F(SceneSessionManagerTest8, PackWindowPropertyChangeRecord01, TestSize.Level1)
 {
     ssm_->interestedFlags_ = -1;
     SessionInfo sessionInfo1;
     sessionInfo1.isSystem_ = false;
-    sessionInfo1.bundleName_ = "PackWindowPropertyChangeInfo";
-    sessionInfo1.abilityName_ = "PackWindowPropertyChangeInfo";
+    sessionInfo1.bundleName_ = "PackWindowPropertyChangeRecord";
+    sessionInfo1.abilityName_ = "PackWindowPropertyChangeRecord";
     sessionInfo1.appIndex_ = 10;
     sptr<SceneSession> sceneSession1 = sptr<SceneSession>::MakeSptr(sessionInfo1, nullptr);
     sceneSession1->SetVisibilityState(WINDOW_VISIBILITY_STATE_TOTALLY_OCCUSION);
@@ -1054,11 +1055,19 @@ HWTEST_F(SceneSessionManagerTest8, PackWindowPropertyChangeInfo01, TestSize.Leve
     sceneSession1->SetFloatingScale(1.0f);
     sceneSession1->SetIsMidScene(true);
 
-    std::unordered_map<WindowInfoKey, WindowChangeInfoType> windowPropertyChangeInfo;
-    ssm_->PackWindowPropertyChangeInfo(sceneSession1, windowPropertyChangeInfo);
-    EXPECT_EQ(windowPropertyChangeInfo.size(), 12);
-    EXPECT_EQ(std::get<WindowModeInfo>(windowPropertyChangeInfo[WindowInfoKey::WINDOW_MODE_INFO]).windowMode,
-        WindowMode::WINDOW_MODE_FULLSCREEN);
+    WindowPropertyChangeBatch batch;
+    ssm_->PackWindowPropertyChangeRecord(sceneSession1, batch);
+    ssm_->PackWindowPropertyChangeRecord(sceneSession1, batch);
+    ASSERT_EQ(batch.GetRecords().size(), 2);
+    const auto& record = batch.GetRecords()[0];
+    EXPECT_EQ(std::bitset<32>(record.presentKeys_).count(), 12);
+    EXPECT_EQ(record.modeInfo_.windowMode, WindowMode::WINDOW_MODE_FULLSCREEN);
+    EXPECT_EQ(record.appIndex_, 10);
+    EXPECT_TRUE(record.isMidScene_);
+    EXPECT_EQ(batch.GetString(record.bundleNameIndex_), "PackWindowPropertyChangeRecord");
+    // both names are interned once for the batch
+    EXPECT_EQ(record.bundleNameIndex_, record.abilityNameIndex_);
+    EXPECT_EQ(batch.GetRecords()[1].bundleNameIndex_, record.bundleNameIndex_);
 }
 
 /**
@@ -1507,7 +1516,7 @@ HWTEST_F(SceneSessionManagerTest8, SessionBlackListSystemTest, TestSize.Level1)
         SessionInfo sessionInfo;
         sessionInfo.bundleName_ = "test";
         sptr<SceneSession> sceneSession = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
-        ssm_->sceneSessionMap_[i] = sceneSession;
+        ssm_->sceneSessionMap_.insert_or_assign(i, sceneSession);
     }
     SessionInfo sessionInfo1;
     sessionInfo1.bundleName_ = "test";
@@ -13,7 +13,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "display_manager.h"
 #include "input_event.h"
@@ -2272,6 +2275,95 @@ HWTEST_F(SceneSessionTest4, StartMoveEventKeepsAvoidRectUnsetWhenFocusIsRequired
     EXPECT_EQ(sceneSession->OnSessionEvent(SessionEvent::EVENT_START_MOVE, param), WSError::WS_OK);
     EXPECT_EQ(sceneSession->moveDragController_->movingAvoidRect_, WSRect::EMPTY_RECT);
 }
+
+/**
+ * @tc.name: GetAvoidAreaFromQueryState
+ * @tc.desc: avoid area queries off the session thread are answered from the query state without waiting for it
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionTest4, GetAvoidAreaFromQueryState, TestSize.Level1)
+{
+    constexpr uint32_t busyTaskMs = 200;
+    constexpr size_t queryCount = 1000;
+    SessionInfo info;
+    info.abilityName_ = "GetAvoidAreaFromQueryState";
+    info.bundleName_ = "GetAvoidAreaFromQueryState";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    auto handler = sceneSession->GetEventHandler();
+    ASSERT_NE(handler, nullptr);
+    session->SetEventHandler(handler, nullptr);
+    WSRect rect = { 0, 0, 1260, 2720 };
+    session->GetLayoutController()->SetSessionRect(rect);
+    session->isVisible_ = true;
+    EXPECT_EQ(session->GetQueryState(), nullptr);
+
+    session->PublishQueryState();
+    auto queryState = session->GetQueryState();
+    ASSERT_NE(queryState, nullptr);
+    EXPECT_EQ(queryState->rect_, rect);
+    EXPECT_TRUE(queryState->isVisible_);
+    EXPECT_TRUE(queryState->hasAvoidAreas_);
+    std::map<AvoidAreaType, AvoidArea> avoidAreas;
+    EXPECT_EQ(session->GetAllAvoidAreas(avoidAreas), queryState->avoidAreasRet_);
+    EXPECT_EQ(avoidAreas.size(), queryState->avoidAreas_.size());
+
+    // keep the session thread busy, as a saturated main queue
+    handler->PostTask([busyTaskMs] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(busyTaskMs));
+    }, "BusyTask");
+    std::vector<int64_t> costUs;
+    costUs.reserve(queryCount);
+    for (size_t i = 0; i < queryCount; i++) {
+        auto start = std::chrono::steady_clock::now();
+        EXPECT_EQ(session->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM),
+            queryState->avoidAreas_[AvoidAreaType::TYPE_SYSTEM]);
+        costUs.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+    // a rect other than the session rect still waits for the session thread
+    auto start = std::chrono::steady_clock::now();
+    session->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, { 0, 0, 100, 100 });
+    int64_t syncCostUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    std::sort(costUs.begin(), costUs.end());
+    int64_t p50Us = costUs[queryCount / 2];
+    int64_t p99Us = costUs[queryCount * 99 / 100];
+    GTEST_LOG_(INFO) << "query state p50: " << p50Us << "us, p99: " << p99Us
+                     << "us, sync task: " << syncCostUs << "us";
+}
+
+/**
+ * @tc.name: IsQueryStateOutdated
+ * @tc.desc: the query state is outdated by a change of the published fields or an avoid area update
+ * @tc.type: FUNC
+ */
+HWTEST_F(SceneSessionTest4, IsQueryStateOutdated, TestSize.Level1)
+{
+    SessionInfo info;
+    info.abilityName_ = "IsQueryStateOutdated";
+    info.bundleName_ = "IsQueryStateOutdated";
+    sptr<SceneSession> session = sptr<SceneSession>::MakeSptr(info, nullptr);
+    EXPECT_TRUE(session->IsQueryStateOutdated());
+    session->GetLayoutController()->SetSessionRect({ 0, 0, 1260, 2720 });
+    session->isVisible_ = true;
+    session->PublishQueryState();
+    session->ResetDirtyFlags();
+    EXPECT_FALSE(session->IsQueryStateOutdated());
+
+    session->GetLayoutController()->SetSessionRect({ 0, 0, 1260, 1360 });
+    EXPECT_TRUE(session->IsQueryStateOutdated());
+    session->PublishQueryState();
+    EXPECT_FALSE(session->IsQueryStateOutdated());
+
+    session->UpdateAvoidArea(sptr<AvoidArea>::MakeSptr(), AvoidAreaType::TYPE_SYSTEM);
+    EXPECT_TRUE(session->IsQueryStateOutdated());
+
+    std::map<AvoidAreaType, AvoidArea> avoidAreas;
+    avoidAreas[AvoidAreaType::TYPE_SYSTEM].topRect_ = { 0, 0, 1260, 100 };
+    session->PublishQueryState(&avoidAreas);
+    EXPECT_FALSE(session->IsQueryStateOutdated());
+    EXPECT_EQ(session->GetQueryState()->avoidAreas_, avoidAreas);
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "session/host/include/session_change_recorder.h"
 
@@ -22,6 +23,7 @@ using namespace testing::ext;
 
 namespace OHOS::Rosen {
 constexpr uint32_t MAX_RECORD_TYPE_SIZE = 10;
+constexpr uint32_t MAX_RING_BUFFER_NUM = 64;
 
 class SessionChangeRecorderTest : public testing::Test {
 public:
@@ -247,5 +249,80 @@ HWTEST_F(SessionChangeRecorderTest, SimplifyDumpInfo, TestSize.Level1)
     SessionChangeRecorder::GetInstance().SimplifyDumpInfo(dumpInfo, "TestSimplifyDumpInfo");
     EXPECT_NE(dumpInfo.size(), 0);
 }
+
+/**
+ * @tc.name: RingBufferReadFrom
+ * @tc.desc: RingBufferReadFrom
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionChangeRecorderTest, RingBufferReadFrom, TestSize.Level1)
+{
+    SessionChangeRingBuffer ringBuffer;
+    std::vector<SessionChangeRecord> records;
+    EXPECT_EQ(ringBuffer.ReadFrom(0, records), 0);
+    EXPECT_EQ(records.size(), 0);
+
+    SessionChangeRecord record;
+    for (uint32_t i = 0; i < SessionChangeRingBuffer::CAPACITY + 10; i++) {
+        record.persistentId_ = static_cast<int32_t>(i);
+        ringBuffer.Push(record);
+    }
+    uint64_t writeIndex = ringBuffer.ReadFrom(0, records);
+    EXPECT_EQ(writeIndex, SessionChangeRingBuffer::CAPACITY + 10);
+    ASSERT_EQ(records.size(), SessionChangeRingBuffer::CAPACITY);
+    EXPECT_EQ(records.front().persistentId_, 10);
+    EXPECT_EQ(records.back().persistentId_, SessionChangeRingBuffer::CAPACITY + 9);
+
+    records.clear();
+    ringBuffer.Push(record);
+    EXPECT_EQ(ringBuffer.ReadFrom(writeIndex, records), writeIndex + 1);
+    EXPECT_EQ(records.size(), 1);
+}
+
+/**
+ * @tc.name: RecordBinarySceneSessionChange
+ * @tc.desc: RecordBinarySceneSessionChange
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionChangeRecorderTest, RecordBinarySceneSessionChange, TestSize.Level1)
+{
+    auto result1 = SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD,
+        789, WmsLogTag::DEFAULT, RecordFormatId::VISIBILITY_CHANGE, 1);
+    EXPECT_EQ(result1, WSError::WS_ERROR_INVALID_PARAM);
+    auto result2 = SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::VISIBLE_RECORD,
+        789, WmsLogTag::WMS_ATTRIBUTE, RecordFormatId::FORMAT_ID_END, 1);
+    EXPECT_EQ(result2, WSError::WS_ERROR_INVALID_PARAM);
+    auto result3 = SessionChangeRecorder::GetInstance().RecordSceneSessionChange(RecordType::ORIENTAION_RECORD,
+        789, WmsLogTag::WMS_ROTATION, RecordFormatId::ORIENTATION_CHANGE, 2, 1);
+    EXPECT_EQ(result3, WSError::WS_OK);
+
+    std::vector<std::string> params = { "789" };
+    std::string dumpInfo;
+    SessionChangeRecorder::GetInstance().GetSceneSessionNeedDumpInfo(params, dumpInfo);
+    EXPECT_NE(dumpInfo.find("Orientation change to 2, animation change to 1"), std::string::npos);
+}
+
+/**
+ * @tc.name: ReleaseThreadRingBuffer
+ * @tc.desc: the ring buffers of exited threads are reused, records of new threads are not dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionChangeRecorderTest, ReleaseThreadRingBuffer, TestSize.Level1)
+{
+    auto& recorder = SessionChangeRecorder::GetInstance();
+    uint64_t droppedRecordNum = recorder.GetDroppedRecordNum();
+    for (uint32_t i = 0; i < MAX_RING_BUFFER_NUM * 2; i++) { // 2: more threads than buffers
+        WSError result = WSError::WS_DO_NOTHING;
+        std::thread recordThread([&recorder, &result] {
+            result = recorder.RecordSceneSessionChange(RecordType::VISIBLE_RECORD, 790, WmsLogTag::WMS_ATTRIBUTE,
+                RecordFormatId::VISIBILITY_CHANGE, 1);
+        });
+        recordThread.join();
+        EXPECT_EQ(result, WSError::WS_OK);
+    }
+    EXPECT_EQ(recorder.GetDroppedRecordNum(), droppedRecordNum);
+    std::lock_guard<std::mutex> lock(recorder.ringBufferMutex_);
+    EXPECT_LE(recorder.ringBuffers_.size(), MAX_RING_BUFFER_NUM);
+}
 }
 } // namespace OHOS::Rosen
\ No newline at end of file
@@ -19,13 +19,52 @@
 #include "session_info.h"
 #include "session/host/include/scene_session.h"
 #include "window_manager_agent.h"
+#include "window_property_change_batch.h"
 #include "zidl/window_manager_agent_interface.h"
+#include "zidl/window_manager_agent_proxy.h"
 
 using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+class PropertyChangeRecordAgent : public WindowManagerAgent {
+public:
+    void NotifyWindowPropertyChange(uint32_t propertyDirtyFlags, const WindowInfoList& windowInfoList) override
+    {
+        notifyCount_++;
+        propertyDirtyFlags_ = propertyDirtyFlags;
+        windowInfoList_ = windowInfoList;
+    }
+
+    uint32_t notifyCount_ = 0;
+    uint32_t propertyDirtyFlags_ = 0;
+    WindowInfoList windowInfoList_;
+};
+
+class FilterRecordAgent : public WindowManagerAgent {
+public:
+    void UpdateWindowVisibilityInfo(const std::vector<sptr<WindowVisibilityInfo>>& visibilityInfos) override
+    {
+        visibilityNotifyCount_++;
+        visibilityInfos_ = visibilityInfos;
+    }
+
+    void UpdateWindowDrawingContentInfo(
+        const std::vector<sptr<WindowDrawingContentInfo>>& windowDrawingContentInfos) override
+    {
+        drawingContentNotifyCount_++;
+        drawingContentInfos_ = windowDrawingContentInfos;
+    }
+
+    uint32_t visibilityNotifyCount_ = 0;
+    std::vector<sptr<WindowVisibilityInfo>> visibilityInfos_;
+    uint32_t drawingContentNotifyCount_ = 0;
+    std::vector<sptr<WindowDrawingContentInfo>> drawingContentInfos_;
+};
+} // namespace
+
 class SessionManagerAgentControllerTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -166,6 +205,84 @@ HWTEST_F(SessionManagerAgentControllerTest, UpdateWindowVisibilityInfo, TestSize
               SessionManagerAgentController::GetInstance().UnregisterWindowManagerAgent(windowManagerAgent, type, pid));
 }
 
+/**
+ * @tc.name: UpdateWindowVisibilityInfoWithFilter
+ * @tc.desc: a filtered agent only receives the matching windows and no call when none matches
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionManagerAgentControllerTest, UpdateWindowVisibilityInfoWithFilter, TestSize.Level1)
+{
+    int32_t pid = 65535;
+    auto& controller = SessionManagerAgentController::GetInstance();
+    WindowManagerAgentType type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY;
+    sptr<FilterRecordAgent> pidAgent = sptr<FilterRecordAgent>::MakeSptr();
+    sptr<FilterRecordAgent> displayAgent = sptr<FilterRecordAgent>::MakeSptr();
+    sptr<FilterRecordAgent> bundleAgent = sptr<FilterRecordAgent>::MakeSptr();
+    sptr<FilterRecordAgent> allAgent = sptr<FilterRecordAgent>::MakeSptr();
+    WindowManagerAgentFilter pidFilter;
+    pidFilter.pids = { 100 };
+    pidFilter.displayIds = { 0 };
+    EXPECT_EQ(WMError::WM_ERROR_INVALID_OPERATION, controller.SetWindowManagerAgentFilter(pidAgent, type, pidFilter));
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(pidAgent, type, pid));
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(displayAgent, type, pid));
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(bundleAgent, type, pid));
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(allAgent, type, pid));
+    EXPECT_EQ(WMError::WM_OK, controller.SetWindowManagerAgentFilter(pidAgent, type, pidFilter));
+    WindowManagerAgentFilter displayFilter;
+    displayFilter.displayIds = { 1 };
+    EXPECT_EQ(WMError::WM_OK, controller.SetWindowManagerAgentFilter(displayAgent, type, displayFilter));
+    WindowManagerAgentFilter bundleFilter;
+    bundleFilter.bundleNames = { "not.visible.bundle" };
+    EXPECT_EQ(WMError::WM_OK, controller.SetWindowManagerAgentFilter(bundleAgent, type, bundleFilter));
+
+    // built by the scene session manager, so the display id comes from the session property
+    auto& ssm = SceneSessionManager::GetInstance();
+    std::vector<sptr<SceneSession>> sessions;
+    std::vector<sptr<WindowVisibilityInfo>> windowVisibilityInfos;
+    std::string visibilityInfo;
+    for (int32_t persistentId = 1; persistentId <= 3; persistentId++) {
+        SessionInfo sessionInfo;
+        sessionInfo.bundleName_ = "UpdateWindowVisibilityInfoWithFilter";
+        sessionInfo.abilityName_ = "UpdateWindowVisibilityInfoWithFilter";
+        auto session = sptr<SceneSession>::MakeSptr(sessionInfo, nullptr);
+        session->persistentId_ = persistentId;
+        session->callingPid_ = persistentId == 2 ? 100 : 200;
+        session->GetSessionProperty()->SetDisplayId(persistentId == 3 ? 1 : 0);
+        ssm.SetSessionVisibilityInfo(session, WindowVisibilityState::WINDOW_VISIBILITY_STATE_NO_OCCLUSION,
+            windowVisibilityInfos, visibilityInfo);
+        sessions.push_back(session);
+    }
+    controller.UpdateWindowVisibilityInfo(windowVisibilityInfos);
+    EXPECT_EQ(pidAgent->visibilityNotifyCount_, 1);
+    ASSERT_EQ(pidAgent->visibilityInfos_.size(), 1);
+    EXPECT_EQ(pidAgent->visibilityInfos_[0]->windowId_, 2);
+    EXPECT_EQ(displayAgent->visibilityNotifyCount_, 1);
+    ASSERT_EQ(displayAgent->visibilityInfos_.size(), 1);
+    EXPECT_EQ(displayAgent->visibilityInfos_[0]->windowId_, 3);
+    EXPECT_EQ(bundleAgent->visibilityNotifyCount_, 0);
+    EXPECT_EQ(allAgent->visibilityNotifyCount_, 1);
+    EXPECT_EQ(allAgent->visibilityInfos_.size(), 3);
+
+    // the info sent when the window is destroyed carries its display id too
+    sessions[2]->SetRSVisible(true);
+    ssm.WindowDestroyNotifyVisibility(sessions[2]);
+    EXPECT_EQ(displayAgent->visibilityNotifyCount_, 2);
+    ASSERT_EQ(displayAgent->visibilityInfos_.size(), 1);
+    EXPECT_EQ(displayAgent->visibilityInfos_[0]->GetDisplayId(), 1);
+    EXPECT_EQ(pidAgent->visibilityNotifyCount_, 1);
+
+    // an empty filter turns the agent back to receiving every window
+    EXPECT_EQ(WMError::WM_OK, controller.SetWindowManagerAgentFilter(bundleAgent, type, WindowManagerAgentFilter()));
+    controller.UpdateWindowVisibilityInfo(windowVisibilityInfos);
+    EXPECT_EQ(bundleAgent->visibilityNotifyCount_, 1);
+    EXPECT_EQ(bundleAgent->visibilityInfos_.size(), 3);
+
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(pidAgent, type, pid));
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(displayAgent, type, pid));
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(bundleAgent, type, pid));
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(allAgent, type, pid));
+}
+
 /**
  * @tc.name: UpdateVisibleWindowNum
  * @tc.desc: UpdateVisibleWindowNum Test
@@ -198,6 +315,42 @@ HWTEST_F(SessionManagerAgentControllerTest, UpdateWindowDrawingContentInfo, Test
               SessionManagerAgentController::GetInstance().RegisterWindowManagerAgent(windowManagerAgent, type, pid));
 }
 
+/**
+ * @tc.name: UpdateWindowDrawingContentInfoWithFilter
+ * @tc.desc: drawing content entries are filtered by pid and window id only
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionManagerAgentControllerTest, UpdateWindowDrawingContentInfoWithFilter, TestSize.Level1)
+{
+    int32_t pid = 65535;
+    auto& controller = SessionManagerAgentController::GetInstance();
+    WindowManagerAgentType type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE;
+    sptr<FilterRecordAgent> agent = sptr<FilterRecordAgent>::MakeSptr();
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(agent, type, pid));
+    WindowManagerAgentFilter filter;
+    filter.windowIds = { 1, 3 };
+    filter.bundleNames = { "ignored.for.drawing.content" };
+    EXPECT_EQ(WMError::WM_OK, controller.SetWindowManagerAgentFilter(agent, type, filter));
+
+    std::vector<sptr<WindowDrawingContentInfo>> windowDrawingContentInfos;
+    for (uint32_t windowId = 1; windowId <= 3; windowId++) {
+        windowDrawingContentInfos.push_back(sptr<WindowDrawingContentInfo>::MakeSptr(windowId, 100, 0, true,
+            WindowType::WINDOW_TYPE_APP_MAIN_WINDOW));
+    }
+    controller.UpdateWindowDrawingContentInfo(windowDrawingContentInfos);
+    EXPECT_EQ(agent->drawingContentNotifyCount_, 1);
+    ASSERT_EQ(agent->drawingContentInfos_.size(), 2);
+    EXPECT_EQ(agent->drawingContentInfos_[0]->windowId_, 1);
+    EXPECT_EQ(agent->drawingContentInfos_[1]->windowId_, 3);
+
+    // the filter is dropped along with the agent
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(agent, type, pid));
+    ASSERT_EQ(WMError::WM_OK, controller.RegisterWindowManagerAgent(agent, type, pid));
+    controller.UpdateWindowDrawingContentInfo(windowDrawingContentInfos);
+    EXPECT_EQ(agent->drawingContentInfos_.size(), 3);
+    EXPECT_EQ(WMError::WM_OK, controller.UnregisterWindowManagerAgent(agent, type, pid));
+}
+
 /**
  * @tc.name: UpdateCameraWindowStatus
  * @tc.desc: UpdateCameraWindowStatus Test
@@ -272,6 +425,94 @@ HWTEST_F(SessionManagerAgentControllerTest, NotifyWindowPropertyChange01, TestSi
               SessionManagerAgentController::GetInstance().UnregisterWindowManagerAgent(windowManagerAgent, type, pid));
 }
 
+/**
+ * @tc.name: NotifyWindowPropertyChangeBatch
+ * @tc.desc: the batch sent by the agent proxy is decoded by the agent stub as the window info list
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionManagerAgentControllerTest, NotifyWindowPropertyChangeBatch, TestSize.Level1)
+{
+    int32_t pid = 65535;
+    sptr<PropertyChangeRecordAgent> agent = sptr<PropertyChangeRecordAgent>::MakeSptr();
+    sptr<IWindowManagerAgent> agentProxy = sptr<WindowManagerAgentProxy>::MakeSptr(agent->AsObject());
+    WindowManagerAgentType type = WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_PROPERTY;
+    ASSERT_EQ(WMError::WM_OK,
+              SessionManagerAgentController::GetInstance().RegisterWindowManagerAgent(agentProxy, type, pid));
+
+    WindowPropertyChangeBatch batch;
+    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(batch);
+    EXPECT_EQ(agent->notifyCount_, 0);
+
+    uint32_t presentKeys = static_cast<uint32_t>(WindowInfoKey::WINDOW_ID) |
+        static_cast<uint32_t>(WindowInfoKey::BUNDLE_NAME) | static_cast<uint32_t>(WindowInfoKey::WINDOW_RECT) |
+        static_cast<uint32_t>(WindowInfoKey::WINDOW_MODE_INFO);
+    batch.AddPropertyDirtyFlags(static_cast<uint32_t>(WindowInfoKey::WINDOW_RECT));
+    for (int32_t windowId = 1; windowId <= 2; windowId++) {
+        auto& record = batch.AddRecord();
+        record.presentKeys_ = presentKeys;
+        record.windowId_ = windowId;
+        record.bundleNameIndex_ = batch.InternString("NotifyWindowPropertyChangeBatch");
+        record.rect_ = { windowId, windowId, 100, 200 };
+        record.modeInfo_.windowMode = WindowMode::WINDOW_MODE_SPLIT_PRIMARY;
+    }
+    EXPECT_EQ(batch.GetRecords()[0].bundleNameIndex_, batch.GetRecords()[1].bundleNameIndex_);
+    SessionManagerAgentController::GetInstance().NotifyWindowPropertyChange(batch);
+    EXPECT_EQ(agent->notifyCount_, 1);
+    EXPECT_EQ(agent->propertyDirtyFlags_, static_cast<uint32_t>(WindowInfoKey::WINDOW_RECT));
+    ASSERT_EQ(agent->windowInfoList_.size(), 2);
+    auto& windowInfo = agent->windowInfoList_[1];
+    EXPECT_EQ(windowInfo.size(), 4);
+    EXPECT_EQ(std::get<uint32_t>(windowInfo[WindowInfoKey::WINDOW_ID]), 2);
+    EXPECT_EQ(std::get<std::string>(windowInfo[WindowInfoKey::BUNDLE_NAME]), "NotifyWindowPropertyChangeBatch");
+    Rect rect = { 2, 2, 100, 200 };
+    EXPECT_EQ(std::get<Rect>(windowInfo[WindowInfoKey::WINDOW_RECT]), rect);
+    EXPECT_EQ(std::get<WindowModeInfo>(windowInfo[WindowInfoKey::WINDOW_MODE_INFO]).windowMode,
+        WindowMode::WINDOW_MODE_SPLIT_PRIMARY);
+    EXPECT_EQ(WMError::WM_OK,
+              SessionManagerAgentController::GetInstance().UnregisterWindowManagerAgent(agentProxy, type, pid));
+}
+
+/**
+ * @tc.name: WindowPropertyChangeBatchUnmarshalling
+ * @tc.desc: the fixed-layout records are read back, a name index out of the string table is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionManagerAgentControllerTest, WindowPropertyChangeBatchUnmarshalling, TestSize.Level1)
+{
+    WindowPropertyChangeBatch batch;
+    batch.AddPropertyDirtyFlags(static_cast<uint32_t>(WindowInfoKey::DISPLAY_ID));
+    auto& record = batch.AddRecord();
+    record.presentKeys_ = static_cast<uint32_t>(WindowInfoKey::ABILITY_NAME) |
+        static_cast<uint32_t>(WindowInfoKey::DISPLAY_ID);
+    record.abilityNameIndex_ = batch.InternString("WindowPropertyChangeBatchUnmarshalling");
+    record.displayId_ = 10;
+    Parcel parcel;
+    ASSERT_TRUE(batch.Marshalling(parcel));
+
+    WindowPropertyChangeBatch readBatch;
+    ASSERT_TRUE(readBatch.Unmarshalling(parcel));
+    EXPECT_EQ(readBatch.GetPropertyDirtyFlags(), static_cast<uint32_t>(WindowInfoKey::DISPLAY_ID));
+    ASSERT_EQ(readBatch.GetRecords().size(), 1);
+    WindowInfoList windowInfoList;
+    readBatch.ToWindowInfoList(windowInfoList);
+    ASSERT_EQ(windowInfoList.size(), 1);
+    EXPECT_EQ(windowInfoList[0].size(), 2);
+    EXPECT_EQ(std::get<std::string>(windowInfoList[0][WindowInfoKey::ABILITY_NAME]),
+        "WindowPropertyChangeBatchUnmarshalling");
+    EXPECT_EQ(std::get<uint64_t>(windowInfoList[0][WindowInfoKey::DISPLAY_ID]), 10);
+
+    record.abilityNameIndex_ = 1;
+    Parcel invalidParcel;
+    ASSERT_TRUE(batch.Marshalling(invalidParcel));
+    EXPECT_FALSE(readBatch.Unmarshalling(invalidParcel));
+
+    Parcel truncatedParcel;
+    truncatedParcel.WriteUint32(0);
+    truncatedParcel.WriteUint32(0);
+    truncatedParcel.WriteUint32(1);
+    EXPECT_FALSE(readBatch.Unmarshalling(truncatedParcel));
+}
+
 /**
  * @tc.name: NotifySupportRotationChange
  * @tc.desc: NotifySupportRotationChange Test
@@ -519,6 +519,35 @@ HWTEST_F(SessionStageStubTest, HandleUpdateAvoidArea, TestSize.Level1)
     ASSERT_EQ(ERR_INVALID_VALUE, sessionStageStub_->OnRemoteRequest(code, data, reply, option));
 }
 
+/**
+ * @tc.name: HandleUpdateAvoidAreaWithRect
+ * @tc.desc: the avoid area is handled only with the rect it is computed for
+ * @tc.type: FUNC
+ */
+HWTEST_F(SessionStageStubTest, HandleUpdateAvoidAreaWithRect, TestSize.Level1)
+{
+    ASSERT_TRUE((sessionStageStub_ != nullptr));
+    uint32_t code = static_cast<uint32_t>(SessionStageInterfaceCode::TRANS_ID_UPDATE_AVOID_AREA);
+    sptr<AvoidArea> avoidArea = sptr<AvoidArea>::MakeSptr();
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    data.WriteInterfaceToken(SessionStageStub::GetDescriptor());
+    data.WriteStrongParcelable(avoidArea);
+    data.WriteUint32(static_cast<uint32_t>(AvoidAreaType::TYPE_SYSTEM));
+    EXPECT_EQ(ERR_INVALID_VALUE, sessionStageStub_->OnRemoteRequest(code, data, reply, option));
+
+    MessageParcel rectData;
+    rectData.WriteInterfaceToken(SessionStageStub::GetDescriptor());
+    rectData.WriteStrongParcelable(avoidArea);
+    rectData.WriteUint32(static_cast<uint32_t>(AvoidAreaType::TYPE_SYSTEM));
+    rectData.WriteInt32(0);
+    rectData.WriteInt32(0);
+    rectData.WriteUint32(1260);
+    rectData.WriteUint32(2720);
+    EXPECT_EQ(ERR_NONE, sessionStageStub_->OnRemoteRequest(code, rectData, reply, option));
+}
+
 /**
  * @tc.name: HandleNotifyScreenshot
  * @tc.desc: test function : HandleNotifyScreenshot
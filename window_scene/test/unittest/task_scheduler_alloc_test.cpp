@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+
+#include "common/include/task_scheduler.h"
+#include "mock/mock_alloc_counter.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t POST_NUM = 1000;
+constexpr int64_t DELAY_TIME_MS = 60 * 1000; // keep tasks queued while counting
+// growth of the containers in the event queue, which is not per post
+constexpr uint64_t ALLOC_TOLERANCE = 16;
+const std::string LEGACY_TASK_NAME = "allocLegacyTask";
+const std::string HANDLER_TASK_NAME = "wms:allocHandlerTask";
+}
+
+class TaskSchedulerAllocTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        taskScheduler_ = std::make_shared<TaskScheduler>("allocTestThread");
+    }
+    void TearDown() override
+    {
+        if (taskScheduler_ == nullptr) {
+            return;
+        }
+        taskScheduler_->RemoveTask(LEGACY_TASK_NAME);
+        taskScheduler_->RemoveTask(WMS_TASK_NAME("allocInternedTask"));
+        taskScheduler_->GetEventHandler()->RemoveTask(HANDLER_TASK_NAME);
+        taskScheduler_ = nullptr;
+    }
+
+    std::shared_ptr<TaskScheduler> taskScheduler_;
+};
+
+namespace {
+/**
+ * @tc.name: TaskFunctorInline
+ * @tc.desc: small callable is stored inline without allocation
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerAllocTest, TaskFunctorInline, TestSize.Level1)
+{
+    int32_t value = 0;
+    MockAllocCounter::StartThreadCounting();
+    TaskFunctor functor([&value, this] { value = taskScheduler_ == nullptr ? 0 : 1; });
+    TaskFunctor movedFunctor(std::move(functor));
+    movedFunctor();
+    uint64_t allocCount = MockAllocCounter::StopThreadCounting();
+    EXPECT_EQ(allocCount, 0);
+    EXPECT_EQ(value, 1);
+    EXPECT_FALSE(functor);
+    EXPECT_TRUE(movedFunctor.IsStoredInline());
+
+    std::array<char, TaskFunctor::INLINE_SIZE + 1> largeCapture = {};
+    TaskFunctor largeFunctor([largeCapture] {});
+    EXPECT_FALSE(largeFunctor.IsStoredInline());
+}
+
+/**
+ * @tc.name: PostAllocCount
+ * @tc.desc: interned task allocates no more per post than posting to the event handler directly
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerAllocTest, PostAllocCount, TestSize.Level1)
+{
+    int32_t value = 0;
+    auto handler = taskScheduler_->GetEventHandler();
+    // warm up the task slot pool and the event queue
+    for (uint32_t i = 0; i < POST_NUM; i++) {
+        taskScheduler_->PostAsyncTask([&value] { value++; }, WMS_TASK_NAME("allocInternedTask"),
+            TaskLane::LAYOUT, DELAY_TIME_MS);
+    }
+    taskScheduler_->RemoveTask(WMS_TASK_NAME("allocInternedTask"));
+
+    MockAllocCounter::StartThreadCounting();
+    for (uint32_t i = 0; i < POST_NUM; i++) {
+        handler->PostTask([&value] { value++; }, HANDLER_TASK_NAME, DELAY_TIME_MS,
+            AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    }
+    uint64_t handlerAllocCount = MockAllocCounter::StopThreadCounting();
+
+    MockAllocCounter::StartThreadCounting();
+    for (uint32_t i = 0; i < POST_NUM; i++) {
+        taskScheduler_->PostAsyncTask([&value] { value++; }, LEGACY_TASK_NAME, DELAY_TIME_MS);
+    }
+    uint64_t legacyAllocCount = MockAllocCounter::StopThreadCounting();
+
+    MockAllocCounter::StartThreadCounting();
+    for (uint32_t i = 0; i < POST_NUM; i++) {
+        taskScheduler_->PostAsyncTask([&value] { value++; }, WMS_TASK_NAME("allocInternedTask"),
+            TaskLane::LAYOUT, DELAY_TIME_MS);
+    }
+    uint64_t internedAllocCount = MockAllocCounter::StopThreadCounting();
+
+    GTEST_LOG_(INFO) << "alloc per post, event handler: " << static_cast<double>(handlerAllocCount) / POST_NUM
+        << ", string name: " << static_cast<double>(legacyAllocCount) / POST_NUM
+        << ", interned name: " << static_cast<double>(internedAllocCount) / POST_NUM;
+    EXPECT_LE(internedAllocCount, handlerAllocCount + ALLOC_TOLERANCE);
+    EXPECT_LT(internedAllocCount, legacyAllocCount);
+    EXPECT_EQ(value, 0);
+}
+
+/**
+ * @tc.name: PooledTaskOutlivesScheduler
+ * @tc.desc: pooled task still queued in the event handler is dropped after the scheduler is released
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerAllocTest, PooledTaskOutlivesScheduler, TestSize.Level1)
+{
+    constexpr int64_t shortDelayTimeMs = 10;
+    std::atomic<int32_t> value { 0 };
+    auto handler = taskScheduler_->GetEventHandler();
+    taskScheduler_->PostAsyncTask([&value] { value++; }, WMS_TASK_NAME("allocReleasedTask"),
+        TaskLane::LAYOUT, shortDelayTimeMs);
+    taskScheduler_->PostAsyncTask([&value] { value++; }, WMS_TASK_NAME("allocRemovedTask"),
+        TaskLane::LAYOUT, DELAY_TIME_MS);
+    taskScheduler_ = nullptr;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(shortDelayTimeMs * 5));
+    EXPECT_EQ(value.load(), 0);
+    handler->RemoveTask(WMS_TASK_NAME("allocRemovedTask").GetQueueName());
+    handler = nullptr;
+    EXPECT_EQ(value.load(), 0);
+}
+
+/**
+ * @tc.name: PostWithoutSharedOwner
+ * @tc.desc: scheduler not owned by shared_ptr still runs the tasks, move-only callable included
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerAllocTest, PostWithoutSharedOwner, TestSize.Level1)
+{
+    TaskScheduler taskScheduler("allocNoOwnerThread");
+    std::atomic<int32_t> value { 0 };
+    auto movedValue = std::make_unique<int32_t>(2);
+    taskScheduler.PostAsyncTask([&value] { value++; }, WMS_TASK_NAME("allocNoOwnerTask"));
+    taskScheduler.PostAsyncTask([&value, movedValue = std::move(movedValue)] { value += *movedValue; },
+        WMS_TASK_NAME("allocNoOwnerMoveOnlyTask"), TaskLane::BACKGROUND);
+    int32_t result = taskScheduler.PostSyncTask([&value] { return value.load(); }, "allocNoOwnerSyncTask");
+    EXPECT_EQ(result, 3);
+}
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -14,7 +14,10 @@
  */
 
 #include "common/include/task_scheduler.h"
+#include <condition_variable>
 #include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
 
 using namespace testing;
 using namespace testing::ext;
@@ -155,6 +158,113 @@ HWTEST_F(TaskSchedulerTest, ExecuteExportTask, TestSize.Level1)
     taskScheduler->ExecuteExportTask();
     ASSERT_EQ(taskScheduler->exportFuncMap_.size(), 0);
 }
+
+/**
+ * @tc.name: PostLaneTask
+ * @tc.desc: PostLaneTask counts queue depth per lane only when lane mode is enabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostLaneTask, TestSize.Level1)
+{
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>("threadName");
+    auto taskFunc = []() {};
+    constexpr int64_t delayTime = 1000;
+    taskScheduler->PostLaneTask(taskFunc, "backgroundTask", TaskLane::BACKGROUND, delayTime);
+    EXPECT_FALSE(taskScheduler->IsLaneModeEnabled());
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::BACKGROUND), 0);
+    taskScheduler->RemoveTask("backgroundTask");
+
+    taskScheduler->SetLaneModeEnabled(true);
+    taskScheduler->PostLaneTask(taskFunc, "backgroundTask", TaskLane::BACKGROUND, delayTime);
+    taskScheduler->PostLaneTask(taskFunc, "backgroundTask", TaskLane::BACKGROUND, delayTime);
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::BACKGROUND), 2);
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::INPUT_CRITICAL), 0);
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::LANE_END), 0);
+
+    taskScheduler->RemoveTask("backgroundTask");
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::BACKGROUND), 0);
+    EXPECT_EQ(taskScheduler->laneStats_[static_cast<size_t>(TaskLane::BACKGROUND)].maxQueueDepth_.load(), 2);
+}
+
+/**
+ * @tc.name: PostLaneTask02
+ * @tc.desc: async input tasks run first and async background tasks run last, layout and sync tasks keep post order
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostLaneTask02, TestSize.Level1)
+{
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>("threadName");
+    taskScheduler->SetLaneModeEnabled(true);
+    std::vector<TaskLane> executedLanes;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isStarted = false;
+    bool isBlocked = true;
+    taskScheduler->PostLaneTask([&mutex, &cv, &isStarted, &isBlocked] {
+        std::unique_lock<std::mutex> lock(mutex);
+        isStarted = true;
+        cv.notify_all();
+        cv.wait(lock, [&isBlocked] { return !isBlocked; });
+    }, "blockTask", TaskLane::LAYOUT);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&isStarted] { return isStarted; });
+    }
+    taskScheduler->PostLaneTask([&executedLanes] { executedLanes.push_back(TaskLane::BACKGROUND); },
+        "backgroundTask", TaskLane::BACKGROUND);
+    taskScheduler->PostLaneTask([&executedLanes] { executedLanes.push_back(TaskLane::INPUT_CRITICAL); },
+        "inputTask", TaskLane::INPUT_CRITICAL);
+    taskScheduler->PostLaneTask([&executedLanes] { executedLanes.push_back(TaskLane::LAYOUT); },
+        "layoutTask", TaskLane::LAYOUT);
+    // sync tasks posted from the main thread are VIP, so post from another thread to check the queue order
+    std::thread syncThread([taskScheduler, &executedLanes] {
+        taskScheduler->PostSyncTask([&executedLanes] {
+            executedLanes.push_back(TaskLane::INPUT_CRITICAL);
+            return 0;
+        }, "syncInputTask", TaskLane::INPUT_CRITICAL);
+    });
+    while (taskScheduler->GetLaneQueueDepth(TaskLane::INPUT_CRITICAL) < 2) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isBlocked = false;
+    }
+    cv.notify_all();
+    syncThread.join();
+    ASSERT_EQ(executedLanes.size(), 4);
+    EXPECT_EQ(executedLanes[0], TaskLane::INPUT_CRITICAL);
+    EXPECT_EQ(executedLanes[1], TaskLane::LAYOUT);
+    EXPECT_EQ(executedLanes[2], TaskLane::INPUT_CRITICAL);
+    EXPECT_EQ(executedLanes[3], TaskLane::BACKGROUND);
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::INPUT_CRITICAL), 0);
+
+    std::ostringstream oss;
+    taskScheduler->DumpLaneInfo(oss);
+    EXPECT_NE(oss.str().find("lane:background"), std::string::npos);
+}
+
+/**
+ * @tc.name: PostLaneTask03
+ * @tc.desc: sync lane task returns the result of the task and leaves its lane
+ * @tc.type: FUNC
+ */
+HWTEST_F(TaskSchedulerTest, PostLaneTask03, TestSize.Level1)
+{
+    std::shared_ptr<TaskScheduler> taskScheduler = std::make_shared<TaskScheduler>("threadName");
+    int32_t result = taskScheduler->PostSyncTask([] { return 1; }, "syncTask", TaskLane::BACKGROUND);
+    EXPECT_EQ(result, 1);
+    EXPECT_EQ(taskScheduler->laneStats_[static_cast<size_t>(TaskLane::BACKGROUND)].postCount_.load(), 0);
+
+    taskScheduler->SetLaneModeEnabled(true);
+    std::thread syncThread([taskScheduler, &result] {
+        result = taskScheduler->PostSyncTask([] { return 2; }, "syncTask", TaskLane::BACKGROUND);
+    });
+    syncThread.join();
+    EXPECT_EQ(result, 2);
+    EXPECT_EQ(taskScheduler->laneStats_[static_cast<size_t>(TaskLane::BACKGROUND)].postCount_.load(), 1);
+    EXPECT_EQ(taskScheduler->GetLaneQueueDepth(TaskLane::BACKGROUND), 0);
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
@@ -15,6 +15,9 @@
 
 #include "common/include/extension_data_handler.h"
 
+#include <cstring>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <message_parcel.h>
 #include <want.h>
@@ -25,6 +28,45 @@ using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Rosen::Extension {
+namespace {
+constexpr uint32_t TEST_CHANNEL_CAPACITY = 1024;
+constexpr uint32_t LARGE_PAYLOAD_SIZE = 128 * 1024;
+// the limit of the payloads consumed ahead of the first pending one
+constexpr size_t MAX_COMPLETED_RANGE_NUM = 256;
+
+/**
+ * @brief Handler delivering the sent parcel to its peer in the same process, as the IPC would.
+ */
+class LoopbackDataHandler : public DataHandler {
+public:
+    DataHandlerErr SendData(const AAFwk::Want& toSend, AAFwk::Want& reply, const DataTransferConfig& config) override
+    {
+        MessageParcel sendParcel;
+        DataChannelRange range;
+        auto err = PrepareSendData(sendParcel, config, toSend, range);
+        if (err != DataHandlerErr::OK) {
+            return err;
+        }
+        isChannelUsed_ = (range.length != 0);
+        if (config.isChannelSetup) {
+            channelSetupCount_++;
+        }
+        MessageParcel replyParcel;
+        peer_->NotifyDataConsumer(sendParcel, replyParcel);
+        return ParseReply(replyParcel, reply, config);
+    }
+
+    bool WriteInterfaceToken(MessageParcel& data) override
+    {
+        return true;
+    }
+
+    DataHandler* peer_ = nullptr;
+    bool isChannelUsed_ = false;
+    uint32_t channelSetupCount_ = 0;
+};
+} // namespace
+
 class ExtensionDataHandlerTest : public testing::Test {
 public:
     static void SetUpTestCase() {}
@@ -62,6 +104,8 @@ HWTEST_F(ExtensionDataHandlerTest, DataTransferConfigUnmarshalling01, TestSize.L
     parcel.WriteUint32(123);
     parcel.WriteBool(true);
     parcel.WriteBool(false);
+    parcel.WriteBool(true);
+    parcel.WriteBool(false);
 
     auto config = DataTransferConfig::Unmarshalling(parcel);
     ASSERT_NE(nullptr, config);
@@ -69,6 +113,8 @@ HWTEST_F(ExtensionDataHandlerTest, DataTransferConfigUnmarshalling01, TestSize.L
     ASSERT_EQ(123u, config->customId);
     ASSERT_TRUE(config->needReply);
     ASSERT_FALSE(config->needSyncSend);
+    ASSERT_TRUE(config->useSharedMemory);
+    ASSERT_FALSE(config->isChannelSetup);
     delete config;
 }
 
@@ -263,4 +309,166 @@ HWTEST_F(ExtensionDataHandlerTest, NotifyDataConsumer03, TestSize.Level1)
     auto ret = handler.NotifyDataConsumer(std::move(data), reply, config);
     ASSERT_EQ(DataHandlerErr::NO_CONSUME_CALLBACK, ret);
 }
+
+/**
+ * @tc.name: DataChannelWriteRead
+ * @tc.desc: the receiver reads what the sender wrote, a full ring rejects the write until space is given back
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExtensionDataHandlerTest, DataChannelWriteRead, TestSize.Level1)
+{
+    auto sender = DataChannel::Create(TEST_CHANNEL_CAPACITY);
+    ASSERT_NE(nullptr, sender);
+    auto receiver = DataChannel::Map(sender->GetAshmem());
+    ASSERT_NE(nullptr, receiver);
+    ASSERT_EQ(TEST_CHANNEL_CAPACITY, receiver->GetCapacity());
+
+    std::vector<uint8_t> payload(600, 0x5a);
+    DataChannelRange range;
+    ASSERT_TRUE(sender->Write(payload.data(), payload.size(), range));
+    DataChannelRange fullRange;
+    ASSERT_FALSE(sender->Write(payload.data(), payload.size(), fullRange));
+
+    Parcel parcel;
+    ASSERT_TRUE(receiver->Read(range, parcel));
+    const uint8_t* readData = parcel.ReadBuffer(payload.size());
+    ASSERT_NE(nullptr, readData);
+    ASSERT_EQ(0, memcmp(readData, payload.data(), payload.size()));
+    receiver->Complete(range);
+
+    // the payload does not fit at the tail of the ring, so it starts over from the head
+    DataChannelRange wrappedRange;
+    ASSERT_TRUE(sender->Write(payload.data(), payload.size(), wrappedRange));
+    ASSERT_EQ(range.end, wrappedRange.begin);
+    ASSERT_EQ(TEST_CHANNEL_CAPACITY + payload.size(), wrappedRange.end);
+
+    DataChannelRange invalidRange { 0, 2 * TEST_CHANNEL_CAPACITY, 1 };
+    ASSERT_FALSE(receiver->Read(invalidRange, parcel));
+}
+
+/**
+ * @tc.name: DataChannelCompleteOutOfOrder
+ * @tc.desc: the space is given back only up to the first payload not consumed yet
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExtensionDataHandlerTest, DataChannelCompleteOutOfOrder, TestSize.Level1)
+{
+    auto sender = DataChannel::Create(TEST_CHANNEL_CAPACITY);
+    ASSERT_NE(nullptr, sender);
+    auto receiver = DataChannel::Map(sender->GetAshmem());
+    ASSERT_NE(nullptr, receiver);
+
+    std::vector<uint8_t> payload(TEST_CHANNEL_CAPACITY / 4, 0x5a);
+    std::vector<DataChannelRange> ranges(3);
+    for (auto& range : ranges) {
+        ASSERT_TRUE(sender->Write(payload.data(), payload.size(), range));
+    }
+    receiver->Complete(ranges[2]);
+    receiver->Complete(ranges[1]);
+    std::vector<uint8_t> largePayload(TEST_CHANNEL_CAPACITY / 2, 0x5a);
+    DataChannelRange largeRange;
+    ASSERT_FALSE(sender->Write(largePayload.data(), largePayload.size(), largeRange));
+
+    receiver->Complete(ranges[0]);
+    ASSERT_TRUE(sender->Write(largePayload.data(), largePayload.size(), largeRange));
+
+    // an undelivered payload at the tail is taken back
+    DataChannelRange lastRange;
+    ASSERT_TRUE(sender->Write(payload.data(), payload.size(), lastRange));
+    sender->Cancel(lastRange);
+    DataChannelRange reusedRange;
+    ASSERT_TRUE(sender->Write(payload.data(), payload.size(), reusedRange));
+    ASSERT_EQ(lastRange.begin, reusedRange.begin);
+}
+
+/**
+ * @tc.name: DataChannelCompleteInvalidRange
+ * @tc.desc: ranges out of the ring, overlapping a consumed one or beyond the limit are not recorded
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExtensionDataHandlerTest, DataChannelCompleteInvalidRange, TestSize.Level1)
+{
+    auto sender = DataChannel::Create(TEST_CHANNEL_CAPACITY);
+    ASSERT_NE(nullptr, sender);
+    auto receiver = DataChannel::Map(sender->GetAshmem());
+    ASSERT_NE(nullptr, receiver);
+
+    std::vector<uint8_t> payload(TEST_CHANNEL_CAPACITY / 4, 0x5a);
+    std::vector<DataChannelRange> ranges(3);
+    for (auto& range : ranges) {
+        ASSERT_TRUE(sender->Write(payload.data(), payload.size(), range));
+    }
+    DataChannelRange outOfRingRange { TEST_CHANNEL_CAPACITY, TEST_CHANNEL_CAPACITY + payload.size(),
+                                      static_cast<uint32_t>(payload.size()) };
+    receiver->Complete(outOfRingRange);
+    ASSERT_TRUE(receiver->completedRanges_.empty());
+
+    receiver->Complete(ranges[2]);
+    receiver->Complete(ranges[2]);
+    DataChannelRange overlappedRange { ranges[1].begin + 1, ranges[2].begin + 1, 1 };
+    receiver->Complete(overlappedRange);
+    ASSERT_EQ(1, receiver->completedRanges_.size());
+
+    receiver->Complete(ranges[1]);
+    receiver->Complete(ranges[0]);
+    ASSERT_TRUE(receiver->completedRanges_.empty());
+    ASSERT_EQ(ranges[2].end, receiver->readPos_);
+
+    // a peer completing many tiny ranges ahead of the first pending one is cut off
+    uint64_t begin = receiver->readPos_ + 1;
+    for (uint32_t i = 0; i < TEST_CHANNEL_CAPACITY / 2; i++) {
+        receiver->Complete({ begin + i, begin + i + 1, 1 });
+    }
+    ASSERT_EQ(MAX_COMPLETED_RANGE_NUM, receiver->completedRanges_.size());
+}
+
+/**
+ * @tc.name: SendDataByChannel
+ * @tc.desc: large wants go through the shared memory channel, small ones through the parcel
+ * @tc.type: FUNC
+ */
+HWTEST_F(ExtensionDataHandlerTest, SendDataByChannel, TestSize.Level1)
+{
+    LoopbackDataHandler host;
+    LoopbackDataHandler provider;
+    host.peer_ = &provider;
+    provider.peer_ = &host;
+
+    std::string received;
+    auto callback = [&received](SubSystemId id, uint32_t customId, AAFwk::Want&& data,
+                                std::optional<AAFwk::Want>& reply) -> int32_t {
+        received = data.GetStringParam("payload");
+        if (reply.has_value()) {
+            reply->SetParam("size", static_cast<int32_t>(received.size()));
+        }
+        return 0;
+    };
+    ASSERT_EQ(DataHandlerErr::OK, provider.RegisterDataConsumer(SubSystemId::WM_UIEXT, std::move(callback)));
+
+    AAFwk::Want largeWant;
+    largeWant.SetParam("payload", std::string(LARGE_PAYLOAD_SIZE, 'a'));
+    AAFwk::Want reply;
+    ASSERT_EQ(DataHandlerErr::OK, host.SendDataSync(SubSystemId::WM_UIEXT, 1, largeWant, reply));
+    ASSERT_TRUE(host.isChannelUsed_);
+    ASSERT_EQ(LARGE_PAYLOAD_SIZE, received.size());
+    ASSERT_EQ(static_cast<int32_t>(LARGE_PAYLOAD_SIZE), reply.GetIntParam("size", 0));
+    // the ashmem was sent once by the setup message before the first payload
+    ASSERT_EQ(1, host.channelSetupCount_);
+    ASSERT_NE(nullptr, provider.recvChannel_);
+
+    // the ring is given back after each message, so it is reused far beyond its capacity
+    for (uint32_t i = 0; i < 64; i++) {
+        received.clear();
+        ASSERT_EQ(DataHandlerErr::OK, host.SendDataSync(SubSystemId::WM_UIEXT, 1, largeWant));
+        ASSERT_TRUE(host.isChannelUsed_);
+        ASSERT_EQ(LARGE_PAYLOAD_SIZE, received.size());
+    }
+    ASSERT_EQ(1, host.channelSetupCount_);
+
+    AAFwk::Want smallWant;
+    smallWant.SetParam("payload", std::string("small"));
+    ASSERT_EQ(DataHandlerErr::OK, host.SendDataSync(SubSystemId::WM_UIEXT, 1, smallWant));
+    ASSERT_FALSE(host.isChannelUsed_);
+    ASSERT_EQ("small", received);
+}
 } // namespace OHOS::Rosen::Extension
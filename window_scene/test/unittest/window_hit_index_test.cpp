@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "common/include/session_helper.h"
+#include "window_hit_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t RANDOM_SEED = 20260301;
+constexpr int32_t WINDOW_COUNT = 200;
+constexpr int32_t QUERY_COUNT = 2000;
+constexpr int32_t DISPLAY_WIDTH = 2560;
+constexpr int32_t DISPLAY_HEIGHT = 1600;
+constexpr DisplayId SECOND_DISPLAY_ID = 1;
+
+bool IsHitByBruteForce(const WindowHitInfo& info, int32_t x, int32_t y, WindowHitMode mode)
+{
+    if (mode == WindowHitMode::RECT || info.hotAreas_.empty()) {
+        return SessionHelper::IsPointInRect(x, y, SessionHelper::TransferToRect(info.rect_));
+    }
+    for (const auto& hotArea : info.hotAreas_) {
+        if (SessionHelper::IsPointInRect(x, y, SessionHelper::TransferToRect(hotArea))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// walk all windows from top to bottom, as the session tree traversal does
+std::vector<int32_t> QueryByBruteForce(const std::map<int32_t, WindowHitInfo>& windows, DisplayId displayId,
+    int32_t x, int32_t y, WindowHitMode mode)
+{
+    std::vector<std::pair<uint32_t, int32_t>> hits;
+    for (const auto& [persistentId, info] : windows) {
+        if (info.displayId_ == displayId && IsHitByBruteForce(info, x, y, mode)) {
+            hits.emplace_back(info.zOrder_, persistentId);
+        }
+    }
+    std::sort(hits.rbegin(), hits.rend());
+    std::vector<int32_t> persistentIds;
+    for (const auto& hit : hits) {
+        persistentIds.push_back(hit.second);
+    }
+    return persistentIds;
+}
+
+WindowHitInfo CreateRandomInfo(std::mt19937& engine)
+{
+    std::uniform_int_distribution<int32_t> posDist(-200, DISPLAY_WIDTH);
+    std::uniform_int_distribution<int32_t> sizeDist(1, 1200);
+    std::uniform_int_distribution<uint32_t> zOrderDist(0, 50);
+    std::uniform_int_distribution<int32_t> hotAreaCountDist(0, 3);
+    WindowHitInfo info;
+    info.displayId_ = engine() % 4 == 0 ? SECOND_DISPLAY_ID : DEFAULT_DISPLAY_ID;
+    info.zOrder_ = zOrderDist(engine);
+    info.rect_ = { posDist(engine), posDist(engine), sizeDist(engine), sizeDist(engine) };
+    int32_t hotAreaCount = hotAreaCountDist(engine);
+    for (int32_t i = 0; i < hotAreaCount; i++) {
+        info.hotAreas_.push_back({ info.rect_.posX_ + static_cast<int32_t>(engine() % info.rect_.width_),
+            info.rect_.posY_ + static_cast<int32_t>(engine() % info.rect_.height_), sizeDist(engine) / 4 + 1,
+            sizeDist(engine) / 4 + 1 });
+    }
+    return info;
+}
+} // namespace
+
+class WindowHitIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+/**
+ * @tc.name: QueryTopmost
+ * @tc.desc: the topmost hit follows zOrder and the rect edges
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowHitIndexTest, QueryTopmost, TestSize.Level1)
+{
+    WindowHitIndex index;
+    WindowHitInfo bottom = { DEFAULT_DISPLAY_ID, 1, { 0, 0, 1000, 1000 }, {} };
+    WindowHitInfo top = { DEFAULT_DISPLAY_ID, 2, { 500, 500, 300, 300 }, { { 500, 500, 10, 10 } } };
+    EXPECT_TRUE(index.Update(1, bottom));
+    EXPECT_TRUE(index.Update(2, top));
+    EXPECT_FALSE(index.Update(2, top));
+    EXPECT_EQ(2, index.Size());
+
+    EXPECT_EQ(2, index.QueryTopmost(DEFAULT_DISPLAY_ID, 600, 600));
+    EXPECT_EQ(1, index.QueryTopmost(DEFAULT_DISPLAY_ID, 600, 600, WindowHitMode::HOT_AREA));
+    EXPECT_EQ(2, index.QueryTopmost(DEFAULT_DISPLAY_ID, 505, 505, WindowHitMode::HOT_AREA));
+    EXPECT_EQ(1, index.QueryTopmost(DEFAULT_DISPLAY_ID, 100, 100));
+    EXPECT_EQ(INVALID_SESSION_ID, index.QueryTopmost(DEFAULT_DISPLAY_ID, 2000, 100));
+    EXPECT_EQ(INVALID_SESSION_ID, index.QueryTopmost(SECOND_DISPLAY_ID, 600, 600));
+    std::vector<int32_t> expectIds = { 2, 1 };
+    EXPECT_EQ(expectIds, index.QueryAll(DEFAULT_DISPLAY_ID, 600, 600));
+
+    top.zOrder_ = 0;
+    EXPECT_TRUE(index.Update(2, top));
+    EXPECT_EQ(1, index.QueryTopmost(DEFAULT_DISPLAY_ID, 600, 600));
+    top.displayId_ = SECOND_DISPLAY_ID;
+    EXPECT_TRUE(index.Update(2, top));
+    EXPECT_EQ(2, index.QueryTopmost(SECOND_DISPLAY_ID, 600, 600));
+    index.Remove(2);
+    EXPECT_FALSE(index.Contains(2));
+    EXPECT_EQ(INVALID_SESSION_ID, index.QueryTopmost(SECOND_DISPLAY_ID, 600, 600));
+    index.Clear();
+    EXPECT_EQ(0, index.Size());
+}
+
+/**
+ * @tc.name: NegativeAndOversizedRect
+ * @tc.desc: windows with negative coordinates or covering too many cells are hit
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowHitIndexTest, NegativeAndOversizedRect, TestSize.Level1)
+{
+    WindowHitIndex index(1);
+    WindowHitInfo negative = { DEFAULT_DISPLAY_ID, 2, { -100, -100, 50, 50 }, {} };
+    WindowHitInfo oversized = { DEFAULT_DISPLAY_ID, 1, { 0, 0, 100, 100 }, {} };
+    WindowHitInfo empty = { DEFAULT_DISPLAY_ID, 3, { 0, 0, 0, 0 }, {} };
+    index.Update(1, oversized);
+    index.Update(2, negative);
+    index.Update(3, empty);
+    EXPECT_EQ(2, index.QueryTopmost(DEFAULT_DISPLAY_ID, -90, -90));
+    EXPECT_EQ(INVALID_SESSION_ID, index.QueryTopmost(DEFAULT_DISPLAY_ID, -1, -1));
+    EXPECT_EQ(1, index.QueryTopmost(DEFAULT_DISPLAY_ID, 50, 50));
+    EXPECT_EQ(1, index.QueryTopmost(DEFAULT_DISPLAY_ID, 0, 0));
+    index.Remove(1);
+    EXPECT_EQ(INVALID_SESSION_ID, index.QueryTopmost(DEFAULT_DISPLAY_ID, 50, 50));
+}
+
+/**
+ * @tc.name: ConsistentWithBruteForce
+ * @tc.desc: random windows, updates and removals give the same hits as walking all windows
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowHitIndexTest, ConsistentWithBruteForce, TestSize.Level1)
+{
+    std::mt19937 engine(RANDOM_SEED);
+    WindowHitIndex index;
+    std::map<int32_t, WindowHitInfo> windows;
+    for (int32_t persistentId = 1; persistentId <= WINDOW_COUNT; persistentId++) {
+        windows[persistentId] = CreateRandomInfo(engine);
+        index.Update(persistentId, windows[persistentId]);
+    }
+    std::uniform_int_distribution<int32_t> idDist(1, WINDOW_COUNT);
+    std::uniform_int_distribution<int32_t> xDist(-300, DISPLAY_WIDTH + 300);
+    std::uniform_int_distribution<int32_t> yDist(-300, DISPLAY_HEIGHT + 300);
+    for (int32_t i = 0; i < QUERY_COUNT; i++) {
+        // mutate the windows as flushes do
+        int32_t persistentId = idDist(engine);
+        if (engine() % 5 == 0) {
+            windows.erase(persistentId);
+            index.Remove(persistentId);
+        } else {
+            windows[persistentId] = CreateRandomInfo(engine);
+            index.Update(persistentId, windows[persistentId]);
+        }
+        ASSERT_EQ(windows.size(), index.Size());
+        int32_t x = xDist(engine);
+        int32_t y = yDist(engine);
+        for (auto displayId : { DEFAULT_DISPLAY_ID, SECOND_DISPLAY_ID }) {
+            for (auto mode : { WindowHitMode::RECT, WindowHitMode::HOT_AREA }) {
+                auto expectIds = QueryByBruteForce(windows, displayId, x, y, mode);
+                ASSERT_EQ(expectIds, index.QueryAll(displayId, x, y, mode)) << "x:" << x << " y:" << y;
+                ASSERT_EQ(expectIds.empty() ? INVALID_SESSION_ID : expectIds.front(),
+                    index.QueryTopmost(displayId, x, y, mode));
+            }
+        }
+    }
+}
+}
+} // namespace Rosen
+} // namespace OHOS
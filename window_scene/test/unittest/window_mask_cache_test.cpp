@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "window_mask_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int32_t MASK_WIDTH = 4;
+constexpr int32_t MASK_HEIGHT = 2;
+constexpr uint32_t MASK_PIXEL_NUM = MASK_WIDTH * MASK_HEIGHT;
+
+std::shared_ptr<Media::PixelMap> CreateMask(uint32_t color, int32_t width = MASK_WIDTH)
+{
+    uint32_t colors[MASK_PIXEL_NUM];
+    for (auto& pixel : colors) {
+        pixel = color;
+    }
+    Media::InitializationOptions opts;
+    opts.size.width = width;
+    opts.size.height = MASK_HEIGHT;
+    opts.pixelFormat = Media::PixelFormat::RGBA_8888;
+    opts.alphaType = Media::AlphaType::IMAGE_ALPHA_TYPE_OPAQUE;
+    return Media::PixelMap::Create(colors, static_cast<uint32_t>(width * MASK_HEIGHT), 0, width, opts);
+}
+
+bool IsContentHashed(const std::shared_ptr<Media::PixelMap>& mask)
+{
+    auto& cache = WindowMaskCache::GetInstance();
+    auto range = cache.masks_.equal_range(WindowMaskCache::HashLayout(*mask));
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second.mask_.lock() == mask) {
+            return iter->second.hasContentHash_;
+        }
+    }
+    return false;
+}
+} // namespace
+
+class WindowMaskCacheTest : public testing::Test {
+public:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: InternSameContent
+ * @tc.desc: a mask with the same pixels gets the instance already interned
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowMaskCacheTest, InternSameContent, TestSize.Level1)
+{
+    auto& cache = WindowMaskCache::GetInstance();
+    auto mask = CreateMask(0xff0000ff);
+    auto sameMask = CreateMask(0xff0000ff);
+    ASSERT_NE(mask, nullptr);
+    ASSERT_NE(sameMask, nullptr);
+    ASSERT_NE(mask, sameMask);
+    EXPECT_EQ(WindowMaskCache::HashContent(*mask), WindowMaskCache::HashContent(*sameMask));
+    EXPECT_TRUE(WindowMaskCache::IsSameContent(*mask, *sameMask));
+
+    auto internedMask = cache.Intern(mask);
+    EXPECT_EQ(internedMask, mask);
+    EXPECT_EQ(cache.Intern(sameMask), mask);
+    EXPECT_EQ(cache.Intern(mask), mask);
+}
+
+/**
+ * @tc.name: InternChangedContent
+ * @tc.desc: a mask with other pixels is kept as it is
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowMaskCacheTest, InternChangedContent, TestSize.Level1)
+{
+    auto& cache = WindowMaskCache::GetInstance();
+    auto mask = CreateMask(0xff0000ff);
+    auto changedMask = CreateMask(0x00ff00ff);
+    ASSERT_NE(mask, nullptr);
+    ASSERT_NE(changedMask, nullptr);
+    EXPECT_FALSE(WindowMaskCache::IsSameContent(*mask, *changedMask));
+
+    EXPECT_EQ(cache.Intern(mask), mask);
+    EXPECT_EQ(cache.Intern(changedMask), changedMask);
+    EXPECT_EQ(cache.Intern(nullptr), nullptr);
+}
+
+/**
+ * @tc.name: ReleaseMask
+ * @tc.desc: a mask no window holds any more is dropped from the cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowMaskCacheTest, ReleaseMask, TestSize.Level1)
+{
+    auto& cache = WindowMaskCache::GetInstance();
+    size_t size = cache.Size();
+    auto mask = CreateMask(0x0000ffff);
+    ASSERT_NE(mask, nullptr);
+    cache.Intern(mask);
+    EXPECT_EQ(cache.Size(), size + 1);
+    mask.reset();
+    EXPECT_EQ(cache.Size(), size);
+
+    auto newMask = CreateMask(0x0000ffff);
+    EXPECT_EQ(cache.Intern(newMask), newMask);
+}
+
+/**
+ * @tc.name: InternNewLayout
+ * @tc.desc: the pixels of a mask are only hashed once a mask of the same layout is interned
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowMaskCacheTest, InternNewLayout, TestSize.Level1)
+{
+    auto& cache = WindowMaskCache::GetInstance();
+    constexpr int32_t newLayoutWidth = MASK_WIDTH - 1;
+    auto mask = CreateMask(0x00ffffff, newLayoutWidth);
+    auto otherLayoutMask = CreateMask(0x00ffffff);
+    ASSERT_NE(mask, nullptr);
+    ASSERT_NE(otherLayoutMask, nullptr);
+    EXPECT_FALSE(WindowMaskCache::IsSameLayout(*mask, *otherLayoutMask));
+    EXPECT_FALSE(WindowMaskCache::IsSameContent(*mask, *otherLayoutMask));
+
+    EXPECT_EQ(cache.Intern(mask), mask);
+    EXPECT_FALSE(IsContentHashed(mask));
+    EXPECT_EQ(cache.Intern(mask), mask);
+    EXPECT_FALSE(IsContentHashed(mask));
+
+    auto sameMask = CreateMask(0x00ffffff, newLayoutWidth);
+    ASSERT_NE(sameMask, nullptr);
+    EXPECT_EQ(cache.Intern(sameMask), mask);
+    EXPECT_TRUE(IsContentHashed(mask));
+}
+} // namespace Rosen
+} // namespace OHOS
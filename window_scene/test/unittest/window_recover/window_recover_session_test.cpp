@@ -580,7 +580,7 @@ HWTEST_F(WindowRecoverSessionTest, RecoverCachedSubSession, TestSize.Level1)
     parentInfo.bundleName_ = "ParentSession";
     parentInfo.abilityName_ = "ParentSession";
     sptr<SceneSession> parentSession = sptr<SceneSession>::MakeSptr(parentInfo, nullptr);
-    ssm_->sceneSessionMap_[123] = parentSession;
+    ssm_->sceneSessionMap_.insert_or_assign(123, parentSession);
     NotifyCreateSubSessionFunc func = [](const sptr<SceneSession>& session, bool isBoundedSystemTray) {};
     ssm_->createSubSessionFuncMap_[123] = func;
 
@@ -936,6 +936,65 @@ HWTEST_F(WindowSessionPropertyTest, SetKeyboardTouchHotAreas, TestSize.Level1)
     property->SetKeyboardTouchHotAreas(hotAreas);
 }
 
+/**
+ * @tc.name: GetTouchHotAreaBuffer
+ * @tc.desc: the buffer is shared until the hot areas change
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowSessionPropertyTest, GetTouchHotAreaBuffer, TestSize.Level1)
+{
+    sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
+    auto emptyBuffer = property->GetTouchHotAreaBuffer();
+    ASSERT_NE(nullptr, emptyBuffer);
+    EXPECT_TRUE(emptyBuffer->Empty());
+    EXPECT_NE(0, emptyBuffer->GetVersion());
+
+    std::vector<Rect> rects{ { 1, 2, 3, 4 }, { 5, 6, 7, 8 } };
+    property->SetTouchHotAreas(rects);
+    auto buffer = property->GetTouchHotAreaBuffer();
+    ASSERT_EQ(2, buffer->Size());
+    EXPECT_NE(emptyBuffer->GetVersion(), buffer->GetVersion());
+    EXPECT_EQ(rects[1], buffer->GetRect(1));
+    EXPECT_EQ(rects, buffer->ToRects());
+    EXPECT_EQ(buffer, property->GetTouchHotAreaBuffer());
+
+    property->SetTouchHotAreas(rects);
+    EXPECT_EQ(buffer, property->GetTouchHotAreaBuffer());
+    rects.pop_back();
+    property->SetTouchHotAreas(rects);
+    auto newBuffer = property->GetTouchHotAreaBuffer();
+    EXPECT_NE(buffer->GetVersion(), newBuffer->GetVersion());
+    EXPECT_EQ(1, newBuffer->Size());
+    EXPECT_EQ(2, buffer->Size());
+}
+
+/**
+ * @tc.name: GetKeyboardHotAreaBuffer
+ * @tc.desc: each keyboard hot area buffer is replaced only when its own hot areas change
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowSessionPropertyTest, GetKeyboardHotAreaBuffer, TestSize.Level1)
+{
+    sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
+    KeyboardTouchHotAreas hotAreas;
+    hotAreas.landscapeKeyboardHotAreas_.push_back({ 1, 1, 1, 1 });
+    hotAreas.portraitPanelHotAreas_.push_back({ 2, 2, 2, 2 });
+    hotAreas.displayId_ = 1;
+    property->SetKeyboardTouchHotAreas(hotAreas);
+    EXPECT_EQ(1, property->GetKeyboardTouchHotAreasDisplayId());
+    auto landscapeKeyboard = property->GetKeyboardHotAreaBuffer(false, true);
+    auto portraitPanel = property->GetKeyboardHotAreaBuffer(true, false);
+    EXPECT_EQ(hotAreas.landscapeKeyboardHotAreas_, landscapeKeyboard->ToRects());
+    EXPECT_EQ(hotAreas.portraitPanelHotAreas_, portraitPanel->ToRects());
+    EXPECT_TRUE(property->GetKeyboardHotAreaBuffer(false, false)->Empty());
+    EXPECT_TRUE(property->GetKeyboardHotAreaBuffer(true, true)->Empty());
+
+    hotAreas.portraitPanelHotAreas_.push_back({ 3, 3, 3, 3 });
+    property->SetKeyboardTouchHotAreas(hotAreas);
+    EXPECT_EQ(landscapeKeyboard, property->GetKeyboardHotAreaBuffer(false, true));
+    EXPECT_EQ(2, property->GetKeyboardHotAreaBuffer(true, false)->Size());
+}
+
 /**
  * @tc.name: UnmarshallingWindowLimits
  * @tc.desc: UnmarshallingWindowLimits test
@@ -1066,6 +1125,33 @@ HWTEST_F(WindowSessionPropertyTest, CopyFrom, TestSize.Level1)
     ASSERT_EQ(windowSessionProperty.GetWindowName(), name);
 }
 
+/**
+ * @tc.name: CopyFromHotAreas
+ * @tc.desc: CopyFrom copies the hot areas and rebuilds the hot area buffers, also when copying itself
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowSessionPropertyTest, CopyFromHotAreas, TestSize.Level1)
+{
+    sptr<WindowSessionProperty> property = sptr<WindowSessionProperty>::MakeSptr();
+    std::vector<Rect> rects{ { 1, 2, 3, 4 } };
+    property->SetTouchHotAreas(rects);
+    KeyboardTouchHotAreas keyboardHotAreas;
+    keyboardHotAreas.landscapeKeyboardHotAreas_.push_back({ 5, 6, 7, 8 });
+    property->SetKeyboardTouchHotAreas(keyboardHotAreas);
+
+    sptr<WindowSessionProperty> copied = sptr<WindowSessionProperty>::MakeSptr();
+    auto oldBuffer = copied->GetTouchHotAreaBuffer();
+    copied->CopyFrom(property);
+    EXPECT_NE(oldBuffer, copied->GetTouchHotAreaBuffer());
+    EXPECT_EQ(rects, copied->GetTouchHotAreaBuffer()->ToRects());
+    EXPECT_EQ(keyboardHotAreas.landscapeKeyboardHotAreas_, copied->GetKeyboardHotAreaBuffer(false, true)->ToRects());
+
+    auto buffer = property->GetTouchHotAreaBuffer();
+    property->CopyFrom(property);
+    EXPECT_NE(buffer, property->GetTouchHotAreaBuffer());
+    EXPECT_EQ(rects, property->GetTouchHotAreaBuffer()->ToRects());
+}
+
 /**
  * @tc.name: SetFocusable
  * @tc.desc: SetFocusable and GetFocusable to check the value
@@ -77,6 +77,8 @@ public:
         const sptr<IWindowManagerAgent>& windowManagerAgent);
     virtual WMError RegisterWindowPropertyChangeAgent(WindowInfoKey windowInfoKey, uint32_t interestInfo,
         const sptr<IWindowManagerAgent>& windowManagerAgent);
+    virtual WMError SetWindowManagerAgentFilter(WindowManagerAgentType type, const WindowManagerAgentFilter& filter,
+        const sptr<IWindowManagerAgent>& windowManagerAgent);
     virtual WMError UnregisterWindowPropertyChangeAgent(WindowInfoKey windowInfoKey, uint32_t interestInfo,
         const sptr<IWindowManagerAgent>& windowManagerAgent);
     virtual WMError CheckWindowId(int32_t windowId, int32_t& pid);
@@ -322,6 +324,9 @@ private:
 
     // Note: Currently, sptr does not support unordered_map<T, unordered_set<sptr<T>>>.
     std::unordered_map<WindowManagerAgentType, std::set<sptr<IWindowManagerAgent>>> windowManagerAgentMap_;
+    // filters set on the agents, sent again on recovery
+    std::unordered_map<WindowManagerAgentType, std::pair<sptr<IWindowManagerAgent>, WindowManagerAgentFilter>>
+        windowManagerAgentFilterMap_;
     std::mutex wmAgentMapMutex_;
     std::unordered_map<WindowManagerAgentType, std::set<sptr<IWindowManagerAgent>>> windowManagerAgentFaultMap_;
     std::mutex wmFaultAgentMapMutex_;
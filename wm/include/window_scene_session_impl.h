@@ -660,6 +660,7 @@ private:
     std::atomic<bool> forceLimits_ = false;
     uint32_t setSameSystembarPropertyCnt_ = 0;
     std::atomic<uint32_t> getAvoidAreaCnt_ = 0;
+    std::atomic<uint32_t> getAvoidAreaCacheHitCnt_ = 0;
     std::atomic<bool> enableImmersiveMode_ = false;
     std::atomic<bool> cacheEnableImmersiveMode_ = false;
     std::atomic<bool> maximizeLayoutFullScreen_ = false;
@@ -613,7 +613,8 @@ public:
     WMError SetAvoidAreaOption(uint32_t avoidAreaOption) override;
     WMError GetAvoidAreaOption(uint32_t& avoidAreaOption) override;
     void NotifyAvoidAreaChange(const sptr<AvoidArea>& avoidArea, AvoidAreaType type);
-    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type) override;
+    WSError UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type,
+        const WSRect& rect = WSRect::EMPTY_RECT) override;
     bool IsSystemWindow() const override { return WindowHelper::IsSystemWindow(GetType()); }
     bool IsAppWindow() const override { return WindowHelper::IsAppWindow(GetType()); }
     WindowType GetRootHostWindowType() const override { return rootHostWindowType_; }
@@ -1103,11 +1104,30 @@ protected:
     virtual void UpdateDefaultStatusBarColor() { return; }
     WMError UpdateStatusBarColorByColorMode(uint32_t& contentColor);
     std::map<AvoidAreaType, AvoidArea> lastAvoidAreaMap_;
+    bool GetAvoidAreaFromCache(AvoidAreaType type, const Rect& rect, AvoidArea& avoidArea);
+    uint64_t GetAvoidAreaCacheVersion();
+    void UpdateAvoidAreaCache(AvoidAreaType type, const AvoidArea& avoidArea, const Rect& rect, uint64_t version);
+    void UpdateAvoidAreaCache(const std::map<AvoidAreaType, AvoidArea>& avoidAreas, const Rect& rect);
+    void SetAvoidAreaCacheEnabled(bool enabled);
+    void InvalidateAvoidAreaCache();
     uint32_t GetStatusBarHeight() const override;
     WindowType rootHostWindowType_ = WindowType::APP_MAIN_WINDOW_BASE;
     SystemBarSettingFlag systemBarSettingFlag_ = SystemBarSettingFlag::DEFAULT_SETTING;
     std::atomic<bool> floatNavigationAvoidAreaEnabled_ = false;
     std::atomic<bool> notifyOnceImmediately_ = true;
+    struct AvoidAreaCacheItem {
+        AvoidArea avoidArea_;
+        // window rect the avoid area is calculated for
+        Rect rect_;
+    };
+    /*
+     * Only trusted while the server pushes avoid area changes, i.e. an avoid area listener is registered,
+     * the version changes with every push or invalidation so a stale query result is not cached.
+     */
+    std::mutex avoidAreaCacheMutex_;
+    bool isAvoidAreaCacheEnabled_ = false;
+    uint64_t avoidAreaCacheVersion_ = 0;
+    std::map<AvoidAreaType, AvoidAreaCacheItem> avoidAreaCache_;
 
     /*
      * PC Fold Screen
@@ -22,6 +22,8 @@
 
 namespace OHOS {
 namespace Rosen {
+class WindowPropertyChangeBatch;
+
 class IWindowManagerAgent : public IRemoteBroker {
 public:
     DECLARE_INTERFACE_DESCRIPTOR(u"OHOS.IWindowManagerAgent");
@@ -47,6 +49,7 @@ public:
         TRANS_ID_NOTIFY_WINDOW_SUPPORT_ROTATION_CHANGE,
         TRANS_ID_NOTIFY_DISPLAY_GROUP_INFO_CHANGE,
         TRANS_ID_NOTIFY_SESSION_SAVE_SNAPSHOT_COMPLETE,
+        TRANS_ID_NOTIFY_WINDOW_PROPERTY_CHANGE_BATCH,
     };
 
     virtual void UpdateFocusChangeInfo(const sptr<FocusChangeInfo>& focusChangeInfo, bool focused) = 0;
@@ -69,6 +72,7 @@ public:
     virtual void NotifyWindowSystemBarPropertyChange(WindowType type, const SystemBarProperty& systemBarProperty) = 0;
     virtual void UpdatePiPWindowStateChanged(const std::string& bundleName, bool isForeground) = 0;
     virtual void NotifyWindowPropertyChange(uint32_t propertyDirtyFlags, const WindowInfoList& windowInfoList) = 0;
+    virtual void NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch) = 0;
     virtual void NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo) = 0;
     virtual void NotifySessionSaveSnapShotComplete(int32_t persistentId) = 0;
 };
@@ -47,6 +47,7 @@ public:
     void NotifyWindowSystemBarPropertyChange(WindowType type, const SystemBarProperty& systemBarProperty) override;
     void UpdatePiPWindowStateChanged(const std::string& bundleName, bool isForeground) override;
     void NotifyWindowPropertyChange(uint32_t propertyDirtyFlags, const WindowInfoList& windowInfoList) override;
+    void NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch) override;
     void NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo) override;
     void NotifySessionSaveSnapShotComplete(int32_t persistentId) override;
 
@@ -29,6 +29,12 @@ public:
     virtual int OnRemoteRequest(uint32_t code, MessageParcel& data, MessageParcel& reply,
         MessageOption& option) override;
 
+    /**
+     * @brief Called on a local agent, hand the batch to the window info list overload.
+     */
+    void NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch) override;
+    using IWindowManagerAgent::NotifyWindowPropertyChange;
+
 private:
     bool ReadWindowInfoList(MessageParcel& data, WindowInfoList& windowInfoList);
     bool ReadWindowInfo(MessageParcel& data, std::unordered_map<WindowInfoKey, WindowChangeInfoType>& windowInfo);
@@ -40,7 +40,8 @@ DataHandlerErr ProviderDataHandler::SendData(const AAFwk::Want& toSend, AAFwk::W
 
     MessageParcel sendParcel;
     MessageOption option(config.needSyncSend ? MessageOption::TF_SYNC : MessageOption::TF_ASYNC);
-    auto err = PrepareSendData(sendParcel, config, toSend);
+    DataChannelRange range;
+    auto err = PrepareSendData(sendParcel, config, toSend, range);
     if (err != DataHandlerErr::OK) {
         return err;
     }
@@ -49,6 +50,7 @@ DataHandlerErr ProviderDataHandler::SendData(const AAFwk::Want& toSend, AAFwk::W
     auto ret = proxy->SendExtensionData(sendParcel, replyParcel, option);
     if (ret != WSError::WS_OK) {
         TLOGE(WmsLogTag::WMS_UIEXT, "SendExtensionData failed, %{public}s", config.ToString().c_str());
+        CancelSendData(range);
         return DataHandlerErr::IPC_SEND_FAILED;
     }
 
@@ -228,6 +228,10 @@ WMError WindowAdapter::UnregisterWindowManagerAgent(WindowManagerAgentType type,
     {
         std::lock_guard<std::mutex> lock(wmAgentMapMutex_);
         windowManagerAgentMap_[type].erase(windowManagerAgent);
+        auto filterIter = windowManagerAgentFilterMap_.find(type);
+        if (filterIter != windowManagerAgentFilterMap_.end() && filterIter->second.first == windowManagerAgent) {
+            windowManagerAgentFilterMap_.erase(filterIter);
+        }
     }
     {
         std::lock_guard<std::mutex> lock(wmFaultAgentMapMutex_);
@@ -269,6 +273,27 @@ WMError WindowAdapter::RegisterWindowPropertyChangeAgent(WindowInfoKey windowInf
     return ret;
 }
 
+WMError WindowAdapter::SetWindowManagerAgentFilter(WindowManagerAgentType type,
+    const WindowManagerAgentFilter& filter, const sptr<IWindowManagerAgent>& windowManagerAgent)
+{
+    INIT_PROXY_CHECK_RETURN(WMError::WM_ERROR_SAMGR);
+    auto wmsProxy = GetWindowManagerServiceProxy();
+    CHECK_PROXY_RETURN_ERROR_IF_NULL(wmsProxy, WMError::WM_ERROR_SAMGR);
+    auto ret = wmsProxy->SetWindowManagerAgentFilter(type, filter, windowManagerAgent);
+    if (ret != WMError::WM_OK) {
+        TLOGW(WmsLogTag::WMS_ATTRIBUTE, "Set filter failed, type: %{public}u, ret: %{public}d",
+            static_cast<uint32_t>(type), static_cast<int32_t>(ret));
+        return ret;
+    }
+    std::lock_guard<std::mutex> lock(wmAgentMapMutex_);
+    if (filter.IsEmpty()) {
+        windowManagerAgentFilterMap_.erase(type);
+    } else {
+        windowManagerAgentFilterMap_[type] = { windowManagerAgent, filter };
+    }
+    return ret;
+}
+
 WMError WindowAdapter::UnregisterWindowPropertyChangeAgent(WindowInfoKey windowInfoKey,
     uint32_t interestInfo, const sptr<IWindowManagerAgent>& windowManagerAgent)
 {
@@ -763,6 +788,8 @@ void WindowAdapter::ReregisterWindowManagerAgent()
     CHECK_PROXY_RETURN_IF_NULL(wmsProxy);
 
     std::vector<std::pair<WindowManagerAgentType, sptr<IWindowManagerAgent>>> agentsToRegister;
+    std::unordered_map<WindowManagerAgentType, std::pair<sptr<IWindowManagerAgent>, WindowManagerAgentFilter>>
+        filtersToSet;
     {
         std::lock_guard<std::mutex> lock(wmAgentMapMutex_);
         for (const auto& [type, agents] : windowManagerAgentMap_) {
@@ -771,12 +798,18 @@ void WindowAdapter::ReregisterWindowManagerAgent()
                 agentsToRegister.emplace_back(type, agent);
             }
         }
+        filtersToSet = windowManagerAgentFilterMap_;
     }
     for (const auto& [type, agent] : agentsToRegister) {
         if (wmsProxy->RegisterWindowManagerAgent(type, agent, userId_) != WMError::WM_OK) {
             TLOGE(WmsLogTag::WMS_RECOVER, "Register failed due to wms proxy, type: %{public}" PRIu32, type);
         }
     }
+    for (const auto& [type, agentFilter] : filtersToSet) {
+        if (wmsProxy->SetWindowManagerAgentFilter(type, agentFilter.second, agentFilter.first) != WMError::WM_OK) {
+            TLOGE(WmsLogTag::WMS_RECOVER, "Set filter failed due to wms proxy, type: %{public}" PRIu32, type);
+        }
+    }
 
     // Note: Recover the window manager agent which were registered failed during the SCB is starting.
     {
@@ -82,6 +82,32 @@ public:
     static inline SingletonDelegator<WindowManager> delegator_;
     template<typename T>
     using ListenerSet = std::unordered_set<sptr<T>, SptrHash<T>>;
+    template<typename T>
+    using ListenerFilterMap = std::unordered_map<sptr<T>, WindowManagerAgentFilter, SptrHash<T>>;
+
+    template<typename T>
+    static WindowManagerAgentFilter GetAgentFilter(const ListenerSet<T>& listeners,
+        const ListenerFilterMap<T>& listenerFilters)
+    {
+        WindowManagerAgentFilter agentFilter;
+        bool isFirst = true;
+        for (const auto& listener : listeners) {
+            auto iter = listenerFilters.find(listener);
+            if (iter == listenerFilters.end()) {
+                // one listener wants all windows
+                return {};
+            }
+            if (isFirst) {
+                agentFilter = iter->second;
+                isFirst = false;
+            } else {
+                agentFilter.Merge(iter->second);
+            }
+        }
+        return agentFilter;
+    }
+    void UpdateAgentFilter(int32_t userId, WindowManagerAgentType type, const sptr<WindowManagerAgent>& agent,
+        const WindowManagerAgentFilter& filter, WindowManagerAgentFilter& sentFilter);
 
     // Attribute
     std::recursive_mutex& mutex_;
@@ -134,6 +160,8 @@ public:
 
     // Window visbility
     ListenerSet<IVisibilityChangedListener> windowVisibilityListeners_;
+    ListenerFilterMap<IVisibilityChangedListener> windowVisibilityListenerFilters_;
+    WindowManagerAgentFilter windowVisibilityAgentFilter_;
     sptr<WindowManagerAgent> windowVisibilityListenerAgent_ = nullptr;
 
     // Window visibility state
@@ -142,6 +170,8 @@ public:
 
     // Window drawing content
     ListenerSet<IDrawingContentChangedListener> windowDrawingContentListeners_;
+    ListenerFilterMap<IDrawingContentChangedListener> windowDrawingContentListenerFilters_;
+    WindowManagerAgentFilter windowDrawingContentAgentFilter_;
     sptr<WindowManagerAgent> windowDrawingContentListenerAgent_ = nullptr;
 
     // Camera float window
@@ -319,16 +349,33 @@ void WindowManager::Impl::NotifyWindowVisibilityInfoChanged(
     const std::vector<sptr<WindowVisibilityInfo>>& windowVisibilityInfos)
 {
     std::vector<sptr<IVisibilityChangedListener>> visibilityChangeListeners;
+    ListenerFilterMap<IVisibilityChangedListener> listenerFilters;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         visibilityChangeListeners.assign(windowVisibilityListeners_.begin(), windowVisibilityListeners_.end());
+        listenerFilters = windowVisibilityListenerFilters_;
     }
     TLOGD(WmsLogTag::WMS_ATTRIBUTE, "size=%{public}u", static_cast<uint32_t>(visibilityChangeListeners.size()));
     for (auto& listener : visibilityChangeListeners) {
-        if (listener != nullptr) {
-            listener->OnWindowVisibilityChanged(windowVisibilityInfos);
-        } else {
+        if (listener == nullptr) {
             TLOGE(WmsLogTag::WMS_ATTRIBUTE, "listener is null.");
+            continue;
+        }
+        auto iter = listenerFilters.find(listener);
+        if (iter == listenerFilters.end()) {
+            listener->OnWindowVisibilityChanged(windowVisibilityInfos);
+            continue;
+        }
+        // the agent receives the union of the filters of all listeners in the process
+        std::vector<sptr<WindowVisibilityInfo>> filteredInfos;
+        for (const auto& info : windowVisibilityInfos) {
+            if (info != nullptr &&
+                iter->second.IsMatched(info->pid_, info->windowId_, info->bundleName_, info->displayId_)) {
+                filteredInfos.push_back(info);
+            }
+        }
+        if (!filteredInfos.empty()) {
+            listener->OnWindowVisibilityChanged(filteredInfos);
         }
     }
 }
@@ -384,17 +431,49 @@ void WindowManager::Impl::NotifyWindowDrawingContentInfoChanged(
     const std::vector<sptr<WindowDrawingContentInfo>>& windowDrawingContentInfos)
 {
     std::vector<sptr<IDrawingContentChangedListener>> windowDrawingContentChangeListeners;
+    ListenerFilterMap<IDrawingContentChangedListener> listenerFilters;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         windowDrawingContentChangeListeners.assign(windowDrawingContentListeners_.begin(),
                                                    windowDrawingContentListeners_.end());
+        listenerFilters = windowDrawingContentListenerFilters_;
     }
     for (auto& listener : windowDrawingContentChangeListeners) {
         WLOGFD("Notify windowDrawingContentInfo to caller");
-        listener->OnWindowDrawingContentChanged(windowDrawingContentInfos);
+        auto iter = listenerFilters.find(listener);
+        if (iter == listenerFilters.end()) {
+            listener->OnWindowDrawingContentChanged(windowDrawingContentInfos);
+            continue;
+        }
+        std::vector<sptr<WindowDrawingContentInfo>> filteredInfos;
+        for (const auto& info : windowDrawingContentInfos) {
+            if (info != nullptr && iter->second.IsWindowMatched(info->pid_, info->windowId_)) {
+                filteredInfos.push_back(info);
+            }
+        }
+        if (!filteredInfos.empty()) {
+            listener->OnWindowDrawingContentChanged(filteredInfos);
+        }
     }
 }
 
+void WindowManager::Impl::UpdateAgentFilter(int32_t userId, WindowManagerAgentType type,
+    const sptr<WindowManagerAgent>& agent, const WindowManagerAgentFilter& filter,
+    WindowManagerAgentFilter& sentFilter)
+{
+    if (agent == nullptr || filter == sentFilter) {
+        return;
+    }
+    // the listeners filter again on their own, so a failure only costs the entries the server could have skipped
+    auto ret = WindowAdapter::GetInstance(userId).SetWindowManagerAgentFilter(type, filter, agent);
+    if (ret != WMError::WM_OK) {
+        TLOGW(WmsLogTag::WMS_ATTRIBUTE, "set filter failed, type: %{public}u, ret: %{public}d",
+            static_cast<uint32_t>(type), static_cast<int32_t>(ret));
+        return;
+    }
+    sentFilter = filter;
+}
+
 void WindowManager::Impl::UpdateCameraFloatWindowStatus(uint32_t accessTokenId, bool isShowing)
 {
     TLOGD(WmsLogTag::DEFAULT,
@@ -1079,6 +1158,12 @@ WMError WindowManager::UnregisterWindowUpdateListener(const sptr<IWindowUpdateLi
 }
 
 WMError WindowManager::RegisterVisibilityChangedListener(const sptr<IVisibilityChangedListener>& listener)
+{
+    return RegisterVisibilityChangedListener(listener, WindowManagerAgentFilter());
+}
+
+WMError WindowManager::RegisterVisibilityChangedListener(const sptr<IVisibilityChangedListener>& listener,
+    const WindowManagerAgentFilter& filter)
 {
     HITRACE_METER_NAME(HITRACE_TAG_WINDOW_MANAGER,
         "CUSTOM_ANIMATOR_WindowManager::RegisterVisibilityChangedListener");
@@ -1106,6 +1191,14 @@ WMError WindowManager::RegisterVisibilityChangedListener(const sptr<IVisibilityC
     }
 
     pImpl_->windowVisibilityListeners_.insert(listener);
+    if (filter.IsEmpty()) {
+        pImpl_->windowVisibilityListenerFilters_.erase(listener);
+    } else {
+        pImpl_->windowVisibilityListenerFilters_[listener] = filter;
+    }
+    pImpl_->UpdateAgentFilter(userId_, agentType, pImpl_->windowVisibilityListenerAgent_,
+        Impl::GetAgentFilter(pImpl_->windowVisibilityListeners_, pImpl_->windowVisibilityListenerFilters_),
+        pImpl_->windowVisibilityAgentFilter_);
     return ret;
 }
 
@@ -1119,6 +1212,7 @@ WMError WindowManager::UnregisterVisibilityChangedListener(const sptr<IVisibilit
     }
     std::lock_guard<std::recursive_mutex> lock(pImpl_->mutex_);
     pImpl_->windowVisibilityListeners_.erase(listener);
+    pImpl_->windowVisibilityListenerFilters_.erase(listener);
 
     WMError ret = WMError::WM_OK;
     if (pImpl_->windowVisibilityListeners_.empty() && pImpl_->windowVisibilityListenerAgent_ != nullptr) {
@@ -1128,7 +1222,13 @@ WMError WindowManager::UnregisterVisibilityChangedListener(const sptr<IVisibilit
         TLOGI(WmsLogTag::WMS_ATTRIBUTE, "ret=%{public}d", ret);
         if (ret == WMError::WM_OK) {
             pImpl_->windowVisibilityListenerAgent_ = nullptr;
+            pImpl_->windowVisibilityAgentFilter_ = {};
         }
+    } else if (!pImpl_->windowVisibilityListeners_.empty()) {
+        pImpl_->UpdateAgentFilter(userId_, WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_VISIBILITY,
+            pImpl_->windowVisibilityListenerAgent_,
+            Impl::GetAgentFilter(pImpl_->windowVisibilityListeners_, pImpl_->windowVisibilityListenerFilters_),
+            pImpl_->windowVisibilityAgentFilter_);
     }
     return ret;
 }
@@ -2327,6 +2427,12 @@ WMError WindowManager::NotifyWindowStyleChange(WindowStyleType type)
 }
 
 WMError WindowManager::RegisterDrawingContentChangedListener(const sptr<IDrawingContentChangedListener>& listener)
+{
+    return RegisterDrawingContentChangedListener(listener, WindowManagerAgentFilter());
+}
+
+WMError WindowManager::RegisterDrawingContentChangedListener(const sptr<IDrawingContentChangedListener>& listener,
+    const WindowManagerAgentFilter& filter)
 {
     if (listener == nullptr) {
         WLOGFE("listener could not be null");
@@ -2350,6 +2456,16 @@ WMError WindowManager::RegisterDrawingContentChangedListener(const sptr<IDrawing
         pImpl_->windowDrawingContentListenerAgent_ = nullptr;
     } else {
         pImpl_->windowDrawingContentListeners_.insert(listener);
+        if (filter.IsEmpty()) {
+            pImpl_->windowDrawingContentListenerFilters_.erase(listener);
+        } else {
+            pImpl_->windowDrawingContentListenerFilters_[listener] = filter;
+        }
+        pImpl_->UpdateAgentFilter(userId_, WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE,
+            pImpl_->windowDrawingContentListenerAgent_,
+            Impl::GetAgentFilter(pImpl_->windowDrawingContentListeners_,
+                pImpl_->windowDrawingContentListenerFilters_),
+            pImpl_->windowDrawingContentAgentFilter_);
     }
     return ret;
 }
@@ -2362,6 +2478,7 @@ WMError WindowManager::UnregisterDrawingContentChangedListener(const sptr<IDrawi
     }
     std::lock_guard<std::recursive_mutex> lock(pImpl_->mutex_);
     pImpl_->windowDrawingContentListeners_.erase(listener);
+    pImpl_->windowDrawingContentListenerFilters_.erase(listener);
 
     WMError ret = WMError::WM_OK;
     if (pImpl_->windowDrawingContentListeners_.empty() && pImpl_->windowDrawingContentListenerAgent_ != nullptr) {
@@ -2370,7 +2487,14 @@ WMError WindowManager::UnregisterDrawingContentChangedListener(const sptr<IDrawi
             pImpl_->windowDrawingContentListenerAgent_);
         if (ret == WMError::WM_OK) {
             pImpl_->windowDrawingContentListenerAgent_ = nullptr;
-        }
+            pImpl_->windowDrawingContentAgentFilter_ = {};
+        }
+    } else if (!pImpl_->windowDrawingContentListeners_.empty()) {
+        pImpl_->UpdateAgentFilter(userId_, WindowManagerAgentType::WINDOW_MANAGER_AGENT_TYPE_WINDOW_DRAWING_STATE,
+            pImpl_->windowDrawingContentListenerAgent_,
+            Impl::GetAgentFilter(pImpl_->windowDrawingContentListeners_,
+                pImpl_->windowDrawingContentListenerFilters_),
+            pImpl_->windowDrawingContentAgentFilter_);
     }
     return ret;
 }
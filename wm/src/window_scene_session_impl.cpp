@@ -3629,10 +3629,21 @@ WMError WindowSceneSessionImpl::GetAvoidAreaByType(AvoidAreaType type, AvoidArea
         TLOGI(WmsLogTag::WMS_IMMS, "win %{public}u type not supported", GetWindowId());
         return WMError::WM_DO_NOTHING;
     }
+    if (GetAvoidAreaFromCache(type, rect, avoidArea)) {
+        getAvoidAreaCacheHitCnt_++;
+        TLOGD(WmsLogTag::WMS_IMMS, "win %{public}u type %{public}d cached times %{public}u area %{public}s",
+            GetWindowId(), type, getAvoidAreaCacheHitCnt_.load(), avoidArea.ToString().c_str());
+        return WMError::WM_OK;
+    }
     auto hostSession = GetHostSession();
     CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_NULLPTR);
+    uint64_t cacheVersion = GetAvoidAreaCacheVersion();
+    Rect windowRect = property_->GetWindowRect();
     WSRect sessionRect = { rect.posX_, rect.posY_, rect.width_, rect.height_ };
     avoidArea = hostSession->GetAvoidAreaByType(type, sessionRect, apiVersion);
+    if (rect == Rect::EMPTY_RECT || rect == windowRect) {
+        UpdateAvoidAreaCache(type, avoidArea, windowRect, cacheVersion);
+    }
     getAvoidAreaCnt_++;
     TLOGI_LMT(TEN_SECONDS, RECORD_100_TIMES, WmsLogTag::WMS_IMMS,
         "win %{public}u type %{public}d times %{public}u area %{public}s",
@@ -1371,6 +1371,7 @@ WSError WindowSessionImpl::UpdateRect(const WSRect& rect, SizeChangeReason reaso
 
     property_->SetWindowRect(wmRect);
     property_->SetRequestRect(wmRect);
+    UpdateAvoidAreaCache(avoidAreas, wmRect);
 
     TLOGI_LMT(TEN_SECONDS, RECORD_100_TIMES, WmsLogTag::WMS_LAYOUT,
         "[WindowRectUpdate:ClientRecv] UpdateRect id:%{public}d name:%{public}s, preRect=%{public}s, "
@@ -2039,6 +2040,7 @@ WSError WindowSessionImpl::UpdateDisplayId(uint64_t displayId)
 {
     TLOGI(WmsLogTag::WMS_ATTRIBUTE, "wid: %{public}d, displayId: %{public}" PRIu64, GetPersistentId(), displayId);
     property_->SetDisplayId(displayId);
+    InvalidateAvoidAreaCache();
     return WSError::WS_OK;
 }
 
@@ -2173,6 +2175,7 @@ bool WindowSessionImpl::IsNotifyInteractiveDuplicative(bool interactive)
 void WindowSessionImpl::NotifyForegroundInteractiveStatus(bool interactive)
 {
     TLOGI(WmsLogTag::WMS_LIFE, "interactive: %{public}d, state: %{public}d", interactive, state_);
+    InvalidateAvoidAreaCache();
     if (IsWindowSessionInvalid() || state_ != WindowState::STATE_SHOWN) {
         return;
     }
@@ -6237,6 +6240,7 @@ WMError WindowSessionImpl::SetWindowContainerModalColor(const std::string& activ
 
 void WindowSessionImpl::NotifyAfterForeground(bool needNotifyListeners, bool needNotifyUiContent, bool waitAttach)
 {
+    InvalidateAvoidAreaCache();
     if (needNotifyListeners) {
         NotifyAfterLifecycleForeground();
         {
@@ -6335,6 +6339,7 @@ void WindowSessionImpl::NotifyAfterDidForeground(uint32_t reason)
 
 void WindowSessionImpl::NotifyAfterBackground(bool needNotifyListeners, bool needNotifyUiContent)
 {
+    InvalidateAvoidAreaCache();
     if (needNotifyListeners) {
         {
             std::lock_guard<std::recursive_mutex> lockListener(lifeCycleListenerMutex_);
@@ -7193,6 +7198,7 @@ WMError WindowSessionImpl::RegisterAvoidAreaChangeListener(const sptr<IAvoidArea
     }
     if (isUpdate) {
         ret = SingletonContainer::Get<WindowAdapter>().UpdateSessionAvoidAreaListener(persistentId, true);
+        SetAvoidAreaCacheEnabled(ret == WMError::WM_OK);
     }
     return ret;
 }
@@ -7219,6 +7225,7 @@ WMError WindowSessionImpl::UnregisterAvoidAreaChangeListener(const sptr<IAvoidAr
         }
     }
     if (isUpdate) {
+        SetAvoidAreaCacheEnabled(false);
         ret = SingletonContainer::Get<WindowAdapter>().UpdateSessionAvoidAreaListener(persistentId, false);
     }
     return ret;
@@ -7288,8 +7295,12 @@ WSErrorCode WindowSessionImpl::NotifyTransferComponentDataSync(const AAFwk::Want
     return WSErrorCode::WS_OK;
 }
 
-WSError WindowSessionImpl::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type)
+WSError WindowSessionImpl::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, AvoidAreaType type, const WSRect& rect)
 {
+    // the window rect may have moved on since the server computed the area, cache it for the server rect only
+    if (avoidArea != nullptr && !rect.IsEmpty()) {
+        UpdateAvoidAreaCache({ { type, *avoidArea } }, { rect.posX_, rect.posY_, rect.width_, rect.height_ });
+    }
     auto task = [weak = wptr(this), avoidArea, type] {
         auto window = weak.promote();
         if (!window) {
@@ -7310,6 +7321,69 @@ WSError WindowSessionImpl::UpdateAvoidArea(const sptr<AvoidArea>& avoidArea, Avo
     return WSError::WS_OK;
 }
 
+bool WindowSessionImpl::GetAvoidAreaFromCache(AvoidAreaType type, const Rect& rect, AvoidArea& avoidArea)
+{
+    Rect windowRect = property_->GetWindowRect();
+    if (rect != Rect::EMPTY_RECT && rect != windowRect) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    // the server stops pushing once the window is not visible or interactive
+    if (!isAvoidAreaCacheEnabled_ || state_ != WindowState::STATE_SHOWN || !interactive_) {
+        return false;
+    }
+    auto iter = avoidAreaCache_.find(type);
+    if (iter == avoidAreaCache_.end() || iter->second.rect_ != windowRect) {
+        return false;
+    }
+    avoidArea = iter->second.avoidArea_;
+    return true;
+}
+
+uint64_t WindowSessionImpl::GetAvoidAreaCacheVersion()
+{
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    return avoidAreaCacheVersion_;
+}
+
+void WindowSessionImpl::UpdateAvoidAreaCache(AvoidAreaType type, const AvoidArea& avoidArea, const Rect& rect,
+    uint64_t version)
+{
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    // pushed or invalidated while querying, the result may be older than the cache
+    if (!isAvoidAreaCacheEnabled_ || version != avoidAreaCacheVersion_) {
+        return;
+    }
+    avoidAreaCache_[type] = { avoidArea, rect };
+}
+
+void WindowSessionImpl::UpdateAvoidAreaCache(const std::map<AvoidAreaType, AvoidArea>& avoidAreas, const Rect& rect)
+{
+    if (avoidAreas.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    avoidAreaCacheVersion_++;
+    for (const auto& [type, avoidArea] : avoidAreas) {
+        avoidAreaCache_[type] = { avoidArea, rect };
+    }
+}
+
+void WindowSessionImpl::SetAvoidAreaCacheEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    isAvoidAreaCacheEnabled_ = enabled;
+    avoidAreaCacheVersion_++;
+    avoidAreaCache_.clear();
+}
+
+void WindowSessionImpl::InvalidateAvoidAreaCache()
+{
+    std::lock_guard<std::mutex> lock(avoidAreaCacheMutex_);
+    avoidAreaCacheVersion_++;
+    avoidAreaCache_.clear();
+}
+
 WMError WindowSessionImpl::SetFloatNavigationAvoidAreaEnabled(bool enable)
 {
     if (IsWindowSessionInvalid()) {
@@ -7318,6 +7392,7 @@ WMError WindowSessionImpl::SetFloatNavigationAvoidAreaEnabled(bool enable)
     }
     TLOGI(WmsLogTag::WMS_IMMS, "win %{public}u enable %{public}u", GetWindowId(), enable);
     floatNavigationAvoidAreaEnabled_ = enable;
+    InvalidateAvoidAreaCache();
     auto hostSession = GetHostSession();
     CHECK_HOST_SESSION_RETURN_ERROR_IF_NULL(hostSession, WMError::WM_ERROR_NULLPTR);
     auto ret = hostSession->SetFloatNavigationEnabled(notifyOnceImmediately_);
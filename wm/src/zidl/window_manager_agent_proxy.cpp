@@ -17,6 +17,7 @@
 #include <ipc_types.h>
 #include "marshalling_helper.h"
 #include "window_manager_hilog.h"
+#include "window_property_change_batch.h"
 #include "wm_common.h"
 
 namespace OHOS {
@@ -587,6 +588,30 @@ void WindowManagerAgentProxy::NotifyWindowPropertyChange(
     }
 }
 
+void WindowManagerAgentProxy::NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    if (!data.WriteInterfaceToken(GetDescriptor())) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "WriteInterfaceToken failed");
+        return;
+    }
+    if (!batch.Marshalling(data)) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "Write batch failed");
+        return;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "remote is null");
+        return;
+    }
+    if (remote->SendRequest(static_cast<uint32_t>(WindowManagerAgentMsg::TRANS_ID_NOTIFY_WINDOW_PROPERTY_CHANGE_BATCH),
+        data, reply, option) != ERR_NONE) {
+        TLOGE(WmsLogTag::WMS_ATTRIBUTE, "SendRequest failed");
+    }
+}
+
 void WindowManagerAgentProxy::NotifySupportRotationChange(const SupportRotationInfo& supportRotationInfo)
 {
     MessageParcel data;
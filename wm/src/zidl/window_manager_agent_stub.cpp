@@ -17,6 +17,7 @@
 #include "ipc_skeleton.h"
 #include "marshalling_helper.h"
 #include "window_manager_hilog.h"
+#include "window_property_change_batch.h"
 #include "wm_common.h"
 
 namespace OHOS {
@@ -278,6 +279,15 @@ int WindowManagerAgentStub::OnRemoteRequest(uint32_t code, MessageParcel& data,
             NotifyWindowPropertyChange(propertyDirtyFlags, windowInfoList);
             break;
         }
+        case WindowManagerAgentMsg::TRANS_ID_NOTIFY_WINDOW_PROPERTY_CHANGE_BATCH: {
+            WindowPropertyChangeBatch batch;
+            if (!batch.Unmarshalling(data)) {
+                TLOGE(WmsLogTag::WMS_ATTRIBUTE, "fail to read batch.");
+                return ERR_INVALID_DATA;
+            }
+            NotifyWindowPropertyChange(batch);
+            break;
+        }
         case WindowManagerAgentMsg::TRANS_ID_NOTIFY_WINDOW_SUPPORT_ROTATION_CHANGE: {
             sptr<SupportRotationInfo> supportRotationInfo = data.ReadParcelable<SupportRotationInfo>();
             if (supportRotationInfo == nullptr) {
@@ -303,6 +313,13 @@ int WindowManagerAgentStub::OnRemoteRequest(uint32_t code, MessageParcel& data,
     return ERR_NONE;
 }
 
+void WindowManagerAgentStub::NotifyWindowPropertyChange(const WindowPropertyChangeBatch& batch)
+{
+    WindowInfoList windowInfoList;
+    batch.ToWindowInfoList(windowInfoList);
+    NotifyWindowPropertyChange(batch.GetPropertyDirtyFlags(), windowInfoList);
+}
+
 // LCOV_EXCL_START
 bool WindowManagerAgentStub::ReadWindowInfoList(MessageParcel& data, WindowInfoList& windowInfoList)
 {
@@ -109,16 +109,25 @@ public:
         return WMError::WM_OK;
     }
 
+    WMError SetWindowManagerAgentFilter(WindowManagerAgentType type, const WindowManagerAgentFilter& filter,
+        const sptr<IWindowManagerAgent>& windowManagerAgent) override
+    {
+        lastAgentFilter_ = filter;
+        return WMError::WM_OK;
+    }
+
     static std::string lastModuleName_;
     static std::string lastAbilityName_;
     static uint32_t lastColor_;
     static int32_t lastUid_;
+    static WindowManagerAgentFilter lastAgentFilter_;
 };
 
 std::string MockWindowAdapter::lastModuleName_;
 std::string MockWindowAdapter::lastAbilityName_;
 uint32_t MockWindowAdapter::lastColor_ = 0;
 int32_t MockWindowAdapter::lastUid_ = 0;
+WindowManagerAgentFilter MockWindowAdapter::lastAgentFilter_;
 
 class TestCameraFloatWindowChangedListener : public ICameraFloatWindowChangedListener {
 public:
@@ -136,6 +145,30 @@ public:
     };
 };
 
+class CountVisibilityChangedListener : public IVisibilityChangedListener {
+public:
+    void OnWindowVisibilityChanged(const std::vector<sptr<WindowVisibilityInfo>>& windowVisibilityInfo) override
+    {
+        notifyCount_++;
+        lastInfoSize_ = windowVisibilityInfo.size();
+    }
+
+    uint32_t notifyCount_ = 0;
+    size_t lastInfoSize_ = 0;
+};
+
+class CountDrawingContentChangedListener : public IDrawingContentChangedListener {
+public:
+    void OnWindowDrawingContentChanged(const std::vector<sptr<WindowDrawingContentInfo>>& windowDrawingInfo) override
+    {
+        notifyCount_++;
+        lastInfoSize_ = windowDrawingInfo.size();
+    }
+
+    uint32_t notifyCount_ = 0;
+    size_t lastInfoSize_ = 0;
+};
+
 class TestWindowUpdateListener : public IWindowUpdateListener {
 public:
     void OnWindowUpdate(const std::vector<sptr<AccessibilityWindowInfo>>& infos, WindowUpdateType type) override
@@ -3348,6 +3381,160 @@ HWTEST_F(WindowManagerTest, WMSConnectionChangedListenerBackwardCompatibility, T
     listener->OnConnected(100, 0, 6666);
     listener->OnDisconnected(100, 0, 6666);
 }
+
+/**
+ * @tc.name: WindowManagerAgentFilterMerge
+ * @tc.desc: merging keeps the entries of both filters and drops a field one of them does not restrict
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowManagerTest, WindowManagerAgentFilterMerge, TestSize.Level1)
+{
+    WindowManagerAgentFilter filter;
+    filter.pids = { 1 };
+    filter.bundleNames = { "bundleA" };
+    filter.displayIds = { 0 };
+    WindowManagerAgentFilter other;
+    other.pids = { 2 };
+    other.bundleNames = { "bundleB" };
+    other.windowIds = { 10 };
+    filter.Merge(other);
+
+    EXPECT_EQ(filter.pids, (std::unordered_set<int32_t>{ 1, 2 }));
+    EXPECT_EQ(filter.bundleNames, (std::unordered_set<std::string>{ "bundleA", "bundleB" }));
+    EXPECT_TRUE(filter.windowIds.empty());
+    EXPECT_TRUE(filter.displayIds.empty());
+    EXPECT_TRUE(filter.IsMatched(2, 11, "bundleA", 1));
+    EXPECT_FALSE(filter.IsMatched(3, 11, "bundleA", 1));
+
+    filter.Merge(WindowManagerAgentFilter());
+    EXPECT_TRUE(filter.IsEmpty());
+}
+
+/**
+ * @tc.name: WindowManagerAgentFilterMarshalling
+ * @tc.desc: a filter survives a parcel round trip and an oversize set is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowManagerTest, WindowManagerAgentFilterMarshalling, TestSize.Level1)
+{
+    WindowManagerAgentFilter filter;
+    filter.pids = { 1, 2 };
+    filter.bundleNames = { "bundleA" };
+    filter.windowIds = { 10 };
+    filter.displayIds = { 0, 1 };
+    Parcel parcel;
+    ASSERT_TRUE(filter.Marshalling(parcel));
+    std::unique_ptr<WindowManagerAgentFilter> result(WindowManagerAgentFilter::Unmarshalling(parcel));
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(*result, filter);
+
+    Parcel oversizeParcel;
+    oversizeParcel.WriteUint32(WindowManagerAgentFilter::MAX_FILTER_SIZE + 1);
+    oversizeParcel.WriteUint32(0);
+    oversizeParcel.WriteUint32(0);
+    oversizeParcel.WriteUint32(0);
+    EXPECT_EQ(WindowManagerAgentFilter::Unmarshalling(oversizeParcel), nullptr);
+
+    Parcel truncatedParcel;
+    truncatedParcel.WriteUint32(2);
+    truncatedParcel.WriteUint32(0);
+    truncatedParcel.WriteUint32(0);
+    truncatedParcel.WriteUint32(0);
+    truncatedParcel.WriteInt32(1);
+    EXPECT_EQ(WindowManagerAgentFilter::Unmarshalling(truncatedParcel), nullptr);
+}
+
+/**
+ * @tc.name: RegisterVisibilityChangedListenerWithFilter
+ * @tc.desc: the agent filter is the merge of the listener filters and each listener only gets its own entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowManagerTest, RegisterVisibilityChangedListenerWithFilter, TestSize.Level1)
+{
+    auto pidListener = sptr<CountVisibilityChangedListener>::MakeSptr();
+    auto displayListener = sptr<CountVisibilityChangedListener>::MakeSptr();
+    auto allListener = sptr<CountVisibilityChangedListener>::MakeSptr();
+    WindowManagerAgentFilter pidFilter;
+    pidFilter.pids = { 1 };
+    WindowManagerAgentFilter displayFilter;
+    displayFilter.pids = { 2 };
+    displayFilter.displayIds = { 1 };
+    MockWindowAdapter::lastAgentFilter_ = {};
+
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->RegisterVisibilityChangedListener(pidListener, pidFilter));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_, pidFilter);
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->RegisterVisibilityChangedListener(displayListener, displayFilter));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_.pids, (std::unordered_set<int32_t>{ 1, 2 }));
+    EXPECT_TRUE(MockWindowAdapter::lastAgentFilter_.displayIds.empty());
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->RegisterVisibilityChangedListener(allListener));
+    EXPECT_TRUE(MockWindowAdapter::lastAgentFilter_.IsEmpty());
+
+    std::vector<sptr<WindowVisibilityInfo>> infos;
+    for (int32_t pid = 1; pid <= 3; pid++) {
+        auto info = sptr<WindowVisibilityInfo>::MakeSptr(static_cast<uint32_t>(pid), pid, 0,
+            WindowVisibilityState::WINDOW_VISIBILITY_STATE_NO_OCCLUSION, WindowType::WINDOW_TYPE_APP_MAIN_WINDOW);
+        info->displayId_ = 1;
+        infos.push_back(info);
+    }
+    infos[0]->displayId_ = 0;
+    mockInstance_->pImpl_->NotifyWindowVisibilityInfoChanged(infos);
+    EXPECT_EQ(pidListener->lastInfoSize_, 1);
+    EXPECT_EQ(displayListener->lastInfoSize_, 1);
+    EXPECT_EQ(allListener->lastInfoSize_, 3);
+
+    infos.resize(1);
+    mockInstance_->pImpl_->NotifyWindowVisibilityInfoChanged(infos);
+    EXPECT_EQ(pidListener->notifyCount_, 2);
+    EXPECT_EQ(displayListener->notifyCount_, 1);
+    EXPECT_EQ(allListener->notifyCount_, 2);
+
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->UnregisterVisibilityChangedListener(allListener));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_.pids, (std::unordered_set<int32_t>{ 1, 2 }));
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->UnregisterVisibilityChangedListener(pidListener));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_, displayFilter);
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->UnregisterVisibilityChangedListener(displayListener));
+}
+
+/**
+ * @tc.name: RegisterDrawingContentChangedListenerWithFilter
+ * @tc.desc: drawing content entries are filtered by pid and window id per listener
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowManagerTest, RegisterDrawingContentChangedListenerWithFilter, TestSize.Level1)
+{
+    auto pidListener = sptr<CountDrawingContentChangedListener>::MakeSptr();
+    auto windowListener = sptr<CountDrawingContentChangedListener>::MakeSptr();
+    WindowManagerAgentFilter pidFilter;
+    pidFilter.pids = { 1 };
+    WindowManagerAgentFilter windowFilter;
+    windowFilter.windowIds = { 3 };
+    MockWindowAdapter::lastAgentFilter_ = {};
+
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->RegisterDrawingContentChangedListener(pidListener, pidFilter));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_, pidFilter);
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->RegisterDrawingContentChangedListener(windowListener, windowFilter));
+    EXPECT_TRUE(MockWindowAdapter::lastAgentFilter_.IsEmpty());
+
+    std::vector<sptr<WindowDrawingContentInfo>> infos;
+    for (int32_t pid = 1; pid <= 3; pid++) {
+        infos.push_back(sptr<WindowDrawingContentInfo>::MakeSptr(static_cast<uint32_t>(pid), pid, 0, true,
+            WindowType::WINDOW_TYPE_APP_MAIN_WINDOW));
+    }
+    mockInstance_->pImpl_->NotifyWindowDrawingContentInfoChanged(infos);
+    EXPECT_EQ(pidListener->notifyCount_, 1);
+    EXPECT_EQ(pidListener->lastInfoSize_, 1);
+    EXPECT_EQ(windowListener->notifyCount_, 1);
+    EXPECT_EQ(windowListener->lastInfoSize_, 1);
+
+    infos.resize(1);
+    mockInstance_->pImpl_->NotifyWindowDrawingContentInfoChanged(infos);
+    EXPECT_EQ(pidListener->notifyCount_, 2);
+    EXPECT_EQ(windowListener->notifyCount_, 1);
+
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->UnregisterDrawingContentChangedListener(windowListener));
+    EXPECT_EQ(MockWindowAdapter::lastAgentFilter_, pidFilter);
+    EXPECT_EQ(WMError::WM_OK, mockInstance_->UnregisterDrawingContentChangedListener(pidListener));
+}
 } // namespace
 } // namespace Rosen
 } // namespace OHOS
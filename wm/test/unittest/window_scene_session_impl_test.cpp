@@ -2097,6 +2097,62 @@ HWTEST_F(WindowSceneSessionImplTest, GetAvoidAreaByType, TestSize.Level1)
     ASSERT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_CUTOUT, avoidarea, rect, 16));
 }
 
+/**
+ * @tc.name: GetAvoidAreaByTypeCache
+ * @tc.desc: avoid areas of the current rect are answered by the cache kept by server pushes
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowSceneSessionImplTest, GetAvoidAreaByTypeCache, TestSize.Level1)
+{
+    sptr<WindowOption> option = sptr<WindowOption>::MakeSptr();
+    option->SetWindowName("GetAvoidAreaByTypeCache");
+    sptr<WindowSceneSessionImpl> window = sptr<WindowSceneSessionImpl>::MakeSptr(option);
+    window->property_->SetPersistentId(1);
+    window->property_->SetWindowRect({ 0, 0, 1260, 2720 });
+    SessionInfo sessionInfo = { "CreateTestBundle", "CreateTestModule", "CreateTestAbility" };
+    sptr<SessionMocker> session = sptr<SessionMocker>::MakeSptr(sessionInfo);
+    window->hostSession_ = session;
+    window->state_ = WindowState::STATE_SHOWN;
+    window->SetAvoidAreaCacheEnabled(true);
+
+    AvoidArea queriedArea;
+    queriedArea.topRect_ = { 0, 0, 1260, 100 };
+    AvoidArea pushedArea;
+    pushedArea.topRect_ = { 0, 0, 1260, 120 };
+    EXPECT_CALL(*session, GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, _, _))
+        .Times(4).WillRepeatedly(Return(queriedArea));
+    AvoidArea avoidArea;
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea));
+    EXPECT_EQ(avoidArea, queriedArea);
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea));
+    EXPECT_EQ(avoidArea, queriedArea);
+    EXPECT_EQ(window->getAvoidAreaCacheHitCnt_, 1);
+
+    window->UpdateAvoidArea(sptr<AvoidArea>::MakeSptr(pushedArea), AvoidAreaType::TYPE_SYSTEM,
+        { 0, 0, 1260, 2720 });
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea));
+    EXPECT_EQ(avoidArea, pushedArea);
+    EXPECT_EQ(window->getAvoidAreaCacheHitCnt_, 2);
+
+    // pushed for a rect the window has already left, the query goes to the server
+    AvoidArea stalePushedArea;
+    stalePushedArea.topRect_ = { 0, 0, 1260, 140 };
+    window->UpdateAvoidArea(sptr<AvoidArea>::MakeSptr(stalePushedArea), AvoidAreaType::TYPE_SYSTEM,
+        { 0, 0, 1260, 1360 });
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea));
+    EXPECT_EQ(avoidArea, queriedArea);
+    EXPECT_EQ(window->getAvoidAreaCacheHitCnt_, 2);
+
+    Rect otherRect = { 0, 0, 600, 600 };
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea, otherRect));
+    EXPECT_EQ(avoidArea, queriedArea);
+
+    window->NotifyForegroundInteractiveStatus(false);
+    EXPECT_EQ(WMError::WM_OK, window->GetAvoidAreaByType(AvoidAreaType::TYPE_SYSTEM, avoidArea));
+    EXPECT_EQ(avoidArea, queriedArea);
+    EXPECT_EQ(window->getAvoidAreaCacheHitCnt_, 2);
+}
+
 /**
  * @tc.name: GetAvoidAreaByTypeIgnoringVisibility
  * @tc.desc: GetAvoidAreaByTypeIgnoringVisibility test
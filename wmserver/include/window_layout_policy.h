@@ -16,6 +16,7 @@
 #ifndef OHOS_ROSEN_WINDOW_LAYOUT_POLICY_H
 #define OHOS_ROSEN_WINDOW_LAYOUT_POLICY_H
 
+#include <functional>
 #include <map>
 #include <refbase.h>
 #include <set>
@@ -62,6 +63,8 @@ public:
     static void SetMaxFloatingWindowSize(uint32_t maxSize);
     static void CalcAndSetNodeHotZone(const Rect& winRect, const sptr<WindowNode>& node);
     virtual void GetMaximizeRect(const sptr<WindowNode>& node, Rect& maxRect);
+    // node count of the latest layout tree pass, skipped nodes have no layout input changed
+    void GetLayoutNodeCount(uint32_t& visitedCount, uint32_t& skippedCount) const;
 
 protected:
     /*
@@ -70,7 +73,14 @@ protected:
     virtual void UpdateLayoutRect(const sptr<WindowNode>& node) = 0;
     void LayoutWindowTree(DisplayId displayId);
     void LayoutWindowNode(const sptr<WindowNode>& node);
-    void LayoutWindowNodesByRootType(const std::vector<sptr<WindowNode>>& nodeVec);
+    void LayoutDirtyWindowNode(const sptr<WindowNode>& node, bool isParentRelayout);
+    void LayoutDirtyWindowNodesByRootType(const std::vector<sptr<WindowNode>>& nodeVec);
+    // mark the nodes of the display dirty with their children, all nodes when isAffected is empty
+    void MarkWindowTreeLayoutDirty(DisplayId displayId,
+        const std::function<bool(const sptr<WindowNode>&)>& isAffected = nullptr);
+    Rect GetNodeLimitRect(const sptr<WindowNode>& node) const;
+    DisplayOrientation GetNodeDisplayOrientation(const sptr<WindowNode>& node) const;
+    void SetNodeLayoutDone(const sptr<WindowNode>& node, const Rect& limitRect, DisplayOrientation orientation);
     void FixWindowRectWithinDisplay(const sptr<WindowNode>& node) const;
 
     /*
@@ -122,6 +132,8 @@ protected:
     static uint32_t floatingBottomPosY_;
     // max size of floating window in config
     static uint32_t maxFloatingWindowSize_;
+    uint32_t layoutVisitedCount_ = 0;
+    uint32_t layoutSkippedCount_ = 0;
 };
 }
 }
@@ -45,6 +45,7 @@ private:
     void InitAllRects();
     void InitSplitRects(DisplayId displayId);
     void SetSplitRectByDivider(const Rect& divRect, DisplayId displayId);
+    void MarkSplitNodesLayoutDirty(DisplayId displayId);
     void SetInitialDividerRect(const sptr<WindowNode>& node, DisplayId displayId);
     void InitCascadeRect(DisplayId displayId);
     void SetDefaultCascadeRect(const sptr<WindowNode>& node);
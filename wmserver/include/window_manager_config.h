@@ -29,6 +29,11 @@ public:
     ~WindowManagerConfig() = default;
 
     static bool LoadConfigXml();
+
+    /**
+     * @brief Check whether the config snapshot matches a fresh parse of the xml.
+     */
+    static bool CheckConfigSnapshot();
     static const ConfigItem& GetConfig()
     {
         return config_;
@@ -39,6 +44,7 @@ private:
     static ConfigItem config_;
     static const std::map<std::string, ValueType> configItemTypeMap_;
 
+    static bool ParseConfigXml(const std::string& configFilePath, ConfigItem& config);
     static bool IsValidNode(const xmlNode& currNode);
     static std::map<std::string, ConfigItem> ReadProperty(const xmlNodePtr& currNode);
     static std::vector<int> ReadIntNumbersConfigInfo(const xmlNodePtr& currNode);
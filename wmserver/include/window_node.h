@@ -20,6 +20,7 @@
 #include <refbase.h>
 #include <ui/rs_surface_node.h>
 #include <ui/rs_ui_context.h>
+#include "dm_common.h"
 #include "zidl/window_interface.h"
 #include "window_manager_hilog.h"
 #include "window_node_state_machine.h"
@@ -98,6 +99,10 @@ public:
     void SetAspectRatio(float ratio);
     void SetWindowGravity(WindowGravity gravity, uint32_t percent);
     void SetVisibilityState(WindowVisibilityState state);
+    void SetMaximizeMode(MaximizeMode mode);
+    void SetLayoutDirty(bool isDirty);
+    void SetLastLayoutLimitRect(const Rect& rect);
+    void SetLastLayoutDisplayOrientation(DisplayOrientation orientation);
 
     const sptr<IWindow>& GetWindowToken() const;
     uint32_t GetWindowId() const;
@@ -138,6 +143,9 @@ public:
     void GetWindowGravity(WindowGravity& gravity, uint32_t& percent) const;
     WindowVisibilityState GetVisibilityState() const;
     bool GetTouchable() const;
+    bool IsLayoutDirty() const;
+    const Rect& GetLastLayoutLimitRect() const;
+    DisplayOrientation GetLastLayoutDisplayOrientation() const;
 
     bool EnableDefaultAnimation(bool animationPlayed);
 
@@ -187,6 +195,9 @@ private:
     int32_t inputCallingPid_ = { 0 };
     int32_t callingUid_ = { 0 };
     WindowSizeChangeReason windowSizeChangeReason_ {WindowSizeChangeReason::UNDEFINED};
+    bool isLayoutDirty_ { true }; // layout inputs changed since last layout
+    Rect lastLayoutLimitRect_ { 0, 0, 0, 0 }; // limit rect used by last layout
+    DisplayOrientation lastLayoutDisplayOrientation_ { DisplayOrientation::UNKNOWN }; // used by last layout
 };
 } // Rosen
 } // OHOS
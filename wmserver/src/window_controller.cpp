@@ -1626,7 +1626,7 @@ WMError WindowController::UpdateProperty(sptr<WindowProperty>& property, Propert
         }
         case PropertyChangeAction::ACTION_UPDATE_MAXIMIZE_STATE: {
             MaximizeMode mode = property->GetMaximizeMode();
-            node->GetWindowProperty()->SetMaximizeMode(mode);
+            node->SetMaximizeMode(mode);
             Rect newRect = {0, 0, 0, 0};
             if (mode == MaximizeMode::MODE_AVOID_SYSTEM_BAR) {
                 node->SetOriginRect(node->GetWindowRect());
@@ -30,6 +30,25 @@ namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "Layout"};
+
+void MarkNodeLayoutDirty(const sptr<WindowNode>& node,
+    const std::function<bool(const sptr<WindowNode>&)>& isAffected)
+{
+    if (node == nullptr) {
+        return;
+    }
+    if (!isAffected || isAffected(node)) {
+        node->SetLayoutDirty(true);
+        // children are laid out against their parent, relayout all of them
+        for (auto& childNode : node->children_) {
+            MarkNodeLayoutDirty(childNode, nullptr);
+        }
+        return;
+    }
+    for (auto& childNode : node->children_) {
+        MarkNodeLayoutDirty(childNode, isAffected);
+    }
+}
 }
 
 uint32_t WindowLayoutPolicy::floatingBottomPosY_ = 0;
@@ -197,6 +216,9 @@ void WindowLayoutPolicy::PostProcessWhenDisplayChange()
 {
     DisplayGroupInfo::GetInstance().UpdateLeftAndRightDisplayId();
     UpdateMultiDisplayFlag();
+    for (auto& elem : displayGroupWindowTree_) {
+        MarkWindowTreeLayoutDirty(elem.first);
+    }
     Launch();
 }
 
@@ -283,20 +305,11 @@ void WindowLayoutPolicy::ProcessDisplaySizeChangeOrRotation(DisplayId displayId,
 
 void WindowLayoutPolicy::ProcessDisplayVprChange(DisplayId displayId)
 {
+    // vpr is not cached in node, relayout all nodes of this display
+    MarkWindowTreeLayoutDirty(displayId);
     Launch();
 }
 
-void WindowLayoutPolicy::LayoutWindowNodesByRootType(const std::vector<sptr<WindowNode>>& nodeVec)
-{
-    if (nodeVec.empty()) {
-        WLOGW("The node vector is empty!");
-        return;
-    }
-    for (auto& node : nodeVec) {
-        LayoutWindowNode(node);
-    }
-}
-
 void WindowLayoutPolicy::NotifyAnimationSizeChangeIfNeeded()
 {
     if (!RemoteAnimation::CheckAnimationController()) {
@@ -331,11 +344,102 @@ void WindowLayoutPolicy::LayoutWindowTree(DisplayId displayId)
     limitRectMap_[displayId] = DisplayGroupInfo::GetInstance().GetDisplayRect(displayId);
     displayGroupLimitRect_ = displayGroupRect_;
 
+    layoutVisitedCount_ = 0;
+    layoutSkippedCount_ = 0;
+
     // ensure that the avoid area windows are traversed first
     auto& displayWindowTree = displayGroupWindowTree_[displayId];
-    LayoutWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::ABOVE_WINDOW_NODE]));
-    LayoutWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::APP_WINDOW_NODE]));
-    LayoutWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::BELOW_WINDOW_NODE]));
+    LayoutDirtyWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::ABOVE_WINDOW_NODE]));
+    LayoutDirtyWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::APP_WINDOW_NODE]));
+    LayoutDirtyWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::BELOW_WINDOW_NODE]));
+    WLOGFD("Layout window tree, displayId: %{public}" PRIu64", visited: %{public}u, skipped: %{public}u",
+        displayId, layoutVisitedCount_, layoutSkippedCount_);
+}
+
+void WindowLayoutPolicy::LayoutDirtyWindowNodesByRootType(const std::vector<sptr<WindowNode>>& nodeVec)
+{
+    for (auto& node : nodeVec) {
+        LayoutDirtyWindowNode(node, false);
+    }
+}
+
+void WindowLayoutPolicy::LayoutDirtyWindowNode(const sptr<WindowNode>& node, bool isParentRelayout)
+{
+    if (node == nullptr || node->parent_ == nullptr) {
+        WLOGFE("Node or it's parent is nullptr");
+        return;
+    }
+    if (!node->currentVisibility_) {
+        // inputs may change while invisible, relayout when it shows again
+        node->SetLayoutDirty(true);
+        return;
+    }
+
+    /*
+     * only relayout node when its own inputs, its parent or the limit rect it depends on changed,
+     * avoid node still need to update limit rect because the limit rect is reset before traverse
+     */
+    Rect limitRect = GetNodeLimitRect(node);
+    DisplayOrientation orientation = GetNodeDisplayOrientation(node);
+    bool needLayout = isParentRelayout || node->IsLayoutDirty() || node->GetLastLayoutLimitRect() != limitRect ||
+        node->GetLastLayoutDisplayOrientation() != orientation;
+    if (needLayout) {
+        UpdateLayoutRect(node);
+        SetNodeLayoutDone(node, limitRect, orientation);
+        layoutVisitedCount_++;
+    } else {
+        layoutSkippedCount_++;
+    }
+    if (WindowHelper::IsSystemBarWindow(node->GetWindowType())) {
+        UpdateDisplayLimitRect(node, limitRectMap_[node->GetDisplayId()]);
+        UpdateDisplayGroupLimitRect();
+        WindowInnerManager::GetInstance().NotifyDisplayLimitRectChange(limitRectMap_);
+    }
+    for (auto& childNode : node->children_) {
+        LayoutDirtyWindowNode(childNode, needLayout);
+    }
+}
+
+void WindowLayoutPolicy::MarkWindowTreeLayoutDirty(DisplayId displayId,
+    const std::function<bool(const sptr<WindowNode>&)>& isAffected)
+{
+    auto iter = displayGroupWindowTree_.find(displayId);
+    if (iter == displayGroupWindowTree_.end()) {
+        return;
+    }
+    for (auto& elem : iter->second) {
+        if (elem.second == nullptr) {
+            continue;
+        }
+        for (auto& node : *(elem.second)) {
+            MarkNodeLayoutDirty(node, isAffected);
+        }
+    }
+}
+
+Rect WindowLayoutPolicy::GetNodeLimitRect(const sptr<WindowNode>& node) const
+{
+    return node->isShowingOnMultiDisplays_ ? displayGroupLimitRect_ : limitRectMap_[node->GetDisplayId()];
+}
+
+DisplayOrientation WindowLayoutPolicy::GetNodeDisplayOrientation(const sptr<WindowNode>& node) const
+{
+    auto displayInfo = DisplayGroupInfo::GetInstance().GetDisplayInfo(node->GetDisplayId());
+    return displayInfo != nullptr ? displayInfo->GetDisplayOrientation() : DisplayOrientation::UNKNOWN;
+}
+
+void WindowLayoutPolicy::SetNodeLayoutDone(const sptr<WindowNode>& node, const Rect& limitRect,
+    DisplayOrientation orientation)
+{
+    node->SetLayoutDirty(false);
+    node->SetLastLayoutLimitRect(limitRect);
+    node->SetLastLayoutDisplayOrientation(orientation);
+}
+
+void WindowLayoutPolicy::GetLayoutNodeCount(uint32_t& visitedCount, uint32_t& skippedCount) const
+{
+    visitedCount = layoutVisitedCount_;
+    skippedCount = layoutSkippedCount_;
 }
 
 void WindowLayoutPolicy::LayoutWindowNode(const sptr<WindowNode>& node)
@@ -353,7 +457,10 @@ void WindowLayoutPolicy::LayoutWindowNode(const sptr<WindowNode>& node)
      * 1. update window rect
      * 2. update diplayLimitRect and displayGroupRect if this is avoidNode
      */
+    Rect limitRect = GetNodeLimitRect(node);
+    DisplayOrientation orientation = GetNodeDisplayOrientation(node);
     UpdateLayoutRect(node);
+    SetNodeLayoutDone(node, limitRect, orientation);
     if (WindowHelper::IsSystemBarWindow(node->GetWindowType())) {
         UpdateDisplayLimitRect(node, limitRectMap_[node->GetDisplayId()]);
         UpdateDisplayGroupLimitRect();
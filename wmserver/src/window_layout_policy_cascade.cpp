@@ -459,7 +459,7 @@ void WindowLayoutPolicyCascade::UpdateLayoutRect(const sptr<WindowNode>& node)
             if (property->GetMaximizeMode() == MaximizeMode::MODE_AVOID_SYSTEM_BAR) {
                 // restore the origin rect so when recover from fullscreen we can use
                 node->SetRequestRect(node->GetOriginRect());
-                property->SetMaximizeMode(MaximizeMode::MODE_FULL_FILL);
+                node->SetMaximizeMode(MaximizeMode::MODE_FULL_FILL);
             }
             break;
         }
@@ -518,6 +518,7 @@ void WindowLayoutPolicyCascade::InitSplitRects(DisplayId displayId)
     float virtualPixelRatio = DisplayGroupInfo::GetInstance().GetDisplayVirtualPixelRatio(displayId);
     uint32_t dividerWidth = static_cast<uint32_t>(DIVIDER_WIDTH * virtualPixelRatio);
     auto& dividerRect = cascadeRectsMap_[displayId].dividerRect_;
+    const Rect oriDividerRect = dividerRect;
     const auto& displayRect = DisplayGroupInfo::GetInstance().GetDisplayRect(displayId);
     if (!IsVerticalDisplay(displayId)) {
         dividerRect = { static_cast<uint32_t>((displayRect.width_ - dividerWidth) * DEFAULT_SPLIT_RATIO), 0,
@@ -526,15 +527,27 @@ void WindowLayoutPolicyCascade::InitSplitRects(DisplayId displayId)
         dividerRect = { 0, static_cast<uint32_t>((displayRect.height_ - dividerWidth) * DEFAULT_SPLIT_RATIO),
                displayRect.width_, dividerWidth };
     }
+    if (dividerRect != oriDividerRect) {
+        MarkSplitNodesLayoutDirty(displayId);
+    }
     SetSplitRectByDivider(dividerRect, displayId);
 }
 
+void WindowLayoutPolicyCascade::MarkSplitNodesLayoutDirty(DisplayId displayId)
+{
+    // split nodes and the divider read the split rects in UpdateLayoutRect
+    MarkWindowTreeLayoutDirty(displayId, [](const sptr<WindowNode>& node) {
+        return node->IsSplitMode() || node->GetWindowType() == WindowType::WINDOW_TYPE_DOCK_SLICE;
+    });
+}
+
 void WindowLayoutPolicyCascade::SetSplitRectByDivider(const Rect& divRect, DisplayId displayId)
 {
     auto& dividerRect = cascadeRectsMap_[displayId].dividerRect_;
     auto& primaryRect = cascadeRectsMap_[displayId].primaryRect_;
     auto& secondaryRect = cascadeRectsMap_[displayId].secondaryRect_;
     const auto& displayRect = DisplayGroupInfo::GetInstance().GetDisplayRect(displayId);
+    const CascadeRects oriRects = cascadeRectsMap_[displayId];
 
     dividerRect.width_ = divRect.width_;
     dividerRect.height_ = divRect.height_;
@@ -565,6 +578,10 @@ void WindowLayoutPolicyCascade::SetSplitRectByDivider(const Rect& divRect, Displ
         dividerRect.posX_, dividerRect.posY_, dividerRect.width_, dividerRect.height_,
         primaryRect.posX_, primaryRect.posY_, primaryRect.width_, primaryRect.height_,
         secondaryRect.posX_, secondaryRect.posY_, secondaryRect.width_, secondaryRect.height_);
+    if (dividerRect != oriRects.dividerRect_ || primaryRect != oriRects.primaryRect_ ||
+        secondaryRect != oriRects.secondaryRect_) {
+        MarkSplitNodesLayoutDirty(displayId);
+    }
 }
 
 Rect WindowLayoutPolicyCascade::GetCurCascadeRect(const sptr<WindowNode>& node) const
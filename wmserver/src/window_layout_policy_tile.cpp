@@ -51,8 +51,8 @@ void WindowLayoutPolicyTile::Launch()
          * Layout above and below nodes, it is necessary when display rotatation or size change
          */
         auto& displayWindowTree = displayGroupWindowTree_[displayId];
-        LayoutWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::ABOVE_WINDOW_NODE]));
-        LayoutWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::BELOW_WINDOW_NODE]));
+        LayoutDirtyWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::ABOVE_WINDOW_NODE]));
+        LayoutDirtyWindowNodesByRootType(*(displayWindowTree[WindowRootNodeType::BELOW_WINDOW_NODE]));
         WLOGFD("[Launch TileLayout], displayId: %{public}" PRIu64"", displayId);
     }
     WLOGI("[Launch TileLayout Finished]");
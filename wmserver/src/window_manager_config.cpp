@@ -17,11 +17,16 @@
 #include "config_policy_utils.h"
 #include "window_helper.h"
 #include "window_manager_hilog.h"
+#include "xml_config_snapshot.h"
 
 namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr HiviewDFX::HiLogLabel LABEL = {LOG_CORE, HILOG_DOMAIN_WINDOW, "WindowManagerConfig"};
+const std::string CONFIG_FILE_NAME = "etc/window/resources/window_manager_config.xml";
+const std::string SNAPSHOT_NAME = "window_manager_config";
+// bump when ParseConfigXml builds a different ConfigItem tree
+constexpr uint32_t SNAPSHOT_PARSER_VERSION = 1;
 }
 
 WindowManagerConfig::ConfigItem WindowManagerConfig::config_;
@@ -160,13 +165,25 @@ void WindowManagerConfig::ReadConfig(const xmlNodePtr& rootPtr, std::map<std::st
 
 bool WindowManagerConfig::LoadConfigXml()
 {
-    auto configFilePath = GetConfigPath("etc/window/resources/window_manager_config.xml");
+    auto configFilePath = GetConfigPath(CONFIG_FILE_NAME);
+    WLOGI("[WmConfig] filePath: %{public}s", configFilePath.c_str());
+    return XmlConfigSnapshot::LoadOrParse(configFilePath, SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml, config_);
+}
+
+bool WindowManagerConfig::CheckConfigSnapshot()
+{
+    return XmlConfigSnapshot::Check(GetConfigPath(CONFIG_FILE_NAME), SNAPSHOT_NAME, SNAPSHOT_PARSER_VERSION,
+        ParseConfigXml);
+}
+
+bool WindowManagerConfig::ParseConfigXml(const std::string& configFilePath, ConfigItem& config)
+{
     xmlDocPtr docPtr = nullptr;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
         docPtr = xmlReadFile(configFilePath.c_str(), nullptr, XML_PARSE_NOBLANKS);
     }
-    WLOGI("[WmConfig] filePath: %{public}s", configFilePath.c_str());
     if (docPtr == nullptr) {
         WLOGFE("[WmConfig] load xml error!");
         return false;
@@ -181,8 +198,8 @@ bool WindowManagerConfig::LoadConfigXml()
     }
 
     std::map<std::string, ConfigItem> configMap;
-    config_.SetValue(configMap);
-    ReadConfig(rootPtr, *config_.mapValue_);
+    config.SetValue(configMap);
+    ReadConfig(rootPtr, *config.mapValue_);
 
     xmlFreeDoc(docPtr);
     return true;
@@ -38,6 +38,7 @@
 #include "minimize_app.h"
 #include "permission.h"
 #include "persistent_storage.h"
+#include "persistent_storage_write_behind.h"
 #include "remote_animation.h"
 #include "rs_adapter.h"
 #include "singleton_container.h"
@@ -808,6 +809,7 @@ void WindowManagerService::OnStop()
 {
     windowCommonEvent_->UnSubscriberEvent();
     WindowInnerManager::GetInstance().Stop();
+    PersistentStorageWriteBehind::GetInstance().FlushAll(true);
     WLOGI("ready to stop service.");
 }
 
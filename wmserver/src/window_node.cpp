@@ -34,6 +34,7 @@ WindowNode::~WindowNode()
 void WindowNode::SetDisplayId(DisplayId displayId)
 {
     property_->SetDisplayId(displayId);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetEntireWindowTouchHotArea(const Rect& rect)
@@ -54,21 +55,25 @@ void WindowNode::SetWindowRect(const Rect& rect)
 void WindowNode::SetDecorEnable(bool decorEnable)
 {
     property_->SetDecorEnable(decorEnable);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetDecoStatus(bool decoStatus)
 {
     property_->SetDecoStatus(decoStatus);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetRequestRect(const Rect& rect)
 {
     property_->SetRequestRect(rect);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetWindowProperty(const sptr<WindowProperty>& property)
 {
     property_ = property;
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetSystemBarProperty(WindowType type, const SystemBarProperty& property)
@@ -79,6 +84,7 @@ void WindowNode::SetSystemBarProperty(WindowType type, const SystemBarProperty&
 void WindowNode::SetWindowMode(WindowMode mode)
 {
     property_->SetWindowMode(mode);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetBrightness(float brightness)
@@ -119,17 +125,20 @@ uint32_t WindowNode::GetCallingWindow() const
 void WindowNode::SetWindowSizeChangeReason(WindowSizeChangeReason reason)
 {
     windowSizeChangeReason_ = reason;
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetRequestedOrientation(Orientation orientation)
 {
     property_->SetRequestedOrientation(orientation);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetShowingDisplays(const std::vector<DisplayId>& displayIdVec)
 {
     showingDisplays_.clear();
     showingDisplays_.assign(displayIdVec.begin(), displayIdVec.end());
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetWindowModeSupportType(uint32_t windowModeSupportType)
@@ -171,11 +180,13 @@ void WindowNode::SetCallingUid(int32_t uid)
 void WindowNode::SetDragType(DragType dragType)
 {
     property_->SetDragType(dragType);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetOriginRect(const Rect& rect)
 {
     property_->SetOriginRect(rect);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetTouchHotAreas(const std::vector<Rect>& rects)
@@ -191,11 +202,13 @@ void WindowNode::SetPointerHotAreas(const std::vector<Rect>& rects)
 void WindowNode::SetWindowSizeLimits(const WindowLimits& sizeLimits)
 {
     property_->SetSizeLimits(sizeLimits);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::SetWindowUpdatedSizeLimits(const WindowLimits& sizeLimits)
 {
     property_->SetUpdatedSizeLimits(sizeLimits);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::ComputeTransform()
@@ -206,6 +219,7 @@ void WindowNode::ComputeTransform()
 void WindowNode::SetTransform(const Transform& trans)
 {
     property_->SetTransform(trans);
+    isLayoutDirty_ = true;
 }
 
 Transform WindowNode::GetZoomTransform() const
@@ -407,6 +421,7 @@ std::shared_ptr<Media::PixelMap> WindowNode::GetSnapshot()
 void WindowNode::SetAspectRatio(float ratio)
 {
     property_->SetAspectRatio(ratio);
+    isLayoutDirty_ = true;
 }
 
 float WindowNode::GetAspectRatio() const
@@ -417,6 +432,7 @@ float WindowNode::GetAspectRatio() const
 void WindowNode::SetWindowGravity(WindowGravity gravity, uint32_t percent)
 {
     property_->SetWindowGravity(gravity, percent);
+    isLayoutDirty_ = true;
 }
 
 void WindowNode::GetWindowGravity(WindowGravity& gravity, uint32_t& percent) const
@@ -439,6 +455,42 @@ bool WindowNode::GetTouchable() const
     return property_->GetTouchable();
 }
 
+void WindowNode::SetMaximizeMode(MaximizeMode mode)
+{
+    property_->SetMaximizeMode(mode);
+    isLayoutDirty_ = true;
+}
+
+void WindowNode::SetLayoutDirty(bool isDirty)
+{
+    isLayoutDirty_ = isDirty;
+}
+
+bool WindowNode::IsLayoutDirty() const
+{
+    return isLayoutDirty_;
+}
+
+void WindowNode::SetLastLayoutLimitRect(const Rect& rect)
+{
+    lastLayoutLimitRect_ = rect;
+}
+
+const Rect& WindowNode::GetLastLayoutLimitRect() const
+{
+    return lastLayoutLimitRect_;
+}
+
+void WindowNode::SetLastLayoutDisplayOrientation(DisplayOrientation orientation)
+{
+    lastLayoutDisplayOrientation_ = orientation;
+}
+
+DisplayOrientation WindowNode::GetLastLayoutDisplayOrientation() const
+{
+    return lastLayoutDisplayOrientation_;
+}
+
 std::shared_ptr<RSUIContext> WindowNode::GetRSUIContext() const
 {
     RETURN_IF_RS_CLIENT_MULTI_INSTANCE_DISABLED(nullptr);
@@ -1480,6 +1480,118 @@ HWTEST_F(WindowLayoutPolicyTest, NotifyClientAndAnimation, TestSize.Level1)
     layoutPolicy_->NotifyClientAndAnimation(node, winRect, reason);
 }
 
+/**
+ * @tc.name: LayoutDirtyWindowNode
+ * @tc.desc: test clean node is skipped and dirty node is relayout in layout tree pass
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowLayoutPolicyTest, LayoutDirtyWindowNode, TestSize.Level1)
+{
+    sptr<WindowNode> node = CreateWindowNode(windowInfo_);
+    ASSERT_TRUE(node != nullptr);
+    node->parent_ = container_->appWindowNode_;
+    node->currentVisibility_ = true;
+    sptr<WindowNode> child = CreateWindowNode(windowInfo_);
+    ASSERT_TRUE(child != nullptr);
+    child->parent_ = node;
+    child->currentVisibility_ = true;
+    node->children_.push_back(child);
+
+    uint32_t visitedCount = 0;
+    uint32_t skippedCount = 0;
+    layoutPolicy_->layoutVisitedCount_ = 0;
+    layoutPolicy_->layoutSkippedCount_ = 0;
+    layoutPolicy_->LayoutDirtyWindowNode(node, false);
+    layoutPolicy_->GetLayoutNodeCount(visitedCount, skippedCount);
+    ASSERT_EQ(2, visitedCount);
+    ASSERT_EQ(0, skippedCount);
+    ASSERT_FALSE(node->IsLayoutDirty());
+    ASSERT_FALSE(child->IsLayoutDirty());
+
+    layoutPolicy_->layoutVisitedCount_ = 0;
+    layoutPolicy_->layoutSkippedCount_ = 0;
+    layoutPolicy_->LayoutDirtyWindowNode(node, false);
+    layoutPolicy_->GetLayoutNodeCount(visitedCount, skippedCount);
+    ASSERT_EQ(0, visitedCount);
+    ASSERT_EQ(2, skippedCount);
+
+    // parent relayout forces child relayout
+    node->SetLayoutDirty(true);
+    layoutPolicy_->layoutVisitedCount_ = 0;
+    layoutPolicy_->layoutSkippedCount_ = 0;
+    layoutPolicy_->LayoutDirtyWindowNode(node, false);
+    layoutPolicy_->GetLayoutNodeCount(visitedCount, skippedCount);
+    ASSERT_EQ(2, visitedCount);
+    ASSERT_EQ(0, skippedCount);
+
+    // invisible node is kept dirty for next layout
+    child->currentVisibility_ = false;
+    child->SetLayoutDirty(false);
+    layoutPolicy_->LayoutDirtyWindowNode(child, false);
+    ASSERT_TRUE(child->IsLayoutDirty());
+}
+
+/**
+ * @tc.name: LayoutDirtyWindowNodeOrientation
+ * @tc.desc: test node laid out with another display orientation is relayout
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowLayoutPolicyTest, LayoutDirtyWindowNodeOrientation, TestSize.Level1)
+{
+    sptr<WindowNode> node = CreateWindowNode(windowInfo_);
+    ASSERT_TRUE(node != nullptr);
+    node->parent_ = container_->appWindowNode_;
+    node->currentVisibility_ = true;
+
+    uint32_t visitedCount = 0;
+    uint32_t skippedCount = 0;
+    layoutPolicy_->LayoutDirtyWindowNode(node, false);
+    ASSERT_EQ(layoutPolicy_->GetNodeDisplayOrientation(node), node->GetLastLayoutDisplayOrientation());
+
+    auto orientation = layoutPolicy_->GetNodeDisplayOrientation(node);
+    node->SetLastLayoutDisplayOrientation(orientation == DisplayOrientation::UNKNOWN ?
+        DisplayOrientation::PORTRAIT : DisplayOrientation::UNKNOWN);
+    layoutPolicy_->layoutVisitedCount_ = 0;
+    layoutPolicy_->layoutSkippedCount_ = 0;
+    layoutPolicy_->LayoutDirtyWindowNode(node, false);
+    layoutPolicy_->GetLayoutNodeCount(visitedCount, skippedCount);
+    ASSERT_EQ(1, visitedCount);
+    ASSERT_EQ(0, skippedCount);
+}
+
+/**
+ * @tc.name: MarkSplitNodesLayoutDirty
+ * @tc.desc: test changed split rects mark only split nodes dirty
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowLayoutPolicyTest, MarkSplitNodesLayoutDirty, TestSize.Level1)
+{
+    sptr<WindowNode> splitNode = CreateWindowNode(windowInfo_);
+    ASSERT_TRUE(splitNode != nullptr);
+    splitNode->SetWindowMode(WindowMode::WINDOW_MODE_SPLIT_PRIMARY);
+    sptr<WindowNode> floatingNode = CreateWindowNode(windowInfo_);
+    ASSERT_TRUE(floatingNode != nullptr);
+    auto& appNodes = *(layoutPolicy_->displayGroupWindowTree_[0][WindowRootNodeType::APP_WINDOW_NODE]);
+    appNodes.push_back(splitNode);
+    appNodes.push_back(floatingNode);
+
+    layoutPolicy_->InitSplitRects(0);
+    splitNode->SetLayoutDirty(false);
+    floatingNode->SetLayoutDirty(false);
+    Rect dividerRect = layoutPolicy_->cascadeRectsMap_[0].dividerRect_;
+    layoutPolicy_->SetSplitRectByDivider(dividerRect, 0);
+    ASSERT_FALSE(splitNode->IsLayoutDirty());
+
+    dividerRect.width_ += 1;
+    layoutPolicy_->SetSplitRectByDivider(dividerRect, 0);
+    ASSERT_TRUE(splitNode->IsLayoutDirty());
+    ASSERT_FALSE(floatingNode->IsLayoutDirty());
+
+    appNodes.pop_back();
+    appNodes.pop_back();
+    layoutPolicy_->InitSplitRects(0);
+}
+
 }
 }
 }
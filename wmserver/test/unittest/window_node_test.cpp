@@ -970,6 +970,48 @@ HWTEST_F(WindowNodeTest, GetTouchable01, TestSize.Level1)
     windowNode->SetTouchable(true);
     ASSERT_EQ(true, windowNode->GetTouchable());
 }
+
+/**
+ * @tc.name: LayoutDirty01
+ * @tc.desc: SetLayoutDirty & IsLayoutDirty, layout inputs mark node dirty
+ * @tc.type: FUNC
+ */
+HWTEST_F(WindowNodeTest, LayoutDirty01, TestSize.Level1)
+{
+    std::string windowName = "WindowNode34";
+    auto property = CreateWindowProperty(34, windowName);
+    ASSERT_NE(nullptr, property);
+    sptr<WindowNode> windowNode = new WindowNode(property);
+    ASSERT_NE(nullptr, windowNode);
+
+    ASSERT_EQ(true, windowNode->IsLayoutDirty());
+    windowNode->SetLayoutDirty(false);
+    ASSERT_EQ(false, windowNode->IsLayoutDirty());
+    windowNode->SetTouchable(false);
+    ASSERT_EQ(false, windowNode->IsLayoutDirty());
+    windowNode->SetRequestRect({ 0, 0, 100, 100 });
+    ASSERT_EQ(true, windowNode->IsLayoutDirty());
+
+    windowNode->SetLayoutDirty(false);
+    windowNode->SetWindowMode(WindowMode::WINDOW_MODE_FLOATING);
+    ASSERT_EQ(true, windowNode->IsLayoutDirty());
+
+    Rect limitRect = { 0, 0, 200, 200 };
+    windowNode->SetLastLayoutLimitRect(limitRect);
+    ASSERT_EQ(limitRect, windowNode->GetLastLayoutLimitRect());
+
+    windowNode->SetLayoutDirty(false);
+    windowNode->SetMaximizeMode(MaximizeMode::MODE_AVOID_SYSTEM_BAR);
+    ASSERT_EQ(true, windowNode->IsLayoutDirty());
+    ASSERT_EQ(MaximizeMode::MODE_AVOID_SYSTEM_BAR, windowNode->GetWindowProperty()->GetMaximizeMode());
+
+    windowNode->SetLayoutDirty(false);
+    windowNode->SetRequestedOrientation(Orientation::VERTICAL);
+    ASSERT_EQ(true, windowNode->IsLayoutDirty());
+
+    windowNode->SetLastLayoutDisplayOrientation(DisplayOrientation::LANDSCAPE);
+    ASSERT_EQ(DisplayOrientation::LANDSCAPE, windowNode->GetLastLayoutDisplayOrientation());
+}
 }
 }
 }
\ No newline at end of file